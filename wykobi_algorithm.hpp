@@ -48,10 +48,15 @@ namespace wykobi
       template <typename T> struct covariance_matrix< point2d<T> >;
       template <typename T> struct covariance_matrix< point3d<T> >;
 
+      template <typename T, std::size_t Dimension> class point_moments;
+
       template <typename T> struct ordered_polygon;
       template <typename T> struct ordered_polygon< point2d<T> >;
 
       template <typename T> struct remove_duplicates;
+      template <typename T> struct remove_duplicates< point2d<T> >;
+      template <typename T> struct remove_duplicates< point3d<T> >;
+      template <typename T, std::size_t D> struct remove_duplicates< pointnd<T,D> >;
 
       template <typename T> struct naive_group_intersections;
       template <typename T> struct naive_group_intersections< segment<T,2> >;
@@ -89,6 +94,43 @@ namespace wykobi
       template <typename T> struct polygon_triangulate;
       template <typename T> struct polygon_triangulate< point2d<T> >;
 
+      template <typename T> struct separating_axis_test;
+      template <typename T> struct separating_axis_test< point2d<T> >;
+      template <typename T> struct separating_axis_test< point3d<T> >;
+
+      template <typename T> struct rotating_calipers;
+      template <typename T> struct rotating_calipers< point2d<T> >;
+
+      template <typename T> struct polygon_diameter;
+      template <typename T> struct polygon_diameter< point2d<T> >;
+
+      template <typename T> struct polygon_width;
+      template <typename T> struct polygon_width< point2d<T> >;
+
+      template <typename T> struct antipodal_pairs;
+      template <typename T> struct antipodal_pairs< point2d<T> >;
+
+      template <typename T> struct minimum_area_enclosing_rectangle;
+      template <typename T> struct minimum_area_enclosing_rectangle< point2d<T> >;
+
+      template <typename T> struct minimum_area_enclosing_rectangle_with_ch_filter;
+      template <typename T> struct minimum_area_enclosing_rectangle_with_ch_filter< point2d<T> >;
+
+      template <typename T> struct minimum_perimeter_enclosing_rectangle;
+      template <typename T> struct minimum_perimeter_enclosing_rectangle< point2d<T> >;
+
+      template <typename T> struct minimum_perimeter_enclosing_rectangle_with_ch_filter;
+      template <typename T> struct minimum_perimeter_enclosing_rectangle_with_ch_filter< point2d<T> >;
+
+      template <typename T> struct fit_oriented_bounding_box;
+      template <typename T> struct fit_oriented_bounding_box< point3d<T> >;
+
+      template <typename T> struct pca_oriented_bounding_box;
+      template <typename T> struct pca_oriented_bounding_box< point3d<T> >;
+
+      template <typename T> struct minimum_volume_oriented_bounding_box;
+      template <typename T> struct minimum_volume_oriented_bounding_box< point3d<T> >;
+
 
    } // namespace wykobi::algorithm
 
@@ -103,5 +145,8 @@ namespace wykobi
 #include "wykobi_axis_projection_descriptor.inl"
 #include "wykobi_clipping.inl"
 #include "wykobi_earclipping.inl"
+#include "wykobi_separating_axis.inl"
+#include "wykobi_rotating_calipers.inl"
+#include "wykobi_oriented_bounding_box.inl"
 
 #endif
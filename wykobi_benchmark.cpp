@@ -0,0 +1,721 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+/*
+   Throughput benchmark for the algorithms in wykobi_algorithm.hpp and
+   the hot primitives they are built upon (make benchmark).
+
+   Every benchmark is run over five synthetic point distributions
+   (uniform, clustered, circle boundary, degenerate collinear and a
+   coarse integer grid with duplicates and axis aligned runs) at
+   sizes 10, 100, ... up to --max-size, and each measurement is repeated
+   until at least --min-time seconds have elapsed. Results are emitted
+   as CSV (default) or JSON on standard output.
+
+   Usage: wykobi_benchmark [--max-size N] [--min-time S]
+                           [--format csv|json] [--type float|double|both]
+*/
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "wykobi.hpp"
+#include "wykobi_algorithm.hpp"
+
+
+namespace benchmark
+{
+   enum distribution_type
+   {
+      e_uniform,
+      e_clustered,
+      e_circle_boundary,
+      e_collinear,
+      e_grid
+   };
+
+   const std::size_t distribution_count = 5;
+
+   inline const char* distribution_name(const distribution_type distribution)
+   {
+      switch (distribution)
+      {
+         case e_uniform         : return "uniform";
+         case e_clustered       : return "clustered";
+         case e_circle_boundary : return "circle_boundary";
+         case e_collinear       : return "collinear";
+         case e_grid            : return "grid";
+      }
+
+      return "unknown";
+   }
+
+   template <typename T> inline const char* type_name();
+   template <> inline const char* type_name<float> () { return "float";  }
+   template <> inline const char* type_name<double>() { return "double"; }
+
+   const double extent = 1000.0;
+
+   template <typename T>
+   inline void generate_points(const distribution_type distribution,
+                               const std::size_t point_count,
+                               std::vector< wykobi::point2d<T> >& point_list)
+   {
+      using namespace wykobi;
+
+      point_list.clear();
+      point_list.reserve(point_count);
+
+      const T range = T(extent);
+
+      switch (distribution)
+      {
+         case e_uniform :
+            generate_random_points(T(0.0),T(0.0),range,range,point_count,std::back_inserter(point_list));
+            break;
+
+         case e_clustered :
+            {
+               const std::size_t cluster_count = 16;
+               const T spread = range / T(64.0);
+
+               std::vector< point2d<T> > center;
+
+               generate_random_points(spread,spread,range - spread,range - spread,cluster_count,std::back_inserter(center));
+
+               for (std::size_t i = 0; i < point_count; ++i)
+               {
+                  const point2d<T>& c = center[i % cluster_count];
+
+                  // Sum of uniforms approximates a normal spread about the center.
+                  const T dx = (generate_random_value(spread) + generate_random_value(spread) + generate_random_value(spread)) - T(1.5) * spread;
+                  const T dy = (generate_random_value(spread) + generate_random_value(spread) + generate_random_value(spread)) - T(1.5) * spread;
+
+                  point_list.push_back(make_point(c.x + dx,c.y + dy));
+               }
+            }
+            break;
+
+         case e_circle_boundary :
+            {
+               const T radius = range / T(2.0);
+
+               for (std::size_t i = 0; i < point_count; ++i)
+               {
+                  const T theta = generate_random_value(T(PI2));
+
+                  point_list.push_back(make_point(radius + radius * std::cos(theta),
+                                                  radius + radius * std::sin(theta)));
+               }
+            }
+            break;
+
+         case e_collinear :
+            generate_random_points(make_segment(T(0.0),T(0.0),range,range / T(2.0)),point_count,std::back_inserter(point_list));
+            break;
+
+         case e_grid :
+            {
+               // Coarse lattice, so hull edges carry collinear runs and most points repeat.
+               const int cells = 16;
+               const T   step  = range / T(cells - 1);
+
+               for (std::size_t i = 0; i < point_count; ++i)
+               {
+                  point_list.push_back(make_point(T(std::rand() % cells) * step,T(std::rand() % cells) * step));
+               }
+            }
+            break;
+      }
+   }
+
+   template <typename T>
+   class workload
+   {
+   public:
+
+      workload(const distribution_type distribution, const std::size_t point_count)
+      : distribution_(distribution),
+        ordered_ready_(false),
+        segments_ready_(false)
+      {
+         using namespace wykobi;
+
+         generate_points(distribution,point_count,points);
+
+         point2d<T> min_point = make_point(+infinity<T>(),+infinity<T>());
+         point2d<T> max_point = make_point(-infinity<T>(),-infinity<T>());
+
+         for (std::size_t i = 0; i < points.size(); ++i)
+         {
+            min_point.x = std::min(min_point.x,points[i].x);
+            min_point.y = std::min(min_point.y,points[i].y);
+            max_point.x = std::max(max_point.x,points[i].x);
+            max_point.y = std::max(max_point.y,points[i].y);
+         }
+
+         const T dx = (max_point.x - min_point.x) / T(4.0);
+         const T dy = (max_point.y - min_point.y) / T(4.0);
+
+         clip_rectangle = make_rectangle(min_point.x + dx,min_point.y + dy,
+                                         max_point.x - dx,max_point.y - dy);
+
+         const point2d<T> center = make_point(T(extent / 2.0),T(extent / 2.0));
+
+         query_circle   = make_circle(center,T(extent / 3.0));
+         query_triangle = make_triangle(T(0.0),T(0.0),T(extent),T(extent / 4.0),T(extent / 3.0),T(extent));
+
+         const std::size_t query_vertices = 32;
+
+         for (std::size_t i = 0; i < query_vertices; ++i)
+         {
+            const T theta  = T(PI2 * i / query_vertices);
+            const T radius = T(extent / 2.0) * ((i % 2) ? T(1.0) : T(0.6));
+
+            query_polygon.push_back(make_point(center.x + radius * std::cos(theta),
+                                               center.y + radius * std::sin(theta)));
+         }
+      }
+
+      distribution_type distribution() const
+      {
+         return distribution_;
+      }
+
+      /* Star-shaped simple polygon through every point of the workload. */
+      const wykobi::polygon<T,2>& ordered()
+      {
+         if (!ordered_ready_)
+         {
+            ordered_.reserve(points.size());
+            wykobi::algorithm::ordered_polygon< wykobi::point2d<T> >(points.begin(),points.end(),std::back_inserter(ordered_));
+            ordered_ready_ = true;
+         }
+
+         return ordered_;
+      }
+
+      /* Short segments, one per point, pointing toward the next point. */
+      const std::vector< wykobi::segment<T,2> >& segments()
+      {
+         if (!segments_ready_)
+         {
+            segments_.reserve(points.size());
+
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+               const wykobi::point2d<T>& p = points[i];
+               const wykobi::point2d<T>& q = points[(i + 1) % points.size()];
+
+               segments_.push_back(wykobi::make_segment(p,p + ((q - p) * T(0.01))));
+            }
+
+            segments_ready_ = true;
+         }
+
+         return segments_;
+      }
+
+      std::vector< wykobi::point2d<T> >    points;
+      std::vector< wykobi::point2d<T> >    scratch;
+      std::vector< wykobi::point2d<T> >    output;
+      std::vector< wykobi::triangle<T,2> > triangles;
+      std::vector< T >                     descriptor;
+      wykobi::polygon<T,2>                 clipped;
+      wykobi::polygon<T,2>                 query_polygon;
+      wykobi::rectangle<T>                 clip_rectangle;
+      wykobi::triangle<T,2>                query_triangle;
+      wykobi::circle<T>                    query_circle;
+
+   private:
+
+      distribution_type                    distribution_;
+      bool                                 ordered_ready_;
+      bool                                 segments_ready_;
+      wykobi::polygon<T,2>                 ordered_;
+      std::vector< wykobi::segment<T,2> >  segments_;
+   };
+
+   /*
+      Each benchmark consumes a workload and folds something from its
+      result into the sink so the optimizer cannot discard the work.
+   */
+   template <typename T>
+   inline void convex_hull_graham_scan(workload<T>& w, T& sink)
+   {
+      w.output.clear();
+      wykobi::algorithm::convex_hull_graham_scan< wykobi::point2d<T> >(w.points.begin(),w.points.end(),std::back_inserter(w.output));
+      sink += T(w.output.size());
+   }
+
+   template <typename T>
+   inline void convex_hull_jarvis_march(workload<T>& w, T& sink)
+   {
+      w.output.clear();
+      wykobi::algorithm::convex_hull_jarvis_march< wykobi::point2d<T> >(w.points.begin(),w.points.end(),std::back_inserter(w.output));
+      sink += T(w.output.size());
+   }
+
+   template <typename T>
+   inline void convex_hull_melkman(workload<T>& w, T& sink)
+   {
+      // Melkman requires a simple polyline, hence the ordered polygon.
+      const wykobi::polygon<T,2>& polygon = w.ordered();
+      w.output.clear();
+      wykobi::algorithm::convex_hull_melkman< wykobi::point2d<T> >(polygon.begin(),polygon.end(),std::back_inserter(w.output));
+      sink += T(w.output.size());
+   }
+
+   template <typename T>
+   inline void randomized_minimum_bounding_ball(workload<T>& w, T& sink)
+   {
+      wykobi::circle<T> circle = wykobi::degenerate_circle<T>();
+      wykobi::algorithm::randomized_minimum_bounding_ball< wykobi::point2d<T> >(w.points.begin(),w.points.end(),circle);
+      sink += circle.radius;
+   }
+
+   template <typename T>
+   inline void randomized_minimum_bounding_ball_with_ch_filter(workload<T>& w, T& sink)
+   {
+      wykobi::circle<T> circle = wykobi::degenerate_circle<T>();
+      wykobi::algorithm::randomized_minimum_bounding_ball_with_ch_filter< wykobi::point2d<T> >(w.points.begin(),w.points.end(),circle);
+      sink += circle.radius;
+   }
+
+   template <typename T>
+   inline void naive_minimum_bounding_ball(workload<T>& w, T& sink)
+   {
+      wykobi::circle<T> circle = wykobi::degenerate_circle<T>();
+      wykobi::algorithm::naive_minimum_bounding_ball< wykobi::point2d<T> >(w.points.begin(),w.points.end(),circle);
+      sink += circle.radius;
+   }
+
+   template <typename T>
+   inline void naive_minimum_bounding_ball_with_ch_filter(workload<T>& w, T& sink)
+   {
+      wykobi::circle<T> circle = wykobi::degenerate_circle<T>();
+      wykobi::algorithm::naive_minimum_bounding_ball_with_ch_filter< wykobi::point2d<T> >(w.points.begin(),w.points.end(),circle);
+      sink += circle.radius;
+   }
+
+   template <typename T>
+   inline void ritter_minimum_bounding_ball(workload<T>& w, T& sink)
+   {
+      wykobi::circle<T> circle = wykobi::degenerate_circle<T>();
+      wykobi::algorithm::ritter_minimum_bounding_ball< wykobi::point2d<T> >(w.points.begin(),w.points.end(),circle);
+      sink += circle.radius;
+   }
+
+   template <typename T>
+   inline void sutherland_hodgman_polygon_clipper(workload<T>& w, T& sink)
+   {
+      w.clipped.clear();
+      wykobi::algorithm::sutherland_hodgman_polygon_clipper< wykobi::point2d<T> >(w.clip_rectangle,w.ordered(),w.clipped);
+      sink += T(w.clipped.size());
+   }
+
+   template <typename T>
+   inline void polygon_triangulate(workload<T>& w, T& sink)
+   {
+      w.triangles.clear();
+      wykobi::algorithm::polygon_triangulate< wykobi::point2d<T> >(w.ordered(),std::back_inserter(w.triangles));
+      sink += T(w.triangles.size());
+   }
+
+   template <typename T>
+   inline void naive_group_intersections(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::segment<T,2> >& segments = w.segments();
+      w.output.clear();
+      wykobi::algorithm::naive_group_intersections< wykobi::segment<T,2> >(segments.begin(),segments.end(),std::back_inserter(w.output));
+      sink += T(w.output.size());
+   }
+
+   template <typename T>
+   inline void remove_duplicates(workload<T>& w, T& sink)
+   {
+      w.output.clear();
+      wykobi::algorithm::remove_duplicates< wykobi::point2d<T> >(w.points.begin(),w.points.end(),std::back_inserter(w.output));
+      sink += T(w.output.size());
+   }
+
+   template <typename T>
+   inline void isotropic_normalization(workload<T>& w, T& sink)
+   {
+      // Normalizes in place, so the (linear) copy into scratch is part of the timing.
+      w.scratch.assign(w.points.begin(),w.points.end());
+      wykobi::algorithm::isotropic_normalization< wykobi::point2d<T> >(w.scratch.begin(),w.scratch.end());
+      sink += w.scratch.front().x;
+   }
+
+   template <typename T>
+   inline void generate_axis_projection_descriptor(workload<T>& w, T& sink)
+   {
+      w.descriptor.clear();
+      wykobi::algorithm::generate_axis_projection_descriptor<T>(w.ordered(),std::back_inserter(w.descriptor));
+      sink += w.descriptor.front();
+   }
+
+   template <typename T>
+   inline void orientation(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      int result = 0;
+
+      for (std::size_t i = 2; i < p.size(); ++i)
+      {
+         result += wykobi::orientation(p[i - 2],p[i - 1],p[i]);
+      }
+
+      sink += T(result);
+   }
+
+   template <typename T>
+   inline void distance(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      T result = T(0.0);
+
+      for (std::size_t i = 1; i < p.size(); ++i)
+      {
+         result += wykobi::distance(p[i - 1],p[i]);
+      }
+
+      sink += result;
+   }
+
+   template <typename T>
+   inline void intersect_segments(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::segment<T,2> >& s = w.segments();
+      std::size_t result = 0;
+
+      for (std::size_t i = 1; i < s.size(); ++i)
+      {
+         if (wykobi::intersect(s[i - 1],s[i])) ++result;
+      }
+
+      sink += T(result);
+   }
+
+   template <typename T>
+   inline void point_in_triangle(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      std::size_t result = 0;
+
+      for (std::size_t i = 0; i < p.size(); ++i)
+      {
+         if (wykobi::point_in_triangle(p[i],w.query_triangle)) ++result;
+      }
+
+      sink += T(result);
+   }
+
+   template <typename T>
+   inline void point_in_circle(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      std::size_t result = 0;
+
+      for (std::size_t i = 0; i < p.size(); ++i)
+      {
+         if (wykobi::point_in_circle(p[i],w.query_circle)) ++result;
+      }
+
+      sink += T(result);
+   }
+
+   template <typename T>
+   inline void point_in_polygon(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      std::size_t result = 0;
+
+      for (std::size_t i = 0; i < p.size(); ++i)
+      {
+         if (wykobi::point_in_polygon(p[i],w.query_polygon)) ++result;
+      }
+
+      sink += T(result);
+   }
+
+   template <typename T>
+   inline void closest_point_on_segment(workload<T>& w, T& sink)
+   {
+      const std::vector< wykobi::point2d<T> >& p = w.points;
+      const wykobi::segment<T,2> segment = wykobi::make_segment(w.query_triangle[0],w.query_triangle[1]);
+      T result = T(0.0);
+
+      for (std::size_t i = 0; i < p.size(); ++i)
+      {
+         result += wykobi::closest_point_on_segment_from_point(segment,p[i]).x;
+      }
+
+      sink += result;
+   }
+
+   const std::size_t unlimited = static_cast<std::size_t>(-1);
+
+   template <typename T>
+   struct entry
+   {
+      typedef void (*function_type)(workload<T>&, T&);
+
+      const char*   name;
+      function_type function;
+      std::size_t   max_size;          // quadratic or worse algorithms are capped
+      std::size_t   max_boundary_size; // cap when every point lies on the hull
+      bool          simple_polygon;    // requires a non-degenerate simple polygon
+   };
+
+   template <typename T>
+   inline std::vector< entry<T> > benchmark_list()
+   {
+      const entry<T> list[] =
+         {
+            { "convex_hull_graham_scan"                         , convex_hull_graham_scan<T>                         , unlimited, unlimited, false },
+            { "convex_hull_jarvis_march"                        , convex_hull_jarvis_march<T>                        , unlimited, 10000    , false },
+            { "convex_hull_melkman"                             , convex_hull_melkman<T>                             , unlimited, unlimited, true  },
+            { "randomized_minimum_bounding_ball"                , randomized_minimum_bounding_ball<T>                , unlimited, unlimited, false },
+            { "randomized_minimum_bounding_ball_with_ch_filter" , randomized_minimum_bounding_ball_with_ch_filter<T> , unlimited, unlimited, false },
+            { "naive_minimum_bounding_ball"                     , naive_minimum_bounding_ball<T>                     , 100      , 100      , false },
+            { "naive_minimum_bounding_ball_with_ch_filter"      , naive_minimum_bounding_ball_with_ch_filter<T>      , unlimited, 100      , false },
+            { "ritter_minimum_bounding_ball"                    , ritter_minimum_bounding_ball<T>                    , unlimited, unlimited, false },
+            { "sutherland_hodgman_polygon_clipper"              , sutherland_hodgman_polygon_clipper<T>              , unlimited, unlimited, false },
+            { "polygon_triangulate"                             , polygon_triangulate<T>                             , 10000    , 1000     , true  },
+            { "naive_group_intersections"                       , naive_group_intersections<T>                       , 10000    , 10000    , false },
+            { "remove_duplicates"                               , remove_duplicates<T>                               , unlimited, unlimited, false },
+            { "isotropic_normalization"                         , isotropic_normalization<T>                         , unlimited, unlimited, false },
+            { "generate_axis_projection_descriptor"             , generate_axis_projection_descriptor<T>             , unlimited, unlimited, false },
+            { "orientation"                                     , orientation<T>                                     , unlimited, unlimited, false },
+            { "distance"                                        , distance<T>                                        , unlimited, unlimited, false },
+            { "intersect_segments"                              , intersect_segments<T>                              , unlimited, unlimited, false },
+            { "point_in_triangle"                               , point_in_triangle<T>                               , unlimited, unlimited, false },
+            { "point_in_circle"                                 , point_in_circle<T>                                 , unlimited, unlimited, false },
+            { "point_in_polygon"                                , point_in_polygon<T>                                , unlimited, unlimited, false },
+            { "closest_point_on_segment"                        , closest_point_on_segment<T>                        , unlimited, unlimited, false }
+         };
+
+      return std::vector< entry<T> >(list,list + (sizeof(list) / sizeof(entry<T>)));
+   }
+
+   struct result
+   {
+      std::string type;
+      std::string algorithm;
+      std::string distribution;
+      std::size_t size;
+      std::size_t iterations;
+      double      seconds;
+   };
+
+   struct settings
+   {
+      settings()
+      : max_size(10000000),
+        min_time(0.1),
+        format("csv"),
+        type("double")
+      {}
+
+      std::size_t max_size;
+      double      min_time;
+      std::string format;
+      std::string type;
+   };
+
+   inline double elapsed(const std::clock_t start)
+   {
+      return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+   }
+
+   template <typename T>
+   inline void run(const settings& config, std::vector<result>& result_list, T& sink)
+   {
+      const std::vector< entry<T> > list = benchmark_list<T>();
+
+      for (std::size_t d = 0; d < distribution_count; ++d)
+      {
+         const distribution_type distribution = static_cast<distribution_type>(d);
+
+         for (std::size_t size = 10; size <= config.max_size; size *= 10)
+         {
+            std::srand(static_cast<unsigned int>(size + d));
+
+            workload<T> w(distribution,size);
+
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+               const entry<T>& e = list[i];
+
+               if (size > ((distribution == e_circle_boundary) ? e.max_boundary_size : e.max_size))
+                  continue;
+               else if (e.simple_polygon && ((distribution == e_collinear) || (distribution == e_grid)))
+                  continue;
+
+               // Warm-up run, also builds any lazily derived input.
+               e.function(w,sink);
+
+               std::size_t iterations = 0;
+               double      seconds    = 0.0;
+               const std::clock_t start = std::clock();
+
+               do
+               {
+                  e.function(w,sink);
+                  ++iterations;
+                  seconds = elapsed(start);
+               }
+               while (seconds < config.min_time);
+
+               result r;
+
+               r.type         = type_name<T>();
+               r.algorithm    = e.name;
+               r.distribution = distribution_name(distribution);
+               r.size         = size;
+               r.iterations   = iterations;
+               r.seconds      = seconds;
+
+               result_list.push_back(r);
+            }
+
+            if (size > (config.max_size / 10))
+               break;
+         }
+      }
+   }
+
+   inline void write_csv(std::ostream& os, const std::vector<result>& result_list)
+   {
+      os << "type,algorithm,distribution,size,iterations,seconds,seconds_per_run,elements_per_second\n";
+
+      for (std::size_t i = 0; i < result_list.size(); ++i)
+      {
+         const result& r = result_list[i];
+         const double per_run = r.seconds / r.iterations;
+
+         os << r.type         << ","
+            << r.algorithm    << ","
+            << r.distribution << ","
+            << r.size         << ","
+            << r.iterations   << ","
+            << r.seconds      << ","
+            << per_run        << ","
+            << (r.size / per_run) << "\n";
+      }
+   }
+
+   inline void write_json(std::ostream& os, const std::vector<result>& result_list)
+   {
+      os << "{\n   \"benchmarks\" :\n   [\n";
+
+      for (std::size_t i = 0; i < result_list.size(); ++i)
+      {
+         const result& r = result_list[i];
+         const double per_run = r.seconds / r.iterations;
+
+         os << "      { "
+            << "\"type\" : \""                << r.type         << "\", "
+            << "\"algorithm\" : \""           << r.algorithm    << "\", "
+            << "\"distribution\" : \""        << r.distribution << "\", "
+            << "\"size\" : "                  << r.size         << ", "
+            << "\"iterations\" : "            << r.iterations   << ", "
+            << "\"seconds\" : "               << r.seconds      << ", "
+            << "\"seconds_per_run\" : "       << per_run        << ", "
+            << "\"elements_per_second\" : "   << (r.size / per_run)
+            << " }" << ((i + 1 < result_list.size()) ? ",\n" : "\n");
+      }
+
+      os << "   ]\n}\n";
+   }
+
+   inline bool parse_arguments(int argc, char* argv[], settings& config)
+   {
+      for (int i = 1; i < argc; ++i)
+      {
+         const std::string option = argv[i];
+
+         if ((i + 1) >= argc)
+            return false;
+
+         std::istringstream value(argv[++i]);
+
+         if      (option == "--max-size") value >> config.max_size;
+         else if (option == "--min-time") value >> config.min_time;
+         else if (option == "--format"  ) value >> config.format;
+         else if (option == "--type"    ) value >> config.type;
+         else
+            return false;
+
+         if (value.fail())
+            return false;
+      }
+
+      return
+         (config.max_size >= 10)                                                       &&
+         ((config.format == "csv") || (config.format == "json"))                        &&
+         ((config.type == "float") || (config.type == "double") || (config.type == "both"));
+   }
+
+} // namespace benchmark
+
+
+int main(int argc, char* argv[])
+{
+   benchmark::settings config;
+
+   if (!benchmark::parse_arguments(argc,argv,config))
+   {
+      std::cerr << "usage: wykobi_benchmark [--max-size N] [--min-time S] "
+                   "[--format csv|json] [--type float|double|both]" << std::endl;
+      return 1;
+   }
+
+   std::vector<benchmark::result> result_list;
+
+   float  float_sink  = 0.0f;
+   double double_sink = 0.0;
+
+   if ((config.type == "float") || (config.type == "both"))
+      benchmark::run(config,result_list,float_sink);
+
+   if ((config.type == "double") || (config.type == "both"))
+      benchmark::run(config,result_list,double_sink);
+
+   if (config.format == "json")
+      benchmark::write_json(std::cout,result_list);
+   else
+      benchmark::write_csv(std::cout,result_list);
+
+   std::cerr << "checksum: " << (float_sink + double_sink) << std::endl;
+
+   return 0;
+}
@@ -0,0 +1,149 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_BEZIER
+#define INCLUDE_WYKOBI_BEZIER
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Quadratic and cubic Bezier curve evaluation and measurement.
+   */
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point2d<T>& point, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000, const T& fuzzy = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point2d<T>& point, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000, const T& fuzzy = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point3d<T>& point, const quadratic_bezier<T,3>& bezier, const std::size_t& steps = 1000, const T& fuzzy = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point3d<T>& point, const cubic_bezier<T,3>& bezier, const std::size_t& steps = 1000, const T& fuzzy = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_bezier_from_point(const quadratic_bezier<T,2>& bezier,
+                                                        const point2d<T>& point,
+                                                        const std::size_t& steps = 1000);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_bezier_from_point(const cubic_bezier<T,2>& bezier,
+                                                        const point2d<T>& point,
+                                                        const std::size_t& steps = 1000);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_bezier_from_point(const quadratic_bezier<T,3>& bezier,
+                                                        const point3d<T>& point,
+                                                        const std::size_t& steps = 1000);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_bezier_from_point(const cubic_bezier<T,3>& bezier,
+                                                        const point3d<T>& point,
+                                                        const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,2>& bezier, T& ax, T& bx, T& ay, T& by);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,3>& bezier, T& ax, T& bx, T& ay, T& by, T& az, T& bz);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,2>& bezier, T& ax, T& bx, T& cx, T& ay, T& by, T& cy);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,3>& bezier, T& ax, T& bx, T& cx, T& ay, T& by, T& cy, T& az, T& bz, T& cz);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,2>& bezier,
+                                                                         bezier_coefficients<T,2,eQuadraticBezier>& coeffs);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,3>& bezier,
+                                                                         bezier_coefficients<T,3,eQuadraticBezier>& coeffs);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,2>& bezier,
+                                                                         bezier_coefficients<T,2,eCubicBezier>& coeffs);
+
+   template <typename T> WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,3>& bezier,
+                                                                         bezier_coefficients<T,3,eCubicBezier>& coeffs);
+
+   template <typename T> WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                                                  const T& ax, const T& bx,
+                                                                  const T& ay, const T& by,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                                                  const T& ax, const T& bx,
+                                                                  const T& ay, const T& by,
+                                                                  const T& az, const T& bz,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                                                 const T& ax, const T& bx, const T& cx,
+                                                                 const T& ay, const T& by, const T& cy, const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                                                  const T& ax, const T& bx, const T& cx,
+                                                                  const T& ay, const T& by, const T& cy,
+                                                                  const T& az, const T& bz, const T& cz,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                                                  const bezier_coefficients<T,2,eQuadraticBezier>& coeffs,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                                                  const bezier_coefficients<T,3,eQuadraticBezier>& coeffs,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                                                  const bezier_coefficients<T,2,eCubicBezier>& coeffs,
+                                                                  const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                                                  const bezier_coefficients<T,3,eCubicBezier>& coeffs,
+                                                                  const T& t);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_bezier(const quadratic_bezier<T,2>& bezier, OutputIterator out, const std::size_t& point_count = 1000);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_bezier(const quadratic_bezier<T,3>& bezier, OutputIterator out, const std::size_t& point_count = 1000);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_bezier(const cubic_bezier<T,2>& bezier, OutputIterator out, const std::size_t& point_count = 1000);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_bezier(const cubic_bezier<T,3>& bezier, OutputIterator out, const std::size_t& point_count = 1000);
+
+   template <typename T> WYKOBI_INLINE T bezier_curve_length(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count);
+
+   template <typename T> WYKOBI_INLINE T bezier_curve_length(const quadratic_bezier<T,3>& bezier, const std::size_t& point_count);
+
+   template <typename T> WYKOBI_INLINE T bezier_curve_length(const cubic_bezier<T,2>& bezier, const std::size_t& point_count);
+
+   template <typename T> WYKOBI_INLINE T bezier_curve_length(const cubic_bezier<T,3>& bezier, const std::size_t& point_count);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> bezier_convex_hull(const quadratic_bezier<T,2>& bezier);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> bezier_convex_hull(const cubic_bezier<T,2>& bezier);
+
+} // wykobi namespace
+
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.hpp"
+#include "wykobi_bezier.inl"
+
+#endif
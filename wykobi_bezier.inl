@@ -0,0 +1,587 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_bezier.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point2d<T>& point, const quadratic_bezier<T,2>& bezier, const std::size_t& steps, const T& fuzzy)
+   {
+      return (is_equal(distance(closest_point_on_bezier_from_point(bezier,point,steps),point),T(0.0),fuzzy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point2d<T>& point, const cubic_bezier<T,2>& bezier, const std::size_t& steps, const T& fuzzy)
+   {
+      return (is_equal(distance(closest_point_on_bezier_from_point(bezier,point,steps),point),T(0.0),fuzzy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point3d<T>& point, const quadratic_bezier<T,3>& bezier, const std::size_t& steps, const T& fuzzy)
+   {
+      return (is_equal(distance(closest_point_on_bezier_from_point(bezier,point,steps),point),T(0.0),fuzzy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_bezier(const point3d<T>& point, const cubic_bezier<T,3>& bezier, const std::size_t& steps, const T& fuzzy)
+   {
+      return (is_equal(distance(closest_point_on_bezier_from_point(bezier,point,steps),point),T(0.0),fuzzy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_bezier_from_point(const quadratic_bezier<T,2>& bezier,
+                                                        const point2d<T>& point,
+                                                        const std::size_t& steps)
+   {
+      typedef point2d<T> point_type;
+
+      T smallest_distance = +infinity<T>();
+
+      point_type closest_point = degenerate_point2d<T>();
+
+      std::vector<point_type> point_list;
+      point_list.reserve(steps);
+
+      wykobi::generate_bezier(bezier,std::back_inserter(point_list),steps);
+
+      for (std::size_t i = 0; i < (point_list.size() - 1); ++i)
+      {
+         point_type current_point = closest_point_on_segment_from_point(make_segment(point_list[i],point_list[i+1]),point);
+
+         const T current_distance = distance(current_point,point);
+
+         if (current_distance < smallest_distance)
+         {
+            closest_point = current_point;
+            smallest_distance = current_distance;
+         }
+      }
+
+      return closest_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_bezier_from_point(const cubic_bezier<T,2>& bezier,
+                                                        const point2d<T>& point,
+                                                        const std::size_t& steps)
+   {
+      typedef point2d<T> point_type;
+
+      T smallest_distance = +infinity<T>();
+
+      point_type closest_point = degenerate_point2d<T>();
+
+      std::vector<point_type> point_list;
+      point_list.reserve(steps);
+
+      wykobi::generate_bezier(bezier,std::back_inserter(point_list),steps);
+
+      for (std::size_t i = 0; i < (point_list.size() - 1); ++i)
+      {
+         point_type current_point = closest_point_on_segment_from_point(make_segment(point_list[i],point_list[i+1]),point);
+
+         const T current_distance = distance(current_point,point);
+
+         if (current_distance < smallest_distance)
+         {
+            closest_point = current_point;
+            smallest_distance = current_distance;
+         }
+      }
+
+      return closest_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_bezier_from_point(const quadratic_bezier<T,3>& bezier,
+                                                        const point3d<T>& point,
+                                                        const std::size_t& steps)
+   {
+      typedef point3d<T> point_type;
+
+      T smallest_distance = +infinity<T>();
+
+      point_type closest_point = degenerate_point3d<T>();
+
+      std::vector<point_type> point_list;
+      point_list.reserve(steps);
+
+      wykobi::generate_bezier(bezier,std::back_inserter(point_list),steps);
+
+      for (std::size_t i = 0; i < (point_list.size() - 1); ++i)
+      {
+         point_type current_point = closest_point_on_segment_from_point
+                                    (
+                                      make_segment(point_list[i], point_list[i + 1]),
+                                      point
+                                    );
+
+         const T current_distance = distance(current_point,point);
+
+         if (current_distance < smallest_distance)
+         {
+            closest_point = current_point;
+            smallest_distance = current_distance;
+         }
+      }
+
+      return closest_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_bezier_from_point(const cubic_bezier<T,3>& bezier,
+                                                        const point3d<T>& point,
+                                                        const std::size_t& steps)
+   {
+      typedef point3d<T> point_type;
+
+      T smallest_distance = +infinity<T>();
+
+      point_type closest_point = degenerate_point3d<T>();
+
+      std::vector<point_type> point_list;
+
+      point_list.reserve(steps);
+
+      wykobi::generate_bezier(bezier,std::back_inserter(point_list),steps);
+
+      for (std::size_t i = 0; i < (point_list.size() - 1); ++i)
+      {
+         point_type current_point = closest_point_on_segment_from_point
+                                    (
+                                      make_segment(point_list[i], point_list[i + 1]),
+                                      point
+                                    );
+
+         const T current_distance = distance(current_point, point);
+
+         if (current_distance < smallest_distance)
+         {
+            closest_point = current_point;
+            smallest_distance = current_distance;
+         }
+      }
+
+      return closest_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,2>& bezier, T& ax, T& bx, T& ay, T& by)
+   {
+      bx = T(2.0) * (bezier[1].x - bezier[0].x);
+      by = T(2.0) * (bezier[1].y - bezier[0].y);
+      ax = bezier[2].x - bezier[0].x - bx;
+      ay = bezier[2].y - bezier[0].y - by;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,3>& bezier, T& ax, T& bx, T& ay, T& by, T& az, T& bz)
+   {
+      bx = T(2.0) * (bezier[1].x - bezier[0].x);
+      by = T(2.0) * (bezier[1].y - bezier[0].y);
+      bz = T(2.0) * (bezier[1].z - bezier[0].z);
+      ax = bezier[2].x - bezier[0].x - bx;
+      ay = bezier[2].y - bezier[0].y - by;
+      az = bezier[2].z - bezier[0].z - bz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,2>& bezier, T& ax, T& bx, T& cx, T& ay, T& by, T& cy)
+   {
+      cx = T(3.0) * (bezier[1].x - bezier[0].x);
+      cy = T(3.0) * (bezier[1].y - bezier[0].y);
+      bx = T(3.0) * (bezier[2].x - bezier[1].x) - cx;
+      by = T(3.0) * (bezier[2].y - bezier[1].y) - cy;
+      ax = bezier[3].x - bezier[0].x - cx - bx;
+      ay = bezier[3].y - bezier[0].y - cy - by;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,3>& bezier, T& ax, T& bx, T& cx, T& ay, T& by, T& cy, T& az, T& bz, T& cz)
+   {
+      cx = T(3.0) * (bezier[1].x - bezier[0].x);
+      cy = T(3.0) * (bezier[1].y - bezier[0].y);
+      cz = T(3.0) * (bezier[1].z - bezier[0].z);
+      bx = T(3.0) * (bezier[2].x - bezier[1].x) - cx;
+      by = T(3.0) * (bezier[2].y - bezier[1].y) - cy;
+      bz = T(3.0) * (bezier[2].z - bezier[1].z) - cz;
+      ax = bezier[3].x - bezier[0].x - cx - bx;
+      ay = bezier[3].y - bezier[0].y - cy - by;
+      az = bezier[3].z - bezier[0].z - cz - bz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,2>& bezier,
+                                             bezier_coefficients<T,2,eQuadraticBezier>& coeffs)
+   {
+      calculate_bezier_coefficients
+      (
+        bezier,
+        coeffs.value[0].x,coeffs.value[0].y,
+        coeffs.value[1].x,coeffs.value[1].y
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const quadratic_bezier<T,3>& bezier,
+                                             bezier_coefficients<T,3,eQuadraticBezier>& coeffs)
+   {
+      calculate_bezier_coefficients
+      (
+        bezier,
+        coeffs.value[0].x,coeffs.value[0].y,coeffs.value[0].z,
+        coeffs.value[1].x,coeffs.value[1].y,coeffs.value[1].z
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,2>& bezier,
+                                             bezier_coefficients<T,2,eCubicBezier>& coeffs)
+   {
+      calculate_bezier_coefficients
+      (
+        bezier,
+        coeffs.value[0].x,coeffs.value[0].y,
+        coeffs.value[1].x,coeffs.value[1].y,
+        coeffs.value[2].x,coeffs.value[2].y
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void calculate_bezier_coefficients(const cubic_bezier<T,3>& bezier,
+                                             bezier_coefficients<T,3,eCubicBezier>& coeffs)
+   {
+      calculate_bezier_coefficients
+      (
+        bezier,
+        coeffs.value[0].x,coeffs.value[0].y,coeffs.value[0].z,
+        coeffs.value[1].x,coeffs.value[1].y,coeffs.value[1].z,
+        coeffs.value[2].x,coeffs.value[2].y,coeffs.value[2].z
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                            const T& ax, const T& bx,
+                                            const T& ay, const T& by,
+                                            const T& t)
+   {
+      const T tsqr = t * t;
+
+      return make_point
+             (
+               (ax * tsqr) + (bx * t) + start_point.x,
+               (ay * tsqr) + (by * t) + start_point.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                            const T& ax, const T& bx,
+                                            const T& ay, const T& by,
+                                            const T& az, const T& bz,
+                                            const T& t)
+   {
+      const T tsqr = t * t;
+
+      return make_point
+             (
+               (ax * tsqr) + (bx * t) + start_point.x,
+               (ay * tsqr) + (by * t) + start_point.y,
+               (az * tsqr) + (bz * t) + start_point.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                            const T& ax, const T& bx, const T& cx,
+                                            const T& ay, const T& by, const T& cy,
+                                            const T& t)
+   {
+      const T tsqr  = t * t;
+      const T tcube = tsqr * t;
+
+      return make_point
+             (
+               (ax * tcube) + (bx * tsqr) + (cx * t) + start_point.x,
+               (ay * tcube) + (by * tsqr) + (cy * t) + start_point.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                            const T& ax, const T& bx, const T& cx,
+                                            const T& ay, const T& by, const T& cy,
+                                            const T& az, const T& bz, const T& cz,
+                                            const T& t)
+   {
+      const T tsqr  = t * t;
+      const T tcube = tsqr * t;
+
+      return make_point
+             (
+               (ax * tcube) + (bx * tsqr) + (cx * t) + start_point.x,
+               (ay * tcube) + (by * tsqr) + (cy * t) + start_point.y,
+               (az * tcube) + (bz * tsqr) + (cz * t) + start_point.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                            const bezier_coefficients<T,2,eQuadraticBezier>& coeffs,
+                                            const T& t)
+   {
+      return create_point_on_bezier
+             (
+               start_point,
+               coeffs.value[0].x, coeffs.value[0].y,
+               coeffs.value[1].x, coeffs.value[1].y,
+               t
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                            const bezier_coefficients<T,3,eQuadraticBezier>& coeffs,
+                                            const T& t)
+   {
+      return create_point_on_bezier
+             (
+               start_point,
+               coeffs.value[0].x, coeffs.value[0].y, coeffs.value[0].z,
+               coeffs.value[1].x, coeffs.value[1].y, coeffs.value[1].z,
+               t
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> create_point_on_bezier(const point2d<T>& start_point,
+                                            const bezier_coefficients<T,2,eCubicBezier>& coeffs,
+                                            const T& t)
+   {
+      return create_point_on_bezier
+             (
+               start_point,
+               coeffs.value[0].x, coeffs.value[0].y,
+               coeffs.value[1].x, coeffs.value[1].y,
+               coeffs.value[2].x, coeffs.value[2].y,
+               t
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> create_point_on_bezier(const point3d<T>& start_point,
+                                            const bezier_coefficients<T,3,eCubicBezier>& coeffs,
+                                            const T& t)
+   {
+      return create_point_on_bezier
+             (
+               start_point,
+               coeffs.value[0].x, coeffs.value[0].y, coeffs.value[0].z,
+               coeffs.value[1].x, coeffs.value[1].y, coeffs.value[1].z,
+               coeffs.value[2].x, coeffs.value[2].y, coeffs.value[2].z,
+               t
+             );
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_bezier(const quadratic_bezier<T,2>& bezier, OutputIterator out, const std::size_t& point_count)
+   {
+      if (0 == point_count) return;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * point_count - T(1.0));
+      T ax = T(0.0);
+      T ay = T(0.0);
+      T bx = T(0.0);
+      T by = T(0.0);
+
+      calculate_bezier_coefficients(bezier,ax,bx,ay,by);
+
+      for (std::size_t i = 0; i < point_count; t += dt, ++i)
+      {
+         (*out++) = create_point_on_bezier(bezier[0],ax,bx,ay,by,t);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_bezier(const quadratic_bezier<T,3>& bezier, OutputIterator out, const std::size_t& point_count)
+   {
+      if (0 == point_count) return;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * point_count - T(1.0));
+      T ax = T(0.0);
+      T ay = T(0.0);
+      T az = T(0.0);
+      T bx = T(0.0);
+      T by = T(0.0);
+      T bz = T(0.0);
+
+      calculate_bezier_coefficients(bezier,ax,bx,ay,by,az,bz);
+
+      for (std::size_t i = 0; i < point_count; t += dt, ++i)
+      {
+         (*out++) = create_point_on_bezier(bezier[0],ax,bx,ay,by,az,bz,t);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_bezier(const cubic_bezier<T,2>& bezier, OutputIterator out, const std::size_t& point_count)
+   {
+      if (0 == point_count) return;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * point_count - T(1.0));
+      T ax = T(0.0);
+      T ay = T(0.0);
+      T bx = T(0.0);
+      T by = T(0.0);
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      calculate_bezier_coefficients(bezier,ax,bx,cx,ay,by,cy);
+
+      for (std::size_t i = 0; i < point_count; t += dt, ++i)
+      {
+         (*out++) = create_point_on_bezier(bezier[0],ax,bx,cx,ay,by,cy,t);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_bezier(const cubic_bezier<T,3>& bezier, OutputIterator out, const std::size_t& point_count)
+   {
+      if (0 == point_count) return;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * point_count - T(1.0));
+      T ax = T(0.0);
+      T ay = T(0.0);
+      T az = T(0.0);
+      T bx = T(0.0);
+      T by = T(0.0);
+      T bz = T(0.0);
+      T cx = T(0.0);
+      T cy = T(0.0);
+      T cz = T(0.0);
+
+      calculate_bezier_coefficients(bezier,ax,bx,cx,ay,by,cy,az,bz,cz);
+
+      for (std::size_t i = 0; i < point_count; t += dt, ++i)
+      {
+         (*out++) = create_point_on_bezier(bezier[0],ax,bx,cx,ay,by,cy,az,bz,cz,t);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T bezier_curve_length(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count)
+   {
+      std::vector< point2d<T> > curve;
+
+      curve.reserve(point_count);
+
+      generate_bezier(bezier,std::back_inserter(curve),point_count);
+
+      T total_distance = T(0.0);
+
+      for (std::size_t i = 0; i < (curve.size() - 1); ++i)
+      {
+         total_distance += distance(curve[i],curve[i + 1]);
+      }
+
+      return total_distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T bezier_curve_length(const quadratic_bezier<T,3>& bezier, const std::size_t& point_count)
+   {
+      std::vector< point3d<T> > curve;
+
+      curve.reserve(point_count);
+
+      generate_bezier(bezier,std::back_inserter(curve),point_count);
+
+      T total_distance = T(0.0);
+
+      for (std::size_t i = 0; i < (curve.size() - 1); ++i)
+      {
+         total_distance += distance(curve[i],curve[i + 1]);
+      }
+
+      return total_distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T bezier_curve_length(const cubic_bezier<T,2>& bezier, const std::size_t& point_count)
+   {
+      std::vector< point2d<T> > curve;
+
+      curve.reserve(point_count);
+
+      generate_bezier(bezier,std::back_inserter(curve),point_count);
+
+      T total_distance = T(0.0);
+
+      for (std::size_t i = 0; i < (curve.size() - 1); ++i)
+      {
+         total_distance += distance(curve[i],curve[i + 1]);
+      }
+
+      return total_distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T bezier_curve_length(const cubic_bezier<T,3>& bezier, const std::size_t& point_count)
+   {
+      std::vector< point3d<T> > curve;
+
+      curve.reserve(point_count);
+
+      generate_bezier(bezier,std::back_inserter(curve),point_count);
+
+      T total_distance = T(0.0);
+
+      for (std::size_t i = 0; i < (curve.size() - 1); ++i)
+      {
+         total_distance += distance(curve[i],curve[i + 1]);
+      }
+
+      return total_distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> bezier_convex_hull(const quadratic_bezier<T,2>& bezier)
+   {
+      return make_triangle(bezier[0],bezier[1],bezier[2]);
+   }
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> bezier_convex_hull(const cubic_bezier<T,2>& bezier)
+   {
+      if (orientation(bezier[0],bezier[2],bezier[1]) != orientation(bezier[0],bezier[2],bezier[3]))
+         return make_quadix(bezier[0],bezier[1],bezier[2],bezier[3]);
+      else if (orientation(bezier[0],bezier[3],bezier[1]) != orientation(bezier[0],bezier[3],bezier[2]))
+         return make_quadix(bezier[0],bezier[1],bezier[3],bezier[2]);
+      else
+         return make_quadix(bezier[0],bezier[2],bezier[1],bezier[3]);
+   }
+
+} // wykobi namespace
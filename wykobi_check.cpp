@@ -0,0 +1,773 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+/*
+   Behaviour checks (make check, C++11). Each check compares a routine
+   against a brute force or baseline formulation over seeded random
+   inputs, or round trips data through a reader and writer. A line is
+   printed per check and the exit status is non-zero if any failed.
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "wykobi.hpp"
+#include "wykobi_algorithm.hpp"
+#include "wykobi_execution.hpp"
+#include "wykobi_geometry_store.hpp"
+#include "wykobi_matrix.hpp"
+#include "wykobi_ray_packet.hpp"
+#include "wykobi_serialization.hpp"
+
+
+namespace check
+{
+   using namespace wykobi;
+
+   /* Deterministic generator, so failures reproduce on every platform. */
+   class random
+   {
+   public:
+
+      explicit random(const unsigned long& seed) : state_(seed) {}
+
+      inline double operator()(const double& lo, const double& hi)
+      {
+         state_ = (state_ * 6364136223846793005ULL) + 1442695040888963407ULL;
+         return lo + (hi - lo) * (static_cast<double>(state_ >> 11) / 9007199254740992.0);
+      }
+
+      inline long long integer(const long long& lo, const long long& hi)
+      {
+         return lo + static_cast<long long>((*this)(0.0,1.0) * static_cast<double>(hi - lo + 1));
+      }
+
+   private:
+
+      unsigned long long state_;
+   };
+
+   std::size_t failures = 0;
+
+   inline void report(const char* name, const std::size_t& count, const std::size_t& failed)
+   {
+      std::printf("%-42s %6lu checks %6lu failed\n",name,static_cast<unsigned long>(count),static_cast<unsigned long>(failed));
+      failures += failed;
+   }
+
+   inline bool close(const double& value1, const double& value2, const double& tolerance = 1.0e-9)
+   {
+      return std::abs(value1 - value2) <= tolerance * std::max(1.0,std::max(std::abs(value1),std::abs(value2)));
+   }
+
+   /* Convex polygons overlap iff an edge pair crosses or a vertex of one lies inside the other. */
+   inline bool brute_overlap(const polygon<double,2>& polygon1, const polygon<double,2>& polygon2)
+   {
+      for (std::size_t i = 0; i < polygon1.size(); ++i)
+      {
+         for (std::size_t j = 0; j < polygon2.size(); ++j)
+         {
+            if (intersect(edge(polygon1,i),edge(polygon2,j)))
+               return true;
+         }
+      }
+
+      return point_in_polygon(polygon1[0],polygon2) || point_in_polygon(polygon2[0],polygon1);
+   }
+
+   inline void separating_axis_obb2d()
+   {
+      random rng(1);
+      std::size_t failed = 0;
+      const std::size_t count = 20000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         obb<double,2> obb1 = make_obb(make_point(rng(0.0,10.0),rng(0.0,10.0)),normalize(make_vector(rng(-1.0,1.0),rng(-1.0,1.0))),rng(0.1,3.0),rng(0.1,3.0));
+         obb<double,2> obb2 = make_obb(make_point(rng(0.0,10.0),rng(0.0,10.0)),normalize(make_vector(rng(-1.0,1.0),rng(-1.0,1.0))),rng(0.1,3.0),rng(0.1,3.0));
+
+         algorithm::separating_axis_test< point2d<double> > sat;
+
+         if (sat(obb1,obb2) != brute_overlap(make_polygon(obb1),make_polygon(obb2)))
+            ++failed;
+      }
+
+      report("separating axis obb2d vs edge tests",count,failed);
+   }
+
+   /*
+      Triangles in a common plane against the edge tests on their 2D
+      footprints. The 2D triangle intersect only tests for contained
+      vertices, so misses crossings where neither holds a vertex.
+   */
+   inline void separating_axis_coplanar_triangles()
+   {
+      random rng(2);
+      std::size_t failed = 0;
+      const std::size_t count = 20000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         point2d<double> p[6];
+
+         for (std::size_t k = 0; k < 6; ++k)
+         {
+            p[k] = make_point(rng(0.0,10.0),rng(0.0,10.0));
+         }
+
+         const triangle<double,2> triangle1 = make_triangle(p[0],p[1],p[2]);
+         const triangle<double,2> triangle2 = make_triangle(p[3],p[4],p[5]);
+
+         if (is_degenerate(triangle1) || is_degenerate(triangle2))
+            continue;
+
+         const double z = rng(-5.0,5.0);
+
+         const triangle<double,3> triangle3d1 = make_triangle(make_point(p[0].x,p[0].y,z),make_point(p[1].x,p[1].y,z),make_point(p[2].x,p[2].y,z));
+         const triangle<double,3> triangle3d2 = make_triangle(make_point(p[3].x,p[3].y,z),make_point(p[4].x,p[4].y,z),make_point(p[5].x,p[5].y,z));
+
+         algorithm::separating_axis_test< point3d<double> > sat;
+
+         if (sat(triangle3d1,triangle3d2) != brute_overlap(make_polygon(triangle1),make_polygon(triangle2)))
+            ++failed;
+      }
+
+      report("separating axis coplanar vs edge tests",count,failed);
+   }
+
+   inline std::vector< point2d<double> > random_hull(random& rng, const std::size_t& point_count)
+   {
+      std::vector< point2d<double> > point_list;
+
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         point_list.push_back(make_point(rng(-10.0,10.0),rng(-10.0,10.0)));
+      }
+
+      std::vector< point2d<double> > hull;
+      algorithm::convex_hull_graham_scan< point2d<double> >(point_list.begin(),point_list.end(),std::back_inserter(hull));
+
+      return hull;
+   }
+
+   inline void convex_hull_graham_vs_jarvis()
+   {
+      random rng(3);
+      std::size_t failed = 0;
+      const std::size_t count = 2000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< point2d<double> > point_list;
+
+         for (std::size_t k = 0; k < 50; ++k)
+         {
+            point_list.push_back(make_point(rng(-10.0,10.0),rng(-10.0,10.0)));
+         }
+
+         polygon<double,2> graham;
+         polygon<double,2> jarvis;
+
+         algorithm::convex_hull_graham_scan  < point2d<double> >(point_list.begin(),point_list.end(),std::back_inserter(graham));
+         algorithm::convex_hull_jarvis_march < point2d<double> >(point_list.begin(),point_list.end(),std::back_inserter(jarvis));
+
+         if ((graham.size() != jarvis.size()) || !close(area(graham),area(jarvis)))
+            ++failed;
+      }
+
+      report("convex hull graham vs jarvis",count,failed);
+   }
+
+   /* Diameter and width of a hull against all vertex pairs and all edges. */
+   inline void rotating_calipers_vs_brute()
+   {
+      random rng(4);
+      std::size_t failed = 0;
+      const std::size_t count = 2000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const std::vector< point2d<double> > hull = random_hull(rng,30);
+         const std::size_t n = hull.size();
+
+         double max_distance = 0.0;
+         double min_width    = infinity<double>();
+
+         for (std::size_t a = 0; a < n; ++a)
+         {
+            const point2d<double>& p1 = hull[a];
+            const point2d<double>& p2 = hull[(a + 1) % n];
+
+            double edge_width = 0.0;
+
+            for (std::size_t b = 0; b < n; ++b)
+            {
+               max_distance = std::max(max_distance,distance(hull[a],hull[b]));
+               edge_width   = std::max(edge_width,minimum_distance_from_point_to_line(hull[b].x,hull[b].y,p1.x,p1.y,p2.x,p2.y));
+            }
+
+            min_width = std::min(min_width,edge_width);
+         }
+
+         segment<double,2> diameter;
+         double width = 0.0;
+
+         algorithm::polygon_diameter< point2d<double> >(hull.begin(),hull.end(),diameter);
+         algorithm::polygon_width   < point2d<double> >(hull.begin(),hull.end(),width);
+
+         if (!close(distance(diameter),max_distance) || !close(width,min_width))
+            ++failed;
+      }
+
+      report("rotating calipers diameter and width",count,failed);
+   }
+
+   /*
+      Vertices a and b of a counter-clockwise hull are antipodal iff some
+      direction is maximised at a and minimised at b, ie: the normal cone
+      of a meets the negated normal cone of b.
+   */
+   inline double normal_angle(const std::vector< point2d<double> >& hull, const std::size_t& edge_index)
+   {
+      const point2d<double>& p1 = hull[edge_index];
+      const point2d<double>& p2 = hull[(edge_index + 1) % hull.size()];
+      return std::atan2(-(p2.x - p1.x),(p2.y - p1.y));
+   }
+
+   inline bool within_arc(const double& angle, const double& start, const double& sweep)
+   {
+      const double two_pi = 2.0 * PI;
+      return std::fmod(std::fmod(angle - start,two_pi) + two_pi,two_pi) <= sweep;
+   }
+
+   inline void antipodal_pairs_vs_brute()
+   {
+      random rng(5);
+      std::size_t failed = 0;
+      const std::size_t count = 2000;
+      const double two_pi = 2.0 * PI;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< point2d<double> > hull = random_hull(rng,20);
+
+         if (orientation(hull[0],hull[1],hull[2]) == Clockwise)
+            std::reverse(hull.begin(),hull.end());
+
+         const std::size_t n = hull.size();
+
+         std::vector<double> start(n);
+         std::vector<double> sweep(n);
+
+         for (std::size_t a = 0; a < n; ++a)
+         {
+            start[a] = normal_angle(hull,(a + n - 1) % n);
+            sweep[a] = std::fmod(std::fmod(normal_angle(hull,a) - start[a],two_pi) + two_pi,two_pi);
+         }
+
+         std::size_t expected = 0;
+
+         for (std::size_t a = 0; a < n; ++a)
+         {
+            for (std::size_t b = a + 1; b < n; ++b)
+            {
+               if (within_arc(start[b] + PI,start[a],sweep[a]) || within_arc(start[a],start[b] + PI,sweep[b]))
+                  ++expected;
+            }
+         }
+
+         std::vector< segment<double,2> > pairs;
+         algorithm::antipodal_pairs< point2d<double> >(hull.begin(),hull.end(),std::back_inserter(pairs));
+
+         if (pairs.size() != expected)
+            ++failed;
+      }
+
+      report("antipodal pairs vs normal cones",count,failed);
+   }
+
+   /* Earliest kept point within tolerance per coordinate, as remove_duplicates. */
+   template <typename T>
+   inline std::size_t brute_distinct(const std::vector< point2d<T> >& point_list, const T& tolerance)
+   {
+      std::vector< point2d<T> > kept;
+
+      for (std::size_t i = 0; i < point_list.size(); ++i)
+      {
+         bool found = false;
+
+         for (std::size_t j = 0; (j < kept.size()) && !found; ++j)
+         {
+            const T dx = point_list[i].x - kept[j].x;
+            const T dy = point_list[i].y - kept[j].y;
+            found = (-tolerance <= dx) && (dx <= tolerance) && (-tolerance <= dy) && (dy <= tolerance);
+         }
+
+         if (!found)
+            kept.push_back(point_list[i]);
+      }
+
+      return kept.size();
+   }
+
+   inline void remove_duplicates_vs_brute()
+   {
+      random rng(6);
+      std::size_t failed = 0;
+      const std::size_t count = 1000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< point2d<double> >    real_list;
+         std::vector< point2d<long long> > integer_list;
+
+         const long long range = rng.integer(1,40);
+
+         for (std::size_t k = 0; k < 200; ++k)
+         {
+            real_list.push_back(make_point(rng(-1.0,1.0),rng(-1.0,1.0)));
+            integer_list.push_back(make_point(rng.integer(-range,range),rng.integer(-range,range)));
+         }
+
+         const double    real_tolerance    = rng(0.0,0.2);
+         const long long integer_tolerance = rng.integer(0,4);
+
+         std::vector< point2d<double> >    real_out;
+         std::vector< point2d<long long> > integer_out;
+
+         algorithm::remove_duplicates< point2d<double>    >(real_list.begin(),real_list.end(),std::back_inserter(real_out),real_tolerance);
+         algorithm::remove_duplicates< point2d<long long> >(integer_list.begin(),integer_list.end(),std::back_inserter(integer_out),integer_tolerance);
+
+         if (real_out.size() != brute_distinct(real_list,real_tolerance))
+            ++failed;
+
+         if (integer_out.size() != brute_distinct(integer_list,integer_tolerance))
+            ++failed;
+      }
+
+      report("remove_duplicates vs pairwise (real, int)",2 * count,failed);
+   }
+
+   inline void remove_duplicates_parallel_vs_sequential()
+   {
+      random rng(7);
+      std::size_t failed = 0;
+      const std::size_t count = 4;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< point2d<double> > point_list;
+
+         for (std::size_t k = 0; k < 100000; ++k)
+         {
+            point_list.push_back(make_point(std::floor(rng(0.0,300.0)) * 0.01,std::floor(rng(0.0,300.0)) * 0.01));
+         }
+
+         const double tolerance = 0.015;
+
+         std::vector< point2d<double> > sequential_out;
+         std::vector< point2d<double> > parallel_out;
+         std::vector<std::size_t>       sequential_map;
+         std::vector<std::size_t>       parallel_map;
+
+         algorithm::remove_duplicates< point2d<double> >(point_list.begin(),point_list.end(),std::back_inserter(sequential_out),sequential_map,tolerance);
+         algorithm::remove_duplicates< point2d<double> >(execution::policy(4),point_list.begin(),point_list.end(),std::back_inserter(parallel_out),parallel_map,tolerance);
+
+         if ((sequential_out != parallel_out) || (sequential_map != parallel_map))
+            ++failed;
+      }
+
+      report("remove_duplicates parallel vs sequential",count,failed);
+   }
+
+   inline void lu_solve_residual()
+   {
+      random rng(8);
+      std::size_t failed = 0;
+      const std::size_t count = 2000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         matrix<double,5,5> a;
+         matrix<double,5,1> b;
+
+         for (std::size_t r = 0; r < 5; ++r)
+         {
+            for (std::size_t c = 0; c < 5; ++c)
+            {
+               a(c,r) = rng(-1.0,1.0) + ((r == c) ? 5.0 : 0.0);
+            }
+
+            b(0,r) = rng(-10.0,10.0);
+         }
+
+         matrix<double,5,1> x = b;
+
+         if (!solve(a,x))
+         {
+            ++failed;
+            continue;
+         }
+
+         const matrix<double,5,1> ax = a * x;
+
+         for (std::size_t r = 0; r < 5; ++r)
+         {
+            if (!close(ax(0,r),b(0,r)))
+            {
+               ++failed;
+               break;
+            }
+         }
+      }
+
+      report("lu solve residual",count,failed);
+   }
+
+   inline void symmetric_eigen_residual()
+   {
+      random rng(9);
+      std::size_t failed = 0;
+      const std::size_t count = 5000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         matrix<double,3,3> a;
+
+         for (std::size_t r = 0; r < 3; ++r)
+         {
+            for (std::size_t c = r; c < 3; ++c)
+            {
+               a(c,r) = a(r,c) = rng(-10.0,10.0);
+            }
+         }
+
+         double            eigenvalue [3];
+         vector3d<double>  eigenvector[3];
+
+         symmetric_eigen(a,eigenvalue,eigenvector);
+
+         for (std::size_t k = 0; k < 3; ++k)
+         {
+            const vector3d<double>& v = eigenvector[k];
+            bool valid = close(vector_norm(v),1.0,1.0e-9);
+
+            for (std::size_t r = 0; r < 3; ++r)
+            {
+               const double av = a(0,r) * v.x + a(1,r) * v.y + a(2,r) * v.z;
+               valid = valid && (std::abs(av - eigenvalue[k] * v[r]) <= 1.0e-8 * 30.0);
+            }
+
+            if (!valid)
+            {
+               ++failed;
+               break;
+            }
+         }
+      }
+
+      report("symmetric 3x3 eigen residual",count,failed);
+   }
+
+   inline void point_moments_vs_covariance()
+   {
+      random rng(10);
+      std::size_t failed = 0;
+      const std::size_t count = 500;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< point2d<double> > point_list;
+
+         for (std::size_t k = 0; k < 1000; ++k)
+         {
+            point_list.push_back(make_point(rng(1000.0,1001.0),rng(-5.0,5.0)));
+         }
+
+         algorithm::point_moments<double,2> moments1;
+         algorithm::point_moments<double,2> moments2;
+
+         moments1.add(point_list.begin(),point_list.begin() + 300);
+         moments2.add(point_list.begin() + 300,point_list.end());
+         moments1.merge(moments2);
+
+         const matrix<double,2,2> streamed = moments1.covariance();
+         const matrix<double,2,2> baseline = algorithm::covariance_matrix< point2d<double> >()(point_list.begin(),point_list.end());
+
+         for (std::size_t k = 0; k < 4; ++k)
+         {
+            if (!close(streamed[k],baseline[k],1.0e-8))
+            {
+               ++failed;
+               break;
+            }
+         }
+      }
+
+      report("point_moments merge vs covariance_matrix",count,failed);
+   }
+
+   /* Time of first contact of two moving circles against fine sub-stepping. */
+   inline void time_of_impact_vs_substepping()
+   {
+      random rng(11);
+      std::size_t failed = 0;
+      const std::size_t count = 1000;
+      const std::size_t steps = 4000;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const circle<double>   circle1   = make_circle(rng(0.0,10.0),rng(0.0,10.0),rng(0.2,1.5));
+         const circle<double>   circle2   = make_circle(rng(0.0,10.0),rng(0.0,10.0),rng(0.2,1.5));
+         const vector2d<double> velocity1 = make_vector(rng(-8.0,8.0),rng(-8.0,8.0));
+         const vector2d<double> velocity2 = make_vector(rng(-8.0,8.0),rng(-8.0,8.0));
+
+         double first = -1.0;
+
+         for (std::size_t s = 0; (s <= steps) && (first < 0.0); ++s)
+         {
+            const double t = static_cast<double>(s) / steps;
+            const point2d<double> c1 = make_point(circle1.x + velocity1.x * t,circle1.y + velocity1.y * t);
+            const point2d<double> c2 = make_point(circle2.x + velocity2.x * t,circle2.y + velocity2.y * t);
+
+            if (distance(c1,c2) <= (circle1.radius + circle2.radius))
+               first = t;
+         }
+
+         double           t = 0.0;
+         vector2d<double> normal;
+
+         const bool hit = time_of_impact(circle1,velocity1,circle2,velocity2,t,normal);
+
+         /* A grazing contact can fall between two sub-steps, so only a missed overlap fails. */
+         if (first >= 0.0)
+         {
+            if (!hit || (std::abs(t - first) > (2.0 / steps)))
+               ++failed;
+         }
+      }
+
+      report("time_of_impact vs sub-stepping",count,failed);
+   }
+
+   inline void ray_packet_vs_scalar()
+   {
+      random rng(12);
+      std::size_t failed = 0;
+      const std::size_t count = 5000;
+
+      const box<double,3>      box      = make_box(-1.0,-1.0,-1.0,1.0,1.0,1.0);
+      const sphere<double>     sphere   = make_sphere(0.5,0.0,0.0,1.0);
+      const triangle<double,3> triangle = make_triangle(make_point(-1.0,-1.0,0.2),make_point(1.0,-1.0,0.0),make_point(0.0,1.5,-0.2));
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         std::vector< ray<double,3> > ray_list;
+
+         for (std::size_t lane = 0; lane < 8; ++lane)
+         {
+            const point3d<double> origin = make_point(rng(-2.5,2.5),rng(-2.5,2.5),rng(-2.5,2.5));
+            const point3d<double> target = make_point(rng(-1.5,1.5),rng(-1.5,1.5),rng(-1.5,1.5));
+            ray_list.push_back(make_ray(origin,target - origin));
+         }
+
+         const ray_packet<double,8> packet(ray_list.begin(),ray_list.end());
+
+         /* The scalar ray-box test keeps the baseline's unit t range. */
+         ray_packet<double,8> unit_packet;
+
+         for (std::size_t lane = 0; lane < 8; ++lane)
+         {
+            unit_packet.set(lane,ray_list[lane],1.0);
+         }
+
+         const unsigned int box_mask      = intersect(unit_packet,box);
+         const unsigned int sphere_mask   = intersect(packet,sphere);
+         const unsigned int triangle_mask = intersect(packet,triangle);
+
+         for (std::size_t lane = 0; lane < 8; ++lane)
+         {
+            if (
+                 (((box_mask      >> lane) & 1) != static_cast<unsigned int>(intersect(ray_list[lane],box     ))) ||
+                 (((sphere_mask   >> lane) & 1) != static_cast<unsigned int>(intersect(ray_list[lane],sphere  ))) ||
+                 (((triangle_mask >> lane) & 1) != static_cast<unsigned int>(intersect(ray_list[lane],triangle)))
+               )
+            {
+               ++failed;
+               break;
+            }
+         }
+      }
+
+      report("ray packet vs scalar intersect",count,failed);
+   }
+
+   inline polygon<double,2> random_polygon(random& rng, const std::size_t& vertex_count)
+   {
+      polygon<double,2> polygon;
+
+      for (std::size_t i = 0; i < vertex_count; ++i)
+      {
+         polygon.push_back(make_point(rng(-1.0e6,1.0e6),rng(-1.0e-6,1.0e-6)));
+      }
+
+      return polygon;
+   }
+
+   inline bool same_polygon(const polygon<double,2>& polygon1, const polygon<double,2>& polygon2)
+   {
+      if (polygon1.size() != polygon2.size())
+         return false;
+
+      for (std::size_t i = 0; i < polygon1.size(); ++i)
+      {
+         if ((polygon1[i].x != polygon2[i].x) || (polygon1[i].y != polygon2[i].y))
+            return false;
+      }
+
+      return true;
+   }
+
+   /* Coordinates must read back bit for bit, in the classic and any other locale. */
+   inline void wkt_wkb_round_trip()
+   {
+      random rng(13);
+      std::size_t failed = 0;
+      const std::size_t count = 500;
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         const polygon<double,2> polygon = random_polygon(rng,3 + (i % 20));
+
+         std::string                text;
+         std::vector<unsigned char> bytes;
+
+         write_wkt(polygon,std::back_inserter(text));
+         write_wkb(polygon,std::back_inserter(bytes));
+
+         well_known_geometry<double> geometry;
+         wykobi::polygon<double,2>   from_text;
+         wykobi::polygon<double,2>   from_bytes;
+
+         wkt_reader<double> text_reader(text);
+         wkb_reader<double> byte_reader(&bytes[0],bytes.size());
+
+         if (!text_reader.next(geometry) || !assign(geometry,from_text) || !same_polygon(polygon,from_text))
+            ++failed;
+
+         if (!byte_reader.next(geometry) || !assign(geometry,from_bytes) || !same_polygon(polygon,from_bytes))
+            ++failed;
+      }
+
+      report("wkt and wkb polygon round trip",2 * count,failed);
+   }
+
+   inline void geometry_store_round_trip()
+   {
+      random rng(14);
+      std::size_t failed = 0;
+
+      const std::string file_name = "wykobi_check.store";
+      std::vector< polygon<double,2> > polygon_list;
+
+      {
+         geometry_store_writer<double,2> writer(file_name);
+
+         for (std::size_t i = 0; i < 1000; ++i)
+         {
+            polygon_list.push_back(random_polygon(rng,i % 12));
+            writer.append(polygon_list.back());
+         }
+
+         if (!writer.close())
+            ++failed;
+      }
+
+      geometry_store<double,2> store(file_name);
+
+      if (!store.is_open() || (store.size() != polygon_list.size()))
+      {
+         report("geometry store round trip",1,1);
+         std::remove(file_name.c_str());
+         return;
+      }
+
+      for (std::size_t i = 0; i < polygon_list.size(); ++i)
+      {
+         const polygon_view<double,2> view = store[i];
+         const polygon<double,2>&     polygon = polygon_list[i];
+
+         bool valid = (view.size() == polygon.size());
+
+         for (std::size_t k = 0; valid && (k < view.size()); ++k)
+         {
+            valid = (view[k].x == polygon[k].x) && (view[k].y == polygon[k].y);
+         }
+
+         /* aabb reports an empty rectangle below three vertices, the store keeps the true bounds. */
+         if (valid && (polygon.size() >= 3))
+         {
+            const rectangle<double> bounds   = store.bounds(i);
+            const rectangle<double> expected = aabb(polygon);
+
+            valid = (bounds[0].x == expected[0].x) && (bounds[0].y == expected[0].y) &&
+                    (bounds[1].x == expected[1].x) && (bounds[1].y == expected[1].y);
+         }
+
+         if (!valid)
+            ++failed;
+      }
+
+      store.close();
+      std::remove(file_name.c_str());
+
+      report("geometry store round trip",polygon_list.size(),failed);
+   }
+
+} // namespace check
+
+
+int main()
+{
+   check::separating_axis_obb2d();
+   check::separating_axis_coplanar_triangles();
+   check::convex_hull_graham_vs_jarvis();
+   check::rotating_calipers_vs_brute();
+   check::antipodal_pairs_vs_brute();
+   check::remove_duplicates_vs_brute();
+   check::remove_duplicates_parallel_vs_sequential();
+   check::lu_solve_residual();
+   check::symmetric_eigen_residual();
+   check::point_moments_vs_covariance();
+   check::time_of_impact_vs_substepping();
+   check::ray_packet_vs_scalar();
+   check::wkt_wkb_round_trip();
+   check::geometry_store_round_trip();
+
+   std::printf("%s\n",(0 == check::failures) ? "All checks passed" : "Checks FAILED");
+
+   return (0 == check::failures) ? 0 : 1;
+}
@@ -40,9 +40,44 @@ namespace wykobi
       {
       public:
 
+         template <typename InputAllocator, typename OutputAllocator>
          sutherland_hodgman_polygon_clipper (const rectangle<T>& clip_boundry,
-                                             const polygon<T,2>& input_polygon,
-                                                   polygon<T,2>& clipped_polygon)
+                                             const polygon<T,2,InputAllocator>& input_polygon,
+                                                   polygon<T,2,OutputAllocator>& clipped_polygon)
+         {
+            clip(clip_boundry,input_polygon,clipped_polygon);
+         }
+
+         template <typename OutputAllocator>
+         sutherland_hodgman_polygon_clipper (const rectangle<T>& clip_boundry,
+                                             const polygon_view<T,2>& input_polygon,
+                                                   polygon<T,2,OutputAllocator>& clipped_polygon)
+         {
+            clip(clip_boundry,input_polygon,clipped_polygon);
+         }
+
+         template <typename ClipObject, typename InputAllocator, typename OutputAllocator>
+         sutherland_hodgman_polygon_clipper (const ClipObject& clip_boundry,
+                                             const polygon<T,2,InputAllocator>& input_polygon,
+                                                   polygon<T,2,OutputAllocator>& clipped_polygon)
+         {
+            clip(clip_boundry,input_polygon,clipped_polygon);
+         }
+
+         template <typename ClipObject, typename OutputAllocator>
+         sutherland_hodgman_polygon_clipper (const ClipObject& clip_boundry,
+                                             const polygon_view<T,2>& input_polygon,
+                                                   polygon<T,2,OutputAllocator>& clipped_polygon)
+         {
+            clip(clip_boundry,input_polygon,clipped_polygon);
+         }
+
+      private:
+
+         template <typename InputPolygon, typename OutputPolygon>
+         void clip(const rectangle<T>& clip_boundry,
+                   const InputPolygon& input_polygon,
+                         OutputPolygon& clipped_polygon)
          {
             if (input_polygon.size() < 3) return;
 
@@ -63,10 +98,10 @@ namespace wykobi
                            );
          }
 
-         template <typename ClipObject>
-         sutherland_hodgman_polygon_clipper (const ClipObject& clip_boundry,
-                                             const polygon<T,2>& input_polygon,
-                                                   polygon<T,2>& clipped_polygon)
+         template <typename ClipObject, typename InputPolygon, typename OutputPolygon>
+         void clip(const ClipObject& clip_boundry,
+                   const InputPolygon& input_polygon,
+                         OutputPolygon& clipped_polygon)
          {
             if (input_polygon.size() < 3) return;
 
@@ -128,6 +163,8 @@ namespace wykobi
 
             for (std::size_t i = 0; i < edge_list.size(); ++i)
             {
+               WYKOBI_INSTRUMENT(clipper_passes);
+
                point2d<T> point1 = edge_list[i].first;
                point2d<T> point2 = edge_list[i].second;
 
@@ -0,0 +1,132 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_COMMON
+#define INCLUDE_WYKOBI_COMMON
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Elementary distances, closest points on lines, edges, obb corners
+      and points on rays, shared by the predicate, distance, measure and
+      intersection modules.
+   */
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& px, const T& py,
+                                                      T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                const T& x2, const T& y2, const T& z2,
+                                                const T& px, const T& py, const T& pz,
+                                                      T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                      const T& x2, const T& y2,
+                                                      const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                      const T& x2, const T& y2, const T& z2,
+                                                      const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_line_from_point(const line<T,2>& line, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_line_from_point(const line<T,3>& line, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const T& px, const T& py,
+                                                const T& x1, const T& y1,
+                                                const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const T& px, const T& py, const T& pz,
+                                                const T& x1, const T& y1, const T& z1,
+                                                const T& x2, const T& y2, const T& z2);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const point2d<T>& point, const line<T,2>& line);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const point3d<T>& point, const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE T distance(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE T distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T distance(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point3d<T>& point, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> edge(const triangle<T,2>& triangle, const std::size_t& edge_index);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> edge(const triangle<T,3>& triangle, const std::size_t& edge_index);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> edge(const quadix<T,2>& quadix, const std::size_t& edge_index);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> edge(const quadix<T,3>& quadix, const std::size_t& edge_index);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> edge(const rectangle<T>& rectangle, const std::size_t& edge);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE segment<T,2> edge(const polygon<T,2,Allocator>& polygon, const std::size_t& edge);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE segment<T,3> edge(const polygon<T,3,Allocator>& polygon, const std::size_t& edge);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_point_on_ray(const ray<T,2>& ray, const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_point_on_ray(const ray<T,3>& ray, const T& t);
+
+   template <typename T> WYKOBI_INLINE point2d<T> obb_corner(const obb<T,2>& obb, const std::size_t& corner_index);
+
+   template <typename T> WYKOBI_INLINE point3d<T> obb_corner(const obb<T,3>& obb, const std::size_t& corner_index);
+
+} // wykobi namespace
+
+#include "wykobi_common.inl"
+
+#endif
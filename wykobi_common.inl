@@ -0,0 +1,417 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_common.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& px, const T& py,
+                                                      T& nx,       T& ny)
+   {
+      const T vx = x2 - x1;
+      const T vy = y2 - y1;
+      const T wx = px - x1;
+      const T wy = py - y1;
+
+      const T c1 = vx * wx + vy * wy;
+      const T c2 = vx * vx + vy * vy;
+
+      const T ratio = c1 / c2;
+
+      nx = x1 + ratio * vx;
+      ny = y1 + ratio * vy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                const T& x2, const T& y2, const T& z2,
+                                                const T& px, const T& py, const T& pz,
+                                                      T& nx,       T& ny,       T& nz)
+   {
+      const T vx = x2 - x1;
+      const T vy = y2 - y1;
+      const T vz = z2 - z1;
+      const T wx = px - x1;
+      const T wy = py - y1;
+      const T wz = pz - z1;
+
+      const T c1 = vx * wx + vy * wy + vz * wz;
+      const T c2 = vx * vx + vy * vy + vz * vz;
+
+      const T ratio = c1 / c2;
+
+      nx = x1 + ratio * vx;
+      ny = y1 + ratio * vy;
+      nz = z1 + ratio * vz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                      const T& x2, const T& y2,
+                                                      const T& px, const T& py)
+   {
+      point2d<T> point;
+      closest_point_on_line_from_point(x1,y1,x2,y2,px,py,point.x,point.y);
+      return point;
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                      const T& x2, const T& y2, const T& z2,
+                                                      const T& px, const T& py, const T& pz)
+   {
+      point3d<T> point;
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,point.x,point.y,point.z);
+      return point;
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_line_from_point(const line<T,2>& line, const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      closest_point_on_line_from_point
+      (
+        line[0].x, line[0].y,
+        line[1].x, line[1].y,
+          point.x,   point.y,
+         point_.x,  point_.y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_line_from_point(const line<T,3>& line, const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      closest_point_on_line_from_point
+      (
+        line[0].x, line[0].y, line[0].z,
+        line[1].x, line[1].y, line[1].z,
+          point.x,   point.y,   point.z,
+         point_.x,  point_.y,  point_.z
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const T& px, const T& py,
+                                                const T& x1, const T& y1,
+                                                const T& x2, const T& y2)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+
+      closest_point_on_line_from_point(x1,y1,x2,y2,px,py,nx,ny);
+
+      return distance(px, py, nx, ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const T& px, const T& py, const T& pz,
+                                                const T& x1, const T& y1, const T& z1,
+                                                const T& x2, const T& y2, const T& z2)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+      T nz = T(0.0);
+
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+
+      return distance(px, py, pz, nx, ny, nz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const point2d<T>& point, const line<T,2>& line)
+   {
+      return minimum_distance_from_point_to_line
+             (
+               line[0].x, line[0].y,
+               line[1].x, line[1].y,
+                 point.x,   point.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_line(const point3d<T>& point, const line<T,3>& line)
+   {
+      return minimum_distance_from_point_to_line
+             (
+               line[0].x, line[0].y, line[0].z,
+               line[1].x, line[1].y, line[1].z,
+                 point.x,   point.y,   point.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      const T dx = (x1 - x2);
+      const T dy = (y1 - y2);
+
+      return sqrt(dx * dx + dy * dy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      const T dx = (x1 - x2);
+      const T dy = (y1 - y2);
+      const T dz = (z1 - z2);
+
+      return sqrt(dx * dx + dy * dy + dz * dz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return distance(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return distance(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,2>& segment)
+   {
+      return distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,3>& segment)
+   {
+      return distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      const T dx = (x2 - x1);
+      const T dy = (y2 - y1);
+
+      return dx * dx + dy * dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      const T dx = (x2 - x1);
+      const T dy = (y2 - y1);
+      const T dz = (z2 - z1);
+
+      return dx * dx + dy * dy + dz * dz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return lay_distance(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return lay_distance(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,2>& segment)
+   {
+      return lay_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,3>& segment)
+   {
+      return lay_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point3d<T>& point, const plane<T,3>& plane)
+   {
+      return sqr((plane.normal.x * point.x + plane.normal.y * point.y + plane.normal.z * point.z ) - plane.constant);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> edge(const triangle<T,2>& triangle, const std::size_t& edge_index)
+   {
+      switch(edge_index)
+      {
+          case 0 : return make_segment(triangle[0],triangle[1]);
+          case 1 : return make_segment(triangle[1],triangle[2]);
+          case 2 : return make_segment(triangle[2],triangle[0]);
+         default : return degenerate_segment2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> edge(const triangle<T,3>& triangle, const std::size_t& edge_index)
+   {
+      switch(edge_index)
+      {
+          case 0 : return make_segment(triangle[0],triangle[1]);
+          case 1 : return make_segment(triangle[1],triangle[2]);
+          case 2 : return make_segment(triangle[2],triangle[0]);
+         default : return degenerate_segment3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> edge(const quadix<T,2>& quadix, const std::size_t& edge_index)
+   {
+      switch(edge_index)
+      {
+          case 0 : return make_segment(quadix[0],quadix[1]);
+          case 1 : return make_segment(quadix[1],quadix[2]);
+          case 2 : return make_segment(quadix[2],quadix[3]);
+          case 3 : return make_segment(quadix[3],quadix[0]);
+         default : return degenerate_segment2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> edge(const quadix<T,3>& quadix, const std::size_t& edge_index)
+   {
+      switch(edge_index)
+      {
+          case 0 : return make_segment(quadix[0],quadix[1]);
+          case 1 : return make_segment(quadix[1],quadix[2]);
+          case 2 : return make_segment(quadix[2],quadix[3]);
+          case 3 : return make_segment(quadix[3],quadix[0]);
+         default : return degenerate_segment3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> edge(const rectangle<T>& rectangle, const std::size_t& edge_index)
+   {
+      switch(edge_index)
+      {
+          case 0 : return make_segment(rectangle[0].x,rectangle[0].y,rectangle[1].x,rectangle[0].y);
+          case 1 : return make_segment(rectangle[1].x,rectangle[0].y,rectangle[1].x,rectangle[1].y);
+          case 2 : return make_segment(rectangle[1].x,rectangle[1].y,rectangle[0].x,rectangle[1].y);
+          case 3 : return make_segment(rectangle[0].x,rectangle[1].y,rectangle[0].x,rectangle[0].y);
+         default : return degenerate_segment2d<T>();
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE segment<T,2> edge(const polygon<T,2,Allocator>& polygon, const std::size_t& edge_index)
+   {
+      if (edge_index >= polygon.size()) return make_segment(T(0.0),T(0.0),T(0.0),T(0.0));
+      if (edge_index == (polygon.size() - 1))
+         return make_segment(polygon[edge_index],polygon[0]);
+      else
+         return make_segment(polygon[edge_index],polygon[edge_index + 1]);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE segment<T,3> edge(const polygon<T,3,Allocator>& polygon, const std::size_t& edge_index)
+   {
+      if (edge_index >= polygon.size())
+         return make_segment(T(0.0),T(0.0),T(0.0),T(0.0),T(0.0),T(0.0));
+      else if (edge_index == (polygon.size() - 1))
+         return make_segment(polygon[edge_index],polygon[0]);
+      else
+         return make_segment(polygon[edge_index],polygon[edge_index + 1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_point_on_ray(const ray<T,2>& ray, const T& t)
+   {
+      if (t < T(0.0))
+      {
+         return degenerate_point2d<T>();
+      }
+
+      return make_point
+             (
+               ray.origin.x + t * ray.direction.x,
+               ray.origin.y + t * ray.direction.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_point_on_ray(const ray<T,3>& ray, const T& t)
+   {
+      if (t < T(0.0))
+      {
+         return degenerate_point3d<T>();
+      }
+
+      return make_point
+             (
+               ray.origin.x + t * ray.direction.x,
+               ray.origin.y + t * ray.direction.y,
+               ray.origin.z + t * ray.direction.z
+             );
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> obb_corner(const obb<T,2>& obb, const std::size_t& corner_index)
+   {
+      const vector2d<T> u = obb.axis[0] * obb.half_length[0];
+      const vector2d<T> v = obb.axis[1] * obb.half_length[1];
+
+      switch(corner_index)
+      {
+          case 0 : return obb.center - u - v;
+          case 1 : return obb.center + u - v;
+          case 2 : return obb.center + u + v;
+          case 3 : return obb.center - u + v;
+         default : return degenerate_point2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> obb_corner(const obb<T,3>& obb, const std::size_t& corner_index)
+   {
+      const vector3d<T> u = obb.axis[0] * obb.half_length[0];
+      const vector3d<T> v = obb.axis[1] * obb.half_length[1];
+      const vector3d<T> w = obb.axis[2] * obb.half_length[2];
+
+      switch(corner_index)
+      {
+          case 0 : return obb.center - u - v - w;
+          case 1 : return obb.center + u - v - w;
+          case 2 : return obb.center + u + v - w;
+          case 3 : return obb.center - u + v - w;
+          case 4 : return obb.center - u - v + w;
+          case 5 : return obb.center + u - v + w;
+          case 6 : return obb.center + u + v + w;
+          case 7 : return obb.center - u + v + w;
+         default : return degenerate_point3d<T>();
+      }
+   }
+
+} // wykobi namespace
@@ -0,0 +1,132 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+/*
+   Representative client translation unit used to measure compile times
+   of the header-only build against the precompiled library build
+   (make compile_benchmark).
+*/
+
+#ifdef WYKOBI_EXTERN_TEMPLATES
+ #include "wykobi_extern.hpp"
+#else
+ #include "wykobi.hpp"
+ #include "wykobi_algorithm.hpp"
+ #include "wykobi_utilities.hpp"
+#endif
+
+#include <iostream>
+#include <vector>
+
+
+template <typename T>
+T exercise()
+{
+   using namespace wykobi;
+
+   const point2d<T> p0 = make_point(T(0.0),T(0.0));
+   const point2d<T> p1 = make_point(T(4.0),T(1.0));
+   const point2d<T> p2 = make_point(T(2.0),T(5.0));
+   const point2d<T> p3 = make_point(T(-1.0),T(3.0));
+
+   const point3d<T> q0 = make_point(T(0.0),T(0.0),T(0.0));
+   const point3d<T> q1 = make_point(T(4.0),T(1.0),T(2.0));
+   const point3d<T> q2 = make_point(T(2.0),T(5.0),T(1.0));
+
+   const segment<T,2>  s2 = make_segment(p0,p2);
+   const segment<T,2>  t2 = make_segment(p1,p3);
+   const segment<T,3>  s3 = make_segment(q0,q1);
+   const line<T,2>     l2 = make_line(p0,p1);
+   const triangle<T,2> tr2 = make_triangle(p0,p1,p2);
+   const triangle<T,3> tr3 = make_triangle(q0,q1,q2);
+   const quadix<T,2>   qd2 = make_quadix(p0,p1,p2,p3);
+   const rectangle<T>  rc = make_rectangle(p0,p2);
+   const circle<T>     c0 = make_circle(p1,T(2.0));
+   const circle<T>     c1 = make_circle(p2,T(3.0));
+   const sphere<T>     sp = make_sphere(q1,T(1.5));
+   const box<T,3>      bx = make_box(q0,q1);
+   const polygon<T,2>  pg = make_polygon(qd2);
+
+   T result = T(0.0);
+
+   result += distance(p0,p1) + distance(q0,q1) + distance(p2,s2) + distance(s2,t2) + distance(q2,s3);
+   result += lay_distance(p0,p2) + manhattan_distance(p1,p3) + chebyshev_distance(p0,p3);
+   result += area(tr2) + area(tr3) + area(qd2) + area(rc) + area(c0) + area(pg);
+   result += perimeter(tr2) + perimeter(qd2) + perimeter(rc) + perimeter(c0) + perimeter(pg);
+   result += (intersect(s2,t2) ? T(1.0) : T(0.0));
+   result += (intersect(c0,c1) ? T(1.0) : T(0.0));
+   result += (intersect(s2,rc) ? T(1.0) : T(0.0));
+   result += (intersect(tr2,c0) ? T(1.0) : T(0.0));
+   result += (intersect(bx,sp) ? T(1.0) : T(0.0));
+   result += (point_in_polygon(p1,pg) ? T(1.0) : T(0.0));
+   result += (point_in_triangle(p3,tr2) ? T(1.0) : T(0.0));
+   result += (point_in_circle(p2,c1) ? T(1.0) : T(0.0));
+   result += (is_convex_polygon(pg) ? T(1.0) : T(0.0));
+   result += (collinear(p0,p1,p2) ? T(1.0) : T(0.0));
+   result += T(orientation(p0,p1,p2));
+
+   const point2d<T> ip = intersection_point(s2,t2);
+   const point2d<T> cp = closest_point_on_segment_from_point(s2,p1);
+   const point2d<T> ce = centroid(tr2);
+   const point2d<T> cc = circumcenter(tr2);
+   const point2d<T> ic = incenter(tr2);
+   const point3d<T> cq = closest_point_on_triangle_from_point(tr3,q2);
+
+   result += ip.x + cp.y + ce.x + cc.y + ic.x + cq.z;
+
+   const polygon<T,2>  rp = rotate(T(30.0),pg,p0);
+   const polygon<T,2>  tp = translate(T(1.0),T(2.0),rp);
+   const polygon<T,2>  sc = scale(T(2.0),T(2.0),tp);
+   const triangle<T,2> rt = rotate(T(45.0),tr2);
+   const rectangle<T>  bb = aabb(sc);
+   const circle<T>     ac = circumcircle(rt);
+   const circle<T>     ib = inscribed_circle(rt);
+   const segment<T,2>  ms = mirror(s2,l2);
+
+   result += area(bb) + ac.radius + ib.radius + ms[0].x;
+
+   std::vector< point2d<T> > points;
+   generate_random_points(rc,100,std::back_inserter(points));
+
+   std::vector< point2d<T> > hull;
+   algorithm::convex_hull_graham_scan< point2d<T> >(points.begin(),points.end(),std::back_inserter(hull));
+
+   circle<T> ball;
+   algorithm::randomized_minimum_bounding_ball_with_ch_filter< point2d<T> >(points.begin(),points.end(),ball);
+
+   polygon<T,2> clipped;
+   algorithm::sutherland_hodgman_polygon_clipper< point2d<T> >(rc,pg,clipped);
+
+   std::vector< triangle<T,2> > triangles;
+   algorithm::polygon_triangulate< point2d<T> >(pg,std::back_inserter(triangles));
+
+   result += T(hull.size()) + ball.radius + area(clipped) + T(triangles.size());
+
+   std::cout << ip << cq << s2 << tr2 << c0 << std::endl;
+
+   return result;
+}
+
+int main()
+{
+   std::cout << exercise<float>() << " " << exercise<double>() << std::endl;
+
+   return 0;
+}
@@ -0,0 +1,611 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_DISTANCE
+#define INCLUDE_WYKOBI_DISTANCE
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Distances, closest points and projections.
+   */
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                   const T& x2, const T& y2,
+                                                   const T& px, const T& py,
+                                                         T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                   const T& x2, const T& y2, const T& z2,
+                                                   const T& px, const T& py, const T& pz,
+                                                         T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                                   const T& x2, const T& y2,
+                                                                   const T& px, const T& py,
+                                                                         T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                                   const T& x2, const T& y2, const T& z2,
+                                                                   const T& px, const T& py, const T& pz,
+                                                                         T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                                const T& x2, const T& y2,
+                                                                const T& px, const T& py,
+                                                                      T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                                const T& x2, const T& y2, const T& z2,
+                                                                const T& px, const T& py, const T& pz,
+                                                                      T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_ray_from_point(const T& ox, const T& oy,
+                                               const T& dx, const T& dy,
+                                               const T& px, const T& py,
+                                                     T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_ray_from_point(const T& ox, const T& oy, const T& oz,
+                                               const T& dx, const T& dy, const T& dz,
+                                               const T& px, const T& py, const T& pz,
+                                                     T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                         const T& x2, const T& y2,
+                                                         const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                         const T& x2, const T& y2, const T& z2,
+                                                         const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_segment_from_point(const segment<T,2>& segment, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_segment_from_point(const segment<T,3>& segment, const point3d<T>& point);
+
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_ray_from_point(const T& ox, const T& oy,
+                                                     const T& dx, const T& dy,
+                                                     const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_ray_from_point(const T& ox, const T& oy, const T& oz,
+                                                     const T& dx, const T& dy, const T& dz,
+                                                     const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_ray_from_point(const ray<T,2>& ray, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_ray_from_point(const ray<T,3>& ray, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_triangle_from_point(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3,
+                                                    const T& px, const T& py,
+                                                          T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const T& x1, const T& y1,
+                                                          const T& x2, const T& y2,
+                                                          const T& x3, const T& y3,
+                                                          const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const triangle<T,2>& triangle, const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_triangle_from_point(const T& x1, const T& y1, const T& z1,
+                                                    const T& x2, const T& y2, const T& z2,
+                                                    const T& x3, const T& y3, const T& z3,
+                                                    const T& px, const T& py, const T& pz,
+                                                          T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const T& x1, const T& y1, const T& z1,
+                                                          const T& x2, const T& y2, const T& z2,
+                                                          const T& x3, const T& y3, const T& z3,
+                                                          const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const triangle<T,3>& triangle, const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const triangle<T,3>& triangle, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_rectangle_from_point(const T& x1, const T& y1,
+                                                     const T& x2, const T& y2,
+                                                     const T& px, const T& py,
+                                                           T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const T& x1, const T& y1,
+                                                           const T& x2, const T& y2,
+                                                           const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const rectangle<T>& rectangle, const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const rectangle<T>& rectangle, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_box_from_point(const T& x1, const T& y1, const T& z1,
+                                               const T& x2, const T& y2, const T& z2,
+                                               const T& px, const T& py, const T& pz,
+                                                     T& nx,       T& ny,       T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const T& x1, const T& y1, const T& z1,
+                                                     const T& x2, const T& y2, const T& z2,
+                                                     const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const box<T,3>& box, const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const box<T,3>& box, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_quadix_from_point(const T& x1, const T& y1,
+                                                  const T& x2, const T& y2,
+                                                  const T& x3, const T& y3,
+                                                  const T& x4, const T& y4,
+                                                  const T& px, const T& py,
+                                                        T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_quadix_from_point(const T& x1, const T& y1,
+                                                        const T& x2, const T& y2,
+                                                        const T& x3, const T& y3,
+                                                        const T& x4, const T& y4,
+                                                        const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_quadix_from_point(const quadix<T,2>& quadix, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_point(const circle<T>&  circle,
+                                                        const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_point(const sphere<T>&  sphere,
+                                                        const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_aabbb_from_point(const rectangle<T>& rectangle,
+                                                       const point2d<T>&   point);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_segment(const circle<T>&    circle,
+                                                          const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_segment(const sphere<T>&    sphere,
+                                                          const segment<T,3>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_plane_from_point(const plane<T,3>& plane,
+                                                       const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_circle(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_sphere(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_polygon_from_point(const polygon<T,2>& polygon, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const T& px, const T& py,
+                                                   const T& x1, const T& y1,
+                                                   const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const T& px, const T& py, const T& pz,
+                                                   const T& x1, const T& y1, const T& z1,
+                                                   const T& x2, const T& y2, const T& z2);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const point2d<T>& point, const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const point3d<T>& point, const segment<T,3>& segment);
+
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_triangle(const T& px, const T& py,
+                                                    const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_triangle(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_rectangle(const T& px, const T& py,
+                                                     const T& x1, const T& y1,
+                                                     const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_rectangle(const point2d<T>& point, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const curve_point<T,2>& point1, const curve_point<T,2>& point2);
+
+   template <typename T> WYKOBI_INLINE T distance(const curve_point<T,3>& point1, const curve_point<T,3>& point2);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T distance(const point3d<T>& point, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const ray<T,2>& ray);
+
+   template <typename T> WYKOBI_INLINE T distance(const point3d<T>& point, const ray<T,3>& ray);
+
+   template <typename T> WYKOBI_INLINE T distance(const point3d<T>& point, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE T distance(const line<T,2>& line1, const line<T,2>& line2);
+
+   template <typename T> WYKOBI_INLINE T distance(const line<T,3>& line1, const line<T,3>& line2);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,3>& segment1, const segment<T,3>& segment2);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,2>& segment, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,3>& segment, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,2>& segment, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const segment<T,2>& segment, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE T distance(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE T distance(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE T distance(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE T distance(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point2d<T>& point, const quadix<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point2d<T>& point, const ray<T,2>& ray);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const point3d<T>& point, const ray<T,3>& ray);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,3>& segment1, const segment<T,3>& segment2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const line<T,3>& line1, const line<T,3>& line2);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,2>& segment, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T lay_distance(const segment<T,3>& segment, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const point2d<T>& point, const ray<T,2>& ray);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const point3d<T>& point, const ray<T,3>& ray);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T manhattan_distance(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T chebyshev_distance(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE T inverse_chebyshev_distance(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_segment_to_segment(const T& x1, const T& y1,
+                                        const T& x2, const T& y2,
+                                        const T& x3, const T& y3,
+                                        const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_segment_to_segment(const T& x1, const T& y1, const T& z1,
+                                        const T& x2, const T& y2, const T& z2,
+                                        const T& x3, const T& y3, const T& z3,
+                                        const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_segment_to_segment(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& x3, const T& y3,
+                                            const T& x4, const T& y4);
+
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_segment_to_segment(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3,
+                                            const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_line_to_line(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_line_to_line(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_line_to_line(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3,
+                                      const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_line_to_line(const T& x1, const T& y1, const T& z1,
+                                      const T& x2, const T& y2, const T& z2,
+                                      const T& x3, const T& y3, const T& z3,
+                                      const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_from_point_to_circle_center(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_from_point_to_sphere_center(const point3d<T>& point, const sphere<T>& sphere);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_from_point_to_circle_center(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T>
+   WYKOBI_INLINE T distance_from_point_to_sphere_center(const point3d<T>& point, const sphere<T>& sphere);
+
+   template <typename T>
+   WYKOBI_INLINE T span_length(const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE T span_length(const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE void project_point_t(const T&  srcx, const T&  srcy,
+                               const T& destx, const T& desty,
+                               const T& t,
+                               T& nx, T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void project_point_t(const T&  srcx, const T&  srcy, const T&  srcz,
+                               const T& destx, const T& desty, const T& destz,
+                               const T& t,
+                               T& nx, T& ny, T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T&  srcx, const T&  srcy,
+                             const T& destx, const T& desty,
+                             const T& dist,
+                             T& nx, T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T&  srcx, const T&  srcy, const T&  srcz,
+                             const T& destx, const T& desty, const T& destz,
+                             const T& dist,
+                             T& nx, T& ny, T& nz);
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T& px, const T& py, const T& angle, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point0  (const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point45 (const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point90 (const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point135(const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point180(const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point225(const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point270(const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void project_point315(const T& px, const T& py, const T& distance, T& nx, T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point_t(const point2d<T>& source_point,
+                                     const point2d<T>& destination_point,
+                                     const T& t);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> project_point_t(const point3d<T>& source_point,
+                                     const point3d<T>& destination_point,
+                                     const T& t);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point(const point2d<T>& source_point,
+                                   const point2d<T>& destination_point,
+                                   const T& distance);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> project_point(const point3d<T>& source_point,
+                                   const point3d<T>& destination_point,
+                                   const T& distance);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point(const point2d<T>& point,
+                                   const T& angle,
+                                   const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point0  (const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point45 (const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point90 (const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point135(const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point180(const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point225(const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point270(const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_point315(const point2d<T>& point, const T& distance);
+
+   template <typename T> WYKOBI_INLINE point2d<T> project_object(const point2d<T>& point, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_object(const segment<T,2>& segment, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> project_object(const triangle<T,2>& triangle, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> project_object(const quadix<T,2>& quadix, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE circle<T> project_object(const circle<T>& circle, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> project_object(const polygon<T,2>& polygon, const T& angle, const T& distance);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const point2d<T>& point, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const triangle<T,2>& triangle, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const rectangle<T>& rectangle, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const quadix<T,2>& quadix, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const circle<T>& circle, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const polygon<T,2>& polygon, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const point3d<T>& point, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const triangle<T,3>& triangle, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const box<T,3>& box, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const quadix<T,3>& quadix, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const sphere<T>& sphere, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const polygon<T,3>& polygon, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> project_onto_axis(const obb<T,2>& obb, const line<T,2>& axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> project_onto_axis(const obb<T,3>& obb, const line<T,3>& axis);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const point2d<T>& point, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const triangle<T,2>& triangle, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const rectangle<T>& rectangle, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const quadix<T,2>& quadix, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const circle<T>& circle, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const polygon<T,2>& polygon, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const obb<T,2>& obb, const vector2d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const point3d<T>& point, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const triangle<T,3>& triangle, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const box<T,3>& box, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const quadix<T,3>& quadix, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const sphere<T>& sphere, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const polygon<T,3>& polygon, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE void project_onto_axis(const obb<T,3>& obb, const vector3d<T>& axis, T& min_value, T& max_value);
+
+   template <typename T> WYKOBI_INLINE ray<T,2> make_ray(const point2d<T>& origin, const T& bearing);
+
+   template <typename T> WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE sphere<T> make_sphere(const point3d<T>& point1, const point3d<T>& point2);
+
+} // wykobi namespace
+
+#include "wykobi_common.hpp"
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.inl"
+
+#endif
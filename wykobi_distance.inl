@@ -0,0 +1,2539 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_distance.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                   const T& x2, const T& y2,
+                                                   const T& px, const T& py,
+                                                         T& nx,       T& ny)
+   {
+      const T vx = x2 - x1;
+      const T vy = y2 - y1;
+      const T wx = px - x1;
+      const T wy = py - y1;
+
+      const T c1 = vx * wx + vy * wy;
+
+      if (c1 <= T(0.0))
+      {
+         nx = x1;
+         ny = y1;
+
+         return;
+      }
+
+      const T c2 = vx * vx + vy * vy;
+
+      if (c2 <= c1)
+      {
+         nx = x2;
+         ny = y2;
+
+         return;
+      }
+
+      const T ratio = c1 / c2;
+
+      nx = x1 + ratio * vx;
+      ny = y1 + ratio * vy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                   const T& x2, const T& y2, const T& z2,
+                                                   const T& px, const T& py, const T& pz,
+                                                         T& nx,       T& ny,       T& nz)
+   {
+      const T vx = x2 - x1;
+      const T vy = y2 - y1;
+      const T vz = z2 - z1;
+      const T wx = px - x1;
+      const T wy = py - y1;
+      const T wz = pz - z1;
+
+      const T c1 = vx * wx + vy * wy + vz * wz;
+
+      if (c1 <= T(0.0))
+      {
+         nx = x1;
+         ny = y1;
+         nz = z1;
+
+         return;
+      }
+
+      const T c2 = vx * vx + vy * vy + vz * vz;
+
+      if (c2 <= c1)
+      {
+         nx = x2;
+         ny = y2;
+         nz = z2;
+
+         return;
+      }
+
+      const T ratio = c1 / c2;
+
+      nx = x1 + ratio * vx;
+      ny = y1 + ratio * vy;
+      nz = z1 + ratio * vz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                                   const T& x2, const T& y2,
+                                                                   const T& px, const T& py,
+                                                                         T& nx,       T& ny)
+   {
+      if (x1 < x2)
+      {
+         closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,nx,ny);
+         return;
+      }
+      else if (is_equal(x1,x2) && (y1 < y2))
+      {
+         closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,nx,ny);
+         return;
+      }
+      else
+         closest_point_on_segment_from_point(x2,y2,x1,y1,px,py,nx,ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                                   const T& x2, const T& y2, const T& z2,
+                                                                   const T& px, const T& py, const T& pz,
+                                                                         T& nx,       T& ny,       T& nz)
+   {
+      if (x1 < x2)
+      {
+         closest_point_on_segment_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else if (is_equal(x1,x2) && (y1 < y2))
+      {
+         closest_point_on_segment_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else if (is_equal(y1,y2) && (z1 < z2))
+      {
+         closest_point_on_segment_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else
+         closest_point_on_segment_from_point(x2,y2,z2,x1,y1,z1,px,py,pz,nx,ny,nz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_line_from_point(const T& x1, const T& y1,
+                                                                const T& x2, const T& y2,
+                                                                const T& px, const T& py,
+                                                                      T& nx,       T& ny)
+   {
+      if (x1 < x2)
+      {
+         closest_point_on_line_from_point(x1,y1,x2,y2,px,py,nx,ny);
+         return;
+      }
+      else if (is_equal(x1,x2) && (y1 < y2))
+      {
+         closest_point_on_line_from_point(x1,y1,x2,y2,px,py,nx,ny);
+         return;
+      }
+      else
+         closest_point_on_line_from_point(x2,y2,x1,y1,px,py,nx,ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void order_sensitive_closest_point_on_line_from_point(const T& x1, const T& y1, const T& z1,
+                                                                const T& x2, const T& y2, const T& z2,
+                                                                const T& px, const T& py, const T& pz,
+                                                                      T& nx,       T& ny,       T& nz)
+   {
+      if (x1 < x2)
+      {
+         closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else if (is_equal(x1,x2) && (y1 < y2))
+      {
+         closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else if (is_equal(y1,y2) && (z1 < z2))
+      {
+         closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+         return;
+      }
+      else
+         closest_point_on_segment_from_point(x2,y2,z2,x1,y1,z1,px,py,pz,nx,ny,nz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_ray_from_point(const T& ox, const T& oy,
+                                               const T& dx, const T& dy,
+                                               const T& px, const T& py,
+                                                     T& nx,       T& ny)
+   {
+      const T t  = dx * (px - ox) + dy * (py - oy);
+
+      if (t < T(0.0))
+      {
+         nx = ox;
+         ny = oy;
+      }
+      else
+      {
+         nx = ox + dx * t;
+         ny = oy + dy * t;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_ray_from_point(const T& ox, const T& oy, const T& oz,
+                                               const T& dx, const T& dy, const T& dz,
+                                               const T& px, const T& py, const T& pz,
+                                                     T& nx,       T& ny,       T& nz)
+   {
+      const T t  = dx * (px - ox) + dy * (py - oy) + dz * (pz - oz);
+
+      if (t < T(0.0))
+      {
+         nx = ox;
+         ny = oy;
+         nz = oz;
+      }
+      else
+      {
+         nx = ox + dx * t;
+         ny = oy + dy * t;
+         nz = oz + dz * t;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_segment_from_point(const T& x1, const T& y1,
+                                                         const T& x2, const T& y2,
+                                                         const T& px, const T& py)
+   {
+      point2d<T> point;
+      closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,point.x,point.y);
+
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_segment_from_point(const T& x1, const T& y1, const T& z1,
+                                                         const T& x2, const T& y2, const T& z2,
+                                                         const T& px, const T& py, const T& pz)
+   {
+      point3d<T> point;
+      closest_point_on_segment_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,point.x,point.y,point.z);
+
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_segment_from_point(const segment<T,2>& segment, const point2d<T>& point)
+   {
+      point2d<T> point_;
+      closest_point_on_segment_from_point(segment[0].x, segment[0].y,
+                                          segment[1].x, segment[1].y,
+                                               point.x,      point.y,
+                                              point_.x,     point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_segment_from_point(const segment<T,3>& segment, const point3d<T>& point)
+   {
+      point3d<T> point_;
+      closest_point_on_segment_from_point(segment[0].x, segment[0].y, segment[0].z,
+                                          segment[1].x, segment[1].y, segment[1].z,
+                                               point.x,      point.y,      point.z,
+                                              point_.x,     point_.y,     point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_ray_from_point(const T& ox, const T& oy,
+                                                     const T& dx, const T& dy,
+                                                     const T& px, const T& py)
+   {
+      point2d<T> point_;
+      closest_point_on_ray_from_point(ox,oy,dx,dy,px,py,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_ray_from_point(const T& ox, const T& oy, const T& oz,
+                                                     const T& dx, const T& dy, const T& dz,
+                                                     const T& px, const T& py, const T& pz)
+   {
+      point3d<T> point_;
+      closest_point_on_ray_from_point(ox,oy,oz,dx,dy,dz,px,py,pz,point_.x,point_.y,point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_ray_from_point(const ray<T,2>& ray, const point2d<T>& point)
+   {
+      return closest_point_on_ray_from_point
+             (
+               ray.origin   .x, ray.origin   .y,
+               ray.direction.x, ray.direction.y,
+               point        .x, point        .y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_ray_from_point(const ray<T,3>& ray, const point3d<T>& point)
+   {
+      return closest_point_on_ray_from_point
+             (
+               ray.origin   .x, ray.origin   .y, ray.origin   .z,
+               ray.direction.x, ray.direction.y, ray.direction.z,
+               point        .x, point        .y, point        .z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_triangle_from_point(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3,
+                                                    const T& px, const T& py,
+                                                          T& nx,       T& ny)
+   {
+      const int or1 = orientation((x2 + x3) * T(0.5), (y2 + y3) * T(0.5), x1, y1, px, py);
+      const int or2 = orientation((x1 + x3) * T(0.5), (y1 + y3) * T(0.5), x2, y2, px, py);
+
+      if (differing_orientation(x1,y1,x2,y2,px,py,x3,y3) && ((or1 * or2) == -1))
+      {
+         closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,nx,ny);
+         return;
+      }
+
+      const int or3 = orientation((x1 + x2) * T(0.5),(y1 + y2) * T(0.5),x3,y3,px,py);
+
+      if (differing_orientation(x2,y2,x3,y3,px,py,x1,y1) && ((or2 * or3) == -1))
+      {
+         closest_point_on_segment_from_point(x2,y2,x3,y3,px,py,nx,ny);
+         return;
+      }
+
+      if (differing_orientation(x3,y3,x1,y1,px,py,x2,y2) && ((or3 * or1) == -1))
+      {
+         closest_point_on_segment_from_point(x3,y3,x1,y1,px,py,nx,ny);
+         return;
+      }
+
+      nx = px;
+      ny = py;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const T& x1, const T& y1,
+                                                          const T& x2, const T& y2,
+                                                          const T& x3, const T& y3,
+                                                          const T& px, const T& py)
+   {
+      point2d<T> point;
+      closest_point_on_triangle_from_point(x1,y1,x2,y2,x3,y3,px,py,point.x,point.y);
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const triangle<T,2>& triangle, const T& px, const T& py)
+   {
+      return closest_point_on_triangle_from_point(triangle[0].x,triangle[0].y,
+                                                  triangle[1].x,triangle[1].y,
+                                                  triangle[2].x,triangle[2].y,
+                                                             px,           py);
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_triangle_from_point(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      return closest_point_on_triangle_from_point(triangle[0].x,triangle[0].y,
+                                                  triangle[1].x,triangle[1].y,
+                                                  triangle[2].x,triangle[2].y,
+                                                        point.x,      point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_triangle_from_point(const T& x1, const T& y1, const T& z1,
+                                                    const T& x2, const T& y2, const T& z2,
+                                                    const T& x3, const T& y3, const T& z3,
+                                                    const T& px, const T& py, const T& pz,
+                                                          T& nx,       T& ny,       T& nz)
+   {
+      point3d<T> point_;
+
+      point_ = closest_point_on_triangle_from_point(x1,y1,z1,x2,y2,z2,x3,y3,z3,px,py,pz);
+
+      nx = point_.x;
+      ny = point_.y;
+      nz = point_.z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const T& x1, const T& y1, const T& z1,
+                                                          const T& x2, const T& y2, const T& z2,
+                                                          const T& x3, const T& y3, const T& z3,
+                                                          const T& px, const T& py, const T& pz)
+   {
+      return closest_point_on_triangle_from_point(make_triangle(x1,y1,z1,x2,y2,z2,x3,y3,z3),px,py,pz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const triangle<T,3>& triangle, const T& px, const T& py, const T& pz)
+   {
+      return closest_point_on_triangle_from_point(triangle, make_point(px,py,pz));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_triangle_from_point(const triangle<T,3>& triangle, const point3d<T>& point)
+   {
+      const vector3d<T> ab = triangle[1] - triangle[0];
+      const vector3d<T> ac = triangle[2] - triangle[0];
+      const vector3d<T> bc = triangle[2] - triangle[1];
+
+      const T snom   = dot_product(point - triangle[0], ab);
+      const T sdenom = dot_product(point - triangle[1], triangle[0] - triangle[1]);
+
+      const T tnom   = dot_product(point - triangle[0], ac);
+      const T tdenom = dot_product(point - triangle[2], triangle[0] - triangle[2]);
+
+      if (snom <= T(0.0) && tnom <= T(0.0))
+      {
+         return triangle[0];
+      }
+
+      const T unom   = dot_product(point - triangle[1], bc);
+      const T udenom = dot_product(point - triangle[2], triangle[1] - triangle[2]);
+
+      if ((sdenom <= T(0.0)) && (unom <= T(0.0)))
+      {
+         return triangle[1];
+      }
+
+      if ((tdenom <= T(0.0)) && (udenom <= T(0.0)))
+      {
+         return triangle[2];
+      }
+
+      const vector3d<T> n = (triangle[1] - triangle[0]) * (triangle[2] - triangle[0]);
+
+      const T vc = dot_product(n, (triangle[0] - point) * (triangle[1] - point));
+
+      if ((vc <= T(0.0)) && (snom >= T(0.0)) && (sdenom >= T(0.0)))
+      {
+         return triangle[0] + snom / (snom + sdenom) * ab;
+      }
+
+      const T va = dot_product(n,(triangle[1] - point) * (triangle[2] - point));
+
+      if (va <= T(0.0) && unom >= T(0.0) && udenom >= T(0.0))
+      {
+         return triangle[1] + unom / (unom + udenom) * bc;
+      }
+
+      const T vb = dot_product(n, (triangle[2] - point) * (triangle[0] - point));
+
+      if ((vb <= T(0.0)) && (tnom >= T(0.0)) && (tdenom >= T(0.0)))
+      {
+         return triangle[0] + tnom / (tnom + tdenom) * ac;
+      }
+
+      const T u = va / (va + vb + vc);
+      const T v = vb / (va + vb + vc);
+      const T w = T(1.0) - u - v;
+
+      return (u * triangle[0]) + (v * triangle[1]) + (w * triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_rectangle_from_point(const T& x1, const T& y1,
+                                                     const T& x2, const T& y2,
+                                                     const T& px, const T& py,
+                                                           T& nx,       T& ny)
+   {
+      if (px <min(x1,x2))
+         nx = min(x1,x2);
+      else if (px > max(x1,x2))
+         nx = max(x1,x2);
+      else
+         nx = px;
+
+      if (py <min(y1,y2))
+         ny = min(y1,y2);
+      else if (py > max(y1,y2))
+         ny = max(y1,y2);
+      else
+         ny = py;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const T& x1, const T& y1,
+                                                           const T& x2, const T& y2,
+                                                           const T& px, const T& py)
+   {
+      point2d<T> point;
+      closest_point_on_rectangle_from_point(x1,y1,x2,y2,px,py,point.x,point.y);
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const rectangle<T>& rectangle, const T& px, const T& py)
+   {
+      return closest_point_on_rectangle_from_point(rectangle[0].x,rectangle[0].y,
+                                                   rectangle[1].x,rectangle[1].y,
+                                                               px,            py);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_rectangle_from_point(const rectangle<T>& rectangle, const point2d<T>& point)
+   {
+      return closest_point_on_rectangle_from_point(rectangle[0].x,rectangle[0].y,
+                                                   rectangle[1].x,rectangle[1].y,
+                                                   point.x,              point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_box_from_point(const T& x1, const T& y1, const T& z1,
+                                               const T& x2, const T& y2, const T& z2,
+                                               const T& px, const T& py, const T& pz,
+                                                     T& nx,       T& ny,       T& nz)
+   {
+      if (px <min(x1,x2))
+         nx = min(x1,x2);
+      else if (px > max(x1,x2))
+         nx = max(x1,x2);
+      else
+         nx = px;
+
+      if (py <min(y1,y2))
+         ny = min(y1,y2);
+      else if (py > max(y1,y2))
+         ny = max(y1,y2);
+      else
+         ny = py;
+
+      if (pz <min(z1,z2))
+         nz = min(z1,z2);
+      else if (pz > max(z1,z2))
+         nz = max(z1,z2);
+      else
+         nz = pz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const T& x1, const T& y1, const T& z1,
+                                                     const T& x2, const T& y2, const T& z2,
+                                                     const T& px, const T& py, const T& pz)
+   {
+      point3d<T> point;
+      closest_point_on_box_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,point.x,point.y,point.z);
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const box<T,3>& box, const T& px, const T& py, const T& pz)
+   {
+      return closest_point_on_box_from_point(box[0].x,box[0].y,box[0].z,
+                                                   box[1].x,box[1].y,box[1].z,
+                                                         px,      py,      pz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_box_from_point(const box<T,3>& box, const point3d<T>& point)
+   {
+      return closest_point_on_box_from_point(box[0].x,box[0].y,box[0].z,
+                                             box[1].x,box[1].y,box[1].z,
+                                              point.x, point.y, point.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void closest_point_on_quadix_from_point(const T& x1, const T& y1,
+                                                  const T& x2, const T& y2,
+                                                  const T& x3, const T& y3,
+                                                  const T& x4, const T& y4,
+                                                  const T& px, const T& py,
+                                                        T& nx,       T& ny)
+   {
+      nx = px;
+      ny = py;
+
+      if (point_in_quadix(px,py,x1,y1,x2,y2,x3,y3,x4,y4))
+      {
+         return;
+      }
+
+      T tx;
+      T ty;
+      T temp_dist;
+
+      closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,nx,ny);
+
+      T min_dist = distance(nx,ny,px,py);
+
+      closest_point_on_segment_from_point(x2,y2,x3,y3,px,py,tx,ty);
+      temp_dist = distance(tx,ty,px,py);
+
+      if (min_dist > temp_dist)
+      {
+         min_dist = temp_dist;
+         nx = tx;
+         ny = ty;
+      }
+
+      closest_point_on_segment_from_point(x3,y3,x4,y4,px,py,tx,ty);
+
+      temp_dist = distance(tx,ty,px,py);
+
+      if (min_dist > temp_dist)
+      {
+         min_dist = temp_dist;
+         nx = tx;
+         ny = ty;
+      }
+
+      closest_point_on_segment_from_point(x4,y4,x1,y1,px,py,tx,ty);
+
+      temp_dist = distance(tx,ty,px,py);
+
+      if (min_dist > temp_dist)
+      {
+         nx = tx;
+         ny = ty;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_quadix_from_point(const T& x1, const T& y1,
+                                                        const T& x2, const T& y2,
+                                                        const T& x3, const T& y3,
+                                                        const T& x4, const T& y4,
+                                                        const T& px, const T& py)
+   {
+      point2d<T> point;
+
+      closest_point_on_quadix_from_point(x1,y1,x2,y2,x3,y3,x4,y4,px,py,point.x,point.y);
+
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_quadix_from_point(const quadix<T,2>& quadix,
+                                                        const point2d<T>&  point)
+   {
+      return closest_point_on_quadix_from_point(quadix[0].x, quadix[0].y,
+                                                quadix[1].x, quadix[1].y,
+                                                quadix[2].x, quadix[2].y,
+                                                quadix[3].x, quadix[3].y,
+                                                    point.x,     point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_point(const circle<T>&  circle,
+                                                        const point2d<T>& point)
+   {
+      const T dx = point.x - circle.x;
+      const T dy = point.y - circle.y;
+
+      if ((sqr(dx) + sqr(dy)) <= sqr(circle.radius))
+      {
+         return point;
+      }
+
+      point2d<T> point_;
+
+      const T ratio  = circle.radius / sqrt(dx * dx + dy * dy);
+
+      point_.x = circle.x + ratio * dx;
+      point_.y = circle.y + ratio * dy;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_point(const sphere<T>&  sphere,
+                                                        const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      const T dx    = point.x - sphere.x;
+      const T dy    = point.y - sphere.y;
+      const T dz    = point.z - sphere.z;
+      const T ratio = sphere.radius / sqrt(dx * dx + dy * dy);
+
+      point_.x = sphere.x + ratio * dx;
+      point_.y = sphere.y + ratio * dy;
+      point_.z = sphere.z + ratio * dz;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_aabbb_from_point(const rectangle<T>& rectangle,
+                                                       const point2d<T>&   point)
+   {
+      return closest_point_on_rectangle_from_point(rectangle,point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_segment(const circle<T>&    circle,
+                                                          const segment<T,2>& segment)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+
+      point2d<T> point;
+
+      closest_point_on_segment_from_point
+      (
+        segment[0].x, segment[0].y,
+        segment[1].x, segment[1].y,
+        circle.x, circle.y,
+        nx, ny
+      );
+
+      const T ratio = circle.radius / distance(circle.x,circle.y,nx,ny);
+
+      point.x = circle.x + ratio * (nx - circle.x);
+      point.y = circle.y + ratio * (ny - circle.y);
+
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_segment(const sphere<T>&    sphere,
+                                                          const segment<T,3>& segment)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+      T nz = T(0.0);
+
+      point3d<T> point;
+
+      closest_point_on_segment_from_point(segment[0].x, segment[0].y, segment[0].z,
+                                          segment[1].x, segment[1].y, segment[1].z,
+                                              sphere.x,     sphere.y,     sphere.z,
+                                                    nx,           ny,           nz);
+
+      const T ratio = sphere.radius / distance(sphere.x,sphere.y,nx,ny);
+
+      point.x = sphere.x + ratio * (nx - sphere.x);
+      point.y = sphere.y + ratio * (ny - sphere.y);
+      point.z = sphere.z + ratio * (nz - sphere.z);
+
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_plane_from_point(const plane<T,3>& plane,
+                                                       const point3d<T>& point)
+   {
+      const T mu = plane.normal.x * point.x +
+                   plane.normal.y * point.y +
+                   plane.normal.z * point.z  - plane.constant;
+
+      if (is_equal(mu,T(0.0)))
+         return point;
+      else
+         return make_point(point.x - mu * plane.normal.x,
+                           point.y - mu * plane.normal.y,
+                           point.z - mu * plane.normal.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_circle_from_circle(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return closest_point_on_circle_from_point
+             (
+               circle1,
+               closest_point_on_circle_from_point
+               (
+                 circle2, make_point(circle1)
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> closest_point_on_sphere_from_sphere(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      return closest_point_on_sphere_from_point
+             (
+               sphere1,
+               closest_point_on_sphere_from_point
+               (
+                 sphere2,
+                 make_point(sphere1)
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> closest_point_on_polygon_from_point(const polygon<T,2>& polygon, const point2d<T>& point)
+   {
+      if (polygon.size() < 3) return degenerate_point2d<T>();
+
+      if (point_in_polygon(point,polygon)) return point;
+
+      std::size_t j = polygon.size() - 1;
+      T min_dist = std::numeric_limits<T>::max();
+
+      point2d<T> closest_point = degenerate_point2d<T>();
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         point2d<T> curr_point = closest_point_on_segment_from_point
+                                 (
+                                   make_segment(polygon[i], polygon[j]),
+                                   point
+                                 );
+
+         const T curr_dist = distance(point,curr_point);
+
+         if (curr_dist < min_dist)
+         {
+            closest_point = curr_point;
+            min_dist = curr_dist;
+         }
+
+         j = i;
+      }
+
+      return closest_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const T& px, const T& py,
+                                                   const T& x1, const T& y1,
+                                                   const T& x2, const T& y2)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+
+      closest_point_on_segment_from_point(x1,y1,x2,y2,px,py,nx,ny);
+
+      return distance(px,py,nx,ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const T& px, const T& py, const T& pz,
+                                                   const T& x1, const T& y1, const T& z1,
+                                                   const T& x2, const T& y2, const T& z2)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+      T nz = T(0.0);
+
+      closest_point_on_segment_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+
+      return distance(px,py,pz,nx,ny,nz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const point2d<T>& point, const segment<T,2>& segment)
+   {
+      return minimum_distance_from_point_to_segment
+             (
+                    point.x,      point.y,
+               segment[0].x, segment[0].y,
+               segment[1].x, segment[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_segment(const point3d<T>& point, const segment<T,3>& segment)
+   {
+      return minimum_distance_from_point_to_segment
+             (
+                    point.x,      point.y,      point.z,
+               segment[0].x, segment[0].y, segment[0].z,
+               segment[1].x, segment[1].y, segment[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_triangle(const T& px, const T& py,
+                                                    const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+
+      closest_point_on_triangle_from_point(x1,y1,x2,y2,x3,y3,px,py,nx,ny);
+
+      return distance(px,py,nx,ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_triangle(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return minimum_distance_from_point_to_triangle
+             (
+                     point.x,       point.y,
+               triangle[0].x, triangle[0].y,
+               triangle[1].x, triangle[1].y,
+               triangle[2].x, triangle[2].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_rectangle(const T& px, const T& py,
+                                                     const T& x1, const T& y1,
+                                                     const T& x2, const T& y2)
+   {
+      T nx = T(0.0);
+      T ny = T(0.0);
+
+      closest_point_on_rectangle_from_point(x1,y1,x2,y2,px,py,nx,ny);
+
+      return distance(px,py,nx,ny);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T minimum_distance_from_point_to_rectangle(const point2d<T>& point, const rectangle<T>& rectangle)
+   {
+      return minimum_distance_from_point_to_rectangle(rectangle[0].x, rectangle[0].y,
+                                                      rectangle[1].x, rectangle[1].y,
+                                                             point.x,        point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const segment<T,2>& segment)
+   {
+      return distance(closest_point_on_segment_from_point(segment,point),point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const curve_point<T,2>& point1, const curve_point<T,2>& point2)
+   {
+      return distance(point1().x,point1().y,point2().x,point2().y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const curve_point<T,3>& point1, const curve_point<T,3>& point2)
+   {
+      return distance(point1().x,point1().y,point1().z,point2().x,point2().y,point2().z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point3d<T>& point, const segment<T,3>& segment)
+   {
+      return distance(closest_point_on_segment_from_point(segment,point),point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const rectangle<T>& rectangle)
+   {
+      return distance(closest_point_on_rectangle_from_point(rectangle,point),point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return distance(closest_point_on_triangle_from_point(triangle,point),point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const quadix<T,2>& quadix)
+   {
+      return sqrt(lay_distance(point,quadix));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const ray<T,2>& ray)
+   {
+      return distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point3d<T>& point, const ray<T,3>& ray)
+   {
+      return distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point3d<T>& point, const plane<T,3>& plane)
+   {
+      return (plane.normal.x * point.x + plane.normal.y * point.y + plane.normal.z * point.z ) - plane.constant;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const line<T,2>& line1, const line<T,2>& line2)
+   {
+      return distance_line_to_line(line1[0].x, line1[0].y,
+                                   line1[1].x, line1[1].y,
+                                   line2[0].x, line2[0].y,
+                                   line2[1].x, line2[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const line<T,3>& line1, const line<T,3>& line2)
+   {
+      return distance_line_to_line(line1[0].x, line1[0].y, line1[0].z,
+                                   line1[1].x, line1[1].y, line1[1].z,
+                                   line2[0].x, line2[0].y, line2[0].z,
+                                   line2[1].x, line2[1].y, line2[1].z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return distance_segment_to_segment
+             (
+               segment1[0].x, segment1[0].y,
+               segment1[1].x, segment1[1].y,
+               segment2[0].x, segment2[0].y,
+               segment2[1].x, segment2[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,3>& segment1, const segment<T,3>& segment2)
+   {
+      return distance_segment_to_segment
+             (
+               segment1[0].x, segment1[0].y, segment1[0].z,
+               segment1[1].x, segment1[1].y, segment1[1].z,
+               segment2[0].x, segment2[0].y, segment2[0].z,
+               segment2[1].x, segment2[1].y, segment2[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,2>& segment, const triangle<T,2>& triangle)
+   {
+      return sqrt(lay_distance(segment,triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,3>& segment, const triangle<T,3>& triangle)
+   {
+      return sqrt(lay_distance(segment,triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,2>& segment, const rectangle<T>& rectangle)
+   {
+      return min(min(distance(segment, edge(rectangle,0)), distance(segment, edge(rectangle,1))),
+                 min(distance(segment, edge(rectangle,2)), distance(segment, edge(rectangle,3))));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const segment<T,2>& segment, const circle<T>& circle)
+   {
+      return distance(closest_point_on_circle_from_segment(circle,segment),segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      T min_dist = min(minimum_distance_from_point_to_triangle(triangle1[0],triangle2),
+                       minimum_distance_from_point_to_triangle(triangle2[0],triangle1));
+
+      for (std::size_t i = 1; i < triangle<T,2>::PointCount; ++i)
+      {
+         if (is_equal(min_dist,T(0.0)))
+            return min_dist;
+
+         min_dist = min(min_dist,
+                       min(minimum_distance_from_point_to_triangle(triangle1[i],triangle2),
+                           minimum_distance_from_point_to_triangle(triangle2[i],triangle1)));
+      }
+
+      return min_dist;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const point2d<T>& point, const circle<T>& circle)
+   {
+      if (point_in_circle(point,circle))
+         return T(0.0);
+      else
+         return distance(point,closest_point_on_circle_from_point(circle,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      const T dist = distance(circle1.x, circle1.y, circle2.x, circle2.y);
+
+      if (dist > (circle1.radius + circle2.radius))
+         return (dist - (circle1.radius + circle2.radius));
+      else
+         return T(0.0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      const T dist = distance
+                     (
+                       sphere1.x, sphere1.y, sphere1.z,
+                       sphere2.x, sphere2.y, sphere2.z
+                     );
+
+      if (dist > (sphere1.radius + sphere2.radius))
+         return (dist - (sphere1.radius + sphere2.radius));
+      else
+         return T(0.0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return lay_distance(point,closest_point_on_triangle_from_point(triangle,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point2d<T>& point, const quadix<T,2>& quadix)
+   {
+      return lay_distance(point,closest_point_on_quadix_from_point(quadix,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point2d<T>& point, const ray<T,2>& ray)
+   {
+      return lay_distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const point3d<T>& point, const ray<T,3>& ray)
+   {
+      return lay_distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return lay_distance_segment_to_segment
+             (
+               segment1[0].x, segment1[0].y,
+               segment1[1].x, segment1[1].y,
+               segment2[0].x, segment2[0].y,
+               segment2[1].x, segment2[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,3>& segment1, const segment<T,3>& segment2)
+   {
+      return lay_distance_segment_to_segment
+             (
+               segment1[0].x, segment1[0].y, segment1[0].z,
+               segment1[1].x, segment1[1].y, segment1[1].z,
+               segment2[0].x, segment2[0].y, segment2[0].z,
+               segment2[1].x, segment2[1].y, segment2[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const line<T,3>& line1, const line<T,3>& line2)
+   {
+      return lay_distance_line_to_line
+             (
+               line1[0].x, line1[0].y, line1[0].z,
+               line1[1].x, line1[1].y, line1[1].z,
+               line2[0].x, line2[0].y, line2[0].z,
+               line2[1].x, line2[1].y, line2[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,2>& segment, const triangle<T,2>& triangle)
+   {
+      return min
+             (
+               min
+               (
+                 lay_distance_segment_to_segment
+                 (
+                    segment[0].x,  segment[0].y,
+                    segment[1].x,  segment[1].y,
+                   triangle[0].x, triangle[0].y,
+                   triangle[1].x, triangle[1].y
+                 ),
+                 lay_distance_segment_to_segment
+                 (
+                    segment[0].x, segment[0].y,
+                    segment[1].x, segment[1].y,
+                   triangle[1].x,triangle[1].y,
+                   triangle[2].x,triangle[2].y
+                 )
+               ),
+               lay_distance_segment_to_segment
+               (
+                  segment[0].x, segment[0].y,
+                  segment[1].x, segment[1].y,
+                 triangle[2].x,triangle[2].y,
+                 triangle[0].x,triangle[0].y
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance(const segment<T,3>& segment, const triangle<T,3>& triangle)
+   {
+      return min
+             (
+               min
+               (
+                 lay_distance_segment_to_segment( segment[0].x, segment[0].y, segment[0].z,
+                                                  segment[1].x, segment[1].y, segment[1].z,
+                                                 triangle[0].x,triangle[0].y,triangle[0].z,
+                                                 triangle[1].x,triangle[1].y,triangle[1].z),
+                 lay_distance_segment_to_segment( segment[0].x, segment[0].y, segment[0].z,
+                                                  segment[1].x, segment[1].y, segment[1].z,
+                                                 triangle[1].x,triangle[1].y,triangle[1].z,
+                                                 triangle[2].x,triangle[2].y,triangle[2].z)
+               ),
+               lay_distance_segment_to_segment( segment[0].x, segment[0].y,  segment[0].z,
+                                                segment[1].x, segment[1].y,  segment[1].z,
+                                               triangle[2].x,triangle[2].y, triangle[2].z,
+                                               triangle[0].x,triangle[0].y, triangle[0].z)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      return abs(x2 - x1) + abs(y2 - y1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      return abs(x2 - x1) + abs(y2 - y1) + abs(z2 - z1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return manhattan_distance(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return manhattan_distance(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const point2d<T>& point, const ray<T,2>& ray)
+   {
+      return manhattan_distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const point3d<T>& point, const ray<T,3>& ray)
+   {
+      return manhattan_distance(point,closest_point_on_ray_from_point(ray,point));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const segment<T,2>& segment)
+   {
+      return manhattan_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const segment<T,3>& segment)
+   {
+      return manhattan_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T manhattan_distance(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return manhattan_distance(circle1.x,circle1.y,circle2.x,circle2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      return max(abs(x2 - x1), abs(y2 - y1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      return max(max(abs(x2 - x1), abs(y2 - y1)), abs(z2 - z1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return chebyshev_distance(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return chebyshev_distance(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const segment<T,2>& segment)
+   {
+      return chebyshev_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const segment<T,3>& segment)
+   {
+      return chebyshev_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T chebyshev_distance(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return chebyshev_distance(circle1.x,circle1.y,circle2.x,circle2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      return min(abs(x2 - x1),abs(y2 - y1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      return min(min(abs(x2 - x1), abs(y2 - y1)), abs(z2 - z1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return inverse_chebyshev_distance(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return inverse_chebyshev_distance(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const segment<T,2>& segment)
+   {
+      return inverse_chebyshev_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const segment<T,3>& segment)
+   {
+      return inverse_chebyshev_distance(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T inverse_chebyshev_distance(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return inverse_chebyshev_distance(circle1.x,circle1.y,circle2.x,circle2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_segment_to_segment(const T& x1, const T& y1,
+                                        const T& x2, const T& y2,
+                                        const T& x3, const T& y3,
+                                        const T& x4, const T& y4)
+   {
+      return sqrt(lay_distance_segment_to_segment(x1,y1,x2,y2,x3,y3,x4,y4));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_segment_to_segment(const T& x1, const T& y1, const T& z1,
+                                        const T& x2, const T& y2, const T& z2,
+                                        const T& x3, const T& y3, const T& z3,
+                                        const T& x4, const T& y4, const T& z4)
+   {
+      return sqrt(lay_distance_segment_to_segment(x1,y1,z1,x2,y2,z2,x3,y3,z3,x4,y4,z4));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_segment_to_segment(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& x3, const T& y3,
+                                            const T& x4, const T& y4)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+
+      const T a  = (ux * ux + uy * uy);
+      const T b  = (ux * vx + uy * vy);
+      const T c  = (vx * vx + vy * vy);
+      const T d  = (ux * wx + uy * wy);
+      const T e  = (vx * wx + vy * wy);
+      const T dt = a * c - b * b;
+
+      T sc = T(0.0);
+      T sn = T(0.0);
+      T tc = T(0.0);
+      T tn = T(0.0);
+      T sd = dt;
+      T td = dt;
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sn = T(0.0);
+         sd = T(1.0);
+         tn = e;
+         td = c;
+      }
+      else
+      {
+         sn = (b * e - c * d);
+         tn = (a * e - b * d);
+
+         if (sn < T(0.0))
+         {
+            sn = T(0.0);
+            tn = e;
+            td = c;
+         }
+         else if (sn > sd)
+         {
+            sn = sd;
+            tn = e + b;
+            td = c;
+         }
+      }
+
+      if (tn < T(0.0))
+      {
+         tn = T(0.0);
+
+         if (-d < T(0.0))
+            sn = T(0.0);
+         else if (-d > a)
+            sn = sd;
+         else
+         {
+            sn = -d;
+            sd = a;
+         }
+      }
+      else if (tn > td)
+      {
+         tn = td;
+
+         if ((-d + b) < T(0.0))
+            sn = T(0.0);
+         else if ((-d + b) > a)
+            sn = sd;
+         else
+         {
+            sn = (-d + b);
+            sd = a;
+         }
+      }
+
+      if (is_equal(sn,T(0.0)))
+         sc = T(0.0);
+      else
+         sc = sn / sd;
+
+      if (is_equal(tn,T(0.0)))
+         tc = T(0.0);
+      else
+         tc = tn / td;
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+
+      return dx * dx + dy * dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_segment_to_segment(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3,
+                                            const T& x4, const T& y4, const T& z4)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+      const T uz = z2 - z1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+      const T vz = z4 - z3;
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+      const T wz = z1 - z3;
+
+      const T a  = (ux * ux + uy * uy + uz * uz);
+      const T b  = (ux * vx + uy * vy + uz * vz);
+      const T c  = (vx * vx + vy * vy + vz * vz);
+      const T d  = (ux * wx + uy * wy + uz * wz);
+      const T e  = (vx * wx + vy * wy + vz * wz);
+      const T dt = a * c - b * b;
+
+      T sd = dt;
+      T td = dt;
+
+      T sn = T(0.0);
+      T tn = T(0.0);
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sn = T(0.0);
+         sd = T(1.00);
+         tn = e;
+         td = c;
+      }
+      else
+      {
+         sn = (b * e - c * d);
+         tn = (a * e - b * d);
+
+         if (sn < T(0.0))
+         {
+            sn = T(0.0);
+            tn = e;
+            td = c;
+         }
+         else if (sn > sd)
+         {
+            sn = sd;
+            tn = e + b;
+            td = c;
+         }
+      }
+
+      if (tn < T(0.0))
+      {
+         tn = T(0.0);
+
+         if (-d < T(0.0))
+            sn = T(0.0);
+         else if (-d > a)
+            sn = sd;
+         else
+         {
+            sn = -d;
+            sd = a;
+         }
+      }
+      else if (tn > td)
+      {
+         tn = td;
+
+         if ((-d + b) < T(0.0))
+            sn = T(0.0);
+         else if ((-d + b) > a)
+            sn = sd;
+         else
+         {
+            sn = (-d + b);
+            sd = a;
+         }
+      }
+
+      T sc = T(0.0);
+      T tc = T(0.0);
+
+      if (is_equal(sn,T(0.0)))
+         sc = T(0.0);
+      else
+         sc = sn / sd;
+
+      if (is_equal(tn,T(0.0)))
+         tc = T(0.0);
+      else
+         tc = tn / td;
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+      const T dz = wz + (sc * uz) - (tc * vz);
+
+      return (dx * dx) + (dy * dy) + (dz * dz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_line_to_line(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const T& x4, const T& y4)
+   {
+      return sqrt(lay_distance_line_to_line(x1, y1, x2, y2, x3, y3, x4, y4));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_line_to_line(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4)
+   {
+      return sqrt(lay_distance_line_to_line(x1, y1, z1, x2, y2, z2,
+                                            x3, y3, z3, x4, y4, z4));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_line_to_line(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3,
+                                      const T& x4, const T& y4)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+
+      if (not_equal(ux * vy, uy * vx))
+      {
+         return T(0.0);
+      }
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+
+      const T a  = (ux * ux + uy * uy);
+      const T b  = (ux * vx + uy * vy);
+      const T c  = (vx * vx + vy * vy);
+      const T d  = (ux * wx + uy * wy);
+      const T e  = (vx * wx + vy * wy);
+      const T dt = a * c - b * b;
+
+      T sc = T(0.0);
+      T tc = T(0.0);
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sc = T(0.0);
+
+         if (b > c)
+            tc = d / b;
+         else
+            tc = e / c;
+      }
+      else
+      {
+         sc = (b * e - c * d) / dt;
+         tc = (a * e - b * d) / dt;
+      }
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+
+      return dx * dx + dy * dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_line_to_line(const T& x1, const T& y1, const T& z1,
+                                      const T& x2, const T& y2, const T& z2,
+                                      const T& x3, const T& y3, const T& z3,
+                                      const T& x4, const T& y4, const T& z4)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+      const T uz = z2 - z1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+      const T vz = z4 - z3;
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+      const T wz = z1 - z3;
+
+      const T a  = (ux * ux + uy * uy + uz * uz);
+      const T b  = (ux * vx + uy * vy + uz * vz);
+      const T c  = (vx * vx + vy * vy + vz * vz);
+      const T d  = (ux * wx + uy * wy + uz * wz);
+      const T e  = (vx * wx + vy * wy + vz * wz);
+      const T dt = a * c - b * b;
+
+      T sc = T(0.0);
+      T tc = T(0.0);
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sc = T(0.0);
+
+         if (b > c )
+            tc = d / b;
+         else
+            tc = e / c;
+      }
+      else
+      {
+         sc = (b * e - c * d) / dt;
+         tc = (a * e - b * d) / dt;
+      }
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+      const T dz = wz + (sc * uz) - (tc * vz);
+
+      return (dx * dx) + (dy * dy) + (dz * dz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_from_point_to_circle_center(const point2d<T>& point, const circle<T>& circle)
+   {
+      return lay_distance(point.x,point.y,circle.x,circle.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T lay_distance_from_point_to_sphere_center(const point3d<T>& point, const sphere<T>& sphere)
+   {
+      return lay_distance(point.x,point.y,point.z,sphere.x,sphere.y,sphere.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_from_point_to_circle_center(const point2d<T>& point, const circle<T>& circle)
+   {
+      return sqrt(lay_distance_from_point_to_circle_center(point,circle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance_from_point_to_sphere_center(const point3d<T>& point, const sphere<T>& sphere)
+   {
+      return sqrt(lay_distance_from_point_to_sphere_center(point,sphere));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T span_length(const rectangle<T>& rect)
+   {
+      return distance(rect[0],rect[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T span_length(const box<T,3>& box)
+   {
+      return distance(box[0],box[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point_t(const T&  srcx, const T&  srcy,
+                               const T& destx, const T& desty,
+                               const T& t,
+                               T& nx, T& ny)
+   {
+      nx = srcx + t * (destx - srcx);
+      ny = srcy + t * (desty - srcy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point_t(const T&  srcx, const T&  srcy, const T&  srcz,
+                               const T& destx, const T& desty, const T& destz,
+                               const T& t,
+                               T& nx, T& ny, T& nz)
+   {
+      nx = srcx + t * (destx - srcx);
+      ny = srcy + t * (desty - srcy);
+      nz = srcz + t * (destz - srcz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T&  srcx, const T&  srcy,
+                             const T& destx, const T& desty,
+                             const T& dist,
+                             T& nx, T& ny)
+   {
+      project_point_t
+      (
+        srcx,  srcy,
+        destx, desty,
+        dist / distance(srcx, srcy, destx, desty),
+        nx, ny
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T&  srcx, const T&  srcy, const T&  srcz,
+                             const T& destx, const T& desty, const T& destz,
+                             const T& dist,
+                             T& nx, T& ny, T& nz)
+   {
+      project_point_t
+      (
+        srcx,  srcy,  srcz,
+        destx, desty, destz,
+        dist / distance(srcx, srcy, srcz, destx, desty, destz),
+        nx, ny, nz
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point(const T& px, const T& py, const T& angle, const T& distance, T& nx, T& ny)
+   {
+      T dx = T(0.0);
+      T dy = T(0.0);
+
+      switch (quadrant(angle))
+      {
+         case 1 : {
+                     dx = T(cos(angle * T(PIDiv180))) * distance;
+                     dy = T(sin(angle * T(PIDiv180))) * distance;
+                  }
+                  break;
+
+         case 2 : {
+                     dx = T(sin((angle - T(90.0)) * T(PIDiv180))) * distance * T(-1.0);
+                     dy = T(cos((angle - T(90.0)) * T(PIDiv180))) * distance;
+                  }
+                  break;
+
+         case 3 : {
+                     dx = T(cos((angle - T(180.0)) * T(PIDiv180))) * distance * T(-1.0);
+                     dy = T(sin((angle - T(180.0)) * T(PIDiv180))) * distance * T(-1.0);
+                  }
+                  break;
+
+         case 4 : {
+                     dx = T(sin((angle - T(270.0)) * T(PIDiv180))) * distance;
+                     dy = T(cos((angle - T(270.0)) * T(PIDiv180))) * distance * T(-1.0);
+                  }
+                  break;
+      }
+
+      nx = px + dx;
+      ny = py + dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point0(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px + distance;
+      ny = py;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point45(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px + T(0.70710678118654752440084436210485) * distance;
+      ny = py + T(0.70710678118654752440084436210485) * distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point90(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px;
+      ny = py + distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point135(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px - T(0.70710678118654752440084436210485) * distance;
+      ny = py + T(0.70710678118654752440084436210485) * distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point180(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px - distance;
+      ny = py;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point225(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px - T(0.70710678118654752440084436210485) * distance;
+      ny = py - T(0.70710678118654752440084436210485) * distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point270(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px;
+      ny = py - distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_point315(const T& px, const T& py, const T& distance, T& nx, T& ny)
+   {
+      nx = px + T(0.70710678118654752440084436210485) * distance;
+      ny = py - T(0.70710678118654752440084436210485) * distance;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point_t(const point2d<T>& source_point,
+                                     const point2d<T>& destination_point,
+                                     const T& t)
+   {
+      point2d<T> point_;
+
+      project_point_t
+      (
+        source_point     .x, source_point     .y,
+        destination_point.x, destination_point.y,
+        t,
+        point_           .x,point_            .y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> project_point_t(const point3d<T>& source_point,
+                                     const point3d<T>& destination_point,
+                                     const T& t)
+   {
+      point3d<T> point_;
+
+      project_point_t
+      (
+        source_point     .x, source_point     .y, source_point     .z,
+        destination_point.x, destination_point.y, destination_point.z,
+        t,
+        point_           .x, point_           .y, point_           .z
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point(const point2d<T>& source_point,
+                                   const point2d<T>& destination_point,
+                                   const T& distance)
+   {
+      point2d<T> point_;
+
+      project_point
+      (
+        source_point     .x, source_point    .y,
+        destination_point.x,destination_point.y,
+        distance,
+        point_           .x,point_           .y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> project_point(const point3d<T>& source_point,
+                                   const point3d<T>& destination_point,
+                                   const T& distance)
+   {
+      point3d<T> point_;
+
+      project_point
+      (
+        source_point     .x, source_point     .y, source_point     .z,
+        destination_point.x, destination_point.y, destination_point.z,
+        distance,
+        point_           .x, point_           .y, point_           .z
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point(const point2d<T>& point,
+                                   const T& angle,
+                                   const T& distance)
+   {
+      point2d<T> point_;
+      project_point(point.x, point.y, angle, distance, point_.x, point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point0(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point0(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point45(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point45(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point90(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point90(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point135(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point135(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point180(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point180(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point225(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point225(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point270(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point270(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_point315(const point2d<T>& point, const T& distance)
+   {
+      point2d<T> point_;
+      project_point315(point.x,point.y,distance,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> project_object(const point2d<T>& point, const T& angle, const T& distance)
+   {
+      return project_point(point,angle,distance);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_object(const segment<T,2>& segment, const T& angle, const T& distance)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = project_point(segment[i],angle,distance);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> project_object(const triangle<T,2>& triangle, const T& angle, const T& distance)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = project_point(triangle[i],angle,distance);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> project_object(const quadix<T,2>& quadix, const T& angle, const T& distance)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = project_point(quadix[i],angle,distance);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> project_object(const circle<T>& circle, const T& angle, const T& distance)
+   {
+      wykobi::circle<T> circle_ = circle;
+      project_point(circle.x,circle.y,angle,distance,circle_.x,circle_.y);
+      return circle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> project_object(const polygon<T,2>& polygon, const T& angle, const T& distance)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(project_point(polygon[i],angle,distance));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const point2d<T>& point, const line<T,2>& axis)
+   {
+      wykobi::point2d<T> point_ = closest_point_on_line_from_point(axis,point);
+      return make_segment(point_,point_);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const triangle<T,2>& triangle, const line<T,2>& axis)
+   {
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(3);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,triangle[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const rectangle<T>& rectangle, const line<T,2>& axis)
+   {
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(4);
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(rectangle[0].x,rectangle[0].y)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(rectangle[1].x,rectangle[0].y)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(rectangle[1].x,rectangle[1].y)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(rectangle[0].x,rectangle[1].y)));
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const quadix<T,2>& quadix, const line<T,2>& axis)
+   {
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(4);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,quadix[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const circle<T>& circle, const line<T,2>& axis)
+   {
+      vector2d<T> v = normalize(axis[0] - axis[1]);
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(3);
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(circle.x,circle.y)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(point_list.front().x + (v.x * circle.radius),
+                                                                            point_list.front().y + (v.y * circle.radius))));
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(point_list.front().x - (v.x * circle.radius),
+                                                                            point_list.front().y - (v.y * circle.radius))));
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const polygon<T,2>& polygon, const line<T,2>& axis)
+   {
+      if (polygon.size() == 0)
+         return degenerate_segment2d<T>();
+
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,polygon[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const point3d<T>& point, const line<T,3>& axis)
+   {
+      wykobi::point3d<T> point_ = closest_point_on_line_from_point(axis,point);
+      return make_segment(point_,point_);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const triangle<T,3>& triangle, const line<T,3>& axis)
+   {
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(3);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,triangle[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const box<T,3>& box, const line<T,3>& axis)
+   {
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(8);
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[0].x,box[0].y,box[0].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[1].x,box[0].y,box[0].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[1].x,box[1].y,box[0].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[0].x,box[1].y,box[0].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[0].x,box[0].y,box[1].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[1].x,box[0].y,box[1].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[1].x,box[1].y,box[1].z)));
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(box[0].x,box[1].y,box[1].z)));
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const quadix<T,3>& quadix, const line<T,3>& axis)
+   {
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(4);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,quadix[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const sphere<T>& sphere, const line<T,3>& axis)
+   {
+      vector3d<T> v = normalize(axis[0] - axis[1]);
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(3);
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(sphere.x,sphere.y,sphere.z)));
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(point_list.front().x + (v.x * sphere.radius),
+                                                                            point_list.front().y + (v.y * sphere.radius),
+                                                                            point_list.front().z + (v.z * sphere.radius))));
+
+      point_list.push_back(closest_point_on_line_from_point(axis,make_point(point_list.front().x - (v.x * sphere.radius),
+                                                                            point_list.front().y - (v.y * sphere.radius),
+                                                                            point_list.front().z - (v.z * sphere.radius))));
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const polygon<T,3>& polygon, const line<T,3>& axis)
+   {
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,polygon[i]));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> project_onto_axis(const obb<T,2>& obb, const line<T,2>& axis)
+   {
+      std::vector< point2d<T> > point_list;
+
+      point_list.reserve(4);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,obb_corner(obb,i)));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> project_onto_axis(const obb<T,3>& obb, const line<T,3>& axis)
+   {
+      std::vector< point3d<T> > point_list;
+
+      point_list.reserve(8);
+
+      for (std::size_t i = 0; i < 8; ++i)
+      {
+         point_list.push_back(closest_point_on_line_from_point(axis,obb_corner(obb,i)));
+      }
+
+      std::sort(point_list.begin(),point_list.end());
+
+      return make_segment(point_list.front(),point_list.back());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const point2d<T>& point, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      min_value = (point.x * axis.x) + (point.y * axis.y);
+      max_value = min_value;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const triangle<T,2>& triangle, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      project_onto_axis(triangle[0],axis,min_value,max_value);
+
+      for (std::size_t i = 1; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         const T value = (triangle[i].x * axis.x) + (triangle[i].y * axis.y);
+
+         if (value < min_value)
+            min_value = value;
+         else if (value > max_value)
+            max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const rectangle<T>& rectangle, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = T(0.5) * (((rectangle[0].x + rectangle[1].x) * axis.x) + ((rectangle[0].y + rectangle[1].y) * axis.y));
+      const T radius = T(0.5) * ((abs(rectangle[1].x - rectangle[0].x) * abs(axis.x)) + (abs(rectangle[1].y - rectangle[0].y) * abs(axis.y)));
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const quadix<T,2>& quadix, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      project_onto_axis(quadix[0],axis,min_value,max_value);
+
+      for (std::size_t i = 1; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         const T value = (quadix[i].x * axis.x) + (quadix[i].y * axis.y);
+
+         if (value < min_value)
+            min_value = value;
+         else if (value > max_value)
+            max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const circle<T>& circle, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = (circle.x * axis.x) + (circle.y * axis.y);
+      const T radius = circle.radius * vector_norm(axis);
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const polygon<T,2>& polygon, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      min_value = +infinity<T>();
+      max_value = -infinity<T>();
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         const T value = (polygon[i].x * axis.x) + (polygon[i].y * axis.y);
+
+         if (value < min_value) min_value = value;
+         if (value > max_value) max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const obb<T,2>& obb, const vector2d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = (obb.center.x * axis.x) + (obb.center.y * axis.y);
+      const T radius = (obb.half_length[0] * abs(dot_product(obb.axis[0],axis))) +
+                       (obb.half_length[1] * abs(dot_product(obb.axis[1],axis)));
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const point3d<T>& point, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      min_value = (point.x * axis.x) + (point.y * axis.y) + (point.z * axis.z);
+      max_value = min_value;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const triangle<T,3>& triangle, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      project_onto_axis(triangle[0],axis,min_value,max_value);
+
+      for (std::size_t i = 1; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         const T value = (triangle[i].x * axis.x) + (triangle[i].y * axis.y) + (triangle[i].z * axis.z);
+
+         if (value < min_value)
+            min_value = value;
+         else if (value > max_value)
+            max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const box<T,3>& box, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = T(0.5) * (((box[0].x + box[1].x) * axis.x) +
+                                 ((box[0].y + box[1].y) * axis.y) +
+                                 ((box[0].z + box[1].z) * axis.z));
+
+      const T radius = T(0.5) * ((abs(box[1].x - box[0].x) * abs(axis.x)) +
+                                 (abs(box[1].y - box[0].y) * abs(axis.y)) +
+                                 (abs(box[1].z - box[0].z) * abs(axis.z)));
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const quadix<T,3>& quadix, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      project_onto_axis(quadix[0],axis,min_value,max_value);
+
+      for (std::size_t i = 1; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         const T value = (quadix[i].x * axis.x) + (quadix[i].y * axis.y) + (quadix[i].z * axis.z);
+
+         if (value < min_value)
+            min_value = value;
+         else if (value > max_value)
+            max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const sphere<T>& sphere, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = (sphere.x * axis.x) + (sphere.y * axis.y) + (sphere.z * axis.z);
+      const T radius = sphere.radius * vector_norm(axis);
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const polygon<T,3>& polygon, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      min_value = +infinity<T>();
+      max_value = -infinity<T>();
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         const T value = (polygon[i].x * axis.x) + (polygon[i].y * axis.y) + (polygon[i].z * axis.z);
+
+         if (value < min_value) min_value = value;
+         if (value > max_value) max_value = value;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void project_onto_axis(const obb<T,3>& obb, const vector3d<T>& axis, T& min_value, T& max_value)
+   {
+      const T center = (obb.center.x * axis.x) + (obb.center.y * axis.y) + (obb.center.z * axis.z);
+      const T radius = (obb.half_length[0] * abs(dot_product(obb.axis[0],axis))) +
+                       (obb.half_length[1] * abs(dot_product(obb.axis[1],axis))) +
+                       (obb.half_length[2] * abs(dot_product(obb.axis[2],axis)));
+
+      min_value = center - radius;
+      max_value = center + radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> make_ray(const point2d<T>& origin, const T& bearing)
+   {
+      return make_ray(origin,make_vector(project_point<T>(make_point(T(0.0),T(0.0)),bearing,T(1.0))));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return make_circle
+             (
+               (point1.x + point2.x)   * T(0.5),
+               (point1.y + point2.y)   * T(0.5),
+               distance(point1,point2) * T(0.5)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> make_sphere(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return make_sphere
+             (
+               (point1.x + point2.x)   * T(0.5),
+               (point1.y + point2.y)   * T(0.5),
+               (point1.z + point2.z)   * T(0.5),
+               distance(point1,point2) * T(0.5)
+             );
+   }
+
+} // wykobi namespace
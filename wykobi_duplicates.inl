@@ -20,6 +20,14 @@
 
 #include "wykobi.hpp"
 #include "wykobi_algorithm.hpp"
+#include "wykobi_execution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <vector>
 
 
 namespace wykobi
@@ -34,6 +42,9 @@ namespace wykobi
          template <typename InputIterator, typename OutputIterator>
          remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out)
          {
+            if (begin == end)
+               return;
+
             std::sort(begin,end);
 
             T previous = (*begin);
@@ -50,6 +61,513 @@ namespace wykobi
          }
       };
 
+      namespace detail
+      {
+         /*
+            Spatial hash of the distinct points seen so far, bucketed on
+            cells of side cell_scale x tolerance. A point within tolerance
+            (per coordinate, as is_equal) of a stored point lies in the
+            same cell, or in the adjacent cell along those axes where it
+            is closer than tolerance to the cell boundary, so most lookups
+            probe a single cell. A zero tolerance hashes the coordinates
+            themselves. Integer coordinates are located by exact floor
+            division, as truncating division and fractional thresholds
+            both misplace them.
+         */
+         template <typename T, std::size_t Dimension, typename PointType>
+         class point_hash_grid
+         {
+         public:
+
+            static const std::size_t npos = static_cast<std::size_t>(-1);
+
+            point_hash_grid(const T& tolerance)
+            : tolerance_(tolerance),
+              bucket_(64,npos)
+            {}
+
+            inline std::size_t size() const { return point_.size(); }
+
+            inline void reserve(const std::size_t& count)
+            {
+               point_.reserve(count);
+               entry_.reserve(count);
+
+               std::size_t bucket_count = bucket_.size();
+
+               while (bucket_count < (2 * count))
+               {
+                  bucket_count *= 2;
+               }
+
+               if (bucket_count > bucket_.size())
+               {
+                  rehash(bucket_count);
+               }
+            }
+
+            /* Index of the earliest stored point matching point, storing point first if there is none. */
+            inline std::size_t insert(const PointType& point)
+            {
+               T   cell[Dimension];
+               int side[Dimension];
+
+               locate(point,cell,side);
+
+               const std::size_t cell_hash = hash(cell);
+               const std::size_t match     = find(point,cell,cell_hash,side);
+
+               if (npos != match)
+                  return match;
+
+               if ((2 * (point_.size() + 1)) > bucket_.size())
+               {
+                  rehash(2 * bucket_.size());
+               }
+
+               const std::size_t index  = point_.size();
+               const std::size_t bucket = cell_hash & (bucket_.size() - 1);
+
+               point_.push_back(point);
+               entry_.push_back(entry(bucket_[bucket],cell_hash));
+               bucket_[bucket] = index;
+
+               return index;
+            }
+
+         private:
+
+            /* Chain link and full cell hash, the hash rejects other cells without touching their points. */
+            struct entry
+            {
+               entry(const std::size_t& n, const std::size_t& h) : next(n), hash(h) {}
+
+               std::size_t next;
+               std::size_t hash;
+            };
+
+            /*
+               Cells are a few tolerances wide so that a point is near at
+               most one boundary per axis. The near threshold is widened
+               slightly beyond 1 / cell_scale to absorb rounding.
+            */
+            static inline T cell_scale    () { return T(4);   }
+            static inline T near_threshold() { return T(0.3); }
+
+            template <bool Integer> struct integer_tag {};
+
+            inline void locate(const PointType& point, T* cell, int* side) const
+            {
+               for (std::size_t k = 0; k < Dimension; ++k)
+               {
+                  if (tolerance_ > T(0))
+                  {
+                     locate(point[k],cell[k],side[k],integer_tag<std::numeric_limits<T>::is_integer>());
+                  }
+                  else
+                  {
+                     cell[k] = point[k] + T(0);
+                     side[k] = 0;
+                  }
+               }
+            }
+
+            inline void locate(const T& value, T& cell, int& side, integer_tag<false>) const
+            {
+               const T scaled = value / (cell_scale() * tolerance_);
+               cell = T(std::floor(scaled)) + T(0);
+
+               const T fraction = scaled - cell;
+
+               side = (fraction < near_threshold()) ? -1 : ((fraction > (T(1) - near_threshold())) ? 1 : 0);
+            }
+
+            /*
+               Floor division with the remainder in [0,width). Values within
+               tolerance can lie in the cell below only if remainder is less
+               than tolerance, and in the cell above only if width - remainder
+               is at most tolerance.
+            */
+            inline void locate(const T& value, T& cell, int& side, integer_tag<true>) const
+            {
+               const T width     = cell_scale() * tolerance_;
+                     T quotient  = value / width;
+                     T remainder = value % width;
+
+               if (remainder < T(0))
+               {
+                  --quotient;
+                  remainder += width;
+               }
+
+               cell = quotient;
+               side = (remainder < tolerance_) ? -1 : (((width - remainder) <= tolerance_) ? 1 : 0);
+            }
+
+            inline std::size_t find(const PointType& point, const T* cell, const std::size_t& cell_hash, const int* side) const
+            {
+               T probe[Dimension];
+               std::size_t match = npos;
+
+               /* Bit k of the mask selects the neighbouring cell along axis k. */
+               for (std::size_t mask = 0; mask < (std::size_t(1) << Dimension); ++mask)
+               {
+                  bool valid = true;
+
+                  for (std::size_t k = 0; k < Dimension; ++k)
+                  {
+                     if (0 == (mask & (std::size_t(1) << k)))
+                        probe[k] = cell[k];
+                     else if (0 != side[k])
+                        probe[k] = cell[k] + T(side[k]);
+                     else
+                     {
+                        valid = false;
+                        break;
+                     }
+                  }
+
+                  if (!valid)
+                     continue;
+
+                  const std::size_t probe_hash = (0 == mask) ? cell_hash : hash(probe);
+
+                  for (std::size_t i = bucket_[probe_hash & (bucket_.size() - 1)]; i != npos; i = entry_[i].next)
+                  {
+                     if ((i < match) && (probe_hash == entry_[i].hash) && within_tolerance(point_[i],point))
+                        match = i;
+                  }
+               }
+
+               return match;
+            }
+
+            inline bool within_tolerance(const PointType& point1, const PointType& point2) const
+            {
+               for (std::size_t k = 0; k < Dimension; ++k)
+               {
+                  const T diff = point1[k] - point2[k];
+
+                  if (!((-tolerance_ <= diff) && (diff <= tolerance_)))
+                     return false;
+               }
+
+               return true;
+            }
+
+            static inline std::size_t hash(const T* cell)
+            {
+               std::size_t result = 0;
+
+               for (std::size_t k = 0; k < Dimension; ++k)
+               {
+                  std::size_t word[(sizeof(T) + sizeof(std::size_t) - 1) / sizeof(std::size_t)] = { 0 };
+                  std::memcpy(word,&cell[k],sizeof(T));
+
+                  for (std::size_t i = 0; i < (sizeof(word) / sizeof(std::size_t)); ++i)
+                  {
+                     result ^= word[i] + 0x9E3779B9 + (result << 6) + (result >> 2);
+                  }
+               }
+
+               /* Spread the high bits into the masked low bits. */
+               result ^= (result >> 16);
+               result *= 0x45D9F3B;
+               result ^= (result >> 16);
+
+               return result;
+            }
+
+            inline void rehash(const std::size_t& bucket_count)
+            {
+               bucket_.assign(bucket_count,npos);
+
+               for (std::size_t i = 0; i < entry_.size(); ++i)
+               {
+                  const std::size_t bucket = entry_[i].hash & (bucket_count - 1);
+                  entry_[i].next  = bucket_[bucket];
+                  bucket_[bucket] = i;
+               }
+            }
+
+            T                        tolerance_;
+            std::vector<PointType>   point_;
+            std::vector<entry>       entry_;
+            std::vector<std::size_t> bucket_;
+         };
+
+         template <typename T, std::size_t Dimension, typename PointType>
+         const std::size_t point_hash_grid<T,Dimension,PointType>::npos;
+
+         /* Input size when it can be known without consuming the range. */
+         template <typename InputIterator>
+         inline std::size_t size_hint(InputIterator, InputIterator, std::input_iterator_tag)
+         {
+            return 0;
+         }
+
+         template <typename ForwardIterator>
+         inline std::size_t size_hint(ForwardIterator begin, ForwardIterator end, std::forward_iterator_tag)
+         {
+            return static_cast<std::size_t>(std::distance(begin,end));
+         }
+
+         template <typename T, std::size_t Dimension, typename PointType, typename InputIterator, typename OutputIterator>
+         inline void remove_point_duplicates(InputIterator begin, InputIterator end, OutputIterator out,
+                                             std::vector<std::size_t>* index_map, const T& tolerance)
+         {
+            point_hash_grid<T,Dimension,PointType> grid(tolerance);
+
+            grid.reserve(size_hint(begin,end,typename std::iterator_traits<InputIterator>::iterator_category()));
+
+            if (0 != index_map)
+            {
+               index_map->clear();
+            }
+
+            for (InputIterator it = begin; it != end; ++it)
+            {
+               const std::size_t count = grid.size();
+               const std::size_t index = grid.insert(*it);
+
+               if (index == count)
+               {
+                  (*out++) = (*it);
+               }
+
+               if (0 != index_map)
+               {
+                  index_map->push_back(index);
+               }
+            }
+         }
+
+         /*
+            First pass of the policy driven version: each block folds its
+            exact duplicates, recording its distinct values (as input
+            positions) and for every point the block local index of the
+            first occurrence of its value. An exact duplicate always meets
+            the same fate as that first occurrence in the sequential
+            version, so dropping it here cannot change the result.
+         */
+         template <typename T, std::size_t Dimension, typename PointType, typename RandomAccessIterator>
+         class point_duplicates_block
+         {
+         public:
+
+            point_duplicates_block(const RandomAccessIterator& begin,
+                                   std::vector<std::size_t>& index,
+                                   std::vector< std::vector<std::size_t> >& distinct)
+            : begin_(begin),
+              index_(index),
+              distinct_(distinct)
+            {}
+
+            inline void operator()(const std::size_t& block, const std::size_t& first, const std::size_t& last)
+            {
+               point_hash_grid<T,Dimension,PointType> grid(T(0));
+
+               grid.reserve(last - first);
+
+               for (std::size_t i = first; i < last; ++i)
+               {
+                  const std::size_t count = grid.size();
+
+                  index_[i] = grid.insert(begin_[i]);
+
+                  if (index_[i] == count)
+                  {
+                     distinct_[block].push_back(i);
+                  }
+               }
+            }
+
+         private:
+
+            point_duplicates_block& operator=(const point_duplicates_block&);
+
+            RandomAccessIterator                     begin_;
+            std::vector<std::size_t>&                index_;
+            std::vector< std::vector<std::size_t> >& distinct_;
+         };
+
+         /*
+            The distinct values of each block are then merged, by their own
+            coordinates and in input order, into a single grid with the
+            requested tolerance. That is the sequential version run over the
+            first occurrences only, so the output and index map are the same
+            as the sequential version's for any tolerance and thread count.
+         */
+         template <typename T, std::size_t Dimension, typename PointType, typename RandomAccessIterator, typename OutputIterator>
+         inline void remove_point_duplicates(const execution::policy& policy,
+                                             RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                                             std::vector<std::size_t>* index_map, const T& tolerance)
+         {
+            const std::size_t block_size = 1 << 14;
+            const std::size_t count      = static_cast<std::size_t>(std::distance(begin,end));
+
+            std::vector<std::size_t>                index(count);
+            std::vector< std::vector<std::size_t> > distinct(execution::block_count(count,block_size));
+
+            point_duplicates_block<T,Dimension,PointType,RandomAccessIterator> task(begin,index,distinct);
+            execution::for_each_block(policy,count,block_size,task);
+
+            point_hash_grid<T,Dimension,PointType> grid(tolerance);
+
+            std::size_t distinct_count = 0;
+
+            for (std::size_t i = 0; i < distinct.size(); ++i)
+            {
+               distinct_count += distinct[i].size();
+            }
+
+            grid.reserve(distinct_count);
+
+            std::vector<std::size_t> output_index;
+
+            for (std::size_t i = 0; i < distinct.size(); ++i)
+            {
+               output_index.resize(distinct[i].size());
+
+               for (std::size_t j = 0; j < distinct[i].size(); ++j)
+               {
+                  const std::size_t size = grid.size();
+
+                  output_index[j] = grid.insert(begin[distinct[i][j]]);
+
+                  if (output_index[j] == size)
+                  {
+                     (*out++) = begin[distinct[i][j]];
+                  }
+               }
+
+               if (0 != index_map)
+               {
+                  const std::size_t last = std::min(count,(i + 1) * block_size);
+
+                  for (std::size_t j = i * block_size; j < last; ++j)
+                  {
+                     index[j] = output_index[index[j]];
+                  }
+               }
+            }
+
+            if (0 != index_map)
+            {
+               index_map->swap(index);
+            }
+         }
+
+      } // namespace wykobi::algorithm::detail
+
+      /*
+         Point specialisations: the input range is left untouched (single
+         pass input iterators suffice) and the first occurrence of each
+         point is written in input order, in expected linear time. Points
+         equal within tolerance per coordinate to an already written point
+         are dropped. index_map, when given, receives for every input point
+         the output index of the point it was merged into. The policy driven
+         constructors take a random access range and reduce it in blocks.
+      */
+      template <typename T>
+      struct remove_duplicates< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,2,point2d<T> >(begin,end,out,0,tolerance);
+         }
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,2,point2d<T> >(begin,end,out,&index_map,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,2,point2d<T> >(policy,begin,end,out,0,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,2,point2d<T> >(policy,begin,end,out,&index_map,tolerance);
+         }
+      };
+
+      template <typename T>
+      struct remove_duplicates< point3d<T> >
+      {
+      public:
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,3,point3d<T> >(begin,end,out,0,tolerance);
+         }
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,3,point3d<T> >(begin,end,out,&index_map,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,3,point3d<T> >(policy,begin,end,out,0,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,3,point3d<T> >(policy,begin,end,out,&index_map,tolerance);
+         }
+      };
+
+      template <typename T, std::size_t Dimension>
+      struct remove_duplicates< pointnd<T,Dimension> >
+      {
+      public:
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,Dimension,pointnd<T,Dimension> >(begin,end,out,0,tolerance);
+         }
+
+         template <typename InputIterator, typename OutputIterator>
+         remove_duplicates(InputIterator begin, InputIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,Dimension,pointnd<T,Dimension> >(begin,end,out,&index_map,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,Dimension,pointnd<T,Dimension> >(policy,begin,end,out,0,tolerance);
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         remove_duplicates(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out,
+                           std::vector<std::size_t>& index_map, const T& tolerance = T(Epsilon))
+         {
+            detail::remove_point_duplicates<T,Dimension,pointnd<T,Dimension> >(policy,begin,end,out,&index_map,tolerance);
+         }
+      };
+
    } // namespace wykobi::algorithm
 
 } // namespace wykobi
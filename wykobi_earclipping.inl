@@ -33,8 +33,24 @@ namespace wykobi
       {
       public:
 
+         template <typename Allocator, typename OutputIterator>
+         polygon_triangulate(const polygon<T,2,Allocator>& polygon, OutputIterator out)
+         {
+            wykobi::polygon<T,2,Allocator> internal_polygon(polygon.get_allocator());
+            triangulate(polygon,internal_polygon,out);
+         }
+
          template <typename OutputIterator>
-         polygon_triangulate(const polygon<T,2>& polygon, OutputIterator out)
+         polygon_triangulate(const polygon_view<T,2>& polygon, OutputIterator out)
+         {
+            wykobi::polygon<T,2> internal_polygon;
+            triangulate(polygon,internal_polygon,out);
+         }
+
+      private:
+
+         template <typename InputPolygon, typename InternalPolygon, typename OutputIterator>
+         void triangulate(const InputPolygon& polygon, InternalPolygon& internal_polygon, OutputIterator out)
          {
             if (polygon.size() < 3)
                return;
@@ -44,8 +60,6 @@ namespace wykobi
                return;
             }
 
-            wykobi::polygon<T,2> internal_polygon;
-
             internal_polygon.reserve(polygon.size());
 
             std::copy(polygon.begin(),polygon.end(),std::back_inserter(internal_polygon));
@@ -0,0 +1,635 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_EXECUTION
+#define INCLUDE_WYKOBI_EXECUTION
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#if (__cplusplus >= 201103L)
+ #include <condition_variable>
+ #include <exception>
+ #include <memory>
+ #include <mutex>
+ #include <thread>
+ #define WYKOBI_EXECUTION_THREADS
+#endif
+
+#include "wykobi.hpp"
+
+
+namespace wykobi
+{
+   namespace execution
+   {
+      /*
+         Execution policy accepted by the data parallel routines. Work is
+         always cut into blocks of a fixed size chosen by the routine and
+         partial results are combined in block order, so a routine gives
+         the same result for every thread count, sequential included.
+         A thread count of zero uses every thread of the internal pool.
+         Without C++11 threads all policies run on the calling thread.
+      */
+      class policy
+      {
+      public:
+
+         explicit policy(const std::size_t& thread_count = 0)
+         : thread_count_(thread_count)
+         {}
+
+         inline std::size_t thread_count() const { return thread_count_; }
+
+      private:
+
+         std::size_t thread_count_;
+      };
+
+      const policy sequential(1);
+      const policy parallel  (0);
+
+   } // namespace wykobi::execution
+
+   namespace detail
+   {
+      #ifdef WYKOBI_EXECUTION_THREADS
+
+      /*
+         Process wide pool of hardware_concurrency - 1 workers, started on
+         first use. A job is a range of task indices split evenly between
+         the calling thread and the workers taking part. Each participant
+         takes tasks from the front of its own range and, once that is
+         empty, steals the back half of the range of another participant.
+         Jobs issued from inside a job, or from other threads while a job
+         is running, run on their calling thread or wait their turn.
+      */
+      class thread_pool
+      {
+      public:
+
+         static inline thread_pool& instance()
+         {
+            static thread_pool pool;
+            return pool;
+         }
+
+         inline std::size_t concurrency() const
+         {
+            return worker_.size() + 1;
+         }
+
+         template <typename Function>
+         inline void run(const std::size_t& task_count, std::size_t thread_count, Function& function)
+         {
+            if ((0 == thread_count) || (thread_count > concurrency()))
+            {
+               thread_count = concurrency();
+            }
+
+            if (thread_count > task_count)
+            {
+               thread_count = task_count;
+            }
+
+            if ((thread_count <= 1) || inside_job())
+            {
+               for (std::size_t i = 0; i < task_count; ++i)
+               {
+                  function(i);
+               }
+
+               return;
+            }
+
+            std::unique_lock<std::mutex> job_lock(job_mutex_);
+
+            for (std::size_t i = 0; i < thread_count; ++i)
+            {
+               std::lock_guard<std::mutex> lock(range_[i]->mutex);
+               range_[i]->begin = (task_count * i      ) / thread_count;
+               range_[i]->end   = (task_count * (i + 1)) / thread_count;
+            }
+
+            {
+               std::lock_guard<std::mutex> lock(mutex_);
+               invoke_  = &thread_pool::invoke<Function>;
+               context_ = &function;
+               active_  = thread_count;
+               pending_ = thread_count - 1;
+               error_   = std::exception_ptr();
+               ++generation_;
+            }
+
+            wake_.notify_all();
+
+            execute(0);
+
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            done_.wait(lock,[this]() { return 0 == pending_; });
+
+            if (error_)
+            {
+               std::exception_ptr error = error_;
+               error_ = std::exception_ptr();
+               std::rethrow_exception(error);
+            }
+         }
+
+      private:
+
+         struct task_range
+         {
+            task_range() : begin(0), end(0) {}
+
+            std::mutex  mutex;
+            std::size_t begin;
+            std::size_t end;
+         };
+
+         thread_pool()
+         : invoke_    (0),
+           context_   (0),
+           active_    (0),
+           pending_   (0),
+           generation_(0),
+           stop_      (false)
+         {
+            const std::size_t concurrency = std::max(1u,std::thread::hardware_concurrency());
+
+            for (std::size_t i = 0; i < concurrency; ++i)
+            {
+               range_.push_back(std::unique_ptr<task_range>(new task_range()));
+            }
+
+            for (std::size_t i = 1; i < concurrency; ++i)
+            {
+               worker_.push_back(std::thread(&thread_pool::work,this,i));
+            }
+         }
+
+        ~thread_pool()
+         {
+            {
+               std::lock_guard<std::mutex> lock(mutex_);
+               stop_ = true;
+            }
+
+            wake_.notify_all();
+
+            for (std::size_t i = 0; i < worker_.size(); ++i)
+            {
+               worker_[i].join();
+            }
+         }
+
+         thread_pool(const thread_pool&);
+         thread_pool& operator=(const thread_pool&);
+
+         template <typename Function>
+         static inline void invoke(void* context, const std::size_t& task)
+         {
+            (*static_cast<Function*>(context))(task);
+         }
+
+         static inline bool& inside_job()
+         {
+            static thread_local bool inside = false;
+            return inside;
+         }
+
+         inline void work(const std::size_t& index)
+         {
+            inside_job() = true;
+
+            std::size_t generation = 0;
+
+            for ( ; ; )
+            {
+               {
+                  std::unique_lock<std::mutex> lock(mutex_);
+
+                  wake_.wait(lock,[&]() { return stop_ || (generation != generation_); });
+
+                  if (stop_)
+                     return;
+
+                  generation = generation_;
+
+                  if (index >= active_)
+                     continue;
+               }
+
+               execute(index);
+
+               std::lock_guard<std::mutex> lock(mutex_);
+
+               if (0 == --pending_)
+               {
+                  done_.notify_one();
+               }
+            }
+         }
+
+         inline void execute(const std::size_t& index)
+         {
+            const bool inside = inside_job();
+            inside_job() = true;
+
+            std::size_t task = 0;
+
+            while (take(index,task) || steal(index,task))
+            {
+               try
+               {
+                  invoke_(context_,task);
+               }
+               catch (...)
+               {
+                  std::lock_guard<std::mutex> lock(mutex_);
+
+                  if (!error_)
+                  {
+                     error_ = std::current_exception();
+                  }
+               }
+            }
+
+            inside_job() = inside;
+         }
+
+         inline bool take(const std::size_t& index, std::size_t& task)
+         {
+            std::lock_guard<std::mutex> lock(range_[index]->mutex);
+
+            if (range_[index]->begin == range_[index]->end)
+               return false;
+
+            task = range_[index]->begin++;
+
+            return true;
+         }
+
+         inline bool steal(const std::size_t& index, std::size_t& task)
+         {
+            for (std::size_t i = 1; i < active_; ++i)
+            {
+               task_range& victim = *range_[(index + i) % active_];
+
+               std::size_t begin = 0;
+               std::size_t end   = 0;
+
+               {
+                  std::lock_guard<std::mutex> lock(victim.mutex);
+
+                  if (victim.begin == victim.end)
+                     continue;
+
+                  end   = victim.end;
+                  begin = victim.begin + ((victim.end - victim.begin) / 2);
+                  victim.end = begin;
+               }
+
+               /* The stolen range always holds at least one task, which is returned directly. */
+               std::lock_guard<std::mutex> lock(range_[index]->mutex);
+
+               range_[index]->begin = begin + 1;
+               range_[index]->end   = end;
+
+               task = begin;
+
+               return true;
+            }
+
+            return false;
+         }
+
+         std::vector<std::thread>                 worker_;
+         std::vector<std::unique_ptr<task_range> > range_;
+         std::mutex                               job_mutex_;
+         std::mutex                               mutex_;
+         std::condition_variable                  wake_;
+         std::condition_variable                  done_;
+         void                                   (*invoke_)(void*, const std::size_t&);
+         void*                                    context_;
+         std::size_t                              active_;
+         std::size_t                              pending_;
+         std::size_t                              generation_;
+         bool                                     stop_;
+         std::exception_ptr                       error_;
+      };
+
+      #endif
+
+      /* Adapts a block function, function(block,first,last), to the task interface of the pool. */
+      template <typename Function>
+      class block_task
+      {
+      public:
+
+         block_task(Function& function, const std::size_t& count, const std::size_t& block_size)
+         : function_(function),
+           count_(count),
+           block_size_(block_size)
+         {}
+
+         inline void operator()(const std::size_t& block)
+         {
+            const std::size_t first = block * block_size_;
+            const std::size_t last  = ((count_ - first) > block_size_) ? (first + block_size_) : count_;
+
+            function_(block,first,last);
+         }
+
+      private:
+
+         block_task& operator=(const block_task&);
+
+         Function&   function_;
+         std::size_t count_;
+         std::size_t block_size_;
+      };
+
+   } // namespace wykobi::detail
+
+   namespace execution
+   {
+      inline std::size_t block_count(const std::size_t& count, const std::size_t& block_size)
+      {
+         return (count + block_size - 1) / block_size;
+      }
+
+      /*
+         Calls function(block,first,last) for the index ranges [first,last)
+         of count items cut into blocks of block_size, spread over the
+         threads of the policy. Blocks may run in any order and at the
+         same time, so each must only write to its own part of the output.
+      */
+      template <typename Function>
+      inline void for_each_block(const policy& policy, const std::size_t& count, const std::size_t& block_size, Function& function)
+      {
+         const std::size_t block_count_ = block_count(count,block_size);
+
+         detail::block_task<Function> task(function,count,block_size);
+
+         #ifdef WYKOBI_EXECUTION_THREADS
+         detail::thread_pool::instance().run(block_count_,policy.thread_count(),task);
+         #else
+         (void)policy;
+
+         for (std::size_t i = 0; i < block_count_; ++i)
+         {
+            task(i);
+         }
+         #endif
+      }
+
+   } // namespace wykobi::execution
+
+   /*
+      Policy driven batch routines over random access ranges. Output goes
+      to a random access iterator with room for one result per input
+      element, written at the same position as its input element.
+   */
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const execution::policy& policy, const affine2d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const execution::policy& policy, const affine3d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   template <typename T, typename Iterator>
+   inline void transform_in_place(const execution::policy& policy, const affine2d<T>& affine, const Iterator begin, const Iterator end);
+
+   template <typename T, typename Iterator>
+   inline void transform_in_place(const execution::policy& policy, const affine3d<T>& affine, const Iterator begin, const Iterator end);
+
+   /* Writes point_in_polygon of every point, std::vector<bool> output is safe as blocks span whole words. */
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void point_in_polygon(const execution::policy& policy, const InputIterator begin, const InputIterator end, const polygon<T,2>& polygon, OutputIterator out);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void point_in_polygon(const execution::policy& policy, const InputIterator begin, const InputIterator end, const polygon_view<T,2>& polygon, OutputIterator out);
+
+   /*
+      Random points on a segment, triangle, quadix, rectangle, box or
+      circle. The coordinates of the i-th point are derived from seed and
+      i alone (not from rand()), so the output only depends on the seed.
+   */
+   template <typename Shape, typename OutputIterator>
+   inline void generate_random_points(const execution::policy& policy, const Shape& shape, const std::size_t& point_count, OutputIterator out, const unsigned long& seed = 0);
+
+   namespace detail
+   {
+      template <typename Affine, typename InputIterator, typename OutputIterator>
+      class transform_block
+      {
+      public:
+
+         transform_block(const Affine& affine, const InputIterator& begin, const OutputIterator& out)
+         : affine_(affine),
+           begin_(begin),
+           out_(out)
+         {}
+
+         inline void operator()(const std::size_t&, const std::size_t& first, const std::size_t& last)
+         {
+            for (std::size_t i = first; i < last; ++i)
+            {
+               out_[i] = transform(affine_,begin_[i]);
+            }
+         }
+
+      private:
+
+         const Affine&  affine_;
+         InputIterator  begin_;
+         OutputIterator out_;
+      };
+
+      template <typename Affine, typename Iterator>
+      class transform_in_place_block
+      {
+      public:
+
+         transform_in_place_block(const Affine& affine, const Iterator& begin)
+         : affine_(affine),
+           begin_(begin)
+         {}
+
+         inline void operator()(const std::size_t&, const std::size_t& first, const std::size_t& last)
+         {
+            for (std::size_t i = first; i < last; ++i)
+            {
+               transform_in_place(affine_,begin_[i]);
+            }
+         }
+
+      private:
+
+         const Affine& affine_;
+         Iterator      begin_;
+      };
+
+      template <typename Polygon, typename InputIterator, typename OutputIterator>
+      class point_in_polygon_block
+      {
+      public:
+
+         point_in_polygon_block(const Polygon& polygon, const InputIterator& begin, const OutputIterator& out)
+         : polygon_(polygon),
+           begin_(begin),
+           out_(out)
+         {}
+
+         inline void operator()(const std::size_t&, const std::size_t& first, const std::size_t& last)
+         {
+            for (std::size_t i = first; i < last; ++i)
+            {
+               out_[i] = point_in_polygon(begin_[i],polygon_);
+            }
+         }
+
+      private:
+
+         const Polygon& polygon_;
+         InputIterator  begin_;
+         OutputIterator out_;
+      };
+
+      /*
+         Counter based source of uniform values: the stream for a given
+         (seed, index) pair is fixed, whichever thread draws it. Values
+         are 32 bit integer hashes (murmur3 finaliser) scaled to range.
+      */
+      class counter_source
+      {
+      public:
+
+         counter_source(const unsigned long& seed, const std::size_t& index)
+         : state_(mix(mix(seed & mask) ^ (index & mask)) ^ mix((index >> 16) >> 16))
+         {}
+
+         template <typename T>
+         inline T operator()(const T& range)
+         {
+            state_ = (state_ + 0x9E3779B9UL) & mask;
+            return T((1.0 * range * mix(state_)) / 4294967295.0);
+         }
+
+      private:
+
+         static const unsigned long mask = 0xFFFFFFFFUL;
+
+         static inline unsigned long mix(unsigned long h)
+         {
+            h ^= (h >> 16); h = (h * 0x85EBCA6BUL) & mask;
+            h ^= (h >> 13); h = (h * 0xC2B2AE35UL) & mask;
+            h ^= (h >> 16);
+            return h;
+         }
+
+         unsigned long state_;
+      };
+
+      template <typename Shape, typename OutputIterator>
+      class random_point_block
+      {
+      public:
+
+         random_point_block(const Shape& shape, const unsigned long& seed, const OutputIterator& out)
+         : shape_(shape),
+           seed_(seed),
+           out_(out)
+         {}
+
+         inline void operator()(const std::size_t&, const std::size_t& first, const std::size_t& last)
+         {
+            for (std::size_t i = first; i < last; ++i)
+            {
+               counter_source source(seed_,i);
+               out_[i] = random_point(shape_,source);
+            }
+         }
+
+      private:
+
+         const Shape&   shape_;
+         unsigned long  seed_;
+         OutputIterator out_;
+      };
+
+   } // namespace wykobi::detail
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const execution::policy& policy, const affine2d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      detail::transform_block<affine2d<T>,InputIterator,OutputIterator> block(affine,begin,out);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),4096,block);
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const execution::policy& policy, const affine3d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      detail::transform_block<affine3d<T>,InputIterator,OutputIterator> block(affine,begin,out);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),4096,block);
+   }
+
+   template <typename T, typename Iterator>
+   inline void transform_in_place(const execution::policy& policy, const affine2d<T>& affine, const Iterator begin, const Iterator end)
+   {
+      detail::transform_in_place_block<affine2d<T>,Iterator> block(affine,begin);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),4096,block);
+   }
+
+   template <typename T, typename Iterator>
+   inline void transform_in_place(const execution::policy& policy, const affine3d<T>& affine, const Iterator begin, const Iterator end)
+   {
+      detail::transform_in_place_block<affine3d<T>,Iterator> block(affine,begin);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),4096,block);
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void point_in_polygon(const execution::policy& policy, const InputIterator begin, const InputIterator end, const polygon<T,2>& polygon, OutputIterator out)
+   {
+      detail::point_in_polygon_block<wykobi::polygon<T,2>,InputIterator,OutputIterator> block(polygon,begin,out);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),1024,block);
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void point_in_polygon(const execution::policy& policy, const InputIterator begin, const InputIterator end, const polygon_view<T,2>& polygon, OutputIterator out)
+   {
+      detail::point_in_polygon_block<polygon_view<T,2>,InputIterator,OutputIterator> block(polygon,begin,out);
+      execution::for_each_block(policy,static_cast<std::size_t>(std::distance(begin,end)),1024,block);
+   }
+
+   template <typename Shape, typename OutputIterator>
+   inline void generate_random_points(const execution::policy& policy, const Shape& shape, const std::size_t& point_count, OutputIterator out, const unsigned long& seed)
+   {
+      detail::random_point_block<Shape,OutputIterator> block(shape,seed,out);
+      execution::for_each_block(policy,point_count,4096,block);
+   }
+
+} // namespace wykobi
+
+#endif
@@ -0,0 +1,38 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_EXTERN
+#define INCLUDE_WYKOBI_EXTERN
+
+
+/*
+   Client side header for use with the precompiled wykobi library
+   (libwykobi.a / libwykobi.so). The float and double specializations
+   are declared extern and are linked from the library instead of being
+   instantiated in each including translation unit.
+*/
+
+#ifndef WYKOBI_EXTERN_TEMPLATES
+ #define WYKOBI_EXTERN_TEMPLATES
+#endif
+
+#include "wykobi_instantiate.hpp"
+
+#endif
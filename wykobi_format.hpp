@@ -0,0 +1,278 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_FORMAT
+#define INCLUDE_WYKOBI_FORMAT
+
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#if (__cplusplus >= 201703L) && defined(__has_include)
+ #if __has_include(<charconv>)
+  #include <charconv>
+ #endif
+#endif
+
+#if defined(__cpp_lib_to_chars)
+ #define WYKOBI_CHARCONV
+#endif
+
+#include "wykobi.hpp"
+#include "wykobi_matrix.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Locale independent text formatting of primitives into a caller
+      supplied buffer [first,last). Each function returns one past the
+      last character written, or null if the buffer is too small, no
+      terminating null is written. Numbers use the shortest form that
+      reads back exactly (std::to_chars, C++17), otherwise enough
+      significant digits to round trip, formatted in the classic locale;
+      a number needs at most 32 characters. Points are written as
+      (x,y[,z]), compound primitives as the concatenation of their points
+      and matrices as tab separated rows, one per line.
+   */
+   template <typename T> inline char* to_chars(char* first, char* last, const point2d<T>& point);
+   template <typename T> inline char* to_chars(char* first, char* last, const point3d<T>& point);
+   template <typename T> inline char* to_chars(char* first, char* last, const vector2d<T>& v);
+   template <typename T> inline char* to_chars(char* first, char* last, const vector3d<T>& v);
+   template <typename T> inline char* to_chars(char* first, char* last, const ray<T,2>& ray);
+   template <typename T> inline char* to_chars(char* first, char* last, const ray<T,3>& ray);
+   template <typename T> inline char* to_chars(char* first, char* last, const rectangle<T>& rectangle);
+   template <typename T> inline char* to_chars(char* first, char* last, const circle<T>& circle);
+   template <typename T> inline char* to_chars(char* first, char* last, const sphere<T>& sphere);
+
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const pointnd<T,Dimension>& point);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const segment<T,Dimension>& segment);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const line<T,Dimension>& line);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const triangle<T,Dimension>& triangle);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const box<T,Dimension>& box);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const quadix<T,Dimension>& quadix);
+   template <typename T, std::size_t Dimension> inline char* to_chars(char* first, char* last, const polygon<T,Dimension>& polygon);
+
+   template <typename T, std::size_t M, std::size_t N> inline char* to_chars(char* first, char* last, const matrix<T,M,N>& matrix);
+
+   namespace detail
+   {
+      template <typename T>
+      inline char* format_number(char* first, char* last, const T& value)
+      {
+         #ifdef WYKOBI_CHARCONV
+         const std::to_chars_result result = std::to_chars(first,last,value);
+         return (std::errc() == result.ec) ? result.ptr : 0;
+         #else
+         /* A classic locale stream, as sprintf would follow the global C locale's decimal point. */
+         std::ostringstream stream;
+         stream.imbue(std::locale::classic());
+         stream.precision(((std::numeric_limits<T>::digits * 30103) / 100000) + 2);
+         stream << value;
+
+         const std::string buffer = stream.str();
+
+         if (buffer.empty() || (static_cast<std::ptrdiff_t>(buffer.size()) > (last - first)))
+            return 0;
+
+         return std::copy(buffer.begin(),buffer.end(),first);
+         #endif
+      }
+
+      inline char* put_char(char* first, char* last, const char& c)
+      {
+         if ((0 == first) || (first == last))
+            return 0;
+
+         *first = c;
+         return first + 1;
+      }
+
+      template <typename T>
+      inline char* put_number(char* first, char* last, const T& value)
+      {
+         return (0 == first) ? 0 : format_number(first,last,value);
+      }
+
+      /* Parenthesised comma separated list of count values. */
+      template <typename T>
+      inline char* put_tuple(char* first, char* last, const T* value, const std::size_t& count)
+      {
+         first = put_char(first,last,'(');
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            if (0 != i)
+               first = put_char(first,last,',');
+
+            first = put_number(first,last,value[i]);
+         }
+
+         return put_char(first,last,')');
+      }
+
+      template <typename Sequence>
+      inline char* put_points(char* first, char* last, const Sequence& sequence, const std::size_t count)
+      {
+         for (std::size_t i = 0; (i < count) && (0 != first); ++i)
+         {
+            first = to_chars(first,last,sequence[i]);
+         }
+
+         return first;
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const point2d<T>& point)
+   {
+      const T value[] = { point.x, point.y };
+      return detail::put_tuple(first,last,value,2);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const point3d<T>& point)
+   {
+      const T value[] = { point.x, point.y, point.z };
+      return detail::put_tuple(first,last,value,3);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const vector2d<T>& v)
+   {
+      const T value[] = { v.x, v.y };
+      return detail::put_tuple(first,last,value,2);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const vector3d<T>& v)
+   {
+      const T value[] = { v.x, v.y, v.z };
+      return detail::put_tuple(first,last,value,3);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const ray<T,2>& ray)
+   {
+      const T value[] = { ray.origin.x, ray.origin.y, ray.direction.x, ray.direction.y };
+      return detail::put_tuple(first,last,value,4);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const ray<T,3>& ray)
+   {
+      const T value[] = { ray.origin.x, ray.origin.y, ray.origin.z, ray.direction.x, ray.direction.y, ray.direction.z };
+      return detail::put_tuple(first,last,value,6);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const rectangle<T>& rectangle)
+   {
+      return detail::put_points(first,last,rectangle,wykobi::rectangle<T>::PointCount);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const circle<T>& circle)
+   {
+      const T value[] = { circle.x, circle.y, circle.radius };
+      return detail::put_tuple(first,last,value,3);
+   }
+
+   template <typename T>
+   inline char* to_chars(char* first, char* last, const sphere<T>& sphere)
+   {
+      const T value[] = { sphere.x, sphere.y, sphere.z, sphere.radius };
+      return detail::put_tuple(first,last,value,4);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const pointnd<T,Dimension>& point)
+   {
+      T value[Dimension];
+
+      for (std::size_t i = 0; i < Dimension; ++i)
+      {
+         value[i] = point[i];
+      }
+
+      return detail::put_tuple(first,last,value,Dimension);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const segment<T,Dimension>& segment)
+   {
+      return detail::put_points(first,last,segment,wykobi::segment<T,Dimension>::PointCount);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const line<T,Dimension>& line)
+   {
+      return detail::put_points(first,last,line,wykobi::line<T,Dimension>::PointCount);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const triangle<T,Dimension>& triangle)
+   {
+      return detail::put_points(first,last,triangle,wykobi::triangle<T,Dimension>::PointCount);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const box<T,Dimension>& box)
+   {
+      return detail::put_points(first,last,box,wykobi::box<T,Dimension>::PointCount);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const quadix<T,Dimension>& quadix)
+   {
+      return detail::put_points(first,last,quadix,wykobi::quadix<T,Dimension>::PointCount);
+   }
+
+   template <typename T, std::size_t Dimension>
+   inline char* to_chars(char* first, char* last, const polygon<T,Dimension>& polygon)
+   {
+      return detail::put_points(first,last,polygon,polygon.size());
+   }
+
+   template <typename T, std::size_t M, std::size_t N>
+   inline char* to_chars(char* first, char* last, const matrix<T,M,N>& matrix)
+   {
+      for (std::size_t x = 0; x < M; ++x)
+      {
+         for (std::size_t y = 0; y < N; ++y)
+         {
+            first = detail::put_number(first,last,matrix(x,y));
+            first = detail::put_char  (first,last,'\t');
+         }
+
+         first = detail::put_char(first,last,'\n');
+      }
+
+      return first;
+   }
+
+} // namespace wykobi
+
+#endif
@@ -0,0 +1,549 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_GEOMETRY_STORE
+#define INCLUDE_WYKOBI_GEOMETRY_STORE
+
+
+#if (__cplusplus < 201103L)
+ #error "wykobi_geometry_store.hpp requires C++11 or later (fixed width file layout)"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+ #define WYKOBI_STORE_MMAP
+#elif defined(_WIN32)
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+ #define WYKOBI_STORE_WIN32
+#endif
+
+#include "wykobi.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Binary polygon store, version 1. All values are in the byte order
+      of the machine that wrote the file (checked through byte_order):
+
+         header    geometry_store_header, padded to section_alignment
+         vertices  vertex_count x Dimension scalars
+         index     record_count + 1 uint64 vertex offsets, record i is
+                   vertices [index[i],index[i + 1])
+         bounds    record_count x (min point, max point) scalars
+
+      Every section starts on a section_alignment boundary, so a mapped
+      file can be addressed in place without any parsing or copying.
+
+      Records are polygons only. The library has no mesh type, so indexed
+      meshes are not supported; a triangulated mesh can be stored as one
+      three vertex record per triangle, at the cost of repeating shared
+      vertices.
+   */
+   struct geometry_store_header
+   {
+      char          magic[8];
+      std::uint32_t version;
+      std::uint32_t byte_order;
+      std::uint32_t dimension;
+      std::uint32_t scalar_size;
+      std::uint32_t scalar_is_integer;
+      std::uint32_t reserved;
+      std::uint64_t record_count;
+      std::uint64_t vertex_count;
+      std::uint64_t vertex_position;
+      std::uint64_t index_position;
+      std::uint64_t bounds_position;
+   };
+
+   namespace detail
+   {
+      static const char          geometry_store_magic[8]    = { 'W', 'Y', 'K', 'O', 'B', 'I', 'G', 'S' };
+      static const std::uint32_t geometry_store_version     = 1;
+      static const std::uint32_t geometry_store_byte_order  = 0x01020304;
+      static const std::uint64_t geometry_store_alignment   = 64;
+
+      inline std::uint64_t geometry_store_align(const std::uint64_t& position)
+      {
+         return (position + geometry_store_alignment - 1) & ~(geometry_store_alignment - 1);
+      }
+
+      template <typename T, std::size_t Dimension>
+      inline geometry_store_header make_geometry_store_header()
+      {
+         geometry_store_header header;
+
+         std::memset(&header,0,sizeof(header));
+         std::memcpy(header.magic,geometry_store_magic,sizeof(header.magic));
+
+         header.version           = geometry_store_version;
+         header.byte_order        = geometry_store_byte_order;
+         header.dimension         = static_cast<std::uint32_t>(Dimension);
+         header.scalar_size       = static_cast<std::uint32_t>(sizeof(T));
+         header.scalar_is_integer = std::numeric_limits<T>::is_integer ? 1 : 0;
+
+         return header;
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T, std::size_t Dimension> struct geometry_store_bounds      { typedef box<T,Dimension> type; };
+   template <typename T>                        struct geometry_store_bounds<T,2> { typedef rectangle<T>     type; };
+
+   /*
+      Appends polygons to a store file. Vertices are streamed to disk as
+      they are appended, only the per record index and bounds are kept
+      in memory until close() writes them out with the final header.
+   */
+   template <typename T, std::size_t Dimension>
+   class geometry_store_writer
+   {
+   public:
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+
+      explicit geometry_store_writer(const std::string& file_name)
+      : stream_(file_name.c_str(),std::ios::binary | std::ios::out | std::ios::trunc),
+        vertex_count_(0),
+        closed_(false)
+      {
+         index_.push_back(0);
+
+         const geometry_store_header header = detail::make_geometry_store_header<T,Dimension>();
+         write(&header,sizeof(header));
+         pad();
+      }
+
+     ~geometry_store_writer()
+      {
+         close();
+      }
+
+      inline bool is_open() const
+      {
+         return !closed_ && static_cast<bool>(stream_);
+      }
+
+      inline std::size_t size() const
+      {
+         return index_.size() - 1;
+      }
+
+      template <typename InputIterator>
+      inline bool append(InputIterator begin, InputIterator end)
+      {
+         if (!is_open())
+            return false;
+
+         T bound_min[Dimension];
+         T bound_max[Dimension];
+
+         for (std::size_t k = 0; k < Dimension; ++k)
+         {
+            bound_min[k] = T(0);
+            bound_max[k] = T(0);
+         }
+
+         std::uint64_t count = 0;
+
+         for (InputIterator it = begin; it != end; ++it, ++count)
+         {
+            const PointType point = *it;
+            T coordinate[Dimension];
+
+            for (std::size_t k = 0; k < Dimension; ++k)
+            {
+               coordinate[k] = point[k];
+
+               if ((0 == count) || (coordinate[k] < bound_min[k])) bound_min[k] = coordinate[k];
+               if ((0 == count) || (coordinate[k] > bound_max[k])) bound_max[k] = coordinate[k];
+            }
+
+            write(coordinate,sizeof(coordinate));
+         }
+
+         vertex_count_ += count;
+         index_.push_back(vertex_count_);
+         bounds_.insert(bounds_.end(),bound_min,bound_min + Dimension);
+         bounds_.insert(bounds_.end(),bound_max,bound_max + Dimension);
+
+         return static_cast<bool>(stream_);
+      }
+
+      template <typename Allocator>
+      inline bool append(const polygon<T,Dimension,Allocator>& polygon)
+      {
+         return append(polygon.begin(),polygon.end());
+      }
+
+      inline bool append(const polygon_view<T,Dimension>& polygon)
+      {
+         return append(polygon.begin(),polygon.end());
+      }
+
+      /* Writes the index, bounds and final header. Returns false if any write failed. */
+      inline bool close()
+      {
+         if (closed_)
+            return static_cast<bool>(stream_);
+
+         closed_ = true;
+
+         geometry_store_header header = detail::make_geometry_store_header<T,Dimension>();
+
+         header.record_count    = index_.size() - 1;
+         header.vertex_count    = vertex_count_;
+         header.vertex_position = detail::geometry_store_align(sizeof(geometry_store_header));
+
+         pad();
+         header.index_position = position();
+         write(&index_[0],index_.size() * sizeof(std::uint64_t));
+
+         pad();
+         header.bounds_position = position();
+
+         if (!bounds_.empty())
+         {
+            write(&bounds_[0],bounds_.size() * sizeof(T));
+         }
+
+         pad();
+
+         stream_.seekp(0);
+         write(&header,sizeof(header));
+         stream_.close();
+
+         return !stream_.fail();
+      }
+
+   private:
+
+      geometry_store_writer(const geometry_store_writer&);
+      geometry_store_writer& operator=(const geometry_store_writer&);
+
+      inline void write(const void* data, const std::size_t& size)
+      {
+         stream_.write(static_cast<const char*>(data),static_cast<std::streamsize>(size));
+      }
+
+      inline std::uint64_t position()
+      {
+         return static_cast<std::uint64_t>(stream_.tellp());
+      }
+
+      inline void pad()
+      {
+         static const char zero[detail::geometry_store_alignment] = { 0 };
+         const std::uint64_t current = position();
+         write(zero,static_cast<std::size_t>(detail::geometry_store_align(current) - current));
+      }
+
+      std::ofstream              stream_;
+      std::vector<std::uint64_t> index_;
+      std::vector<T>             bounds_;
+      std::uint64_t              vertex_count_;
+      bool                       closed_;
+   };
+
+   /*
+      Read-only store backed by a memory mapped file (POSIX mmap or Win32
+      file mapping, elsewhere the file is read into memory). Records are
+      exposed as non-owning polygon views into the mapping, so opening a
+      store costs a header and section bounds check regardless of its
+      size (record offsets are checked per access), and processes
+      mapping the same file share the page cache. Views are valid until
+      the store is closed or destroyed.
+   */
+   template <typename T, std::size_t Dimension>
+   class geometry_store
+   {
+   public:
+
+      typedef polygon_view<T,Dimension>                          view_type;
+      typedef typename geometry_store_bounds<T,Dimension>::type  bounds_type;
+
+      geometry_store()
+      {
+         reset();
+      }
+
+      explicit geometry_store(const std::string& file_name)
+      {
+         reset();
+         open(file_name);
+      }
+
+     ~geometry_store()
+      {
+         close();
+      }
+
+      /* Maps a store file, false if it cannot be mapped or does not match T and Dimension. */
+      inline bool open(const std::string& file_name)
+      {
+         close();
+
+         if (!map(file_name) || !validate())
+         {
+            close();
+            return false;
+         }
+
+         return true;
+      }
+
+      inline void close()
+      {
+         unmap();
+         reset();
+      }
+
+      inline bool        is_open     () const { return (0 != data_);     }
+      inline std::size_t size        () const { return record_count_;    }
+      inline bool        empty       () const { return (0 == record_count_); }
+      inline std::size_t vertex_count() const { return vertex_count_;    }
+
+      /*
+         Record offsets are checked here rather than on open, a record whose
+         offsets are out of order or beyond the vertex array is returned as
+         an empty view.
+      */
+      inline view_type operator[](const std::size_t& index) const
+      {
+         const std::uint64_t first = index_[index    ];
+         const std::uint64_t last  = index_[index + 1];
+
+         if ((last < first) || (last > vertex_count_))
+            return view_type(vertex_,0,Dimension * sizeof(T));
+
+         return view_type(vertex_ + (first * Dimension),
+                          static_cast<std::size_t>(last - first),
+                          Dimension * sizeof(T));
+      }
+
+      inline bounds_type bounds(const std::size_t& index) const
+      {
+         const T* bound = bounds_ + (2 * Dimension * index);
+         bounds_type bounds_;
+
+         for (std::size_t k = 0; k < Dimension; ++k)
+         {
+            bounds_[0][k] = bound[k];
+            bounds_[1][k] = bound[Dimension + k];
+         }
+
+         return bounds_;
+      }
+
+   private:
+
+      geometry_store(const geometry_store&);
+      geometry_store& operator=(const geometry_store&);
+
+      inline void reset()
+      {
+         data_         = 0;
+         size_         = 0;
+         record_count_ = 0;
+         vertex_count_ = 0;
+         vertex_       = 0;
+         index_        = 0;
+         bounds_       = 0;
+      }
+
+      inline bool map(const std::string& file_name)
+      {
+         #if defined(WYKOBI_STORE_MMAP)
+
+         const int descriptor = ::open(file_name.c_str(),O_RDONLY);
+
+         if (descriptor < 0)
+            return false;
+
+         struct stat status;
+
+         if ((0 != ::fstat(descriptor,&status)) || (status.st_size <= 0))
+         {
+            ::close(descriptor);
+            return false;
+         }
+
+         void* mapping = ::mmap(0,static_cast<std::size_t>(status.st_size),PROT_READ,MAP_SHARED,descriptor,0);
+         ::close(descriptor);
+
+         if (MAP_FAILED == mapping)
+            return false;
+
+         data_ = static_cast<const unsigned char*>(mapping);
+         size_ = static_cast<std::size_t>(status.st_size);
+
+         #elif defined(WYKOBI_STORE_WIN32)
+
+         HANDLE file = ::CreateFileA(file_name.c_str(),GENERIC_READ,FILE_SHARE_READ,0,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,0);
+
+         if (INVALID_HANDLE_VALUE == file)
+            return false;
+
+         LARGE_INTEGER file_size;
+
+         if (!::GetFileSizeEx(file,&file_size) || (file_size.QuadPart <= 0))
+         {
+            ::CloseHandle(file);
+            return false;
+         }
+
+         HANDLE mapping = ::CreateFileMappingA(file,0,PAGE_READONLY,0,0,0);
+         ::CloseHandle(file);
+
+         if (0 == mapping)
+            return false;
+
+         const void* view = ::MapViewOfFile(mapping,FILE_MAP_READ,0,0,0);
+         ::CloseHandle(mapping);
+
+         if (0 == view)
+            return false;
+
+         data_ = static_cast<const unsigned char*>(view);
+         size_ = static_cast<std::size_t>(file_size.QuadPart);
+
+         #else
+
+         std::ifstream stream(file_name.c_str(),std::ios::binary);
+
+         if (!stream)
+            return false;
+
+         stream.seekg(0,std::ios::end);
+         const std::streamoff file_size = stream.tellg();
+         stream.seekg(0,std::ios::beg);
+
+         if (file_size <= 0)
+            return false;
+
+         /* uint64 storage keeps every section suitably aligned. */
+         buffer_.resize((static_cast<std::size_t>(file_size) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+
+         if (!stream.read(reinterpret_cast<char*>(&buffer_[0]),file_size))
+         {
+            buffer_.clear();
+            return false;
+         }
+
+         data_ = reinterpret_cast<const unsigned char*>(&buffer_[0]);
+         size_ = static_cast<std::size_t>(file_size);
+
+         #endif
+
+         return true;
+      }
+
+      inline void unmap()
+      {
+         if (0 == data_)
+            return;
+
+         #if defined(WYKOBI_STORE_MMAP)
+         ::munmap(const_cast<unsigned char*>(data_),size_);
+         #elif defined(WYKOBI_STORE_WIN32)
+         ::UnmapViewOfFile(data_);
+         #else
+         std::vector<std::uint64_t>().swap(buffer_);
+         #endif
+      }
+
+      /* The section must be aligned and count elements of element_size must fit in the file. */
+      inline bool within(const std::uint64_t& position, const std::uint64_t& count, const std::uint64_t& element_size) const
+      {
+         return (0 == (position % detail::geometry_store_alignment)) &&
+                (position <= size_)                                  &&
+                (count <= ((size_ - position) / element_size));
+      }
+
+      inline bool validate()
+      {
+         if (size_ < sizeof(geometry_store_header))
+            return false;
+
+         geometry_store_header header;
+         std::memcpy(&header,data_,sizeof(header));
+
+         const geometry_store_header expected = detail::make_geometry_store_header<T,Dimension>();
+
+         if (
+              (0 != std::memcmp(header.magic,expected.magic,sizeof(header.magic))) ||
+              (header.version           != expected.version          )          ||
+              (header.byte_order        != expected.byte_order       )          ||
+              (header.dimension         != expected.dimension        )          ||
+              (header.scalar_size       != expected.scalar_size      )          ||
+              (header.scalar_is_integer != expected.scalar_is_integer)
+            )
+            return false;
+
+         if (
+              !within(header.vertex_position,header.vertex_count,Dimension * sizeof(T))          ||
+              (header.record_count >= std::numeric_limits<std::uint64_t>::max())                 ||
+              !within(header.index_position ,header.record_count + 1,sizeof(std::uint64_t))      ||
+              !within(header.bounds_position,header.record_count,2 * Dimension * sizeof(T))
+            )
+            return false;
+
+         record_count_ = static_cast<std::size_t>(header.record_count);
+         vertex_count_ = static_cast<std::size_t>(header.vertex_count);
+         vertex_       = reinterpret_cast<const T*            >(data_ + header.vertex_position);
+         index_        = reinterpret_cast<const std::uint64_t*>(data_ + header.index_position );
+         bounds_       = reinterpret_cast<const T*            >(data_ + header.bounds_position);
+
+         if ((0 != index_[0]) || (header.vertex_count != index_[record_count_]))
+            return false;
+
+         return true;
+      }
+
+      const unsigned char*  data_;
+      std::size_t           size_;
+      std::size_t           record_count_;
+      std::size_t           vertex_count_;
+      const T*              vertex_;
+      const std::uint64_t*  index_;
+      const T*              bounds_;
+
+      #if !defined(WYKOBI_STORE_MMAP) && !defined(WYKOBI_STORE_WIN32)
+      std::vector<std::uint64_t> buffer_;
+      #endif
+   };
+
+} // namespace wykobi
+
+#endif
@@ -33,16 +33,11 @@
 
 #include "wykobi.hpp"
 #include "wykobi_utilities.hpp"
+#include "wykobi_vertex_batch.hpp"
 
 
 namespace wykobi
 {
-   enum DrawingMode  {
-                        eNoDraw,
-                        eSolid,
-                        eOutLine
-                     };
-
    const GLfloat basic_color[14][3]= {
                                        {    0.0 / 255.0,   0.0 / 255.0,   0.0 / 255.0},
                                        {  255.0 / 255.0,   0.0 / 255.0,   0.0 / 255.0},
@@ -73,6 +68,12 @@ namespace wykobi
            green(1.0),
            blue(1.0)
          {
+            color[0] = red;
+            color[1] = green;
+            color[2] = blue;
+
+            const wykobi::polygon<T,2> circle_polygon = make_polygon(make_circle(T(0.0),T(0.0),T(1.0)));
+            unit_circle.assign(circle_polygon.begin(),circle_polygon.end());
          }
 
          ~wykobi_graphics_opengl(){}
@@ -212,7 +213,6 @@ namespace wykobi
 
          inline void draw_circle(const T& x, const T& y, const T& radius) const
          {
-            wykobi::polygon<T,2> _polygon = make_polygon(make_circle(x,y,radius));
             glColor3fv (color);
             switch (drawing_mode)
             {
@@ -220,13 +220,9 @@ namespace wykobi
                case eOutLine : glBegin(GL_LINE_LOOP);    break;
                case eNoDraw  : return;
             }
-            if (drawing_mode == eSolid)
+            for (std::size_t i = 0; i < unit_circle.size(); ++i)
             {
-               glVertex2d(double(_polygon[0].x),double(_polygon[0].y));
-            }
-            for (std::size_t i = (drawing_mode == eSolid)?1:0; i < _polygon.size(); ++i)
-            {
-               glVertex2d(double(_polygon[i].x),double(_polygon[i].y));
+               glVertex2d(double(x + radius * unit_circle[i].x),double(y + radius * unit_circle[i].y));
             }
             glEnd();
          }
@@ -250,6 +246,11 @@ namespace wykobi
             draw_segment(point1.x,point1.y,point2.x,point2.y);
          }
 
+         inline void draw_segment(const point3d<T>& point1, const point3d<T>& point2) const
+         {
+            draw_segment(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+         }
+
          inline void draw_triangle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3) const
          {
             draw_triangle(point1.x,point1.y,
@@ -296,20 +297,24 @@ namespace wykobi
             draw_circle(point.x,point.y,radius);
          }
 
-         inline void draw_polyline(std::vector< point2d<T> > point_list)
+         inline void draw_polyline(const std::vector< point2d<T> >& point_list) const
          {
-            for (std::size_t i = 0; i < point_list.size() - 1; ++i)
+            glBegin(GL_LINE_STRIP);
+            for (std::size_t i = 0; i < point_list.size(); ++i)
             {
-               draw_segment(point_list[i],point_list[i+1]);
+               glVertex2d(double(point_list[i].x),double(point_list[i].y));
             }
+            glEnd();
          }
 
-         inline void draw_polyline(std::vector< point3d<T> > point_list)
+         inline void draw_polyline(const std::vector< point3d<T> >& point_list) const
          {
-            for (std::size_t i = 0; i < point_list.size() - 1; ++i)
+            glBegin(GL_LINE_STRIP);
+            for (std::size_t i = 0; i < point_list.size(); ++i)
             {
-               draw_segment(point_list[i],point_list[i+1]);
+               glVertex3d(double(point_list[i].x),double(point_list[i].y),double(point_list[i].z));
             }
+            glEnd();
          }
 
          inline void clear()
@@ -354,7 +359,7 @@ namespace wykobi
                }
                for (std::size_t i = 0; i < polygon.size(); ++i)
                {
-                glVertex3d(polygon[i].x1,polygon[i].y1,polygon[i].z1);
+                glVertex2d(double(polygon[i].x),double(polygon[i].y));
                }
                glEnd();
             }
@@ -374,32 +379,57 @@ namespace wykobi
          inline void draw(const cubic_bezier<T,2>& bezier, const std::size_t& point_count)
          {
             std::vector< point2d<T> > point_list;
-            wykobi::generate_bezier(bezier,point_count,point_list);
+            wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
             draw_polyline(point_list);
          }
 
          inline void draw(const cubic_bezier<T,3>& bezier, const std::size_t& point_count)
          {
-            std::vector< point2d<T> > point_list;
-            wykobi::generate_bezier(bezier,point_count,point_list);
+            std::vector< point3d<T> > point_list;
+            wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
             draw_polyline(point_list);
          }
 
          inline void draw(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count)
          {
             std::vector< point2d<T> > point_list;
-            wykobi::generate_bezier(bezier,point_count,point_list);
+            wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
             draw_polyline(point_list);
          }
 
          inline void draw(const quadratic_bezier<T,3>& bezier, const std::size_t& point_count)
          {
-            std::vector< point2d<T> > point_list;
-            wykobi::generate_bezier(bezier,point_count,point_list);
+            std::vector< point3d<T> > point_list;
+            wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
             draw_polyline(point_list);
          }
 
+         /*
+            Submits each non-empty batch with a single glDrawArrays call from
+            interleaved client-side vertex arrays.
+         */
+         inline void draw(const vertex_batch<T>& batch) const
+         {
+            draw_batch(batch.vertices(eTriangleBatch),GL_TRIANGLES);
+            draw_batch(batch.vertices(eLineBatch    ),GL_LINES    );
+            draw_batch(batch.vertices(ePointBatch   ),GL_POINTS   );
+            glColor3fv(color);
+         }
+
       private:
+
+         inline void draw_batch(const std::vector<batch_vertex>& vertex, const GLenum mode) const
+         {
+            if (vertex.empty()) return;
+            glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glEnableClientState(GL_COLOR_ARRAY);
+            glVertexPointer(3,GL_FLOAT,sizeof(batch_vertex),&vertex[0].x);
+            glColorPointer (3,GL_FLOAT,sizeof(batch_vertex),&vertex[0].red);
+            glDrawArrays(mode,0,static_cast<GLsizei>(vertex.size()));
+            glPopClientAttrib();
+         }
+
          unsigned int  _width;
          unsigned int  _height;
          float         red;
@@ -407,6 +437,7 @@ namespace wykobi
          float         blue;
          GLfloat       color[3];
          DrawingMode   drawing_mode;
+         std::vector< point2d<T> > unit_circle;
    };
 
 }// namespace wykobi
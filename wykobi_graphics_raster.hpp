@@ -0,0 +1,879 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_GRAPHICS_RASTER
+#define INCLUDE_WYKOBI_GRAPHICS_RASTER
+
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cmath>
+
+#if (__cplusplus >= 201103L)
+ #include <thread>
+ #define WYKOBI_RASTER_THREADS
+#endif
+
+#include "wykobi.hpp"
+#include "wykobi_vertex_batch.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Headless software rasterizer with the same draw(...) interface as the
+      windowed backends. Drawing calls are binned into horizontal bands of
+      the framebuffer they overlap and rasterized into an in-memory RGBA
+      framebuffer on flush(). Bands are small enough to stay cache resident
+      and are distributed across threads (C++11 and later). Segments are
+      anti-aliased, polygons are filled by scanline and circles are filled
+      and outlined analytically. Pixel (0,0) is the top left corner of the
+      framebuffer.
+   */
+   template <typename T>
+   class wykobi_graphics_raster
+   {
+   public:
+
+      wykobi_graphics_raster(const unsigned int& w, const unsigned int& h, DrawingMode dm = eOutLine)
+      : width_       (w),
+        height_      (h),
+        drawing_mode_(dm),
+        color_       (pack(0,0,0,255)),
+        thread_count_(1),
+        pending_     (0),
+        framebuffer_ (4 * std::size_t(w) * std::size_t(h),0),
+        band_list_   ((h + band_height - 1) / band_height)
+      {
+         #ifdef WYKOBI_RASTER_THREADS
+         thread_count_ = std::max(1u,std::thread::hardware_concurrency());
+         #endif
+         clear(255,255,255);
+      }
+
+     ~wykobi_graphics_raster(){}
+
+      inline unsigned int width () const { return width_;  }
+      inline unsigned int height() const { return height_; }
+
+      inline void set_drawing_mode(DrawingMode dm)           { drawing_mode_ = dm;                          }
+      inline void set_thread_count(const unsigned int& count) { thread_count_ = std::max(1u,count);          }
+
+      inline void set_color(const unsigned int& red, const unsigned int& green, const unsigned int& blue, const unsigned int& alpha = 255)
+      {
+         color_ = pack(red,green,blue,alpha);
+      }
+
+      inline void clear(const unsigned int& red, const unsigned int& green, const unsigned int& blue)
+      {
+         discard();
+
+         for (std::size_t i = 0; i < framebuffer_.size(); i += 4)
+         {
+            framebuffer_[i + 0] = static_cast<unsigned char>(red);
+            framebuffer_[i + 1] = static_cast<unsigned char>(green);
+            framebuffer_[i + 2] = static_cast<unsigned char>(blue);
+            framebuffer_[i + 3] = 255;
+         }
+      }
+
+      inline void clear_white() { clear(255,255,255); }
+      inline void clear_black() { clear(  0,  0,  0); }
+
+      inline void draw_pixel(const T& x, const T& y)
+      {
+         record(ePixelCommand,float(x),float(y),0.0f,0.0f,float(y),float(y));
+      }
+
+      inline void draw_segment(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         record(eSegmentCommand,float(x1),float(y1),float(x2),float(y2),float(std::min(y1,y2)),float(std::max(y1,y2)));
+      }
+
+      inline void draw_line(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         const T dx = x2 - x1;
+         const T dy = y2 - y1;
+
+         if ((dx == T(0.0)) && (dy == T(0.0)))
+            return;
+
+         /* Extend the line beyond the framebuffer along its major axis. */
+         if (abs(dx) >= abs(dy))
+         {
+            const T m = dy / dx;
+            draw_segment(T(-1.0),y1 + m * (T(-1.0) - x1),T(width_ + 1),y1 + m * (T(width_ + 1) - x1));
+         }
+         else
+         {
+            const T m = dx / dy;
+            draw_segment(x1 + m * (T(-1.0) - y1),T(-1.0),x1 + m * (T(height_ + 1) - y1),T(height_ + 1));
+         }
+      }
+
+      inline void draw_triangle(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3)
+      {
+         const T x[3] = { x1, x2, x3 };
+         const T y[3] = { y1, y2, y3 };
+         draw_polygon(x,y,3);
+      }
+
+      inline void draw_quadix(const T& x1, const T& y1,
+                              const T& x2, const T& y2,
+                              const T& x3, const T& y3,
+                              const T& x4, const T& y4)
+      {
+         const T x[4] = { x1, x2, x3, x4 };
+         const T y[4] = { y1, y2, y3, y4 };
+         draw_polygon(x,y,4);
+      }
+
+      inline void draw_rectangle(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         draw_quadix(x1,y1,x2,y1,x2,y2,x1,y2);
+      }
+
+      inline void draw_circle(const T& x, const T& y, const T& radius)
+      {
+         switch (drawing_mode_)
+         {
+            case eSolid   : record(eCircleCommand,       float(x),float(y),float(radius),0.0f,float(y - radius),float(y + radius)); break;
+            case eOutLine : record(eCircleOutlineCommand,float(x),float(y),float(radius),0.0f,float(y - radius),float(y + radius)); break;
+            case eNoDraw  : break;
+         }
+      }
+
+      inline void draw_pixel    (const point2d<T>& point)                                { draw_pixel(point.x,point.y);                                 }
+      inline void draw_segment  (const point2d<T>& point1, const point2d<T>& point2)     { draw_segment(point1.x,point1.y,point2.x,point2.y);          }
+      inline void draw_line     (const point2d<T>& point1, const point2d<T>& point2)     { draw_line(point1.x,point1.y,point2.x,point2.y);             }
+      inline void draw_rectangle(const point2d<T>& point1, const point2d<T>& point2)     { draw_rectangle(point1.x,point1.y,point2.x,point2.y);        }
+      inline void draw_circle   (const point2d<T>& point,  const T& radius)              { draw_circle(point.x,point.y,radius);                        }
+
+      inline void draw_triangle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+      {
+         draw_triangle(point1.x,point1.y,
+                       point2.x,point2.y,
+                       point3.x,point3.y);
+      }
+
+      inline void draw_quadix(const point2d<T>& point1,
+                              const point2d<T>& point2,
+                              const point2d<T>& point3,
+                              const point2d<T>& point4)
+      {
+         draw_quadix(point1.x,point1.y,
+                     point2.x,point2.y,
+                     point3.x,point3.y,
+                     point4.x,point4.y);
+      }
+
+      inline void draw_polyline(const std::vector< point2d<T> >& point_list)
+      {
+         for (std::size_t i = 1; i < point_list.size(); ++i)
+         {
+            draw_segment(point_list[i - 1],point_list[i]);
+         }
+      }
+
+      inline void draw(const point2d<T>&       point) { draw_pixel(point);                                    }
+      inline void draw(const segment<T,2>&   segment) { draw_segment(segment[0],segment[1]);                  }
+      inline void draw(const line<T,2>&         line) { draw_line(line[0],line[1]);                           }
+      inline void draw(const triangle<T,2>& triangle) { draw_triangle(triangle[0],triangle[1],triangle[2]);   }
+      inline void draw(const rectangle<T>& rectangle) { draw_rectangle(rectangle[0],rectangle[1]);            }
+      inline void draw(const quadix<T,2>&     quadix) { draw_quadix(quadix[0],quadix[1],quadix[2],quadix[3]); }
+      inline void draw(const circle<T>&       circle) { draw_circle(circle.x,circle.y,circle.radius);         }
+
+      inline void draw(const polygon<T,2>& polygon)
+      {
+         if (polygon.size() < 3) return;
+
+         std::vector<T> x(polygon.size());
+         std::vector<T> y(polygon.size());
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            x[i] = polygon[i].x;
+            y[i] = polygon[i].y;
+         }
+
+         draw_polygon(&x[0],&y[0],polygon.size());
+      }
+
+      inline void draw(const cubic_bezier<T,2>& bezier, const std::size_t& point_count)
+      {
+         std::vector< point2d<T> > point_list;
+         wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
+         draw_polyline(point_list);
+      }
+
+      inline void draw(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count)
+      {
+         std::vector< point2d<T> > point_list;
+         wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
+         draw_polyline(point_list);
+      }
+
+      /* Rasterizes the x/y coordinates of a vertex batch using its vertex colours. */
+      inline void draw(const vertex_batch<T>& batch)
+      {
+         const unsigned int color = color_;
+
+         const std::vector<batch_vertex>& point = batch.vertices(ePointBatch);
+
+         for (std::size_t i = 0; i < point.size(); ++i)
+         {
+            color_ = pack(point[i]);
+            draw_pixel(T(point[i].x),T(point[i].y));
+         }
+
+         const std::vector<batch_vertex>& line = batch.vertices(eLineBatch);
+
+         for (std::size_t i = 0; (i + 1) < line.size(); i += 2)
+         {
+            color_ = pack(line[i]);
+            draw_segment(T(line[i].x),T(line[i].y),T(line[i + 1].x),T(line[i + 1].y));
+         }
+
+         const std::vector<batch_vertex>& triangle = batch.vertices(eTriangleBatch);
+         const DrawingMode drawing_mode = drawing_mode_;
+
+         drawing_mode_ = eSolid;
+
+         for (std::size_t i = 0; (i + 2) < triangle.size(); i += 3)
+         {
+            color_ = pack(triangle[i]);
+            draw_triangle(T(triangle[i    ].x),T(triangle[i    ].y),
+                          T(triangle[i + 1].x),T(triangle[i + 1].y),
+                          T(triangle[i + 2].x),T(triangle[i + 2].y));
+         }
+
+         drawing_mode_ = drawing_mode;
+         color_        = color;
+      }
+
+      /* Rasterizes all pending drawing calls into the framebuffer. */
+      inline void flush()
+      {
+         if (pending_ == 0)
+            return;
+
+         #ifdef WYKOBI_RASTER_THREADS
+         const std::size_t thread_count = std::min<std::size_t>(thread_count_,band_list_.size());
+
+         std::vector<std::thread> worker;
+
+         for (std::size_t i = 1; i < thread_count; ++i)
+         {
+            worker.push_back(std::thread(&wykobi_graphics_raster::rasterize_bands,this,i,thread_count));
+         }
+
+         rasterize_bands(0,thread_count);
+
+         for (std::size_t i = 0; i < worker.size(); ++i)
+         {
+            worker[i].join();
+         }
+         #else
+         rasterize_bands(0,1);
+         #endif
+
+         discard();
+      }
+
+      /* RGBA, 8 bits per channel, rows top to bottom. */
+      inline const std::vector<unsigned char>& framebuffer()
+      {
+         flush();
+         return framebuffer_;
+      }
+
+      inline void write_ppm(std::ostream& stream)
+      {
+         flush();
+
+         stream << "P6\n" << width_ << " " << height_ << "\n255\n";
+
+         for (std::size_t i = 0; i < framebuffer_.size(); i += 4)
+         {
+            stream.write(reinterpret_cast<const char*>(&framebuffer_[i]),3);
+         }
+      }
+
+      /* Uncompressed (stored deflate blocks) RGBA PNG. */
+      inline void write_png(std::ostream& stream)
+      {
+         flush();
+
+         const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+         stream.write(reinterpret_cast<const char*>(signature),8);
+
+         std::vector<unsigned char> chunk;
+
+         append_u32(chunk,width_);
+         append_u32(chunk,height_);
+         chunk.push_back(8);  /* bit depth               */
+         chunk.push_back(6);  /* colour type: RGBA       */
+         chunk.push_back(0);  /* compression: deflate    */
+         chunk.push_back(0);  /* filter method: adaptive */
+         chunk.push_back(0);  /* interlace: none         */
+         write_png_chunk(stream,"IHDR",chunk);
+
+         const std::size_t row_size = 4 * std::size_t(width_);
+
+         std::vector<unsigned char> raw;
+         raw.reserve((row_size + 1) * height_);
+
+         for (std::size_t y = 0; y < height_; ++y)
+         {
+            raw.push_back(0); /* filter type: none */
+            raw.insert(raw.end(),framebuffer_.begin() + y * row_size,framebuffer_.begin() + (y + 1) * row_size);
+         }
+
+         chunk.clear();
+         chunk.push_back(0x78);
+         chunk.push_back(0x01);
+
+         std::size_t offset = 0;
+
+         do
+         {
+            const std::size_t length = std::min<std::size_t>(raw.size() - offset,65535);
+            const bool        last   = (offset + length) == raw.size();
+
+            chunk.push_back(last ? 1 : 0);
+            chunk.push_back(static_cast<unsigned char>( length        & 0xFF));
+            chunk.push_back(static_cast<unsigned char>((length >> 8)  & 0xFF));
+            chunk.push_back(static_cast<unsigned char>(~length        & 0xFF));
+            chunk.push_back(static_cast<unsigned char>((~length >> 8) & 0xFF));
+            chunk.insert(chunk.end(),raw.begin() + offset,raw.begin() + offset + length);
+
+            offset += length;
+         }
+         while (offset < raw.size());
+
+         unsigned int a = 1;
+         unsigned int b = 0;
+
+         for (std::size_t i = 0; i < raw.size(); ++i)
+         {
+            a = (a + raw[i]) % 65521;
+            b = (b + a)      % 65521;
+         }
+
+         append_u32(chunk,(b << 16) | a);
+         write_png_chunk(stream,"IDAT",chunk);
+
+         chunk.clear();
+         write_png_chunk(stream,"IEND",chunk);
+      }
+
+   private:
+
+      enum CommandType
+      {
+         ePixelCommand,
+         eSegmentCommand,
+         ePolygonCommand,
+         eCircleCommand,
+         eCircleOutlineCommand
+      };
+
+      struct command
+      {
+         float        value[4];  /* pixel: x,y  segment: x1,y1,x2,y2  circle: x,y,radius */
+         float        y_min;
+         float        y_max;
+         unsigned int color;
+         unsigned int type;
+         std::size_t  first;     /* polygon: first coordinate pair in polygon_coord_ */
+         std::size_t  count;     /* polygon: vertex count                            */
+      };
+
+      /* Rows per band, 16 rows of a 1024 pixel wide framebuffer span 64KB. */
+      static const unsigned int band_height = 16;
+
+      /* Pending commands are flushed in chunks to bound memory use. */
+      static const std::size_t max_pending_commands = 1 << 20;
+
+      static inline unsigned int pack(const unsigned int& red, const unsigned int& green, const unsigned int& blue, const unsigned int& alpha)
+      {
+         return (std::min(red,255u)) | (std::min(green,255u) << 8) | (std::min(blue,255u) << 16) | (std::min(alpha,255u) << 24);
+      }
+
+      static inline unsigned int pack(const batch_vertex& vertex)
+      {
+         return pack(static_cast<unsigned int>(vertex.red   * 255.0f + 0.5f),
+                     static_cast<unsigned int>(vertex.green * 255.0f + 0.5f),
+                     static_cast<unsigned int>(vertex.blue  * 255.0f + 0.5f),
+                     255);
+      }
+
+      inline void record(const CommandType type,
+                         const float& v0, const float& v1, const float& v2, const float& v3,
+                         const float& y_min, const float& y_max,
+                         const std::size_t first = 0, const std::size_t count = 0)
+      {
+         if (drawing_mode_ == eNoDraw)
+            return;
+
+         command c;
+
+         c.value[0] = v0;
+         c.value[1] = v1;
+         c.value[2] = v2;
+         c.value[3] = v3;
+         c.y_min    = y_min;
+         c.y_max    = y_max;
+         c.color    = color_;
+         c.type     = type;
+         c.first    = first;
+         c.count    = count;
+
+         /* Anti-aliased coverage may reach one row beyond the bounding box. */
+         const int band_min = floor_int((y_min - 2.0f) / band_height);
+         const int band_max = floor_int((y_max + 2.0f) / band_height);
+
+         if ((band_max < 0) || (band_min >= int(band_list_.size())) || !(y_min <= y_max))
+            return;
+
+         const std::size_t first_band = std::size_t(std::max(band_min,0));
+         const std::size_t last_band  = std::size_t(std::min(band_max,int(band_list_.size()) - 1));
+
+         for (std::size_t i = first_band; i <= last_band; ++i)
+         {
+            band_list_[i].push_back(c);
+         }
+
+         if (++pending_ >= max_pending_commands)
+         {
+            flush();
+         }
+      }
+
+      inline void discard()
+      {
+         for (std::size_t i = 0; i < band_list_.size(); ++i)
+         {
+            band_list_[i].clear();
+         }
+
+         polygon_coord_.clear();
+         pending_ = 0;
+      }
+
+      inline void draw_polygon(const T* x, const T* y, const std::size_t& count)
+      {
+         if (drawing_mode_ == eOutLine)
+         {
+            std::size_t j = count - 1;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+               draw_segment(x[j],y[j],x[i],y[i]);
+               j = i;
+            }
+         }
+         else if (drawing_mode_ == eSolid)
+         {
+            const std::size_t first = polygon_coord_.size() / 2;
+
+            float y_min = +infinity<float>();
+            float y_max = -infinity<float>();
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+               polygon_coord_.push_back(float(x[i]));
+               polygon_coord_.push_back(float(y[i]));
+
+               y_min = std::min(y_min,float(y[i]));
+               y_max = std::max(y_max,float(y[i]));
+            }
+
+            record(ePolygonCommand,0.0f,0.0f,0.0f,0.0f,y_min,y_max,first,count);
+         }
+      }
+
+      inline void blend(const int& x, const int& y, const unsigned int& color, const float& coverage)
+      {
+         const float alpha = coverage * float(color >> 24) * (1.0f / 255.0f);
+
+         if (alpha <= 0.0f)
+            return;
+
+         unsigned char* pixel = &framebuffer_[4 * (std::size_t(y) * width_ + std::size_t(x))];
+
+         for (std::size_t i = 0; i < 3; ++i)
+         {
+            const float source = float((color >> (8 * i)) & 0xFF);
+            pixel[i] = static_cast<unsigned char>(pixel[i] + (source - pixel[i]) * alpha + 0.5f);
+         }
+
+         pixel[3] = static_cast<unsigned char>(pixel[3] + (255.0f - pixel[3]) * alpha + 0.5f);
+      }
+
+      inline void fill_span(const int& y, int x_begin, int x_end, const unsigned int& color)
+      {
+         x_begin = std::max(x_begin,0);
+         x_end   = std::min(x_end,int(width_));
+
+         if ((color >> 24) == 255)
+         {
+            unsigned char* pixel = &framebuffer_[4 * (std::size_t(y) * width_)];
+
+            for (int x = x_begin; x < x_end; ++x)
+            {
+               pixel[4 * x + 0] = static_cast<unsigned char>( color        & 0xFF);
+               pixel[4 * x + 1] = static_cast<unsigned char>((color >> 8)  & 0xFF);
+               pixel[4 * x + 2] = static_cast<unsigned char>((color >> 16) & 0xFF);
+               pixel[4 * x + 3] = 255;
+            }
+         }
+         else
+         {
+            for (int x = x_begin; x < x_end; ++x)
+            {
+               blend(x,y,color,1.0f);
+            }
+         }
+      }
+
+      /* Plots along the major axis of a (possibly steep) segment, restricted to the band. */
+      inline void plot(const bool steep, const int& major, const int& minor, const float& coverage,
+                       const unsigned int& color, const int& row_begin, const int& row_end)
+      {
+         const int x = steep ? minor : major;
+         const int y = steep ? major : minor;
+
+         if ((x >= 0) && (x < int(width_)) && (y >= row_begin) && (y < row_end))
+         {
+            blend(x,y,color,coverage);
+         }
+      }
+
+      /* Xiaolin Wu's anti-aliased line. */
+      inline void rasterize_segment(const command& c, const int& row_begin, const int& row_end)
+      {
+         /* Pixel centres are at integer coordinates in this frame. */
+         float x0 = c.value[0] - 0.5f;
+         float y0 = c.value[1] - 0.5f;
+         float x1 = c.value[2] - 0.5f;
+         float y1 = c.value[3] - 0.5f;
+
+         const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+
+         if (steep)   { std::swap(x0,y0); std::swap(x1,y1); }
+         if (x0 > x1) { std::swap(x0,x1); std::swap(y0,y1); }
+
+         const float dx       = x1 - x0;
+         const float gradient = (dx == 0.0f) ? 1.0f : (y1 - y0) / dx;
+
+         const int major_limit = steep ? int(height_) : int(width_);
+
+         if ((x1 < -1.0f) || (x0 > float(major_limit)))
+            return;
+
+         const int   xpxl1 = floor_int(x0 + 0.5f);
+         const float yend1 = y0 + gradient * (xpxl1 - x0);
+         const float xgap1 = 1.0f - ((x0 + 0.5f) - xpxl1);
+
+         const int   xpxl2 = floor_int(x1 + 0.5f);
+         const float yend2 = y1 + gradient * (xpxl2 - x1);
+         const float xgap2 = (x1 + 0.5f) - xpxl2;
+
+         const int iy1 = floor_int(yend1);
+         const int iy2 = floor_int(yend2);
+
+         plot(steep,xpxl1,iy1    ,(1.0f - (yend1 - iy1)) * xgap1,c.color,row_begin,row_end);
+         plot(steep,xpxl1,iy1 + 1,(        yend1 - iy1 ) * xgap1,c.color,row_begin,row_end);
+         plot(steep,xpxl2,iy2    ,(1.0f - (yend2 - iy2)) * xgap2,c.color,row_begin,row_end);
+         plot(steep,xpxl2,iy2 + 1,(        yend2 - iy2 ) * xgap2,c.color,row_begin,row_end);
+
+         int first = std::max(xpxl1 + 1,0);
+         int last  = std::min(xpxl2 - 1,major_limit - 1);
+
+         if (steep)
+         {
+            first = std::max(first,row_begin);
+            last  = std::min(last ,row_end - 1);
+         }
+         else if (gradient != 0.0f)
+         {
+            /* Major axis positions whose minor coordinate can touch the band. */
+            float a = x0 + (float(row_begin - 1) - y0) / gradient;
+            float b = x0 + (float(row_end  + 1) - y0) / gradient;
+
+            if (a > b) std::swap(a,b);
+
+            first = std::max(first,floor_int(a));
+            last  = std::min(last ,ceil_int (b));
+         }
+         else if ((y0 < float(row_begin - 1)) || (y0 >= float(row_end)))
+            return;
+
+         for (int x = first; x <= last; ++x)
+         {
+            const float intery = y0 + gradient * (x - x0);
+            const int   iy     = floor_int(intery);
+            const float f      = intery - iy;
+
+            plot(steep,x,iy    ,1.0f - f,c.color,row_begin,row_end);
+            plot(steep,x,iy + 1,       f,c.color,row_begin,row_end);
+         }
+      }
+
+      /* Even-odd scanline fill sampled at pixel centres. */
+      inline void rasterize_polygon(const command& c, const int& row_begin, const int& row_end, std::vector<float>& crossing)
+      {
+         const float* coord = &polygon_coord_[2 * c.first];
+
+         const int y_begin = std::max(row_begin,ceil_int(c.y_min - 0.5f));
+         const int y_end   = std::min(row_end  ,floor_int(c.y_max - 0.5f) + 1);
+
+         for (int y = y_begin; y < y_end; ++y)
+         {
+            const float sy = y + 0.5f;
+
+            crossing.clear();
+
+            std::size_t j = c.count - 1;
+
+            for (std::size_t i = 0; i < c.count; ++i)
+            {
+               const float xi = coord[2 * i], yi = coord[2 * i + 1];
+               const float xj = coord[2 * j], yj = coord[2 * j + 1];
+
+               if ((yi <= sy) != (yj <= sy))
+               {
+                  crossing.push_back(xi + (sy - yi) * (xj - xi) / (yj - yi));
+               }
+
+               j = i;
+            }
+
+            std::sort(crossing.begin(),crossing.end());
+
+            for (std::size_t i = 0; (i + 1) < crossing.size(); i += 2)
+            {
+               fill_span(y,ceil_int(crossing[i] - 0.5f),ceil_int(crossing[i + 1] - 0.5f),c.color);
+            }
+         }
+      }
+
+      inline void rasterize_circle(const command& c, const int& row_begin, const int& row_end)
+      {
+         const float cx = c.value[0];
+         const float cy = c.value[1];
+         const float r  = c.value[2];
+
+         const int y_begin = std::max(row_begin,ceil_int(cy - r - 0.5f));
+         const int y_end   = std::min(row_end  ,floor_int(cy + r - 0.5f) + 1);
+
+         for (int y = y_begin; y < y_end; ++y)
+         {
+            const float dy = (y + 0.5f) - cy;
+            const float h2 = r * r - dy * dy;
+
+            if (h2 < 0.0f)
+               continue;
+
+            const float h = std::sqrt(h2);
+
+            fill_span(y,ceil_int(cx - h - 0.5f),ceil_int(cx + h - 0.5f),c.color);
+         }
+      }
+
+      /* One pixel wide anti-aliased ring, coverage falls off with the distance from the radius. */
+      inline void rasterize_circle_outline(const command& c, const int& row_begin, const int& row_end)
+      {
+         const float cx = c.value[0];
+         const float cy = c.value[1];
+         const float r  = c.value[2];
+
+         const float outer = r + 1.0f;
+         const float inner = r - 1.0f;
+
+         const int y_begin = std::max(row_begin,floor_int(cy - outer));
+         const int y_end   = std::min(row_end  ,ceil_int(cy + outer) + 1);
+
+         for (int y = y_begin; y < y_end; ++y)
+         {
+            const float dy = (y + 0.5f) - cy;
+            const float o2 = outer * outer - dy * dy;
+
+            if (o2 < 0.0f)
+               continue;
+
+            const float o = std::sqrt(o2);
+            const float i = ((inner > 0.0f) && ((inner * inner - dy * dy) > 0.0f)) ? std::sqrt(inner * inner - dy * dy) : 0.0f;
+
+            const int left_begin  = std::max(0,floor_int(cx - o));
+            const int left_end    = std::min(int(width_) - 1,ceil_int(cx - i));
+            const int right_begin = std::max(std::max(0,left_end + 1),floor_int(cx + i));
+            const int right_end   = std::min(int(width_) - 1,ceil_int(cx + o));
+
+            for (int x = left_begin; x <= left_end; ++x)
+            {
+               ring_pixel(x,y,cx,dy,r,c.color);
+            }
+
+            for (int x = right_begin; x <= right_end; ++x)
+            {
+               ring_pixel(x,y,cx,dy,r,c.color);
+            }
+         }
+      }
+
+      inline void ring_pixel(const int& x, const int& y, const float& cx, const float& dy, const float& r, const unsigned int& color)
+      {
+         const float dx       = (x + 0.5f) - cx;
+         const float coverage = 1.0f - std::abs(std::sqrt(dx * dx + dy * dy) - r);
+
+         if (coverage > 0.0f)
+         {
+            blend(x,y,color,coverage);
+         }
+      }
+
+      /* Rasterizes bands first, first + stride, first + 2 * stride, ... */
+      inline void rasterize_bands(const std::size_t first, const std::size_t stride)
+      {
+         std::vector<float> crossing;
+
+         for (std::size_t band = first; band < band_list_.size(); band += stride)
+         {
+            const std::vector<command>& command_list = band_list_[band];
+
+            const int row_begin = int(band * band_height);
+            const int row_end   = int(std::min<std::size_t>(height_,(band + 1) * band_height));
+
+            for (std::size_t i = 0; i < command_list.size(); ++i)
+            {
+               rasterize(command_list[i],row_begin,row_end,crossing);
+            }
+         }
+      }
+
+      inline void rasterize(const command& c, const int& row_begin, const int& row_end, std::vector<float>& crossing)
+      {
+         switch (c.type)
+         {
+            case ePixelCommand :
+               {
+                  const int x = floor_int(c.value[0]);
+                  const int y = floor_int(c.value[1]);
+
+                  if ((x >= 0) && (x < int(width_)) && (y >= row_begin) && (y < row_end))
+                  {
+                     blend(x,y,c.color,1.0f);
+                  }
+               }
+               break;
+
+            case eSegmentCommand       : rasterize_segment       (c,row_begin,row_end);          break;
+            case ePolygonCommand       : rasterize_polygon       (c,row_begin,row_end,crossing); break;
+            case eCircleCommand        : rasterize_circle        (c,row_begin,row_end);          break;
+            case eCircleOutlineCommand : rasterize_circle_outline(c,row_begin,row_end);          break;
+         }
+      }
+
+      /* Clamped conversions, avoiding both the libm call and out of range float to int conversion. */
+      static inline int floor_int(float value)
+      {
+         value = (value > -1.0e9f) ? ((value < 1.0e9f) ? value : 1.0e9f) : -1.0e9f;
+         const int i = int(value);
+         return (value < float(i)) ? (i - 1) : i;
+      }
+
+      static inline int ceil_int(const float& value)
+      {
+         return -floor_int(-value);
+      }
+
+      static inline void append_u32(std::vector<unsigned char>& data, const unsigned int& value)
+      {
+         data.push_back(static_cast<unsigned char>((value >> 24) & 0xFF));
+         data.push_back(static_cast<unsigned char>((value >> 16) & 0xFF));
+         data.push_back(static_cast<unsigned char>((value >>  8) & 0xFF));
+         data.push_back(static_cast<unsigned char>( value        & 0xFF));
+      }
+
+      static inline void write_png_chunk(std::ostream& stream, const char* type, const std::vector<unsigned char>& data)
+      {
+         std::vector<unsigned char> header;
+
+         append_u32(header,static_cast<unsigned int>(data.size()));
+         header.insert(header.end(),type,type + 4);
+
+         unsigned int crc = 0xFFFFFFFFu;
+
+         crc = crc32(crc,&header[4],4);
+
+         if (!data.empty())
+         {
+            crc = crc32(crc,&data[0],data.size());
+         }
+
+         std::vector<unsigned char> trailer;
+         append_u32(trailer,crc ^ 0xFFFFFFFFu);
+
+         stream.write(reinterpret_cast<const char*>(&header[0]),header.size());
+
+         if (!data.empty())
+         {
+            stream.write(reinterpret_cast<const char*>(&data[0]),data.size());
+         }
+
+         stream.write(reinterpret_cast<const char*>(&trailer[0]),trailer.size());
+      }
+
+      static inline unsigned int crc32(unsigned int crc, const unsigned char* data, const std::size_t& length)
+      {
+         for (std::size_t i = 0; i < length; ++i)
+         {
+            crc ^= data[i];
+
+            for (std::size_t k = 0; k < 8; ++k)
+            {
+               crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+            }
+         }
+
+         return crc;
+      }
+
+      unsigned int                            width_;
+      unsigned int                            height_;
+      DrawingMode                             drawing_mode_;
+      unsigned int                            color_;
+      unsigned int                            thread_count_;
+      std::size_t                             pending_;
+      std::vector<unsigned char>              framebuffer_;
+      std::vector< std::vector<command> >     band_list_;
+      std::vector<float>                      polygon_coord_;
+   };
+
+}// namespace wykobi
+
+#endif
@@ -0,0 +1,279 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_GRAPHICS_SVG
+#define INCLUDE_WYKOBI_GRAPHICS_SVG
+
+
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <vector>
+#include <string>
+
+#include "wykobi.hpp"
+#include "wykobi_vertex_batch.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Headless SVG backend with the same draw(...) interface as the
+      windowed backends. Drawing calls are appended as SVG elements and
+      the document is emitted with write().
+   */
+   template <typename T>
+   class wykobi_graphics_svg
+   {
+   public:
+
+      wykobi_graphics_svg(const unsigned int& w, const unsigned int& h, DrawingMode dm = eOutLine)
+      : width_       (w),
+        height_      (h),
+        drawing_mode_(dm),
+        pen_width_   (1.0),
+        opacity_     (1.0)
+      {
+         /*
+            Coordinates are written in the classic locale with enough
+            digits to round trip T (max_digits10, spelt out for C++98).
+         */
+         body_.imbue(std::locale::classic());
+         body_.precision(2 + (std::numeric_limits<T>::digits * 30103L) / 100000L);
+         set_color(0,0,0);
+      }
+
+     ~wykobi_graphics_svg(){}
+
+      inline unsigned int width () const { return width_;  }
+      inline unsigned int height() const { return height_; }
+
+      inline void set_drawing_mode(DrawingMode dm)     { drawing_mode_ = dm; }
+      inline void set_pen_width   (const double& w)    { pen_width_    = w;  }
+
+      inline void set_color(const unsigned int& red, const unsigned int& green, const unsigned int& blue, const unsigned int& alpha = 255)
+      {
+         std::ostringstream stream;
+         stream << "rgb(" << red << "," << green << "," << blue << ")";
+         color_   = stream.str();
+         opacity_ = std::min(alpha,255u) / 255.0;
+      }
+
+      inline void clear()
+      {
+         body_.str("");
+         body_.clear();
+      }
+
+      inline void draw_pixel(const T& x, const T& y)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<rect x=\"" << x << "\" y=\"" << y << "\" width=\"1\" height=\"1\" fill=\"" << color_ << "\"" << opacity("fill") << "/>\n";
+      }
+
+      inline void draw_segment(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<line x1=\"" << x1 << "\" y1=\"" << y1 << "\" x2=\"" << x2 << "\" y2=\"" << y2 << "\" " << stroke() << "/>\n";
+      }
+
+      inline void draw_line(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         const T dx = x2 - x1;
+         const T dy = y2 - y1;
+
+         if ((dx == T(0.0)) && (dy == T(0.0)))
+            return;
+
+         if (abs(dx) >= abs(dy))
+         {
+            const T m = dy / dx;
+            draw_segment(T(0.0),y1 - m * x1,T(width_),y1 + m * (T(width_) - x1));
+         }
+         else
+         {
+            const T m = dx / dy;
+            draw_segment(x1 - m * y1,T(0.0),x1 + m * (T(height_) - y1),T(height_));
+         }
+      }
+
+      inline void draw_triangle(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<polygon points=\"" << x1 << "," << y1 << " " << x2 << "," << y2 << " " << x3 << "," << y3 << "\" " << polygon_paint() << "/>\n";
+      }
+
+      inline void draw_quadix(const T& x1, const T& y1,
+                              const T& x2, const T& y2,
+                              const T& x3, const T& y3,
+                              const T& x4, const T& y4)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<polygon points=\"" << x1 << "," << y1 << " " << x2 << "," << y2 << " "
+                                       << x3 << "," << y3 << " " << x4 << "," << y4 << "\" " << polygon_paint() << "/>\n";
+      }
+
+      inline void draw_rectangle(const T& x1, const T& y1, const T& x2, const T& y2)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<rect x=\"" << std::min(x1,x2) << "\" y=\"" << std::min(y1,y2)
+               << "\" width=\"" << abs(x2 - x1) << "\" height=\"" << abs(y2 - y1) << "\" " << paint() << "/>\n";
+      }
+
+      inline void draw_circle(const T& x, const T& y, const T& radius)
+      {
+         if (drawing_mode_ == eNoDraw) return;
+         body_ << "<circle cx=\"" << x << "\" cy=\"" << y << "\" r=\"" << radius << "\" " << paint() << "/>\n";
+      }
+
+      inline void draw_pixel    (const point2d<T>& point)                            { draw_pixel(point.x,point.y);                          }
+      inline void draw_segment  (const point2d<T>& point1, const point2d<T>& point2) { draw_segment(point1.x,point1.y,point2.x,point2.y);   }
+      inline void draw_line     (const point2d<T>& point1, const point2d<T>& point2) { draw_line(point1.x,point1.y,point2.x,point2.y);      }
+      inline void draw_rectangle(const point2d<T>& point1, const point2d<T>& point2) { draw_rectangle(point1.x,point1.y,point2.x,point2.y); }
+      inline void draw_circle   (const point2d<T>& point,  const T& radius)          { draw_circle(point.x,point.y,radius);                 }
+
+      inline void draw_triangle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+      {
+         draw_triangle(point1.x,point1.y,
+                       point2.x,point2.y,
+                       point3.x,point3.y);
+      }
+
+      inline void draw_quadix(const point2d<T>& point1,
+                              const point2d<T>& point2,
+                              const point2d<T>& point3,
+                              const point2d<T>& point4)
+      {
+         draw_quadix(point1.x,point1.y,
+                     point2.x,point2.y,
+                     point3.x,point3.y,
+                     point4.x,point4.y);
+      }
+
+      inline void draw_polyline(const std::vector< point2d<T> >& point_list)
+      {
+         if ((drawing_mode_ == eNoDraw) || (point_list.size() < 2)) return;
+
+         body_ << "<polyline points=\"";
+
+         for (std::size_t i = 0; i < point_list.size(); ++i)
+         {
+            body_ << ((i != 0) ? " " : "") << point_list[i].x << "," << point_list[i].y;
+         }
+
+         body_ << "\" " << stroke() << "/>\n";
+      }
+
+      inline void draw(const point2d<T>&       point) { draw_pixel(point);                                    }
+      inline void draw(const segment<T,2>&   segment) { draw_segment(segment[0],segment[1]);                  }
+      inline void draw(const line<T,2>&         line) { draw_line(line[0],line[1]);                           }
+      inline void draw(const triangle<T,2>& triangle) { draw_triangle(triangle[0],triangle[1],triangle[2]);   }
+      inline void draw(const rectangle<T>& rectangle) { draw_rectangle(rectangle[0],rectangle[1]);            }
+      inline void draw(const quadix<T,2>&     quadix) { draw_quadix(quadix[0],quadix[1],quadix[2],quadix[3]); }
+      inline void draw(const circle<T>&       circle) { draw_circle(circle.x,circle.y,circle.radius);         }
+
+      inline void draw(const polygon<T,2>& polygon)
+      {
+         if ((drawing_mode_ == eNoDraw) || (polygon.size() < 3)) return;
+
+         body_ << "<polygon points=\"";
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            body_ << ((i != 0) ? " " : "") << polygon[i].x << "," << polygon[i].y;
+         }
+
+         body_ << "\" " << polygon_paint() << "/>\n";
+      }
+
+      inline void draw(const cubic_bezier<T,2>& bezier, const std::size_t& point_count)
+      {
+         std::vector< point2d<T> > point_list;
+         wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
+         draw_polyline(point_list);
+      }
+
+      inline void draw(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count)
+      {
+         std::vector< point2d<T> > point_list;
+         wykobi::generate_bezier(bezier,std::back_inserter(point_list),point_count);
+         draw_polyline(point_list);
+      }
+
+      inline void write(std::ostream& stream) const
+      {
+         std::ostringstream header;
+         header.imbue(std::locale::classic());
+         header << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << width_ << "\" height=\"" << height_
+                << "\" viewBox=\"0 0 " << width_ << " " << height_ << "\">\n";
+
+         stream << header.str()
+                << body_.str()
+                << "</svg>\n";
+      }
+
+   private:
+
+      inline std::string stroke() const
+      {
+         std::ostringstream stream;
+         stream.imbue(std::locale::classic());
+         stream << "fill=\"none\" stroke=\"" << color_ << "\" stroke-width=\"" << pen_width_ << "\"" << opacity("stroke");
+         return stream.str();
+      }
+
+      inline std::string paint() const
+      {
+         return (drawing_mode_ == eSolid) ? ("fill=\"" + color_ + "\" stroke=\"none\"" + opacity("fill")) : stroke();
+      }
+
+      /* The raster backend fills polygons even-odd, self-intersecting ones included. */
+      inline std::string polygon_paint() const
+      {
+         return (drawing_mode_ == eSolid) ? (paint() + " fill-rule=\"evenodd\"") : stroke();
+      }
+
+      inline std::string opacity(const char* attribute) const
+      {
+         if (opacity_ >= 1.0) return "";
+
+         std::ostringstream stream;
+         stream.imbue(std::locale::classic());
+         stream << " " << attribute << "-opacity=\"" << opacity_ << "\"";
+         return stream.str();
+      }
+
+      unsigned int       width_;
+      unsigned int       height_;
+      DrawingMode        drawing_mode_;
+      double             pen_width_;
+      double             opacity_;
+      std::string        color_;
+      std::ostringstream body_;
+   };
+
+}// namespace wykobi
+
+#endif
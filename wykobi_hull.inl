@@ -171,9 +171,17 @@ namespace wykobi
 
             point2d<T> lowest_point = *begin;
 
+            /*
+               Lowest then leftmost, which is always a hull vertex. Any other
+               point on a horizontal bottom edge would be stepped over by the
+               farthest collinear rule below and the wrap would never close.
+            */
             for (InputIterator it = begin + 1; it != end; ++it)
             {
-               if ((*it).y < lowest_point.y)
+               if (
+                    ((*it).y < lowest_point.y) ||
+                    (((*it).y == lowest_point.y) && ((*it).x < lowest_point.x))
+                  )
                {
                   lowest_point = *it;
                }
@@ -190,7 +198,19 @@ namespace wykobi
 
                for (InputIterator it = begin; it != end; ++it)
                {
-                  if (orientation(previous_point, current_point, *it) == RightHandSide)
+                  const int turn = orientation(previous_point, current_point, *it);
+
+                  /*
+                     Ties are broken toward the farthest collinear point, so that
+                     collinear runs along the hull are stepped over in one move.
+                  */
+                  if (
+                       (turn == RightHandSide) ||
+                       (
+                         (turn == CollinearOrientation) &&
+                         (lay_distance(previous_point,*it) > lay_distance(previous_point,current_point))
+                       )
+                     )
                   {
                      current_point = *it;
                   }
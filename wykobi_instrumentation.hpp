@@ -0,0 +1,129 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_INSTRUMENTATION
+#define INCLUDE_WYKOBI_INSTRUMENTATION
+
+
+#include <cstddef>
+
+#include "wykobi_math.hpp"
+
+
+#if defined(WYKOBI_INSTRUMENTATION) && (__cplusplus < 201103L)
+ #error "WYKOBI_INSTRUMENTATION requires C++11 or later (thread_local counters)"
+#endif
+
+
+namespace wykobi
+{
+   /*
+      Opt-in per-thread call counters for the predicate, allocation and
+      clipping hot paths. Counting is enabled by compiling with
+      WYKOBI_INSTRUMENTATION defined (requires C++11), otherwise every
+      counting site expands to nothing and snapshot() reports zeros.
+
+      Cost of a single algorithm invocation:
+
+         instrumentation::counters before = instrumentation::snapshot();
+         algorithm::convex_hull_graham_scan< point2d<T> >(begin,end,out);
+         instrumentation::counters cost = instrumentation::snapshot() - before;
+   */
+   namespace instrumentation
+   {
+      struct counters
+      {
+         std::size_t orientation;         /* orientation (2D/3D)                        */
+         std::size_t robust_orientation;  /* robust_orientation (2D/3D)                 */
+         std::size_t intersect;           /* segment-segment intersect tests (2D/3D)    */
+         std::size_t in_circle;           /* in_circle                                  */
+         std::size_t polygon_allocations; /* polygon vertex storage acquisitions        */
+         std::size_t clipper_passes;      /* Sutherland-Hodgman passes (one per edge)   */
+      };
+
+      inline counters snapshot();
+
+      inline void reset();
+
+      inline counters operator-(const counters& counters1, const counters& counters2);
+
+      #ifdef WYKOBI_INSTRUMENTATION
+
+      namespace detail
+      {
+         inline counters& thread_counters()
+         {
+            static thread_local counters counters_ = counters();
+            return counters_;
+         }
+      }
+
+      #endif
+
+      inline counters snapshot()
+      {
+         #ifdef WYKOBI_INSTRUMENTATION
+         return detail::thread_counters();
+         #else
+         const counters counters_ = { 0, 0, 0, 0, 0, 0 };
+         return counters_;
+         #endif
+      }
+
+      inline void reset()
+      {
+         #ifdef WYKOBI_INSTRUMENTATION
+         detail::thread_counters() = counters();
+         #endif
+      }
+
+      inline counters operator-(const counters& counters1, const counters& counters2)
+      {
+         counters counters_;
+
+         counters_.orientation         = counters1.orientation         - counters2.orientation;
+         counters_.robust_orientation  = counters1.robust_orientation  - counters2.robust_orientation;
+         counters_.intersect           = counters1.intersect           - counters2.intersect;
+         counters_.in_circle           = counters1.in_circle           - counters2.in_circle;
+         counters_.polygon_allocations = counters1.polygon_allocations - counters2.polygon_allocations;
+         counters_.clipper_passes      = counters1.clipper_passes      - counters2.clipper_passes;
+
+         return counters_;
+      }
+
+   } // namespace wykobi::instrumentation
+
+} // wykobi namespace
+
+
+/*
+   Counted predicates cannot appear in constant expressions, hence they are
+   declared WYKOBI_COUNTED_CONSTEXPR rather than WYKOBI_CONSTEXPR.
+*/
+#ifdef WYKOBI_INSTRUMENTATION
+ #define WYKOBI_INSTRUMENT(counter) (++wykobi::instrumentation::detail::thread_counters().counter)
+ #define WYKOBI_COUNTED_CONSTEXPR inline
+#else
+ #define WYKOBI_INSTRUMENT(counter) ((void)0)
+ #define WYKOBI_COUNTED_CONSTEXPR WYKOBI_CONSTEXPR
+#endif
+
+
+#endif
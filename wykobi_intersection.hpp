@@ -0,0 +1,556 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_INTERSECTION
+#define INCLUDE_WYKOBI_INTERSECTION
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Intersection tests, intersection points and clipping.
+   */
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3,
+                         const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3,
+                         const T& x4, const T& y4,
+                              T& ix,      T& iy);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point2d<T>& point1,
+                         const point2d<T>& point2,
+                         const point2d<T>& point3,
+                         const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point2d<T>& point1,
+                         const point2d<T>& point2,
+                         const point2d<T>& point3,
+                         const point2d<T>& point4,
+                               point2d<T>& int_point);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2,T& ix, T& iy);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2,point2d<T>& i_point);
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3,
+                         const T& x4, const T& y4, const T& z4,
+                         const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point3d<T>& point1,
+                         const point3d<T>& point2,
+                         const point3d<T>& point3,
+                         const point3d<T>& point4,
+                         const T& fuzzy = T(0.0));
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment1, const segment<T,3>&  segment2, const T& fuzzy = T(0.0));
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const line<T,3>& line, const T& fuzzy = T(0.0));
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const quadratic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const cubic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line1, const line<T,2>& line2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,2>& line, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const quadratic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const cubic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const quadix<T,2>& quadix, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const quadix<T,2>& quadix, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const circle<T>& circle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const circle<T>& circle, const cubic_bezier<T,2>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const box<T,3>& box, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const obb<T,2>& obb1, const obb<T,2>& obb2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const obb<T,3>& obb1, const obb<T,3>& obb2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const sphere<T>& sphere, const quadratic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const sphere<T>& sphere, const cubic_bezier<T,3>& bezier, const std::size_t& steps = 1000);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray1, const ray<T,2>& ray2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray1, const ray<T,3>& ray2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const polygon<T,2>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const plane<T,3>& plane1, const plane<T,3>& plane2);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const plane<T,3>& plane, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool intersect(const plane<T,3>& plane, const line<T,3>& line);
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3,
+                                const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const point2d<T>& point1, const point2d<T>& point2,
+                                const point2d<T>& point3, const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T> WYKOBI_INLINE bool intersect_vertical_horizontal(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T> WYKOBI_INLINE bool intersect_vertical_vertical(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T> WYKOBI_INLINE bool intersect_horizontal_horizontal(const segment<T,2>& segment1, const segment<T,2>& segment2);
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const T& x4, const T& y4,
+                                        T& ix,       T& iy);
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const point2d<T>& point4,
+                                        T& ix,       T& iy);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const point2d<T>& point1,
+                                        const point2d<T>& point2,
+                                        const point2d<T>& point3,
+                                        const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const segment<T,2>& segment1,
+                                        const segment<T,2>& segment2);
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4,
+                                        T& ix,       T& iy,       T& iz, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3,
+                                  const point3d<T>& point4,
+                                        T& ix, T& iy, T& iz, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const point3d<T>& point1,
+                                        const point3d<T>& point2,
+                                        const point3d<T>& point3,
+                                        const point3d<T>& point4, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment1,
+                                        const segment<T,3>& segment2, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const segment<T,2>& segment,
+                                        const line<T,2>& line);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment,
+                                        const line<T,3>& line, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment,
+                                        const plane<T,3>& plane);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const quadratic_bezier<T,2>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps = 1000);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const cubic_bezier<T,2>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps = 1000);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const quadratic_bezier<T,3>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps = 1000);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const cubic_bezier<T,3>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps = 1000);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const line<T,2>& line1,
+                                        const line<T,2>& line2);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const line<T,3>& line1,
+                                        const line<T,3>& line2, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const circle<T>&  circle1,
+                                  const circle<T>&  circle2,
+                                        point2d<T>& point1,
+                                        point2d<T>& point2);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>&  segment,
+                                  const triangle<T,2>& triangle,
+                                  OutputIterator out);
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const line<T,3>&     line,
+                                  const triangle<T,3>& triangle,
+                                  point3d<T>&          ipoint);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const line<T,3>& line,
+                                  const plane<T,3>&      plane);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& cx, const T& cy,
+                                  const T& radius,
+                                  OutputIterator out);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const circle<T>&    circle,
+                                  OutputIterator out);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const line<T,2>& line,
+                                  const circle<T>& circle,
+                                  OutputIterator out);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const sphere<T>&    sphere,
+                                  OutputIterator out);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const line<T,3>& line,
+                                  const sphere<T>& sphere,
+                                  OutputIterator out);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const ray<T,2>& ray1, const ray<T,2>& ray2);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const ray<T,3>& ray, const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const ray<T,3>& ray, const plane<T,3>& plane);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const ray<T,2>& ray, const circle<T>& circle, OutputIterator out);
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const ray<T,3>& ray, const sphere<T>& sphere, OutputIterator out);
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point_line_to_line(const T& x1, const T& y1, const T& z1,
+                                               const T& x2, const T& y2, const T& z2,
+                                               const T& x3, const T& y3, const T& z3,
+                                               const T& x4, const T& y4, const T& z4,
+                                                     T& Ix,       T& Iy,       T& Iz, const T& fuzzy = T(0.0));
+
+   template <typename T>
+   WYKOBI_INLINE bool line_to_line_intersect(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3,
+                                      const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool line_to_line_intersect(const line<T,2>& line1, const line<T,2>& line2);
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_to_rectangle_intersect(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& x3, const T& y3,
+                                                const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_to_rectangle_intersect(const rectangle<T>& rectangle1,
+                                                const rectangle<T>& rectangle2);
+
+   template <typename T>
+   WYKOBI_INLINE bool box_to_box_intersect(const T& x1, const T& y1, const T& z1,
+                                    const T& x2, const T& y2, const T& z2,
+                                    const T& x3, const T& y3, const T& z3,
+                                    const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE bool box_to_box_intersect(const box<T,3>& box1, const box<T,3>& box2);
+
+   template< typename T, unsigned int Dimension, typename Simplex, typename Bezier>
+   inline bool simplex_to_bezier_intersect(const Simplex& simplex,
+                                           const Bezier& bezier,
+                                           const std::size_t& steps);
+
+   template< typename T, unsigned int Dimension, typename Bezier, typename Iterator>
+   inline bool simplex_to_bezier_intersect(const Iterator& begin,
+                                           const Iterator& end,
+                                           const Bezier& bezier,
+                                           const std::size_t& steps);
+
+   template <typename T> WYKOBI_INLINE T distance(const triangle<T,2>& triangle, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T distance(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE T distance(const triangle<T,2>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE T distance(const rectangle<T>& rectangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE int out_code(const point2d<T>& point, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE bool clip(const T& x1, const T& y1,
+                                          const T& x2, const T& y2,
+                                          const T& x3, const T& y3,
+                                          const T& x4, const T& y4,
+                                                T& cx1,      T& cy1,
+                                                T& cx2,      T& cy2);
+
+   template <typename T> WYKOBI_INLINE bool clip(const T& x1, const T& y1, const T& z1,
+                                          const T& x2, const T& y2, const T& z2,
+                                          const T& x3, const T& y3, const T& z3,
+                                          const T& x4, const T& y4, const T& z4,
+                                                T& cx1,      T& cy1,      T& cz1,
+                                                T& cx2,      T& cy2,      T& cz2);
+
+   template <typename T> WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const rectangle<T>&  rectangle,  segment<T,2>& csegment);
+
+   template <typename T> WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const triangle<T,2>& triangle,   segment<T,2>& csegment);
+
+   template <typename T> WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const quadix<T,2>&   quadix,     segment<T,2>& csegment);
+
+   template <typename T> WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const circle<T>&     circle,     segment<T,2>& csegment);
+
+   template <typename T> WYKOBI_INLINE bool clip(const rectangle<T>&  rectangle1, const rectangle<T>&  rectangle2, rectangle<T>& crectangle);
+
+   template <typename T> WYKOBI_INLINE bool clip(const box<T,3>&              box1, const box<T,3>&        box2,       box<T,3>&       cbox);
+
+   template <typename T, unsigned int Dimension, typename Simplex, typename Bezier, typename OutputIterator> WYKOBI_INLINE void simplex_to_bezier_intersection_point(const Simplex& simplex, const Bezier& bezier, OutputIterator out, const std::size_t& steps);
+
+   template <typename T>
+   WYKOBI_INLINE bool exact_intersect(const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4);
+
+   /*
+      Swept (continuous) collision over one time step: during t in [0,1]
+      the first object moves by velocity1 and the second by velocity2 (or
+      stays put). On contact, t receives the time of first contact and
+      normal the unit contact normal, pointing from the second object
+      towards the first. Objects already in contact at t = 0 report t = 0,
+      with the normal along the direction of least penetration.
+   */
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const circle<T>& circle1, const vector2d<T>& velocity1,
+                              const circle<T>& circle2, const vector2d<T>& velocity2,
+                              T& t, vector2d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const circle<T>& circle1, const vector2d<T>& velocity,
+                              const circle<T>& circle2,
+                              T& t, vector2d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const sphere<T>& sphere1, const vector3d<T>& velocity1,
+                              const sphere<T>& sphere2, const vector3d<T>& velocity2,
+                              T& t, vector3d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const sphere<T>& sphere1, const vector3d<T>& velocity,
+                              const sphere<T>& sphere2,
+                              T& t, vector3d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const rectangle<T>& rectangle1, const vector2d<T>& velocity1,
+                              const rectangle<T>& rectangle2, const vector2d<T>& velocity2,
+                              T& t, vector2d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const rectangle<T>& rectangle1, const vector2d<T>& velocity,
+                              const rectangle<T>& rectangle2,
+                              T& t, vector2d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const box<T,3>& box1, const vector3d<T>& velocity1,
+                              const box<T,3>& box2, const vector3d<T>& velocity2,
+                              T& t, vector3d<T>& normal);
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const box<T,3>& box1, const vector3d<T>& velocity,
+                              const box<T,3>& box2,
+                              T& t, vector3d<T>& normal);
+
+   /*
+      First crossing of the polygon edges by a point moving by velocity
+      over t in [0,1], with the normal of the edge facing the point. A
+      translating polygon is handled by passing the relative velocity.
+   */
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const point2d<T>& point, const vector2d<T>& velocity,
+                              const polygon<T,2>& polygon,
+                              T& t, vector2d<T>& normal);
+
+   /*
+      Quadix degeneracy includes self-intersection, hence it lives with
+      the intersection tests rather than the other predicates.
+   */
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const quadix<T,3>& quadix);
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+
+   template <> inline bool intersect<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                                   const std::int32_t& x2, const std::int32_t& y2,
+                                                   const std::int32_t& x3, const std::int32_t& y3,
+                                                   const std::int32_t& x4, const std::int32_t& y4);
+
+   template <> inline bool intersect<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                                   const std::int64_t& x2, const std::int64_t& y2,
+                                                   const std::int64_t& x3, const std::int64_t& y3,
+                                                   const std::int64_t& x4, const std::int64_t& y4);
+   #endif
+
+} // wykobi namespace
+
+#include "wykobi_common.hpp"
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.hpp"
+#include "wykobi_measures.hpp"
+#include "wykobi_bezier.hpp"
+#include "wykobi_intersection.inl"
+
+#endif
@@ -0,0 +1,3107 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_intersection.hpp"
+
+
+namespace wykobi
+{
+   namespace detail
+   {
+      /*
+         Ray kernels shared by the scalar ray tests and the lanes of the
+         ray packet tests (wykobi_ray_packet.hpp). They are free of early
+         exits, conditions are combined with & and selections are plain
+         ternaries, so that a loop over packet lanes vectorises.
+      */
+      template <typename T>
+      inline T slab_inverse(const T& direction)
+      {
+         return ((-T(Epsilon) > direction) || (direction > T(Epsilon))) ? (T(1.0) / direction) : infinity<T>();
+      }
+
+      /*
+         Narrows [tmin,tmax] to the slab [low,high] along one axis. An axis
+         the ray is parallel to has an infinite inverse, which leaves the
+         range either untouched (origin inside the slab, where a zero times
+         infinity NaN fails both comparisons) or empty.
+      */
+      template <typename T>
+      inline void clip_slab(const T& origin, const T& inverse, const T& low, const T& high, T& tmin, T& tmax)
+      {
+         const T t0 = (low  - origin) * inverse;
+         const T t1 = (high - origin) * inverse;
+
+         const T t_near = (inverse < T(0.0)) ? t1 : t0;
+         const T t_far  = (inverse < T(0.0)) ? t0 : t1;
+
+         tmin = (t_near > tmin) ? t_near : tmin;
+         tmax = (t_far  < tmax) ? t_far  : tmax;
+      }
+
+      template <typename T>
+      inline bool ray_box_slab(const T& ox, const T& oy, const T& oz,
+                               const T& ix, const T& iy, const T& iz,
+                               const box<T,3>& box, T& tmin, T& tmax)
+      {
+         clip_slab(ox,ix,box[0].x,box[1].x,tmin,tmax);
+         clip_slab(oy,iy,box[0].y,box[1].y,tmin,tmax);
+         clip_slab(oz,iz,box[0].z,box[1].z,tmin,tmax);
+
+         return (tmin < tmax);
+      }
+
+      /* Unit direction, t is the entry distance, zero when the origin is inside the sphere. */
+      template <typename T>
+      inline bool ray_sphere(const T& ox, const T& oy, const T& oz,
+                             const T& dx, const T& dy, const T& dz,
+                             const sphere<T>& sphere, T& t)
+      {
+         const T px = ox - sphere.x;
+         const T py = oy - sphere.y;
+         const T pz = oz - sphere.z;
+         const T c  = (px * px) + (py * py) + (pz * pz) - (sphere.radius * sphere.radius);
+         const T b  = (px * dx) + (py * dy) + (pz * dz);
+
+         const T discriminant = (b * b) - c;
+         const bool inside    = (c <= T(Epsilon));
+
+         t = inside ? T(0.0) : (-b - sqrt((discriminant > T(0.0)) ? discriminant : T(0.0)));
+
+         return inside | ((b < -T(Epsilon)) & (discriminant >= -T(Epsilon)));
+      }
+
+      /* Moller-Trumbore, t is the distance along the direction to the hit. */
+      template <typename T>
+      inline bool ray_triangle(const T& ox, const T& oy, const T& oz,
+                               const T& dx, const T& dy, const T& dz,
+                               const triangle<T,3>& triangle, T& t)
+      {
+         const T edge1_x = triangle[1].x - triangle[0].x;
+         const T edge1_y = triangle[1].y - triangle[0].y;
+         const T edge1_z = triangle[1].z - triangle[0].z;
+         const T edge2_x = triangle[2].x - triangle[0].x;
+         const T edge2_y = triangle[2].y - triangle[0].y;
+         const T edge2_z = triangle[2].z - triangle[0].z;
+
+         const T pvec_x = (dy * edge2_z) - (dz * edge2_y);
+         const T pvec_y = (dz * edge2_x) - (dx * edge2_z);
+         const T pvec_z = (dx * edge2_y) - (dy * edge2_x);
+
+         const T det = edge1_x * pvec_x + edge1_y * pvec_y + edge1_z * pvec_z;
+
+         const bool valid = (-T(Epsilon) > det) | (det > T(Epsilon));
+
+         const T inv_det = T(1.0) / (valid ? det : T(1.0));
+
+         const T tvec_x = ox - triangle[0].x;
+         const T tvec_y = oy - triangle[0].y;
+         const T tvec_z = oz - triangle[0].z;
+
+         const T u = (tvec_x * pvec_x + tvec_y * pvec_y + tvec_z * pvec_z) * inv_det;
+
+         const T qvec_x = (tvec_y * edge1_z) - (tvec_z * edge1_y);
+         const T qvec_y = (tvec_z * edge1_x) - (tvec_x * edge1_z);
+         const T qvec_z = (tvec_x * edge1_y) - (tvec_y * edge1_x);
+
+         const T v = (dx * qvec_x + dy * qvec_y + dz * qvec_z) * inv_det;
+
+         t = (edge2_x * qvec_x + edge2_y * qvec_y + edge2_z * qvec_z) * inv_det;
+
+         return valid & (u >= T(0.0)) & (u <= T(1.0)) & (v >= T(0.0)) & ((u + v) <= T(1.0)) & (t > T(0.0));
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3,
+                         const T& x4, const T& y4)
+   {
+      WYKOBI_INSTRUMENT(intersect);
+
+      const T ax = x2 - x1;
+      const T bx = x3 - x4;
+
+      T lowerx;
+      T upperx;
+      T uppery;
+      T lowery;
+
+      if (ax < T(0.0))
+      {
+         lowerx = x2;
+         upperx = x1;
+      }
+      else
+      {
+         upperx = x2;
+         lowerx = x1;
+      }
+
+      if (bx > T(0.0))
+      {
+         if ((upperx < x4) || (x3 < lowerx))
+         return false;
+      }
+      else if ((upperx < x3) || (x4 < lowerx))
+         return false;
+
+      const T ay = y2 - y1;
+      const T by = y3 - y4;
+
+      if (ay < T(0.0))
+      {
+         lowery = y2;
+         uppery = y1;
+      }
+      else
+      {
+         uppery = y2;
+         lowery = y1;
+      }
+
+      if (by > T(0.0))
+      {
+         if ((uppery < y4) || (y3 < lowery))
+            return false;
+      }
+      else if ((uppery < y3) || (y4 < lowery))
+         return false;
+
+      const T cx = x1 - x3;
+      const T cy = y1 - y3;
+      const T  d = (by * cx) - (bx * cy);
+      const T  f = (ay * bx) - (ax * by);
+
+      if (f > T(0.0))
+      {
+         if ((d < T(0.0)) || (d > f))
+            return false;
+      }
+      else if ((d > T(0.0)) || (d < f))
+         return false;
+
+      const T e = (ax * cy) - (ay * cx);
+
+      if (f > T(0.0))
+      {
+         if ((e < T(0.0)) || (e > f))
+            return false;
+      }
+      else if ((e > T(0.0)) || (e < f))
+         return false;
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3,
+                         const T& x4, const T& y4,
+                               T& ix,       T& iy)
+   {
+      WYKOBI_INSTRUMENT(intersect);
+
+      const T ax = x2 - x1;
+      const T bx = x3 - x4;
+
+      T lowerx;
+      T upperx;
+      T uppery;
+      T lowery;
+
+      if (ax < T(0.0))
+      {
+         lowerx = x2;
+         upperx = x1;
+      }
+      else
+      {
+         upperx = x2;
+         lowerx = x1;
+      }
+
+      if (bx > T(0.0))
+      {
+         if ((upperx < x4) || (x3 < lowerx))
+            return false;
+      }
+      else if ((upperx < x3) || (x4 < lowerx))
+         return false;
+
+      const T ay = y2 - y1;
+      const T by = y3 - y4;
+
+      if (ay < T(0.0))
+      {
+         lowery = y2;
+         uppery = y1;
+      }
+      else
+      {
+         uppery = y2;
+         lowery = y1;
+      }
+
+      if (by > T(0.0))
+      {
+         if ((uppery < y4) || (y3 < lowery))
+            return false;
+      }
+      else if ((uppery < y3) || (y4 < lowery))
+         return false;
+
+      const T cx = x1 - x3;
+      const T cy = y1 - y3;
+      const T d  = (by * cx) - (bx * cy);
+      const T f  = (ay * bx) - (ax * by);
+
+      if (f > T(0.0))
+      {
+         if ((d < T(0.0)) || (d > f))
+            return false;
+      }
+      else if ((d > T(0.0)) || (d < f))
+         return false;
+
+      const T e = (ax * cy) - (ay * cx);
+
+      if (f > T(0.0))
+      {
+         if ((e < T(0.0)) || (e > f))
+            return false;
+      }
+      else if ((e > T(0.0)) || (e < f))
+         return false;
+
+      T ratio = (ax * -by) - (ay * -bx);
+
+      if (not_equal(ratio,T(0.0)))
+      {
+         ratio = ((cy * -bx) - (cx * -by)) / ratio;
+         ix    = x1 + (ratio * ax);
+         iy    = y1 + (ratio * ay);
+      }
+      else
+      {
+         if (is_equal((ax * -cy),(-cx * ay)))
+         {
+            ix = x3;
+            iy = y3;
+         }
+         else
+         {
+            ix = x4;
+            iy = y4;
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point2d<T>& point1,const point2d<T>& point2,
+                         const point2d<T>& point3,const point2d<T>& point4)
+   {
+      return intersect(point1.x,point1.y,
+                       point2.x,point2.y,
+                       point3.x,point3.y,
+                       point4.x,point4.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point2d<T>& point1, const point2d<T>& point2,
+                         const point2d<T>& point3, const point2d<T>& point4, point2d<T>& int_point)
+   {
+      return intersect(point1   .x, point1   .y,
+                       point2   .x, point2   .y,
+                       point3   .x, point3   .y,
+                       point4   .x, point4   .y,
+                       int_point.x, int_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return intersect(segment1[0],segment1[1],segment2[0],segment2[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect_vertical_horizontal(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return (((segment1[0].y <= segment2[0].y) && (segment2[0].y <= segment1[1].y)) ||
+              ((segment1[1].y <= segment2[0].y) && (segment2[0].y <= segment1[0].y))) &&
+              (
+                ((segment2[0].x <= segment1[0].x) && (segment1[0].x <= segment2[1].x)) ||
+                ((segment2[1].x <= segment1[0].x) && (segment1[0].x <= segment2[0].x))
+              );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect_vertical_vertical(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return (segment1[0].x == segment2[0].x) &&
+             (
+               ((segment1[0].y <= segment2[0].y) && (segment2[0].y <= segment1[1].y)) ||
+               ((segment1[0].y <= segment2[1].y) && (segment2[1].y <= segment1[1].y))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect_horizontal_horizontal(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return (segment1[0].y == segment2[0].y) &&
+             (
+               ((segment1[0].x <= segment2[0].x) && (segment2[0].x <= segment1[1].x)) ||
+               ((segment1[0].x <= segment2[1].x) && (segment2[1].x <= segment1[1].x))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2, T& ix,T& iy)
+   {
+      return intersect(segment1[0].x,segment1[0].y,segment1[1].x,segment1[1].y,
+                       segment2[0].x,segment2[0].y,segment2[1].x,segment2[1].y,
+                       ix,iy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment1, const segment<T,2>& segment2,point2d<T>& i_point)
+   {
+      return intersect(segment1[0].x,segment1[0].y,segment1[1].x,segment1[1].y,
+                       segment2[0].x,segment2[0].y,segment2[1].x,segment2[1].y,
+                       i_point.x,i_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3,
+                         const T& x4, const T& y4, const T& z4,
+                         const T& fuzzy)
+   {
+      WYKOBI_INSTRUMENT(intersect);
+
+      return (less_than_or_equal(lay_distance_segment_to_segment(x1,y1,z1,x2,y2,z2,x3,y3,z3,x4,y4,z4),fuzzy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const point3d<T>& point1,
+                         const point3d<T>& point2,
+                         const point3d<T>& point3,
+                         const point3d<T>& point4,
+                         const T& fuzzy)
+   {
+      return intersect
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z,
+               point4.x, point4.y, point4.z,
+               fuzzy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment1, const segment<T,3>& segment2, const T& fuzzy)
+   {
+      return intersect(segment1[0],segment1[1],segment2[0],segment2[1],fuzzy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const rectangle<T>& rectangle)
+   {
+      if (intersect(rectangle,make_rectangle(segment[0],segment[1])))
+      {
+
+         int orin = orientation(segment[0],segment[1],rectangle[0].x,rectangle[0].y);
+
+         if (
+              (orientation(segment[0],segment[1],rectangle[0].x,rectangle[1].y) == orin) &&
+              (orientation(segment[0],segment[1],rectangle[1].x,rectangle[1].y) == orin) &&
+              (orientation(segment[0],segment[1],rectangle[1].x,rectangle[0].y) == orin)
+            )
+            return false;
+         else
+            return true;
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const triangle<T,2>& triangle)
+   {
+      return intersect(segment,edge(triangle,0))    ||
+             intersect(segment,edge(triangle,1))    ||
+             intersect(segment,edge(triangle,2))    ||
+             point_in_triangle(segment[0],triangle) ||
+             point_in_triangle(segment[1],triangle) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const quadix<T,2>& quadix)
+   {
+      return intersect(segment, make_triangle(quadix[0], quadix[1], quadix[2])) ||
+             intersect(segment, make_triangle(quadix[0], quadix[2], quadix[3])) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const line<T,2>& line)
+   {
+      return (orientation(line,segment[0]) * orientation(line,segment[1]) <= 0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const line<T,3>& line, const T& fuzzy)
+   {
+      return intersect
+             (
+               segment,
+               make_segment
+               (
+                 closest_point_on_line_from_point(line, segment[0]),
+                 closest_point_on_line_from_point(line, segment[1])
+               ),
+               fuzzy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const box<T,3>& box)
+   {
+      const T cx = (box[0].x + box[1].x) * T(0.5);
+      const T cy = (box[0].y + box[1].y) * T(0.5);
+      const T cz = (box[0].z + box[1].z) * T(0.5);
+
+      const T ex = box[1].x - cx;
+      const T ey = box[1].y - cy;
+      const T ez = box[1].z - cz;
+
+      const T mx = (segment[0].x + segment[1].x) * T(0.5) - cx;
+      const T my = (segment[0].y + segment[1].y) * T(0.5) - cy;
+      const T mz = (segment[0].z + segment[1].z) * T(0.5) - cz;
+
+      const T dx = segment[1].x - mx;
+      const T dy = segment[1].y - my;
+      const T dz = segment[1].z - mz;
+
+      T adx = abs(dx);
+      if (abs(mx) > ex + adx) return false;
+
+      T ady = abs(dy);
+      if (abs(my) > ey + ady) return false;
+
+      T adz = abs(dz);
+      if (abs(mz) > ez + adz) return false;
+
+      adx += T(Epsilon);
+      ady += T(Epsilon);
+      adz += T(Epsilon);
+
+      if (abs(my * dz - mz * dy) > (ey * adz + ez * ady)) return false;
+      if (abs(mz * dx - mx * dz) > (ex * adz + ez * adx)) return false;
+      if (abs(mx * dy - my * dx) > (ex * ady + ey * adx)) return false;
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const circle<T>& circle)
+   {
+      T px;
+      T py;
+
+      closest_point_on_segment_from_point
+      (
+        segment[0].x, segment[0].y, segment[1].x, segment[1].y,
+        circle.x, circle.y,
+        px, py
+      );
+
+      return (lay_distance(px,py,circle.x,circle.y) <= (circle.radius * circle.radius));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::segment<T,2>,quadratic_bezier<T,2> >
+             (segment, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,2>& segment, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::segment<T,2>,cubic_bezier<T,2> >
+             (segment, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const sphere<T>& sphere)
+   {
+      const T a = lay_distance(segment);
+      const T b = 2 * ((segment[1].x - segment[0].x) * (segment[0].x - sphere.x) + (segment[1].y - segment[0].y) * (segment[0].y - sphere.y) + (segment[1].z - segment[0].z) * (segment[0].z  - sphere.z));
+      const T c = sqr(sphere.x) + sqr(sphere.y) + sqr(sphere.z) + sqr(segment[1].x) + sqr(segment[1].y) + sqr(segment[1].z) - 2 * (sphere.x * segment[1].x + sphere.y * segment[1].y + sphere.z * segment[1].z) - sqr(sphere.radius);
+
+      //((b * b - 4 * a * c) >= 0)
+      return greater_than_or_equal((b * b - 4 * a * c),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const plane<T,3>& plane)
+   {
+      T signed_dist1 = dot_product(plane.normal,make_vector(segment[0])) - plane.constant;
+      T signed_dist2 = dot_product(plane.normal,make_vector(segment[1])) - plane.constant;
+
+      signed_dist1 = (is_equal(abs(signed_dist1),T(0.0)))? T(0.0) : signed_dist1;
+      signed_dist2 = (is_equal(abs(signed_dist2),T(0.0)))? T(0.0) : signed_dist2;
+
+      return less_than_or_equal(signed_dist1 * signed_dist2,T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const quadratic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,3,wykobi::segment<T,3>,quadratic_bezier<T,3> >
+             (segment, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const segment<T,3>& segment, const cubic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,3,wykobi::segment<T,3>,cubic_bezier<T,3> >
+             (segment, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line, const triangle<T,2>& triangle)
+   {
+      const int or1 = orientation (line[0], line[1], triangle[0]);
+
+      if (0 == or1) return true;
+      int or2 = orientation (line[0], line[1], triangle[1]);
+
+      if (or2 != or1) return true;
+      or2 = orientation (line[0], line[1], triangle[2]);
+
+      return (or2 != or1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line, const quadix<T,2>& quadix)
+   {
+      const int or1 = orientation (line[0], line[1], quadix[0]);
+
+      if (0 == or1) return true;
+      int or2 = orientation (line[0], line[1], quadix[1]);
+
+      if (or2 != or1) return true;
+      or2 = orientation (line[0], line[1], quadix[2]);
+
+      if (or2 != or1) return true;
+      or2 = orientation (line[0], line[1], quadix[3]);
+
+      return (or2 != or1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line1, const line<T,2>& line2)
+   {
+      return line_to_line_intersect(line1,line2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line, const circle<T>& circle)
+   {
+      /*
+         It is assumed that an intersection of a circle by a line
+         is either a full intersection (2 points), partial intersection
+         (1 point), or tangential.
+         anything else will result in a false output.
+      */
+      const T x1 = line[0].x - circle.x;
+      const T y1 = line[0].y - circle.y;
+      const T x2 = line[1].x - circle.x;
+      const T y2 = line[1].y - circle.y;
+
+      return greater_than_or_equal(((circle.radius * circle.radius) * lay_distance(x1,y1,x2,y2) - sqr(x1 * y2 - x2 * y1)),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::line<T,2>,quadratic_bezier<T,2> >
+             (line, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,2>& line, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::line<T,2>,cubic_bezier<T,2> >
+             (line, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,3>& line, const triangle<T,3>& triangle)
+   {
+      vector3d<T> diff     = line[0] - triangle[0];
+      vector3d<T> line_dir = line[1] - line[0];
+      vector3d<T> edge1    = triangle[1] - triangle[0];
+      vector3d<T> edge2    = triangle[2] - triangle[0];
+      vector3d<T> normal   = edge1 * edge2;
+
+      T denom =  dot_product(line_dir,normal);
+      T sign  = 0.0;
+
+      if (denom > T(0.0))
+      {
+         sign = T(1.0);
+      }
+      else if (denom < T(0.0))
+      {
+         sign  = T(-1.0);
+         denom = -denom;
+      }
+      else
+         return false;
+
+      T val1 = sign * dot_product(line_dir,(diff * edge2));
+
+      if (greater_than_or_equal(val1,T(0.0)))
+      {
+         T val2 = sign * dot_product(line_dir,edge1 * diff);
+
+         if (greater_than_or_equal(val2,T(0.0)))
+         {
+            if (val1 + val2 <= denom)
+            {
+               return true;
+            }
+         }
+      }
+
+      return false;
+   }
+
+   template <typename T> WYKOBI_INLINE bool intersect(const line<T,3>& line, const plane<T,3>& plane)
+   {
+      return not_equal(dot_product((line[1] - line[0]),plane.normal),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,3>& line, const sphere<T>& sphere)
+   {
+      const T a =  sqr(line[1].x - line[0].x) + sqr(line[1].y - line[0].y) + sqr(line[1].z - line[0].z);
+
+      const T b =  T(2.0) * ((line[1].x - line[0].x) * (line[0].x - sphere.x) +
+                             (line[1].y - line[0].y) * (line[0].y - sphere.y) +
+                             (line[1].z - line[0].z) * (line[0].z - sphere.z));
+
+      const T c =  sqr(sphere.x)  + sqr(sphere.y)  + sqr(sphere.z) +
+                   sqr(line[0].x) + sqr(line[0].y) + sqr(line[0].z) -
+                   T(2.0) * (sphere.x * line[0].x + sphere.y * line[0].y + sphere.z * line[0].z) - sqr(sphere.radius);
+
+      return greater_than_or_equal(b * b - 4 * a * c, T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,3>& line, const quadratic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,3,wykobi::line<T,3>,quadratic_bezier<T,3> >
+             (line, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const line<T,3>& line, const cubic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,3,wykobi::line<T,3>,cubic_bezier<T,3> >
+             (line, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const circle<T>& circle)
+   {
+      return point_in_circle
+             (
+               closest_point_on_triangle_from_point(triangle, circle.x, circle.y),
+               circle
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const rectangle<T>& rectangle)
+   {
+      return intersect(make_segment(triangle[0],triangle[1]),rectangle) ||
+             intersect(make_segment(triangle[1],triangle[2]),rectangle) ||
+             intersect(make_segment(triangle[2],triangle[0]),rectangle) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::triangle<T,2>,quadratic_bezier<T,2> >
+             (triangle, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,2,wykobi::triangle<T,2>,cubic_bezier<T,2> >(triangle,bezier,steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      for (std::size_t i = 0; i < triangle<T,2>::PointCount; ++i)
+      {
+         if (
+               is_equal(minimum_distance_from_point_to_triangle(triangle1[i],triangle2),T(0.0)) ||
+               is_equal(minimum_distance_from_point_to_triangle(triangle2[i],triangle1),T(0.0))
+            )
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      return rectangle_to_rectangle_intersect
+             (
+               rectangle1[0].x, rectangle1[0].y,
+               rectangle1[1].x, rectangle1[1].y,
+               rectangle2[0].x, rectangle2[0].y,
+               rectangle2[1].x, rectangle2[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::rectangle<T>,quadratic_bezier<T,2> >
+             (rectangle, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::rectangle<T>,cubic_bezier<T,2> >
+             (rectangle, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const rectangle<T>& rectangle, const circle<T>& circle)
+   {
+      return  point_in_circle
+              (
+                closest_point_on_rectangle_from_point(rectangle, circle.x, circle.y),
+                circle
+              );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const quadix<T,2>& quadix, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::quadix<T,2>,quadratic_bezier<T,2> >
+             (quadix, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const quadix<T,2>& quadix, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect
+             <T,2,wykobi::quadix<T,2>,cubic_bezier<T,2> >
+             (quadix, bezier, steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return (lay_distance(circle1.x,circle1.y,circle2.x,circle2.y) <= ((circle1.radius + circle2.radius) * (circle1.radius + circle2.radius)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const circle<T>& circle, const quadratic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,2,wykobi::circle<T>,quadratic_bezier<T,2> >(circle,bezier,steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const circle<T>& circle, const cubic_bezier<T,2>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,2,wykobi::circle<T>,cubic_bezier<T,2> >(circle,bezier,steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const box<T,3>& box, const sphere<T>& sphere)
+   {
+      return point_in_sphere(closest_point_on_box_from_point(box,sphere.x,sphere.y,sphere.z),sphere);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const obb<T,2>& obb1, const obb<T,2>& obb2)
+   {
+      /* Separating axis test over the two face normals of each box */
+      const vector2d<T> t = obb2.center - obb1.center;
+
+      for (std::size_t i = 0; i < obb<T,2>::AxisCount; ++i)
+      {
+         const T ra = obb1.half_length[i];
+         const T rb = obb2.half_length[0] * abs(dot_product(obb1.axis[i],obb2.axis[0])) +
+                      obb2.half_length[1] * abs(dot_product(obb1.axis[i],obb2.axis[1]));
+
+         if (abs(dot_product(t,obb1.axis[i])) > (ra + rb))
+            return false;
+      }
+
+      for (std::size_t i = 0; i < obb<T,2>::AxisCount; ++i)
+      {
+         const T ra = obb1.half_length[0] * abs(dot_product(obb2.axis[i],obb1.axis[0])) +
+                      obb1.half_length[1] * abs(dot_product(obb2.axis[i],obb1.axis[1]));
+         const T rb = obb2.half_length[i];
+
+         if (abs(dot_product(t,obb2.axis[i])) > (ra + rb))
+            return false;
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const obb<T,3>& obb1, const obb<T,3>& obb2)
+   {
+      /*
+         Separating axis test over the 15 candidate axes: 3 face
+         normals of each box and the 9 pairwise edge cross products.
+         r[i][j] expresses obb2 in the frame of obb1, the epsilon
+         term guards the cross products of near parallel edges.
+      */
+      T r    [3][3];
+      T abs_r[3][3];
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         for (std::size_t j = 0; j < 3; ++j)
+         {
+            r    [i][j] = dot_product(obb1.axis[i],obb2.axis[j]);
+            abs_r[i][j] = abs(r[i][j]) + T(Epsilon);
+         }
+      }
+
+      const vector3d<T> d = obb2.center - obb1.center;
+      const T t[3] = {
+                       dot_product(d,obb1.axis[0]),
+                       dot_product(d,obb1.axis[1]),
+                       dot_product(d,obb1.axis[2])
+                     };
+
+      const T* a = obb1.half_length;
+      const T* b = obb2.half_length;
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         const T ra = a[i];
+         const T rb = b[0] * abs_r[i][0] + b[1] * abs_r[i][1] + b[2] * abs_r[i][2];
+
+         if (abs(t[i]) > (ra + rb))
+            return false;
+      }
+
+      for (std::size_t j = 0; j < 3; ++j)
+      {
+         const T ra = a[0] * abs_r[0][j] + a[1] * abs_r[1][j] + a[2] * abs_r[2][j];
+         const T rb = b[j];
+
+         if (abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > (ra + rb))
+            return false;
+      }
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         const std::size_t i1 = (i + 1) % 3;
+         const std::size_t i2 = (i + 2) % 3;
+
+         for (std::size_t j = 0; j < 3; ++j)
+         {
+            const std::size_t j1 = (j + 1) % 3;
+            const std::size_t j2 = (j + 2) % 3;
+
+            const T ra = a[i1] * abs_r[i2][j] + a[i2] * abs_r[i1][j];
+            const T rb = b[j1] * abs_r[i][j2] + b[j2] * abs_r[i][j1];
+
+            if (abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > (ra + rb))
+               return false;
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      return (lay_distance(sphere1.x,sphere1.y,sphere1.z,sphere2.x,sphere2.y,sphere2.z) <= ((sphere1.radius + sphere2.radius) * (sphere1.radius + sphere2.radius)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const sphere<T>& sphere, const quadratic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,3,wykobi::sphere<T>,quadratic_bezier<T,3> >(sphere,bezier,steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const sphere<T>& sphere, const cubic_bezier<T,3>& bezier, const std::size_t& steps)
+   {
+      return simplex_to_bezier_intersect<T,3,wykobi::sphere<T>,cubic_bezier<T,3> >(sphere,bezier,steps);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray1, const ray<T,2>& ray2)
+   {
+      const T denom = dot_product(perpendicular(ray1.direction),ray2.direction);
+
+      if (denom != T(0.0))
+      {
+         vector2d<T> diff = ray1.origin - ray2.origin;
+
+         const T s = dot_product(perpendicular(ray1.direction),diff) / denom;
+         const T t = dot_product(perpendicular(ray2.direction),diff) / denom;
+
+         return (greater_than_or_equal(t,T(0.0)) &&  greater_than_or_equal(s,T(0.0)));
+      }
+      else // parallel
+        return (point_on_ray(ray2.origin,ray1) || point_on_ray(ray1.origin,ray2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray1, const ray<T,3>& ray2)
+   {
+      if (!coplanar(ray1,ray2)) return false;
+
+      const T denom = dot_product(perpendicular(ray1.direction),ray2.direction);
+
+      if (denom != T(0.0))
+      {
+         vector3d<T> diff = ray1.origin - ray2.origin;
+
+         const T s = dot_product(perpendicular(ray1.direction),diff) / denom;
+         const T t = dot_product(perpendicular(ray2.direction),diff) / denom;
+
+         return (greater_than_or_equal(t,T(0.0)) &&  greater_than_or_equal(s,T(0.0)));
+      }
+      else // parallel
+        return (point_on_ray(ray2.origin,ray1) || point_on_ray(ray1.origin,ray2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const segment<T,2>& segment)
+   {
+      vector2d<T> delta = perpendicular(segment[1] - segment[0]);
+
+      const T denom = dot_product(delta,ray.direction);
+
+      if (denom != T(0.0))
+      {
+         vector2d<T> diff = ray.origin - segment[0];
+
+         const T s = dot_product(delta, diff) / denom;
+         const T t = dot_product(perpendicular(ray.direction), diff) / denom;
+
+         return greater_than_or_equal(t, T(0.0)) &&
+                less_than_or_equal   (t, T(1.0)) &&
+                greater_than_or_equal(s, T(0.0));
+      }
+      else
+        return point_on_ray(segment[0],ray);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const segment<T,3>& segment)
+   {
+      if (robust_coplanar(segment[0],segment[1],ray.origin,generate_point_on_ray(ray,T(1.0))))
+         return point_on_segment(closest_point_on_ray_from_point(ray,segment[0]),segment);
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const rectangle<T>& rectangle)
+   {
+      T tmin = 0.0;
+      T tmax = 1.0;
+      T t;
+
+      if (not_equal(ray.direction.x,T(0.0)))
+      {
+         const T recip_dirx = T(1.0) / ray.direction.x;
+
+         if (ray.direction.x > T(0.0))
+         {
+            if ((t = (rectangle[1].x - ray.origin.x) * recip_dirx) < tmin) { return false; } tmax = min(t,tmax);
+            if ((t = (rectangle[0].x - ray.origin.x) * recip_dirx) > tmax) { return false; } tmin = max(t,tmin);
+         }
+         else
+         {
+            if ((t = (rectangle[0].x - ray.origin.x) * recip_dirx) < tmin) { return false; } tmax = min(t,tmax);
+            if ((t = (rectangle[1].x - ray.origin.x) * recip_dirx) > tmax) { return false; } tmin = max(t,tmin);
+         }
+      }
+      else if ((ray.origin.x < rectangle[0].x) || (ray.origin.x > rectangle[1].x))
+         return false;
+
+      if (not_equal(ray.direction.y,T(0.0)))
+      {
+         const T recip_diry = T(1.0) / ray.direction.y;
+
+         if (ray.direction.y > T(0.0))
+         {
+            if ((t = (rectangle[1].y - ray.origin.y) * recip_diry) < tmin) { return false; } tmax = min(t,tmax);
+            if ((t = (rectangle[0].y - ray.origin.y) * recip_diry) > tmax) { return false; } tmin = max(t,tmin);
+         }
+         else
+         {
+            if ((t = (rectangle[0].y - ray.origin.y) * recip_diry) < tmin) { return false; } tmax = min(t,tmax);
+            if ((t = (rectangle[1].y - ray.origin.y) * recip_diry) > tmax) { return false; } tmin = max(t,tmin);
+         }
+      }
+      else if ((ray.origin.y < rectangle[0].y) || (ray.origin.y > rectangle[1].y))
+         return false;
+
+      return (tmin < tmax);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const box<T,3>& box)
+   {
+      T tmin = T(0.0);
+      T tmax = T(1.0);
+
+      return detail::ray_box_slab(ray.origin.x,ray.origin.y,ray.origin.z,
+                                  detail::slab_inverse(ray.direction.x),
+                                  detail::slab_inverse(ray.direction.y),
+                                  detail::slab_inverse(ray.direction.z),
+                                  box,tmin,tmax);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const triangle<T,2>& triangle)
+   {
+      if (point_in_triangle(ray.origin, triangle))
+         return true;
+      else
+         return intersect(ray,edge(triangle,0)) ||
+                intersect(ray,edge(triangle,1)) ||
+                intersect(ray,edge(triangle,2)) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const triangle<T,3>& triangle)
+   {
+      T t;
+
+      return detail::ray_triangle(ray.origin.x,ray.origin.y,ray.origin.z,
+                                  ray.direction.x,ray.direction.y,ray.direction.z,
+                                  triangle,t);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const quadix<T,2>& quadix)
+   {
+      if (point_in_quadix(ray.origin, quadix))
+         return true;
+      else
+         return intersect(ray, edge(quadix, 0)) ||
+                intersect(ray, edge(quadix, 1)) ||
+                intersect(ray, edge(quadix, 2)) ||
+                intersect(ray, edge(quadix, 3)) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const circle<T>& circle)
+   {
+      const T dx = ray.origin.x - circle.x;
+      const T dy = ray.origin.y - circle.y;
+      const T c  = (dx * dx) + (dy * dy) - (circle.radius * circle.radius);
+
+      if (less_than_or_equal(c,T(0.0)))
+      {
+         return true;
+      }
+
+      const T b = dx * ray.direction.x + dy * ray.direction.y;
+
+      if (greater_than_or_equal(b,T(0.0)))
+      {
+         return false;
+      }
+
+      return greater_than_or_equal(b * b,c);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const sphere<T>& sphere)
+   {
+      T t;
+
+      return detail::ray_sphere(ray.origin.x,ray.origin.y,ray.origin.z,
+                                ray.direction.x,ray.direction.y,ray.direction.z,
+                                sphere,t);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,3>& ray, const plane<T,3>& plane)
+   {
+      const T denom = dot_product(ray.direction,plane.normal);
+
+      if (not_equal(denom,T(0.0)))
+      {
+         return ((-distance(ray.origin,plane) / denom) >= T(0.0));
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const ray<T,2>& ray, const polygon<T,2>& polygon)
+   {
+      if (polygon.size() < 3) return false;
+
+      std::size_t j = polygon.size() - 1;
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if (intersect(ray,make_segment(polygon[i],polygon[j])))
+         {
+            return true;
+         }
+
+         j = i;
+      }
+
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const plane<T,3>& plane1, const plane<T,3>& plane2)
+   {
+      return is_equal(dot_product(plane1.normal,plane2.normal),T(1.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const plane<T,3>& plane, const sphere<T>& sphere)
+   {
+      return less_than_or_equal(distance(make_point(sphere.x,sphere.y,sphere.z),plane),sphere.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool intersect(const plane<T,3>& plane, const line<T,3>& line)
+   {
+      return not_equal(dot_product(plane.normal,(line[1] - line[0])),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3,
+                                const T& x4, const T& y4)
+   {
+      return (
+              ((orientation(x1,y1,x2,y2,x3,y3) * orientation(x1,y1,x2,y2,x4,y4)) <= 0) &&
+              ((orientation(x3,y3,x4,y4,x1,y1) * orientation(x3,y3,x4,y4,x2,y2)) <= 0)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const point2d<T>& point1, const point2d<T>& point2,
+                                const point2d<T>& point3, const point2d<T>& point4)
+   {
+      return simple_intersect
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool simple_intersect(const segment<T,2>& segment1, const segment<T,2>& segment2)
+   {
+      return simple_intersect(segment1[0],segment1[1],segment2[0],segment2[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const T& x4, const T& y4,
+                                        T& ix,       T& iy)
+   {
+      const T dx1 = x2 - x1;
+      const T dx2 = x4 - x3;
+      const T dx3 = x1 - x3;
+
+      const T dy1 = y2 - y1;
+      const T dy2 = y1 - y3;
+      const T dy3 = y4 - y3;
+
+      T ratio = dx1 * dy3 - dy1 * dx2;
+
+      if (not_equal(ratio,T(0.0)))
+      {
+         ratio = (dy2 * dx2 - dx3 * dy3) / ratio;
+         ix    = x1 + ratio * dx1;
+         iy    = y1 + ratio * dy1;
+      }
+      else
+      {
+         if (is_equal((dx1 * -dy2),(-dx3 * dy1)))
+         {
+            ix = x3;
+            iy = y3;
+         }
+         else
+         {
+            ix = x4;
+            iy = y4;
+         }
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const point2d<T>& point4,
+                                        T& ix,       T& iy)
+   {
+      intersection_point(point1.x, point1.y,
+                         point2.x, point2.y,
+                         point3.x, point3.y,
+                         point4.x, point4.y,
+                               ix,       iy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const point2d<T>& point1,
+                                        const point2d<T>& point2,
+                                        const point2d<T>& point3,
+                                        const point2d<T>& point4)
+   {
+      point2d<T> point_;
+      intersection_point(point1.x, point1.y,
+                         point2.x, point2.y,
+                         point3.x, point3.y,
+                         point4.x, point4.y,
+                         point_.x, point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const segment<T,2>& segment1,
+                                        const segment<T,2>& segment2)
+   {
+      return intersection_point(segment1[0],segment1[1],segment2[0],segment2[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void  intersection_point(const T& x1, const T& y1, const T& z1,
+                                   const T& x2, const T& y2, const T& z2,
+                                   const T& x3, const T& y3, const T& z3,
+                                   const T& x4, const T& y4, const T& z4,
+                                         T& ix,       T& iy,       T& iz, const T& fuzzy)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+      const T uz = z2 - z1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+      const T vz = z4 - z3;
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+      const T wz = z1 - z3;
+
+      const T a  = (ux * ux + uy * uy + uz * uz);
+      const T b  = (ux * vx + uy * vy + uz * vz);
+      const T c  = (vx * vx + vy * vy + vz * vz);
+      const T d  = (ux * wx + uy * wy + uz * wz);
+      const T e  = (vx * wx + vy * wy + vz * wz);
+      const T dt = a * c - b * b;
+
+      T sd = dt;
+      T td = dt;
+
+      T sn = T(0.0);
+      T tn = T(0.0);
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sn = T(0.0);
+         sd = T(1.00);
+         tn = e;
+         td = c;
+      }
+      else
+      {
+         sn = (b * e - c * d);
+         tn = (a * e - b * d);
+
+         if (sn < T(0.0))
+         {
+            sn = T(0.0);
+            tn = e;
+            td = c;
+         }
+         else if (sn > sd)
+         {
+            sn = sd;
+            tn = e + b;
+            td = c;
+         }
+      }
+
+      if (tn < T(0.0))
+      {
+         tn = T(0.0);
+
+         if (-d < T(0.0))
+            sn = T(0.0);
+         else if (-d > a)
+            sn = sd;
+         else
+         {
+            sn = -d;
+            sd = a;
+         }
+      }
+      else if (tn > td)
+      {
+         tn = td;
+
+         if ((-d + b) < T(0.0))
+            sn = T(0.0);
+         else if ((-d + b) > a)
+            sn = sd;
+         else
+         {
+            sn = (-d + b);
+            sd = a;
+         }
+      }
+
+      T sc = T(0.0);
+      T tc = T(0.0);
+
+      if (is_equal(sn,T(0.0)))
+         sc = T(0.0);
+      else
+         sc = sn / sd;
+
+      if (is_equal(tn,T(0.0)))
+         tc = T(0.0);
+      else
+         tc = tn / td;
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+      const T dz = wz + (sc * uz) - (tc * vz);
+
+      if ((dx * dx + dy * dy + dz * dz) <= sqr(fuzzy))
+      {
+         ix = ((x1 + (sc * ux)) + (x3 + (tc * vx))) * T(0.5);
+         iy = ((y1 + (sc * uy)) + (y3 + (tc * vy))) * T(0.5);
+         iz = ((z1 + (sc * uz)) + (z3 + (tc * vz))) * T(0.5);
+      }
+      else
+      {
+         ix = +infinity<T>();
+         iy = +infinity<T>();
+         iz = +infinity<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3,
+                                  const point3d<T>& point4,
+                                        T& ix, T& iy, T& iz, const T& fuzzy)
+   {
+      intersection_point(point1.x, point1.y, point1.z,
+                         point2.x, point2.y, point2.z,
+                         point3.x, point3.y, point3.z,
+                         point4.x, point4.y, point4.z,
+                               ix,       iy,       iz,fuzzy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const point3d<T>& point1,
+                                        const point3d<T>& point2,
+                                        const point3d<T>& point3,
+                                        const point3d<T>& point4, const T& fuzzy)
+   {
+      point3d<T> point_;
+
+      intersection_point
+      (
+        point1.x, point1.y, point1.z,
+        point2.x, point2.y, point2.z,
+        point3.x, point3.y, point3.z,
+        point4.x, point4.y, point4.z,
+        point_.x, point_.y, point_.z,
+        fuzzy
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment1,
+                                        const segment<T,3>& segment2, const T& fuzzy)
+   {
+      return intersection_point
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               fuzzy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const segment<T,2>& segment, const line<T,2>& line)
+   {
+      return intersection_point
+             (
+               segment,
+               make_segment
+               (
+                 closest_point_on_line_from_point(line, segment[0]),
+                 closest_point_on_line_from_point(line, segment[1])
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment,
+                                        const line<T,3>& line, const T& fuzzy)
+   {
+      return intersection_point
+             (
+               segment,
+               make_segment
+               (
+                 closest_point_on_line_from_point(line, segment[0]),
+                 closest_point_on_line_from_point(line, segment[1])
+               ),
+               fuzzy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const segment<T,3>& segment,
+                                        const plane<T,3>& plane)
+   {
+      vector3d<T> seg_vec = segment[1] - segment[0];
+
+      const T denom = dot_product(seg_vec,plane.normal);
+
+      point3d<T> ipoint = degenerate_point3d<T>();
+
+      if (not_equal(denom,T(0.0)))
+      {
+         const T t = -distance(segment[0],plane) / denom;
+
+         if ((t > T(0.0)) && (t < T(1.0)))
+         {
+            ipoint = segment[0] + t * (segment[1] - segment[0]);
+         }
+      }
+
+      return ipoint;
+   }
+
+   template <typename T, unsigned int Dimension, typename Simplex, typename Bezier, typename OutputIterator>
+   WYKOBI_INLINE void simplex_to_bezier_intersection_point(const Simplex& simplex,
+                                                    const Bezier& bezier,
+                                                    OutputIterator out,
+                                                    const std::size_t& steps)
+   {
+      if (0 == steps) return;
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * steps - T(1.0));
+
+      bezier_coefficients<T,Dimension,Bezier::Type> coeffs;
+
+      calculate_bezier_coefficients(bezier,coeffs);
+
+      PointType previous_point = create_point_on_bezier(bezier[0],coeffs,t);
+
+      t += dt;
+
+      PointType ipoint;
+
+      for (std::size_t i = 1; i < steps; t += dt, ++i)
+      {
+         PointType current_point = create_point_on_bezier(bezier[0],coeffs,t);
+
+         if (intersect(make_segment(previous_point,current_point),simplex, ipoint))
+         {
+            (*out++) = ipoint;
+         }
+
+         previous_point = current_point;
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const quadratic_bezier<T,2>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps)
+   {
+      simplex_to_bezier_intersection_point
+      <T, 2, wykobi::segment<T,2>, quadratic_bezier<T,2>, OutputIterator>
+      (
+        segment,
+        bezier,
+        out,
+        steps
+      );
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const cubic_bezier<T,2>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps)
+   {
+      simplex_to_bezier_intersection_point
+      <T,2,wykobi::segment<T,2>,cubic_bezier<T,2>,OutputIterator>
+      (
+        segment,
+        bezier,
+        out,
+        steps
+      );
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const quadratic_bezier<T,3>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps)
+   {
+      simplex_to_bezier_intersection_point
+      <T,3,wykobi::segment<T,3>,quadratic_bezier<T,3>,OutputIterator>
+      (
+        segment,
+        bezier,
+        out,
+        steps
+      );
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const cubic_bezier<T,3>& bezier,
+                                  OutputIterator out,
+                                  const std::size_t& steps)
+   {
+      simplex_to_bezier_intersection_point
+      <T,3,wykobi::segment<T,3>,cubic_bezier<T,3>,OutputIterator>
+      (
+        segment,
+        bezier,
+        out,
+        steps
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const line<T,2>& line1,
+                                        const line<T,2>& line2)
+   {
+      const T dx1 = line1[0].x - line1[1].x;
+      const T dx2 = line2[0].x - line2[1].x;
+      const T dx3 = line2[1].x - line1[1].x;
+      const T dy1 = line1[0].y - line1[1].y;
+      const T dy2 = line2[0].y - line2[1].y;
+      const T dy3 = line2[1].y - line1[1].y;
+
+      const T det = (dx2 * dy1) - (dy2 * dx1);
+
+      point2d<T> point_ = make_point<T>(T(0.0),T(0.0));
+
+      if (is_equal(det,T(0.0)))
+      {
+         if (is_equal((dx2 * dy3),(dy2 * dx3)))
+         {
+            point_.x = line2[1].x;
+            point_.y = line2[1].y;
+         }
+
+         return point_;
+      }
+
+      const T ratio  = ((dx1 * dy3) - (dy1 * dx3)) / det;
+
+      point_.x = (ratio * dx2) + line2[1].x;
+      point_.y = (ratio * dy2) + line2[1].y;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const line<T,3>& line1,
+                                        const line<T,3>& line2,
+                                        const T& fuzzy)
+   {
+      point3d<T> point_;
+
+      intersection_point_line_to_line
+      (
+        line1[0].x, line1[0].y, line1[0].z,
+        line1[1].x, line1[1].y, line1[1].z,
+        line2[0].x, line2[0].y, line2[0].z,
+        line2[1].x, line2[1].y, line2[1].z,
+          point_.x,   point_.y,   point_.z,
+        fuzzy
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const circle<T>&  circle1,
+                                  const circle<T>&  circle2,
+                                        point2d<T>& point1,
+                                        point2d<T>& point2)
+   {
+      const T dist    = distance(circle1.x, circle1.y, circle2.x, circle2.y);
+      const T dstsqr  = dist * dist;
+      const T r1sqr   = circle1.radius * circle1.radius;
+      const T r2sqr   = circle2.radius * circle2.radius;
+
+      const T a       = (dstsqr - r2sqr + r1sqr) / (2 * dist);
+      const T h       = sqrt(r1sqr - (a*a));
+
+      const T ratio_a = a / dist;
+      const T ratio_h = h / dist;
+
+            T dx      = circle2.x - circle1.x;
+            T dy      = circle2.y - circle1.y;
+
+      const T phix    = circle1.x + (ratio_a * dx);
+      const T phiy    = circle1.y + (ratio_a * dy);
+
+      dx       = dx * ratio_h;
+      dy       = dy * ratio_h;
+
+      point1.x = phix + dy;
+      point1.y = phiy - dx;
+
+      point2.x = phix - dy;
+      point2.y = phiy + dx;
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>&  segment,
+                                  const triangle<T,2>& triangle,
+                                  OutputIterator       out)
+   {
+      T ix = T(0.0);
+      T iy = T(0.0);
+
+      std::size_t int_count = 0;
+
+      if (intersect(segment,edge(triangle,1),ix,iy))
+      {
+         (*out++) = make_point(ix,iy);
+
+         ++int_count;
+      }
+
+      if (intersect(segment,edge(triangle,2),ix,iy))
+      {
+         if (int_count)
+         {
+            (*out++) = make_point(ix,iy);
+            return;
+         }
+
+         (*out++) = make_point(ix,iy);
+
+         ++int_count;
+      }
+
+      if (intersect(segment,edge(triangle,3),ix,iy))
+      {
+         if (int_count)
+         {
+           (*out++) = make_point(ix,iy);
+            return;
+         }
+
+         (*out++) = make_point(ix,iy);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point(const line<T,3>&     line,
+                                  const triangle<T,3>& triangle,
+                                  point3d<T>&          ipoint)
+   {
+      const vector3d<T> dir = line[1] - line[0];
+      const vector3d<T> u   = triangle[1] - triangle[0];
+      const vector3d<T> v   = triangle[2] - triangle[0];
+      const vector3d<T> n   = u * v;
+      const vector3d<T> w   = line[0] - triangle[0];
+
+      const T a = dot_product(n,w) * T(-1.0);
+      const T b = dot_product(n,dir);
+      const T r = a / b;
+
+      ipoint = line[0] + r * dir;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const line<T,3>&  line,
+                                        const plane<T,3>& plane)
+   {
+      const vector3d<T> line_vec = line[1] - line[0];
+
+      const T denom = dot_product(line_vec,plane.normal);
+
+      point3d<T> ipoint = degenerate_point3d<T>();
+
+      if (not_equal(denom,T(0.0)))
+      {
+         const T t = -distance(line[0],plane) / denom;
+
+         ipoint = line[0] + t * (line[1] - line[0]);
+      }
+
+      return ipoint;
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& cx, const T& cy,
+                                  const T& radius,
+                                  OutputIterator out)
+   {
+      const bool p1_in_circle = point_in_circle(x1, y1, cx, cy, radius);
+      const bool p2_in_circle = point_in_circle(x2, y2, cx, cy, radius);
+
+      T ix = T(0.0);
+      T iy = T(0.0);
+
+      if (p1_in_circle && p2_in_circle)
+      {
+         (*out++) = make_point(x1,y1);
+         (*out++) = make_point(x2,y2);
+
+         return;
+      }
+
+      T px = T(0.0);
+      T py = T(0.0);
+
+      if (p1_in_circle || p2_in_circle)
+      {
+         closest_point_on_line_from_point(x1,y1,x2,y2,cx,cy,px,py);
+
+         if (p1_in_circle)
+         {
+            const T h = distance(px,py,cx,cy);
+            const T a = sqrt((radius * radius) - (h * h));
+
+            (*out++) = make_point(x1,y1);
+
+            project_point(px,py,x2,y2,a,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+         }
+         else if (p2_in_circle)
+         {
+            const T h = distance(px,py,cx,cy);
+            const T a = sqrt((radius * radius) - (h * h));
+
+            (*out++) = make_point(x2,y2);
+
+            project_point(px,py,x1,y1,a,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+         }
+
+         return;
+      }
+
+      closest_point_on_segment_from_point(x1,y1,x2,y2,cx,cy,px,py);
+
+      if (
+           (is_equal(x1,px) && is_equal(y1,py)) ||
+           (is_equal(x2,px) && is_equal(y2,py))
+         )
+         return;
+      else
+      {
+         T h = distance(px,py,cx,cy);
+
+         if (h > radius)
+            return;
+         else if (is_equal(h,radius))
+         {
+            (*out++) = make_point(x1,y1);
+            return;
+         }
+         else if (is_equal(h,T(0.0)))
+         {
+            project_point(cx,cy,x1,y1,radius,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+
+            project_point(cx,cy,x2,y2,radius,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+
+            return;
+         }
+         else
+         {
+            const T a = sqrt((radius * radius) - (h * h));
+
+            project_point(px,py,x1,y1,a,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+
+            project_point(px,py,x2,y2,a,ix,iy);
+
+            (*out++) = make_point(ix,iy);
+         }
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,2>& segment,
+                                  const circle<T>&    circle,
+                                  OutputIterator      out)
+   {
+      intersection_point
+      (
+        segment[0].x, segment[0].y,
+        segment[1].x, segment[1].y,
+        circle.x    , circle.y    , circle.radius,
+        out
+      );
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const line<T,2>& line,
+                                  const circle<T>& circle,
+                                  OutputIterator   out)
+   {
+      const T a =  sqr(line[1].x - line[0].x) + sqr(line[1].y - line[0].y);
+
+      const T b =  T(2.0) * ((line[1].x - line[0].x)*(line[0].x - circle.x) +
+                             (line[1].y - line[0].y)*(line[0].y - circle.y));
+
+      const T c = sqr(circle.x)  + sqr(circle.y)  +
+                  sqr(line[0].x) + sqr(line[0].y) -
+                  T(2.0) * (circle.x * line[0].x + circle.y * line[0].y) - sqr(circle.radius);
+
+      const T det =  b * b - T(4.0) * a * c;
+
+      if (det < T(0.0))
+      {
+         return;
+      }
+      else if (is_equal(det,T(0.0)))
+      {
+         const T delta = -b / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y)
+                    );
+
+         return;
+      }
+      else if (det > T(0.0))
+      {
+         const T sqrt_det = sqrt(det);
+
+         T delta = (-b + sqrt_det) / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y)
+                    );
+
+         delta = (-b - sqrt_det) / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y)
+                    );
+
+         return;
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const segment<T,3>& segment,
+                                  const sphere<T>&    sphere,
+                                  OutputIterator      out)
+   {
+      std::vector< point3d<T> > ipoint_;
+
+      intersection_point(make_line(segment),sphere,std::back_inserter(ipoint_));
+
+      for (std::size_t i = 0; i < ipoint_.size(); ++i)
+      {
+         if (point_in_box(ipoint_[i],segment))
+         {
+            (*out++) = ipoint_[i];
+         }
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const line<T,3>& line,
+                                  const sphere<T>& sphere,
+                                  OutputIterator   out)
+   {
+      const T a =  sqr(line[1].x - line[0].x) + sqr(line[1].y - line[0].y) + sqr(line[1].z - line[0].z);
+
+      const T b =  T(2.0) * ((line[1].x - line[0].x)*(line[0].x - sphere.x) +
+                             (line[1].y - line[0].y)*(line[0].y - sphere.y) +
+                             (line[1].z - line[0].z)*(line[0].z - sphere.z));
+
+      const T c = sqr(sphere.x)  + sqr(sphere.y)  +
+                  sqr(sphere.z)  + sqr(line[0].x) +
+                  sqr(line[0].y) + sqr(line[0].z) -
+                  T(2.0) * (sphere.x * line[0].x + sphere.y * line[0].y + sphere.z * line[0].z) - sqr(sphere.radius);
+
+      const T det =  b * b - T(4.0) * a * c ;
+
+      if (det < T(0.0))
+      {
+         return;
+      }
+      else if (is_equal(det,T(0.0)))
+      {
+         const T delta = -b / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y),
+                      line[0].z + delta * (line[1].z - line[0].z)
+                    );
+         return;
+      }
+      else if (det > T(0.0))
+      {
+         T delta = (-b + sqrt(det)) / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y),
+                      line[0].z + delta * (line[1].z - line[0].z)
+                    );
+
+         delta = (-b - sqrt(det)) / (T(2.0) * a);
+
+         (*out++) = make_point
+                    (
+                      line[0].x + delta * (line[1].x - line[0].x),
+                      line[0].y + delta * (line[1].y - line[0].y),
+                      line[0].z + delta * (line[1].z - line[0].z)
+                    );
+         return;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> intersection_point(const ray<T,2>& ray1, const ray<T,2>& ray2)
+   {
+      const T denom = (ray2.direction.y * ray1.direction.x  - ray2.direction.x * ray1.direction.y);
+
+      if (denom != T(0.0))
+      {
+         const T ta = (ray2.direction.x * (ray1.origin.y - ray2.origin.y) - ray2.direction.y * (ray1.origin.x - ray2.origin.x)) / denom;
+         const T tb = (ray1.direction.y * (ray2.origin.x - ray1.origin.x) - ray1.direction.x * (ray2.origin.y - ray1.origin.y)) / denom;
+
+         if (
+              greater_than_or_equal(ta,T(0.0)) &&
+              greater_than_or_equal(tb,T(0.0))
+            )
+            return make_point
+                   (
+                     ray1.origin.x + (ray1.direction.x * ta),
+                     ray1.origin.y + (ray1.direction.y * ta)
+                   );
+         else
+            return degenerate_point2d<T>();
+
+      }
+      else if (point_on_ray(ray2.origin,ray1))
+         return ray2.origin;
+      else if (point_on_ray(ray1.origin,ray2))
+         return ray1.origin;
+      else
+         return degenerate_point2d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const ray<T,3>& ray, const triangle<T,3>& triangle)
+   {
+      T t;
+
+      if (detail::ray_triangle(ray.origin.x,ray.origin.y,ray.origin.z,
+                               ray.direction.x,ray.direction.y,ray.direction.z,
+                               triangle,t))
+         return make_point
+                (
+                  ray.origin.x + (ray.direction.x * t),
+                  ray.origin.y + (ray.direction.y * t),
+                  ray.origin.z + (ray.direction.z * t)
+                );
+      else
+         return degenerate_point3d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> intersection_point(const ray<T,3>& ray, const plane<T,3>& plane)
+   {
+      const T denom = dot_product(ray.direction,plane.normal);
+
+      point3d<T> ipoint = degenerate_point3d<T>();
+
+      if (not_equal(denom,T(0.0)))
+      {
+         const T t = -distance(ray.origin,plane) / denom;
+
+         if (t >= T(0.0))
+         {
+            ipoint = ray.origin + t * ray.direction;
+         }
+      }
+
+      return ipoint;
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const ray<T,2>& ray,
+                                  const circle<T>& circle,
+                                  OutputIterator out)
+
+   {
+      std::vector< point2d<T> > ipoint_;
+
+      intersection_point(make_line(ray),circle,std::back_inserter(ipoint_));
+
+      if (!ipoint_.empty())
+      {
+         for (std::size_t i = 0; i < ipoint_.size(); ++i)
+         {
+             if (point_on_ray(ipoint_[i],ray))
+             {
+                (*out++) = ipoint_[i];
+             }
+         }
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void intersection_point(const ray<T,3>& ray,
+                                  const sphere<T>& sphere,
+                                  OutputIterator out)
+   {
+      const vector3d<T> v = ray.origin - make_point(sphere);
+
+      const T diff = dot_product(v,v) - sqr(sphere.radius);
+
+      if (less_than_or_equal(diff,T(0.0)))
+      {
+         const T b = dot_product(ray.direction,v);
+         const T t = -b + sqrt(sqr(b) - diff);
+
+         (*out++) = (ray.origin + t * ray.direction);
+
+         return;
+      }
+
+      const T a = dot_product(ray.direction,v);
+
+      if (greater_than_or_equal(a,T(0.0)))
+      {
+         return;
+      }
+
+      const T det = sqr(a) - diff;
+
+      if (det < T(0.0))
+      {
+          return;
+      }
+      else if (greater_than_or_equal(det,T(0.0)))
+      {
+         const T root = sqrt(det);
+         const T t1 = -a - root;
+         const T t2 = -a + root;
+
+         (*out++) = (ray.origin + t1 * ray.direction);
+         (*out++) = (ray.origin + t2 * ray.direction);
+      }
+      else
+      {
+         (*out++) = (ray.origin - a * ray.direction);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void intersection_point_line_to_line(const T& x1, const T& y1, const T& z1,
+                                               const T& x2, const T& y2, const T& z2,
+                                               const T& x3, const T& y3, const T& z3,
+                                               const T& x4, const T& y4, const T& z4,
+                                                     T& ix,       T& iy,       T& iz,
+                                               const T& fuzzy)
+   {
+      const T ux = x2 - x1;
+      const T uy = y2 - y1;
+      const T uz = z2 - z1;
+
+      const T vx = x4 - x3;
+      const T vy = y4 - y3;
+      const T vz = z4 - z3;
+
+      const T wx = x1 - x3;
+      const T wy = y1 - y3;
+      const T wz = z1 - z3;
+
+      const T a  = (ux * ux + uy * uy + uz * uz);
+      const T b  = (ux * vx + uy * vy + uz * vz);
+      const T c  = (vx * vx + vy * vy + vz * vz);
+      const T d  = (ux * wx + uy * wy + uz * wz);
+      const T e  = (vx * wx + vy * wy + vz * wz);
+      const T dt = a * c - b * b;
+
+      T sc = T(0.0);
+      T tc = T(0.0);
+
+      if (is_equal(dt,T(0.0)))
+      {
+         sc = T(0.0);
+
+         if (b > c )
+            tc = d / b;
+         else
+            tc = e / c;
+      }
+      else
+      {
+         sc = (b * e - c * d) / dt;
+         tc = (a * e - b * d) / dt;
+      }
+
+      const T dx = wx + (sc * ux) - (tc * vx);
+      const T dy = wy + (sc * uy) - (tc * vy);
+      const T dz = wz + (sc * uz) - (tc * vz);
+
+      if ((dx * dx + dy * dy + dz * dz) <= sqr(fuzzy))
+      {
+         ix = ((x1 + (sc * ux)) + (x3 + (tc * vx))) * T(0.5);
+         iy = ((y1 + (sc * uy)) + (y3 + (tc * vy))) * T(0.5);
+         iz = ((z1 + (sc * uz)) + (z3 + (tc * vz))) * T(0.5);
+      }
+      else
+      {
+         ix = +infinity<T>();
+         iy = +infinity<T>();
+         iz = +infinity<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool line_to_line_intersect(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3,
+                                      const T& x4, const T& y4)
+   {
+       if (not_equal((x1 - x2) * (y3 - y4),(y1 - y2) * (x3 - x4)))
+         return true;
+      else if (collinear(x1,y1,x2,y2,x3,y3))
+         return true;
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool line_to_line_intersect(const line<T,2>& line1, const line<T,2>& line2)
+   {
+      return line_to_line_intersect(line1[0].x,line1[0].y,line1[1].x,line1[1].y,
+                                    line2[0].x,line2[0].y,line2[1].x,line2[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_to_rectangle_intersect(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& x3, const T& y3,
+                                                const T& x4, const T& y4)
+   {
+      return (
+               (x1 <= x4) && (x2 >= x3) &&
+               (y1 <= y4) && (y2 >= y3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_to_rectangle_intersect(const rectangle<T>& rectangle1,
+                                                const rectangle<T>& rectangle2)
+   {
+     return rectangle_to_rectangle_intersect(rectangle1[0].x,rectangle1[0].y,
+                                             rectangle1[1].x,rectangle1[1].y,
+                                             rectangle2[0].x,rectangle2[0].y,
+                                             rectangle2[1].x,rectangle2[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool box_to_box_intersect(const T& x1, const T& y1, const T& z1,
+                                    const T& x2, const T& y2, const T& z2,
+                                    const T& x3, const T& y3, const T& z3,
+                                    const T& x4, const T& y4, const T& z4)
+   {
+      return (
+               (x1 <= x4) && (x2 >= x3) &&
+               (y1 <= y4) && (y2 >= y3) &&
+               (z1 <= z4) && (z2 >= z3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool box_to_box_intersect(const box<T,3>& box1, const box<T,3>& box2)
+   {
+      return box_to_box_intersect(box1[0].x, box1[0].y, box1[0].z,
+                                  box1[1].x, box1[1].y, box1[1].z,
+                                  box2[0].x, box2[0].y, box2[0].z,
+                                  box2[1].x, box2[1].y, box2[1].z);
+   }
+
+   template <typename T, unsigned int Dimension, typename Simplex, typename Bezier>
+   WYKOBI_INLINE bool simplex_to_bezier_intersect(const Simplex& simplex,
+                                           const Bezier& bezier,
+                                           const std::size_t& steps)
+   {
+      if (0 == steps) return false;
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+
+      const T dt = T(1.0) / (T(1.0) * steps - T(1.0));
+      T t  = T(0.0);
+
+      bezier_coefficients<T,Dimension,Bezier::Type> coeffs;
+
+      calculate_bezier_coefficients(bezier,coeffs);
+
+      PointType previous_point = create_point_on_bezier(bezier[0],coeffs,t);
+
+      t += dt;
+
+      for (std::size_t i = 1; i < steps; ++i)
+      {
+         PointType current_point = create_point_on_bezier(bezier[0],coeffs,t);
+
+         if (intersect(make_segment(previous_point,current_point),simplex))
+         {
+            return true;
+         }
+
+         previous_point = current_point;
+
+         t += dt;
+      }
+
+      return false;
+   }
+
+   template <typename T, unsigned int Dimension, typename Bezier, typename Iterator>
+   WYKOBI_INLINE bool simplex_to_bezier_intersect(const Iterator& begin,
+                                           const Iterator& end,
+                                           const Bezier& bezier,
+                                           const std::size_t& steps)
+   {
+      if (0 == steps) return false;
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+
+      T t  = T(0.0);
+      T dt = T(1.0) / (T(1.0) * steps - T(1.0));
+      bezier_coefficients<T,Dimension,Bezier::Type> coeffs;
+
+      calculate_bezier_coefficients(bezier,coeffs);
+
+      PointType previous_point = create_point_on_bezier(bezier[0],coeffs,t);
+      t += dt;
+
+      for (std::size_t i = 1; i < steps; ++i)
+      {
+         PointType current_point = create_point_on_bezier(bezier[0],coeffs,t);
+
+         wykobi::segment<T,Dimension> segment = make_segment(previous_point,current_point);
+
+         for (Iterator it = begin; it != end; ++it)
+         {
+            if (intersect(segment,(*it)))
+            {
+               return true;
+            }
+         }
+
+         previous_point = current_point;
+         t += dt;
+      }
+
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const triangle<T,2>& triangle, const rectangle<T>& rectangle)
+   {
+      if (intersect(triangle,rectangle))
+         return T(0.0);
+      else
+         return min(
+                     min(
+                          distance(edge(rectangle, 0), triangle),
+                          distance(edge(rectangle, 1), triangle)
+                        ),
+                     min(
+                          distance(edge(rectangle, 2), triangle),
+                          distance(edge(rectangle, 3), triangle)
+                        )
+                   );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      if (intersect(rectangle1,rectangle2))
+         return T(0.0);
+      else
+      {
+         const rectangle<T> rec1 = aabb(rectangle1);
+         const rectangle<T> rec2 = aabb(rectangle2);
+
+         if (rec1[1].y < rec2[0].y)
+            return distance
+                   (
+                     make_segment(rec1[0].x,rec1[1].y,rec1[1].x,rec1[1].y),
+                     make_segment(rec2[0].x,rec2[0].y,rec2[1].x,rec2[0].y)
+                   );
+         else if (rec1[0].y > rec2[1].y)
+            return distance
+                   (
+                     make_segment(rec1[0].x,rec1[0].y,rec1[1].x,rec1[0].y),
+                     make_segment(rec2[0].x,rec2[1].y,rec2[1].x,rec2[1].y)
+                   );
+         else if (rec1[1].x < rec2[0].x)
+            return distance
+                   (
+                     make_segment(rec1[1].x,rec1[0].y,rec1[1].x,rec1[1].y),
+                     make_segment(rec2[0].x,rec2[0].y,rec2[0].x,rec2[1].y)
+                   );
+         else if (rec1[0].x > rec2[1].x)
+            return distance
+                   (
+                     make_segment(rec1[0].x,rec1[0].y,rec1[0].x,rec1[1].y),
+                     make_segment(rec2[1].x,rec2[0].y,rec2[1].x,rec2[1].y)
+                   );
+         else
+            return T(0.0);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const triangle<T,2>& triangle, const circle<T>& circle)
+   {
+      if (intersect(triangle,circle))
+         return T(0.0);
+      else
+      {
+         const point2d<T> point1 = closest_point_on_triangle_from_point(triangle, circle.x, circle.y);
+         const point2d<T> point2 = closest_point_on_circle_from_point(circle, point1);
+
+         return distance(point1,point2);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T distance(const rectangle<T>& rectangle, const circle<T>& circle)
+   {
+      if (intersect(rectangle,circle))
+         return T(0.0);
+      else
+      {
+         const point2d<T> point1 = closest_point_on_rectangle_from_point(rectangle, circle.x, circle.y);
+         const point2d<T> point2 = closest_point_on_circle_from_point(circle, point1);
+
+         return distance(point1,point2);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int out_code(const point2d<T>& point, const rectangle<T>& rectangle)
+   {
+      int result = 0;
+      if (point.y < rectangle[0].y)      result |= CLIP_TOP;
+      else if (point.y > rectangle[1].y) result |= CLIP_BOTTOM;
+
+      if (point.x < rectangle[0].x)      result |= CLIP_LEFT;
+      else if (point.x > rectangle[1].x) result |= CLIP_RIGHT;
+
+      return result;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const T&  x1, const T&  y1,
+                    const T&  x2, const T&  y2,
+                    const T&  x3, const T&  y3,
+                    const T&  x4, const T&  y4,
+                          T& cx1,       T& cy1,
+                          T& cx2,       T& cy2)
+   {
+      if (rectangle_to_rectangle_intersect(x1,y1,x2,y2,x3,y3,x4,y4))
+      {
+         if (x1 < x3) cx1 = x3; else cx1 = x1;
+         if (x2 > x4) cx2 = x4; else cx2 = x2;
+         if (y1 < y3) cy1 = y3; else cy1 = y1;
+         if (y2 > y4) cy2 = y4; else cy2 = y2;
+
+         return true;
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const T&  x1, const T&  y1, const T&  z1,
+                    const T&  x2, const T&  y2, const T&  z2,
+                    const T&  x3, const T&  y3, const T&  z3,
+                    const T&  x4, const T&  y4, const T&  z4,
+                          T& cx1,       T& cy1,       T& cz1,
+                          T& cx2,       T& cy2,       T& cz2)
+   {
+      if (box_to_box_intersect(x1,y1,z1,x2,y2,z2,x3,y3,z3,x4,y4,z4))
+      {
+         if (x1 < x3) cx1 = x3; else cx1 = x1;
+         if (x2 > x4) cx2 = x4; else cx2 = x2;
+         if (y1 < y3) cy1 = y3; else cy1 = y1;
+         if (y2 > y4) cy2 = y4; else cy2 = y2;
+         if (z1 < z3) cz1 = z3; else cz1 = z1;
+         if (z2 > z4) cz2 = z4; else cz2 = z2;
+
+         return true;
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const rectangle<T>& rectangle, segment<T,2>& csegment)
+   {
+      bool result = false;
+      T    x      = T(0.0);
+      T    y      = T(0.0);
+      csegment    = src_segment;
+
+      int outcode0   = out_code(csegment[0],rectangle);
+      int outcode1   = out_code(csegment[1],rectangle);
+      int outcodeout = 0;
+
+      while ((outcode0 != 0) || (outcode1 != 0))
+      {
+         if ((outcode0 & outcode1) != 0)
+            return result;
+         else
+         {
+            if (outcode0 != 0)
+               outcodeout = outcode0;
+            else
+               outcodeout = outcode1;
+
+            const T dx = (csegment[1].x - csegment[0].x);
+            const T dy = (csegment[1].y - csegment[0].y);
+
+            if ((outcodeout & CLIP_TOP) == CLIP_TOP)
+            {
+               x = csegment[0].x + dx * (rectangle[0].y - csegment[0].y) / dy;
+               y = rectangle[0].y;
+            }
+            else if ((outcodeout & CLIP_BOTTOM) == CLIP_BOTTOM)
+            {
+               x = csegment[0].x + dx * (rectangle[1].y - csegment[0].y) / dy;
+               y = rectangle[1].y;
+            }
+            else if ((outcodeout & CLIP_RIGHT) == CLIP_RIGHT)
+            {
+               y = csegment[0].y + dy * (rectangle[1].x - csegment[0].x) / dx;
+               x = rectangle[1].x;
+            }
+            else if ((outcodeout & CLIP_LEFT) == CLIP_LEFT)
+            {
+               y = csegment[0].y + dy * (rectangle[0].x - csegment[0].x) / dx;
+               x = rectangle[0].x;
+            }
+
+            if (outcodeout == outcode0)
+            {
+               csegment[0].x = x;
+               csegment[0].y = y;
+               outcode0 = out_code(csegment[0],rectangle);
+            }
+            else
+            {
+               csegment[1].x = x;
+               csegment[1].y = y;
+               outcode1 = out_code(csegment[1],rectangle);
+            }
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const triangle<T,2>& triangle, segment<T,2>& csegment)
+   {
+      if (!intersect(src_segment,triangle)) return false;
+
+      std::size_t pos = 0;
+
+      csegment = src_segment;
+
+      if (intersect(src_segment,edge(triangle,0),csegment[pos].x,csegment[pos].y)) pos++;
+
+      if (intersect(src_segment,edge(triangle,1),csegment[pos].x,csegment[pos].y)) pos++;
+
+      if ((pos < 2) && intersect(src_segment,edge(triangle,2),csegment[pos].x,csegment[pos].y)) pos++;
+
+      if (pos == 1)
+      {
+         if (point_in_triangle(src_segment[0],triangle))
+            csegment[pos] = src_segment[0];
+         else
+            csegment[pos] = src_segment[1];
+      }
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const quadix<T,2>& quadix, segment<T,2>& csegment)
+   {
+      if (!intersect(src_segment,quadix)) return false;
+
+      std::size_t pos = 0;
+
+      csegment = src_segment;
+
+      if (intersect(src_segment,edge(quadix,0),csegment[pos].x,csegment[pos].y)) pos++;
+      if (intersect(src_segment,edge(quadix,1),csegment[pos].x,csegment[pos].y)) pos++;
+
+      if ((pos < 2) && (intersect(src_segment,edge(quadix,2),csegment[pos].x,csegment[pos].y))) pos++;
+      if ((pos < 2) && (intersect(src_segment,edge(quadix,3),csegment[pos].x,csegment[pos].y))) pos++;
+
+      if (pos == 1)
+      {
+         if (point_in_quadix(src_segment[0],quadix))
+            csegment[pos] = src_segment[0];
+         else
+            csegment[pos] = src_segment[1];
+      }
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const segment<T,2>& src_segment, const circle<T>& circle, segment<T,2>& csegment)
+   {
+      std::vector< point2d<T> > int_point;
+
+      intersection_point(src_segment,circle,std::back_inserter(int_point));
+
+      if (int_point.size() == 2)
+      {
+         csegment[0] = int_point[0];
+         csegment[1] = int_point[1];
+         return true;
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const rectangle<T>& rectangle1, const rectangle<T>&  rectangle2, rectangle<T>& crectangle)
+   {
+      return clip
+             (
+               rectangle1[0].x, rectangle1[0].y, rectangle1[1].x, rectangle1[1].y,
+               rectangle2[0].x, rectangle2[0].y, rectangle2[1].x, rectangle2[1].y,
+               crectangle[0].x, crectangle[0].y, crectangle[1].x, crectangle[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool clip(const box<T,3>& box1, const box<T,3>& box2, box<T,3>& cbox)
+   {
+      return clip
+             (
+               box1[0].x, box1[0].y, box1[0].z, box1[1].x, box1[1].y, box1[1].z,
+               box2[0].x, box2[0].y, box2[0].z, box2[1].x, box2[1].y, box2[1].z,
+               cbox[0].x, cbox[0].y, cbox[0].z, cbox[1].x, cbox[1].y, cbox[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool exact_intersect(const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4)
+   {
+      /*
+         Same formulation as intersect, with the differences and their
+         products evaluated in wide_type<T>::type.
+      */
+      typedef typename wide_type<T>::type W;
+
+      const W ax = W(x2) - W(x1);
+      const W bx = W(x3) - W(x4);
+
+      if (bx > W(0))
+      {
+         if ((std::max(x1,x2) < x4) || (x3 < std::min(x1,x2)))
+            return false;
+      }
+      else if ((std::max(x1,x2) < x3) || (x4 < std::min(x1,x2)))
+         return false;
+
+      const W ay = W(y2) - W(y1);
+      const W by = W(y3) - W(y4);
+
+      if (by > W(0))
+      {
+         if ((std::max(y1,y2) < y4) || (y3 < std::min(y1,y2)))
+            return false;
+      }
+      else if ((std::max(y1,y2) < y3) || (y4 < std::min(y1,y2)))
+         return false;
+
+      const W cx = W(x1) - W(x3);
+      const W cy = W(y1) - W(y3);
+      const W  d = (by * cx) - (bx * cy);
+      const W  f = (ay * bx) - (ax * by);
+
+      if (f > W(0))
+      {
+         if ((d < W(0)) || (d > f))
+            return false;
+      }
+      else if ((d > W(0)) || (d < f))
+         return false;
+
+      const W e = (ax * cy) - (ay * cx);
+
+      if (f > W(0))
+      {
+         if ((e < W(0)) || (e > f))
+            return false;
+      }
+      else if ((e > W(0)) || (e < f))
+         return false;
+
+      return true;
+   }
+
+   namespace detail
+   {
+      /*
+         Time in [0,1] at which two balls, centres p apart (first minus
+         second) and closing at relative velocity v, first touch. Takes
+         p.p, p.v and v.v, radius is the sum of the two radii.
+      */
+      template <typename T>
+      inline bool swept_ball(const T& pp, const T& pv, const T& vv, const T& radius, T& t)
+      {
+         const T c = pp - (radius * radius);
+
+         if (c <= T(0.0))
+         {
+            t = T(0.0);
+            return true;
+         }
+
+         if ((pv >= T(0.0)) || (vv <= T(0.0)))
+            return false;
+
+         const T discriminant = (pv * pv) - (vv * c);
+
+         if (discriminant < T(0.0))
+            return false;
+
+         t = (-pv - sqrt(discriminant)) / vv;
+
+         return (t <= T(1.0));
+      }
+
+      /*
+         Slab form of the swept axis aligned box test. The first box moves
+         by velocity relative to the second, both are given as per axis
+         minimum and maximum corners.
+      */
+      template <typename T, std::size_t Dimension>
+      inline bool swept_box(const T (&min1)[Dimension], const T (&max1)[Dimension],
+                            const T (&min2)[Dimension], const T (&max2)[Dimension],
+                            const T (&velocity)[Dimension],
+                            T& t, T (&normal)[Dimension])
+      {
+         T t_first = -infinity<T>();
+         T t_last  = +infinity<T>();
+
+         std::size_t axis = 0;
+
+         for (std::size_t k = 0; k < Dimension; ++k)
+         {
+            if (velocity[k] == T(0.0))
+            {
+               if ((max1[k] < min2[k]) || (min1[k] > max2[k]))
+                  return false;
+
+               continue;
+            }
+
+            const T t0 = (min2[k] - max1[k]) / velocity[k];
+            const T t1 = (max2[k] - min1[k]) / velocity[k];
+
+            const T t_enter = min(t0,t1);
+            const T t_exit  = max(t0,t1);
+
+            if (t_enter > t_first)
+            {
+               t_first = t_enter;
+               axis    = k;
+            }
+
+            t_last = min(t_last,t_exit);
+         }
+
+         if ((t_first > t_last) || (t_first > T(1.0)) || (t_last < T(0.0)))
+            return false;
+
+         for (std::size_t k = 0; k < Dimension; ++k)
+         {
+            normal[k] = T(0.0);
+         }
+
+         if (t_first > T(0.0))
+         {
+            t = t_first;
+            normal[axis] = (velocity[axis] > T(0.0)) ? T(-1.0) : T(1.0);
+            return true;
+         }
+
+         /* Already overlapping, push out along the axis of least penetration. */
+         T depth = +infinity<T>();
+         T sign  = T(1.0);
+
+         for (std::size_t k = 0; k < Dimension; ++k)
+         {
+            const T below = max1[k] - min2[k];
+            const T above = max2[k] - min1[k];
+
+            if (min(below,above) < depth)
+            {
+               depth = min(below,above);
+               axis  = k;
+               sign  = (below < above) ? T(-1.0) : T(1.0);
+            }
+         }
+
+         normal[axis] = sign;
+
+         t = T(0.0);
+
+         return true;
+      }
+
+      /* Unit direction of v, or of fallback when v is too short to have one. */
+      template <typename Vector>
+      inline Vector contact_normal(const Vector& v, const Vector& fallback)
+      {
+         return (vector_norm(v) > Epsilon) ? normalize(v) : fallback;
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const circle<T>& circle1, const vector2d<T>& velocity1,
+                              const circle<T>& circle2, const vector2d<T>& velocity2,
+                              T& t, vector2d<T>& normal)
+   {
+      const vector2d<T> p = make_vector(circle1.x - circle2.x,circle1.y - circle2.y);
+      const vector2d<T> v = velocity1 - velocity2;
+
+      if (!detail::swept_ball(dot_product(p,p),dot_product(p,v),dot_product(v,v),circle1.radius + circle2.radius,t))
+         return false;
+
+      normal = detail::contact_normal(p + (v * t),detail::contact_normal(v * T(-1.0),make_vector(T(1.0),T(0.0))));
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const circle<T>& circle1, const vector2d<T>& velocity,
+                              const circle<T>& circle2,
+                              T& t, vector2d<T>& normal)
+   {
+      return time_of_impact(circle1,velocity,circle2,make_vector(T(0.0),T(0.0)),t,normal);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const sphere<T>& sphere1, const vector3d<T>& velocity1,
+                              const sphere<T>& sphere2, const vector3d<T>& velocity2,
+                              T& t, vector3d<T>& normal)
+   {
+      const vector3d<T> p = make_vector(sphere1.x - sphere2.x,sphere1.y - sphere2.y,sphere1.z - sphere2.z);
+      const vector3d<T> v = velocity1 - velocity2;
+
+      if (!detail::swept_ball(dot_product(p,p),dot_product(p,v),dot_product(v,v),sphere1.radius + sphere2.radius,t))
+         return false;
+
+      normal = detail::contact_normal(p + (v * t),detail::contact_normal(v * T(-1.0),make_vector(T(1.0),T(0.0),T(0.0))));
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const sphere<T>& sphere1, const vector3d<T>& velocity,
+                              const sphere<T>& sphere2,
+                              T& t, vector3d<T>& normal)
+   {
+      return time_of_impact(sphere1,velocity,sphere2,make_vector(T(0.0),T(0.0),T(0.0)),t,normal);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const rectangle<T>& rectangle1, const vector2d<T>& velocity1,
+                              const rectangle<T>& rectangle2, const vector2d<T>& velocity2,
+                              T& t, vector2d<T>& normal)
+   {
+      const T min1[2]     = { rectangle1[0].x, rectangle1[0].y };
+      const T max1[2]     = { rectangle1[1].x, rectangle1[1].y };
+      const T min2[2]     = { rectangle2[0].x, rectangle2[0].y };
+      const T max2[2]     = { rectangle2[1].x, rectangle2[1].y };
+      const T velocity[2] = { velocity1.x - velocity2.x, velocity1.y - velocity2.y };
+
+      T normal_[2];
+
+      if (!detail::swept_box(min1,max1,min2,max2,velocity,t,normal_))
+         return false;
+
+      normal = make_vector(normal_[0],normal_[1]);
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const rectangle<T>& rectangle1, const vector2d<T>& velocity,
+                              const rectangle<T>& rectangle2,
+                              T& t, vector2d<T>& normal)
+   {
+      return time_of_impact(rectangle1,velocity,rectangle2,make_vector(T(0.0),T(0.0)),t,normal);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const box<T,3>& box1, const vector3d<T>& velocity1,
+                              const box<T,3>& box2, const vector3d<T>& velocity2,
+                              T& t, vector3d<T>& normal)
+   {
+      const T min1[3]     = { box1[0].x, box1[0].y, box1[0].z };
+      const T max1[3]     = { box1[1].x, box1[1].y, box1[1].z };
+      const T min2[3]     = { box2[0].x, box2[0].y, box2[0].z };
+      const T max2[3]     = { box2[1].x, box2[1].y, box2[1].z };
+      const T velocity[3] = { velocity1.x - velocity2.x, velocity1.y - velocity2.y, velocity1.z - velocity2.z };
+
+      T normal_[3];
+
+      if (!detail::swept_box(min1,max1,min2,max2,velocity,t,normal_))
+         return false;
+
+      normal = make_vector(normal_[0],normal_[1],normal_[2]);
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const box<T,3>& box1, const vector3d<T>& velocity,
+                              const box<T,3>& box2,
+                              T& t, vector3d<T>& normal)
+   {
+      return time_of_impact(box1,velocity,box2,make_vector(T(0.0),T(0.0),T(0.0)),t,normal);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool time_of_impact(const point2d<T>& point, const vector2d<T>& velocity,
+                              const polygon<T,2>& polygon,
+                              T& t, vector2d<T>& normal)
+   {
+      bool hit = false;
+
+      if (polygon.size() < 2)
+         return false;
+
+      const T speed = vector_norm(velocity);
+
+      for (std::size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++)
+      {
+         const T edge_x = polygon[i].x - polygon[j].x;
+         const T edge_y = polygon[i].y - polygon[j].y;
+
+         const T denom = (velocity.x * edge_y) - (velocity.y * edge_x);
+
+         /* Parallel test relative to |velocity| x |edge|, so it holds at any scale. */
+         if (abs(denom) <= (T(Epsilon) * speed * sqrt((edge_x * edge_x) + (edge_y * edge_y))))
+            continue;
+
+         const T wx = polygon[j].x - point.x;
+         const T wy = polygon[j].y - point.y;
+
+         const T te = ((wx * edge_y) - (wy * edge_x)) / denom;
+         const T s  = ((wx * velocity.y) - (wy * velocity.x)) / denom;
+
+         if ((te < T(0.0)) || (te > T(1.0)) || (s < T(0.0)) || (s > T(1.0)))
+            continue;
+
+         if (!hit || (te < t))
+         {
+            hit    = true;
+            t      = te;
+            normal = normalize(make_vector(edge_y,-edge_x));
+
+            if (dot_product(normal,velocity) > T(0.0))
+            {
+               normal = normal * T(-1.0);
+            }
+         }
+      }
+
+      return hit;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const quadix<T,2>& quadix)
+   {
+      return /* stage 1 unique points check */
+             is_degenerate(quadix[0].x,quadix[0].y,quadix[1].x,quadix[1].y) ||
+             is_degenerate(quadix[0].x,quadix[0].y,quadix[2].x,quadix[2].y) ||
+             is_degenerate(quadix[0].x,quadix[0].y,quadix[3].x,quadix[3].y) ||
+             is_degenerate(quadix[1].x,quadix[1].y,quadix[2].x,quadix[2].y) ||
+             is_degenerate(quadix[1].x,quadix[1].y,quadix[3].x,quadix[3].y) ||
+             is_degenerate(quadix[2].x,quadix[2].y,quadix[3].x,quadix[3].y) ||
+             /* stage 2 collinearity check  */
+             robust_collinear(quadix[0],quadix[1],quadix[2]) ||
+             robust_collinear(quadix[1],quadix[2],quadix[3]) ||
+             robust_collinear(quadix[2],quadix[3],quadix[0]) ||
+             robust_collinear(quadix[3],quadix[0],quadix[1]) ||
+             intersect(quadix[0],quadix[1],quadix[2],quadix[3]) ||
+             intersect(quadix[0],quadix[3],quadix[1],quadix[2]) ||
+             (! convex_quadix(quadix));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const quadix<T,3>& quadix)
+   {
+      return /* stage 1 unique points check */
+             is_degenerate(quadix[0].x, quadix[0].y, quadix[1].x, quadix[1].y) ||
+             is_degenerate(quadix[0].x, quadix[0].y, quadix[2].x, quadix[2].y) ||
+             is_degenerate(quadix[0].x, quadix[0].y, quadix[3].x, quadix[3].y) ||
+             is_degenerate(quadix[1].x, quadix[1].y, quadix[2].x, quadix[2].y) ||
+             is_degenerate(quadix[1].x, quadix[1].y, quadix[3].x, quadix[3].y) ||
+             is_degenerate(quadix[2].x, quadix[2].y, quadix[3].x, quadix[3].y) ||
+             /* stage 2 collinearity check  */
+             robust_collinear(quadix[0], quadix[1], quadix[2])     ||
+             robust_collinear(quadix[1], quadix[2], quadix[3])     ||
+             robust_collinear(quadix[2], quadix[3], quadix[0])     ||
+             robust_collinear(quadix[3], quadix[0], quadix[1])     ||
+             intersect(quadix[0], quadix[1], quadix[2], quadix[3]) ||
+             intersect(quadix[0], quadix[3], quadix[1], quadix[2]);
+   }
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+
+   template <>
+   inline bool intersect<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                       const std::int32_t& x2, const std::int32_t& y2,
+                                       const std::int32_t& x3, const std::int32_t& y3,
+                                       const std::int32_t& x4, const std::int32_t& y4)
+   {
+      WYKOBI_INSTRUMENT(intersect);
+
+      return exact_intersect(x1,y1,x2,y2,x3,y3,x4,y4);
+   }
+
+   template <>
+   inline bool intersect<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                       const std::int64_t& x2, const std::int64_t& y2,
+                                       const std::int64_t& x3, const std::int64_t& y3,
+                                       const std::int64_t& x4, const std::int64_t& y4)
+   {
+      WYKOBI_INSTRUMENT(intersect);
+
+      return exact_intersect(x1,y1,x2,y2,x3,y3,x4,y4);
+   }
+
+   #endif
+
+} // wykobi namespace
@@ -25,6 +25,11 @@
 #include <cmath>
 #include <limits>
 
+#if (__cplusplus >= 201103L) && defined(__SIZEOF_INT128__)
+ #define WYKOBI_EXACT_INTEGER_PREDICATES
+ #include <cstdint>
+#endif
+
 
 namespace wykobi
 {
@@ -42,6 +47,40 @@ namespace wykobi
     typedef long double Float;
    #endif
 
+   /*
+      Function templates of the core modules are declared WYKOBI_INLINE.
+      They are non-inline when building the precompiled library
+      (WYKOBI_LIBRARY) and in its clients (WYKOBI_EXTERN_TEMPLATES), which
+      is what allows the extern template declarations to suppress their
+      instantiation in client translation units.
+   */
+   #if defined(WYKOBI_LIBRARY) || defined(WYKOBI_EXTERN_TEMPLATES)
+    #define WYKOBI_INLINE
+   #else
+    #define WYKOBI_INLINE inline
+   #endif
+
+   /*
+      Functions marked WYKOBI_CONSTEXPR are usable in constant expressions
+      when compiled as C++14 or later, and are plain inline functions
+      otherwise.
+   */
+   #if (__cplusplus >= 201402L)
+    #define WYKOBI_CONSTEXPR constexpr
+   #else
+    #define WYKOBI_CONSTEXPR inline
+   #endif
+
+   /*
+      std::int32_t and std::int64_t coordinates are supported with exact
+      predicates when a 128-bit integer type is available (C++11 with
+      GCC/Clang on 64-bit targets). int64_t coordinates must have a
+      magnitude less than 2^62 for the 128-bit products not to overflow.
+   */
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+    __extension__ typedef __int128 int128;
+   #endif
+
    /*************[ Epsilon constants ]*************/
    static const Float Epsilon_High      = 1.0E-16;
    static const Float Epsilon_Medium    = 1.0E-10;
@@ -78,6 +117,7 @@ namespace wykobi
    template <typename T> inline T approx_sin(T angle);
    template <typename T> inline T approx_cos(T angle);
    template <typename T> inline T approx_tan(T angle);
+   template <typename T> WYKOBI_CONSTEXPR T series_sin(T angle);
 
    template <typename T> inline T clamp(const T& value, const T& low, const T& high);
 
@@ -247,6 +287,43 @@ namespace wykobi
       return result * final_sign;
    }
 
+   template <typename T>
+   WYKOBI_CONSTEXPR T series_sin(T angle)
+   {
+      /*
+         Taylor series sine of an angle in radians. Unlike sin it can be
+         evaluated at compile time, its intended use is the generation of
+         lookup tables.
+      */
+      const T pi     = T(3.141592653589793238462643383279500);
+      const T pi2    = T(6.283185307179586476925286766559000);
+      const T pidiv2 = T(1.570796326794896619231321691639750);
+
+      angle -= pi2 * static_cast<T>(static_cast<long>(angle / pi2));
+
+      if (angle > pi)
+         angle -= pi2;
+      else if (angle < -pi)
+         angle += pi2;
+
+      if (angle > pidiv2)
+         angle = pi - angle;
+      else if (angle < -pidiv2)
+         angle = -pi - angle;
+
+      const T asqr = angle * angle;
+      T term   = angle;
+      T result = angle;
+
+      for (int i = 1; i < 16; ++i)
+      {
+         term   *= -asqr / T((2 * i) * (2 * i + 1));
+         result += term;
+      }
+
+      return result;
+   }
+
    template <typename T>
    inline T clamp(const T& value, const T& low_end, const T& high_end)
    {
@@ -31,24 +31,61 @@
 #include "wykobi_math.hpp"
 
 
+#if !defined(WYKOBI_DISABLE_SIMD)
+   #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+      #define WYKOBI_SSE
+      #include <xmmintrin.h>
+   #endif
+
+   #if defined(__AVX__)
+      #define WYKOBI_AVX
+      #include <immintrin.h>
+   #endif
+#endif
+
+#if defined(_MSC_VER)
+   #define WYKOBI_ALIGN(N) __declspec(align(N))
+#elif defined(__GNUC__) || defined(__clang__)
+   #define WYKOBI_ALIGN(N) __attribute__((aligned(N)))
+#else
+   #define WYKOBI_ALIGN(N)
+#endif
+
+
+
 namespace wykobi
 {
+   namespace detail
+   {
+      /*
+         Alignment of the matrix storage, taken on as an empty base. Only
+         the 4x4 matrices used by the SIMD kernels are aligned, and to a
+         fixed 16 bytes: it does not change with the ISA flags (so objects
+         built with and without AVX agree on the layout) and it does not
+         exceed the alignment that std::allocator honours before C++17.
+         The kernels use unaligned loads, so this is only a placement hint.
+      */
+      template <typename T, std::size_t M, std::size_t N>
+      struct matrix_alignment {};
+
+      template <typename T>
+      struct WYKOBI_ALIGN(16) matrix_alignment<T,4,4> {};
+   }
+
    template <typename T, std::size_t M, std::size_t N>
-   class matrix
+   class matrix : private detail::matrix_alignment<T,M,N>
    {
    public:
 
+      /*
+         Trivially copyable: no self-pointer, the implicit copy constructor
+         and assignment operator are used.
+      */
       matrix()
-      : dptr(reinterpret_cast<T*>(&data))
       {
          zero();
       }
 
-     ~matrix()
-      {}
-
-      matrix(const matrix<T,M,N>& m);
-
       // column major
       const T& operator()(std::size_t x, std::size_t y) const
       {
@@ -62,25 +99,24 @@ namespace wykobi
 
       const T& operator()(std::size_t i) const
       {
-         return dptr[i];
+         return reinterpret_cast<const T*>(data)[i];
       }
 
       T& operator()(std::size_t i)
       {
-         return dptr[i];
+         return reinterpret_cast<T*>(data)[i];
       }
 
       const T& operator[](std::size_t i) const
       {
-         return dptr[i];
+         return reinterpret_cast<const T*>(data)[i];
       }
 
       T& operator[](std::size_t i)
       {
-         return dptr[i];
+         return reinterpret_cast<T*>(data)[i];
       }
 
-      matrix<T,M,N>& operator=(const matrix<T,M,N>& m);
       matrix<T,M,N>& operator+=(const T& value);
       matrix<T,M,N>& operator-=(const T& value);
       matrix<T,M,N>& operator*=(const T& value);
@@ -99,8 +135,7 @@ namespace wykobi
       }
 
    private:
-      T  data[M][N];
-      T* dptr;
+      T data[M][N];
    };
 
    template <typename T> inline T det(const matrix<T,1,1>& matrix);
@@ -113,15 +148,58 @@ namespace wykobi
    template <typename T> inline void transpose(matrix<T,3,3>& matrix);
    template <typename T> inline void transpose(matrix<T,4,4>& matrix);
 
+   template <typename T, std::size_t M, std::size_t N, std::size_t P>
+   inline matrix<T,M,P> operator*(const matrix<T,M,N>& matrix1, const matrix<T,N,P>& matrix2);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const matrix<T,4,4>& matrix, const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   #if defined(WYKOBI_SSE)
+   inline void transpose(matrix<float,4,4>& matrix);
+   inline matrix<float,4,4> operator*(const matrix<float,4,4>& matrix1, const matrix<float,4,4>& matrix2);
+   inline matrix<float,4,4> inverse(const matrix<float,4,4>& matrix);
+
+   template <typename InputIterator, typename OutputIterator>
+   inline void transform(const matrix<float,4,4>& matrix, const InputIterator begin, const InputIterator end, OutputIterator out);
+   #endif
+
+   #if defined(WYKOBI_AVX)
+   inline matrix<double,4,4> operator*(const matrix<double,4,4>& matrix1, const matrix<double,4,4>& matrix2);
+   #endif
+
    template <typename T> inline void inverse(matrix<T,2,2>& out_matrix, const matrix<T,2,2>& in_matrix);
    template <typename T> inline void inverse(matrix<T,3,3>& out_matrix, const matrix<T,3,3>& in_matrix);
    template <typename T> inline void inverse(matrix<T,4,4>& out_matrix, const matrix<T,4,4>& in_matrix);
 
    template <typename T, std::size_t N> inline void inverse(matrix<T,N,N>& out_matrix, const matrix<T,N,N>& in_matrix);
 
-   template <typename T> inline void eigen_values(const matrix<T,2,2>& matrix, T& eigen_value1, T& eigen_value2);
+   template <typename T, std::size_t N> inline T det(const matrix<T,N,N>& matrix);
+
+   template <typename T, std::size_t N> inline bool lu_decompose(matrix<T,N,N>& matrix, std::size_t pivot[N], T& sign);
+   template <typename T, std::size_t N, std::size_t K> inline void lu_solve(const matrix<T,N,N>& lu, const std::size_t pivot[N], matrix<T,N,K>& rhs);
+   template <typename T, std::size_t N, typename Iterator> inline void lu_solve(const matrix<T,N,N>& lu, const std::size_t pivot[N], Iterator begin, Iterator end);
+   template <typename T, std::size_t N> inline T lu_det(const matrix<T,N,N>& lu, const T& sign);
+   template <typename T, std::size_t N> inline void lu_inverse(const matrix<T,N,N>& lu, const std::size_t pivot[N], matrix<T,N,N>& out_matrix);
+
+   template <typename T, std::size_t N> inline bool cholesky_decompose(matrix<T,N,N>& matrix);
+   template <typename T, std::size_t N, std::size_t K> inline void cholesky_solve(const matrix<T,N,N>& l, matrix<T,N,K>& rhs);
+   template <typename T, std::size_t N, typename Iterator> inline void cholesky_solve(const matrix<T,N,N>& l, Iterator begin, Iterator end);
+
+   template <typename T, std::size_t N, std::size_t K> inline bool solve(const matrix<T,N,N>& matrix, wykobi::matrix<T,N,K>& rhs);
+
+   template <typename T> inline void eigenvalues(const matrix<T,2,2>& matrix, T& eigenvalue1, T& eigenvalue2);
    template <typename T> inline void eigenvector(const matrix<T,2,2>& matrix, vector2d<T>& eigenvector1, vector2d<T>& eigenvector2);
 
+   template <typename T> inline void eigenvalues(const matrix<T,3,3>& matrix, T& eigenvalue1, T& eigenvalue2, T& eigenvalue3);
+   template <typename T> inline void eigenvector(const matrix<T,3,3>& matrix, vector3d<T>& eigenvector1, vector3d<T>& eigenvector2, vector3d<T>& eigenvector3);
+
+   template <typename T> inline vector3d<T> symmetric_eigenvector(const matrix<T,3,3>& matrix, const T& eigenvalue);
+   template <typename T> inline vector3d<T> symmetric_eigenvector(const matrix<T,3,3>& matrix, const vector3d<T>& eigenvector, const T& eigenvalue);
+   template <typename T> inline void symmetric_eigen(const matrix<T,3,3>& matrix, T eigenvalue[3], vector3d<T> eigenvector[3]);
+
+   template <typename T, std::size_t N>
+   inline void jacobi_eigen(const matrix<T,N,N>& matrix, T eigenvalue[N], wykobi::matrix<T,N,N>& eigenvector, const std::size_t max_sweeps = 50);
+
 } // namespace wykobi
 
 #include "wykobi_matrix.inl"
@@ -26,29 +26,12 @@
 
 namespace wykobi
 {
-   template <typename T, std::size_t M, std::size_t N>
-   inline matrix<T,M,N>::matrix(const matrix<T,M,N>& m)
-   : dptr(reinterpret_cast<T*>(&data))
-   {
-      std::copy(m.dptr,m.dptr + (M * N), dptr);
-   }
-
-   template <typename T, std::size_t M, std::size_t N>
-   inline matrix<T,M,N>& matrix<T,M,N>::operator=(const matrix<T,M,N>& m)
-   {
-      if (this == &m) return *this;
-
-      std::copy(m.dptr,m.dptr + (M * N), dptr);
-
-      return *this;
-   }
-
    template <typename T, std::size_t M, std::size_t N>
    inline matrix<T,M,N>& matrix<T,M,N>::operator+=(const T& value)
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] += value;
+         (*this)[i] += value;
       }
 
       return (*this);
@@ -59,7 +42,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] -= value;
+         (*this)[i] -= value;
       }
 
       return (*this);
@@ -70,7 +53,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] *= value;
+         (*this)[i] *= value;
       }
 
       return (*this);
@@ -81,7 +64,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] /= value;
+         (*this)[i] /= value;
       }
 
       return (*this);
@@ -92,7 +75,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] += _matrix.dptr[i];
+         (*this)[i] += _matrix[i];
       }
 
       return (*this);
@@ -103,7 +86,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] -= _matrix.dptr[i];
+         (*this)[i] -= _matrix[i];
       }
 
       return (*this);
@@ -114,7 +97,7 @@ namespace wykobi
    {
       for (std::size_t i = 0; i < size(); ++i)
       {
-         dptr[i] = T(0.0);
+         (*this)[i] = T(0.0);
       }
    }
 
@@ -166,6 +149,48 @@ namespace wykobi
       matrix.swap(2,3,3,2);
    }
 
+   template <typename T, std::size_t M, std::size_t N, std::size_t P>
+   inline matrix<T,M,P> operator*(const matrix<T,M,N>& matrix1, const matrix<T,N,P>& matrix2)
+   {
+      matrix<T,M,P> matrix_;
+
+      for (std::size_t i = 0; i < M; ++i)
+      {
+         for (std::size_t k = 0; k < N; ++k)
+         {
+            const T value = matrix1(k,i);
+
+            for (std::size_t j = 0; j < P; ++j)
+            {
+               matrix_(j,i) += value * matrix2(j,k);
+            }
+         }
+      }
+
+      return matrix_;
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   inline void transform(const matrix<T,4,4>& matrix, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      /*
+         Homogeneous transform of a range of point3d, the result being
+         divided through by w.
+      */
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         const T x = (*it).x;
+         const T y = (*it).y;
+         const T z = (*it).z;
+
+         const T w = T(1.0) / (matrix(0,3) * x + matrix(1,3) * y + matrix(2,3) * z + matrix(3,3));
+
+         (*out++) = make_point((matrix(0,0) * x + matrix(1,0) * y + matrix(2,0) * z + matrix(3,0)) * w,
+                               (matrix(0,1) * x + matrix(1,1) * y + matrix(2,1) * z + matrix(3,1)) * w,
+                               (matrix(0,2) * x + matrix(1,2) * y + matrix(2,2) * z + matrix(3,2)) * w);
+      }
+   }
+
    template <typename T>
    inline T det(const matrix<T,1,1>& matrix)
    {
@@ -218,8 +243,8 @@ namespace wykobi
 
          m_(0,0)  = m(1,1) * d;
          m_(1,1)  = m(0,0) * d;
-         m_(1,0) *= T(-1.0) * m(1,0) * d;
-         m_(0,1) *= T(-1.0) * m(0,1) * d;
+         m_(1,0)  = T(-1.0) * m(1,0) * d;
+         m_(0,1)  = T(-1.0) * m(0,1) * d;
 
          return  m_;
       }
@@ -303,10 +328,35 @@ namespace wykobi
          return matrix<T,4,4>();
    }
 
+   template <typename T>
+   inline void inverse(matrix<T,2,2>& out_matrix, const matrix<T,2,2>& in_matrix)
+   {
+      out_matrix = inverse(in_matrix);
+   }
+
+   template <typename T>
+   inline void inverse(matrix<T,3,3>& out_matrix, const matrix<T,3,3>& in_matrix)
+   {
+      out_matrix = inverse(in_matrix);
+   }
+
+   template <typename T>
+   inline void inverse(matrix<T,4,4>& out_matrix, const matrix<T,4,4>& in_matrix)
+   {
+      out_matrix = inverse(in_matrix);
+   }
+
    template <typename T, std::size_t N>
    inline void inverse(matrix<T,N,N>& out_matrix, const matrix<T,N,N>& in_matrix)
    {
-      out_matrix = inverse(in_matrix);
+      matrix<T,N,N> lu = in_matrix;
+      std::size_t pivot[N];
+      T sign;
+
+      if (lu_decompose(lu,pivot,sign))
+         lu_inverse(lu,pivot,out_matrix);
+      else
+         out_matrix.zero();
    }
 
    template <typename T>
@@ -332,4 +382,767 @@ namespace wykobi
       eigenvector2 = normalize(make_vector(T(-1.0) * matrix(1,0), matrix(0,0) - eigenvalue2));
    }
 
+   template <typename T>
+   inline void eigenvalues(const matrix<T,3,3>& matrix, T& eigenvalue1, T& eigenvalue2, T& eigenvalue3)
+   {
+      T           eigenvalue [3];
+      vector3d<T> eigenvector[3];
+
+      symmetric_eigen(matrix,eigenvalue,eigenvector);
+
+      eigenvalue1 = eigenvalue[0];
+      eigenvalue2 = eigenvalue[1];
+      eigenvalue3 = eigenvalue[2];
+   }
+
+   template <typename T>
+   inline void eigenvector(const matrix<T,3,3>& matrix,
+                                 vector3d<T>& eigenvector1,
+                                 vector3d<T>& eigenvector2,
+                                 vector3d<T>& eigenvector3)
+   {
+      T           eigenvalue [3];
+      vector3d<T> eigenvector[3];
+
+      symmetric_eigen(matrix,eigenvalue,eigenvector);
+
+      eigenvector1 = eigenvector[0];
+      eigenvector2 = eigenvector[1];
+      eigenvector3 = eigenvector[2];
+   }
+
+   template <typename T>
+   inline vector3d<T> symmetric_eigenvector(const matrix<T,3,3>& m, const T& eigenvalue)
+   {
+      /*
+         The eigenvector of a simple eigenvalue is orthogonal to the rows of
+         (m - eigenvalue * I), use the most stable of their cross products.
+      */
+      vector3d<T> row0 = make_vector(m(0,0) - eigenvalue, m(0,1)             , m(0,2)             );
+      vector3d<T> row1 = make_vector(m(1,0)             , m(1,1) - eigenvalue, m(1,2)             );
+      vector3d<T> row2 = make_vector(m(2,0)             , m(2,1)             , m(2,2) - eigenvalue);
+
+      vector3d<T> r0xr1 = row0 * row1;
+      vector3d<T> r0xr2 = row0 * row2;
+      vector3d<T> r1xr2 = row1 * row2;
+
+      T d0 = dot_product(r0xr1,r0xr1);
+      T d1 = dot_product(r0xr2,r0xr2);
+      T d2 = dot_product(r1xr2,r1xr2);
+
+      if ((d0 >= d1) && (d0 >= d2) && (d0 > T(0.0)))
+         return r0xr1 * (T(1.0) / sqrt(d0));
+      else if ((d1 >= d2) && (d1 > T(0.0)))
+         return r0xr2 * (T(1.0) / sqrt(d1));
+      else if (d2 > T(0.0))
+         return r1xr2 * (T(1.0) / sqrt(d2));
+      else
+         return make_vector(T(1.0),T(0.0),T(0.0));
+   }
+
+   template <typename T>
+   inline vector3d<T> symmetric_eigenvector(const matrix<T,3,3>& m, const vector3d<T>& eigenvector, const T& eigenvalue)
+   {
+      /*
+         Solve for the second eigenvector within the plane orthogonal to an
+         already known one, reducing the problem to a 2x2 null-space.
+      */
+      vector3d<T> u;
+
+      if (abs(eigenvector.x) > abs(eigenvector.y))
+         u = make_vector(-eigenvector.z, T(0.0), eigenvector.x) * (T(1.0) / sqrt(sqr(eigenvector.x) + sqr(eigenvector.z)));
+      else
+         u = make_vector(T(0.0), eigenvector.z, -eigenvector.y) * (T(1.0) / sqrt(sqr(eigenvector.y) + sqr(eigenvector.z)));
+
+      vector3d<T> v = eigenvector * u;
+
+      vector3d<T> mu = make_vector(m(0,0) * u.x + m(0,1) * u.y + m(0,2) * u.z,
+                                   m(1,0) * u.x + m(1,1) * u.y + m(1,2) * u.z,
+                                   m(2,0) * u.x + m(2,1) * u.y + m(2,2) * u.z);
+
+      vector3d<T> mv = make_vector(m(0,0) * v.x + m(0,1) * v.y + m(0,2) * v.z,
+                                   m(1,0) * v.x + m(1,1) * v.y + m(1,2) * v.z,
+                                   m(2,0) * v.x + m(2,1) * v.y + m(2,2) * v.z);
+
+      T m00 = dot_product(u,mu) - eigenvalue;
+      T m01 = dot_product(u,mv);
+      T m11 = dot_product(v,mv) - eigenvalue;
+
+      T abs_m00 = abs(m00);
+      T abs_m01 = abs(m01);
+      T abs_m11 = abs(m11);
+
+      if (abs_m00 >= abs_m11)
+      {
+         if (max(abs_m00,abs_m01) > T(0.0))
+         {
+            if (abs_m00 >= abs_m01)
+            {
+               m01 /= m00;
+               m00  = T(1.0) / sqrt(T(1.0) + sqr(m01));
+               m01 *= m00;
+            }
+            else
+            {
+               m00 /= m01;
+               m01  = T(1.0) / sqrt(T(1.0) + sqr(m00));
+               m00 *= m01;
+            }
+
+            return (u * m01) - (v * m00);
+         }
+      }
+      else if (max(abs_m11,abs_m01) > T(0.0))
+      {
+         if (abs_m11 >= abs_m01)
+         {
+            m01 /= m11;
+            m11  = T(1.0) / sqrt(T(1.0) + sqr(m01));
+            m01 *= m11;
+         }
+         else
+         {
+            m11 /= m01;
+            m01  = T(1.0) / sqrt(T(1.0) + sqr(m11));
+            m11 *= m01;
+         }
+
+         return (u * m11) - (v * m01);
+      }
+
+      return u;
+   }
+
+   template <typename T>
+   inline void symmetric_eigen(const matrix<T,3,3>& matrix, T eigenvalue[3], vector3d<T> eigenvector[3])
+   {
+      /*
+         Non-iterative trigonometric solution of the characteristic cubic of
+         a symmetric 3x3 matrix. The eigenvalues are returned in descending
+         order, each with its unit eigenvector, the eigenvectors forming a
+         right-handed orthonormal basis.
+      */
+      T max_abs = T(0.0);
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         for (std::size_t j = i; j < 3; ++j)
+         {
+            max_abs = max(max_abs,abs(matrix(i,j)));
+         }
+      }
+
+      if (max_abs == T(0.0))
+      {
+         eigenvalue [0] = eigenvalue[1] = eigenvalue[2] = T(0.0);
+         eigenvector[0] = make_vector(T(1.0),T(0.0),T(0.0));
+         eigenvector[1] = make_vector(T(0.0),T(1.0),T(0.0));
+         eigenvector[2] = make_vector(T(0.0),T(0.0),T(1.0));
+         return;
+      }
+
+      wykobi::matrix<T,3,3> m = matrix;
+
+      m /= max_abs;
+
+      T off_diagonal = sqr(m(0,1)) + sqr(m(0,2)) + sqr(m(1,2));
+
+      if (off_diagonal == T(0.0))
+      {
+         std::size_t order[3] = { 0, 1, 2 };
+
+         if (m(order[0],order[0]) < m(order[1],order[1])) std::swap(order[0],order[1]);
+         if (m(order[1],order[1]) < m(order[2],order[2])) std::swap(order[1],order[2]);
+         if (m(order[0],order[0]) < m(order[1],order[1])) std::swap(order[0],order[1]);
+
+         for (std::size_t i = 0; i < 3; ++i)
+         {
+            eigenvalue [i] = matrix(order[i],order[i]);
+            eigenvector[i] = make_vector((0 == order[i]) ? T(1.0) : T(0.0),
+                                         (1 == order[i]) ? T(1.0) : T(0.0),
+                                         (2 == order[i]) ? T(1.0) : T(0.0));
+         }
+
+         eigenvector[2] = eigenvector[0] * eigenvector[1];
+
+         return;
+      }
+
+      T q   = (m(0,0) + m(1,1) + m(2,2)) / T(3.0);
+      T b00 = m(0,0) - q;
+      T b11 = m(1,1) - q;
+      T b22 = m(2,2) - q;
+      T p   = sqrt((sqr(b00) + sqr(b11) + sqr(b22) + T(2.0) * off_diagonal) / T(6.0));
+
+      T c00 = b11    * b22    - m(1,2) * m(1,2);
+      T c01 = m(0,1) * b22    - m(1,2) * m(0,2);
+      T c02 = m(0,1) * m(1,2) - b11    * m(0,2);
+
+      T half_det = clamp((b00 * c00 - m(0,1) * c01 + m(0,2) * c02) / (T(2.0) * p * p * p), T(-1.0), T(1.0));
+
+      T angle = acos(half_det) / T(3.0);
+
+      T beta_high = T(2.0) * cos(angle);
+      T beta_low  = T(2.0) * cos(angle + T(2.0 * PI / 3.0));
+      T beta_mid  = -(beta_high + beta_low);
+
+      eigenvalue[0] = q + p * beta_high;
+      eigenvalue[2] = q + p * beta_low;
+      eigenvalue[1] = clamp(q + p * beta_mid, eigenvalue[2], eigenvalue[0]);
+
+      /*
+         Start from the eigenvalue furthest from the other two, its
+         eigenvector is the best conditioned.
+      */
+      if (half_det >= T(0.0))
+      {
+         eigenvector[0] = symmetric_eigenvector(m,eigenvalue[0]);
+         eigenvector[1] = symmetric_eigenvector(m,eigenvector[0],eigenvalue[1]);
+         eigenvector[2] = eigenvector[0] * eigenvector[1];
+      }
+      else
+      {
+         eigenvector[2] = symmetric_eigenvector(m,eigenvalue[2]);
+         eigenvector[1] = symmetric_eigenvector(m,eigenvector[2],eigenvalue[1]);
+         eigenvector[0] = eigenvector[1] * eigenvector[2];
+      }
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         eigenvalue[i] *= max_abs;
+      }
+   }
+
+   template <typename T, std::size_t N>
+   inline void jacobi_eigen(const matrix<T,N,N>& matrix, T eigenvalue[N], wykobi::matrix<T,N,N>& eigenvector, const std::size_t max_sweeps)
+   {
+      /*
+         Cyclic Jacobi rotations on a symmetric NxN matrix. The eigenvalues
+         are returned in descending order, the k-th eigenvector being stored
+         in the k-th column of eigenvector, ie: eigenvector(k,i).
+      */
+      T a[N][N];
+      T v[N][N];
+
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         for (std::size_t j = 0; j < N; ++j)
+         {
+            a[i][j] = matrix(j,i);
+            v[i][j] = ((i == j) ? T(1.0) : T(0.0));
+         }
+      }
+
+      for (std::size_t sweep = 0; sweep < max_sweeps; ++sweep)
+      {
+         T off_diagonal = T(0.0);
+         T diagonal     = T(0.0);
+
+         for (std::size_t i = 0; i < N; ++i)
+         {
+            diagonal += sqr(a[i][i]);
+
+            for (std::size_t j = i + 1; j < N; ++j)
+            {
+               off_diagonal += sqr(a[i][j]);
+            }
+         }
+
+         if (off_diagonal <= (sqr(std::numeric_limits<T>::epsilon()) * diagonal))
+            break;
+
+         for (std::size_t p = 0; p + 1 < N; ++p)
+         {
+            for (std::size_t q = p + 1; q < N; ++q)
+            {
+               if (a[p][q] == T(0.0))
+                  continue;
+
+               T theta = (a[q][q] - a[p][p]) / (T(2.0) * a[p][q]);
+               T t     = T(0.0);
+
+               if (abs(theta) > T(1.0E+10))
+                  t = T(0.5) / theta;
+               else
+                  t = ((theta < T(0.0)) ? T(-1.0) : T(1.0)) / (abs(theta) + sqrt(sqr(theta) + T(1.0)));
+
+               T c = T(1.0) / sqrt(sqr(t) + T(1.0));
+               T s = t * c;
+
+               for (std::size_t k = 0; k < N; ++k)
+               {
+                  T akp = a[k][p];
+                  T akq = a[k][q];
+                  a[k][p] = c * akp - s * akq;
+                  a[k][q] = s * akp + c * akq;
+               }
+
+               for (std::size_t k = 0; k < N; ++k)
+               {
+                  T apk = a[p][k];
+                  T aqk = a[q][k];
+                  a[p][k] = c * apk - s * aqk;
+                  a[q][k] = s * apk + c * aqk;
+               }
+
+               for (std::size_t k = 0; k < N; ++k)
+               {
+                  T vkp = v[k][p];
+                  T vkq = v[k][q];
+                  v[k][p] = c * vkp - s * vkq;
+                  v[k][q] = s * vkp + c * vkq;
+               }
+            }
+         }
+      }
+
+      std::size_t order[N];
+
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         order[i] = i;
+      }
+
+      for (std::size_t i = 1; i < N; ++i)
+      {
+         for (std::size_t j = i; (j > 0) && (a[order[j - 1]][order[j - 1]] < a[order[j]][order[j]]); --j)
+         {
+            std::swap(order[j - 1],order[j]);
+         }
+      }
+
+      for (std::size_t k = 0; k < N; ++k)
+      {
+         eigenvalue[k] = a[order[k]][order[k]];
+
+         for (std::size_t i = 0; i < N; ++i)
+         {
+            eigenvector(k,i) = v[i][order[k]];
+         }
+      }
+   }
+
+   template <typename T, std::size_t N>
+   inline bool lu_decompose(matrix<T,N,N>& matrix, std::size_t pivot[N], T& sign)
+   {
+      /*
+         In-place Doolittle LU factorisation with partial pivoting, such that
+         P * A = L * U. L (unit diagonal) is stored below the diagonal, U on
+         and above it. pivot[i] holds the original row now at row i.
+      */
+      sign = T(1.0);
+
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         pivot[i] = i;
+      }
+
+      for (std::size_t k = 0; k < N; ++k)
+      {
+         std::size_t p         = k;
+         T           max_value = abs(matrix(k,k));
+
+         for (std::size_t r = k + 1; r < N; ++r)
+         {
+            if (abs(matrix(k,r)) > max_value)
+            {
+               max_value = abs(matrix(k,r));
+               p         = r;
+            }
+         }
+
+         if (max_value == T(0.0))
+            return false;
+
+         if (p != k)
+         {
+            for (std::size_t c = 0; c < N; ++c)
+            {
+               std::swap(matrix(c,k),matrix(c,p));
+            }
+
+            std::swap(pivot[k],pivot[p]);
+            sign = -sign;
+         }
+
+         for (std::size_t r = k + 1; r < N; ++r)
+         {
+            T factor = (matrix(k,r) /= matrix(k,k));
+
+            for (std::size_t c = k + 1; c < N; ++c)
+            {
+               matrix(c,r) -= factor * matrix(c,k);
+            }
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T, std::size_t N, std::size_t K>
+   inline void lu_solve(const matrix<T,N,N>& lu, const std::size_t pivot[N], matrix<T,N,K>& rhs)
+   {
+      for (std::size_t k = 0; k < K; ++k)
+      {
+         T x[N];
+
+         for (std::size_t r = 0; r < N; ++r)
+         {
+            x[r] = rhs(k,pivot[r]);
+
+            for (std::size_t c = 0; c < r; ++c)
+            {
+               x[r] -= lu(c,r) * x[c];
+            }
+         }
+
+         for (std::size_t r = N; r-- > 0;)
+         {
+            for (std::size_t c = r + 1; c < N; ++c)
+            {
+               x[r] -= lu(c,r) * x[c];
+            }
+
+            x[r] /= lu(r,r);
+         }
+
+         for (std::size_t r = 0; r < N; ++r)
+         {
+            rhs(k,r) = x[r];
+         }
+      }
+   }
+
+   template <typename T, std::size_t N, typename Iterator>
+   inline void lu_solve(const matrix<T,N,N>& lu, const std::size_t pivot[N], Iterator begin, Iterator end)
+   {
+      for (Iterator it = begin; it != end; ++it)
+      {
+         lu_solve(lu,pivot,(*it));
+      }
+   }
+
+   template <typename T, std::size_t N>
+   inline T lu_det(const matrix<T,N,N>& lu, const T& sign)
+   {
+      T result = sign;
+
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         result *= lu(i,i);
+      }
+
+      return result;
+   }
+
+   template <typename T, std::size_t N>
+   inline void lu_inverse(const matrix<T,N,N>& lu, const std::size_t pivot[N], matrix<T,N,N>& out_matrix)
+   {
+      out_matrix.identity();
+      lu_solve(lu,pivot,out_matrix);
+   }
+
+   template <typename T, std::size_t N>
+   inline bool cholesky_decompose(matrix<T,N,N>& matrix)
+   {
+      /*
+         In-place Cholesky factorisation A = L * transpose(L) of a symmetric
+         positive definite matrix. L is stored on and below the diagonal, the
+         strictly upper triangle is zeroed.
+      */
+      for (std::size_t j = 0; j < N; ++j)
+      {
+         T sum = matrix(j,j);
+
+         for (std::size_t k = 0; k < j; ++k)
+         {
+            sum -= sqr(matrix(k,j));
+         }
+
+         if (sum <= T(0.0))
+            return false;
+
+         matrix(j,j) = sqrt(sum);
+
+         for (std::size_t i = j + 1; i < N; ++i)
+         {
+            sum = matrix(j,i);
+
+            for (std::size_t k = 0; k < j; ++k)
+            {
+               sum -= matrix(k,i) * matrix(k,j);
+            }
+
+            matrix(j,i) = sum / matrix(j,j);
+            matrix(i,j) = T(0.0);
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T, std::size_t N, std::size_t K>
+   inline void cholesky_solve(const matrix<T,N,N>& l, matrix<T,N,K>& rhs)
+   {
+      for (std::size_t k = 0; k < K; ++k)
+      {
+         T x[N];
+
+         for (std::size_t r = 0; r < N; ++r)
+         {
+            x[r] = rhs(k,r);
+
+            for (std::size_t c = 0; c < r; ++c)
+            {
+               x[r] -= l(c,r) * x[c];
+            }
+
+            x[r] /= l(r,r);
+         }
+
+         for (std::size_t r = N; r-- > 0;)
+         {
+            for (std::size_t c = r + 1; c < N; ++c)
+            {
+               x[r] -= l(r,c) * x[c];
+            }
+
+            x[r] /= l(r,r);
+         }
+
+         for (std::size_t r = 0; r < N; ++r)
+         {
+            rhs(k,r) = x[r];
+         }
+      }
+   }
+
+   template <typename T, std::size_t N, typename Iterator>
+   inline void cholesky_solve(const matrix<T,N,N>& l, Iterator begin, Iterator end)
+   {
+      for (Iterator it = begin; it != end; ++it)
+      {
+         cholesky_solve(l,(*it));
+      }
+   }
+
+   template <typename T, std::size_t N, std::size_t K>
+   inline bool solve(const matrix<T,N,N>& matrix, wykobi::matrix<T,N,K>& rhs)
+   {
+      wykobi::matrix<T,N,N> lu = matrix;
+      std::size_t pivot[N];
+      T sign;
+
+      if (!lu_decompose(lu,pivot,sign))
+         return false;
+
+      lu_solve(lu,pivot,rhs);
+
+      return true;
+   }
+
+   template <typename T, std::size_t N>
+   inline T det(const matrix<T,N,N>& matrix)
+   {
+      wykobi::matrix<T,N,N> lu = matrix;
+      std::size_t pivot[N];
+      T sign;
+
+      if (!lu_decompose(lu,pivot,sign))
+         return T(0.0);
+
+      return lu_det(lu,sign);
+   }
+
+   #if defined(WYKOBI_SSE)
+
+   inline void transpose(matrix<float,4,4>& matrix)
+   {
+      __m128 row0 = _mm_loadu_ps(&matrix[ 0]);
+      __m128 row1 = _mm_loadu_ps(&matrix[ 4]);
+      __m128 row2 = _mm_loadu_ps(&matrix[ 8]);
+      __m128 row3 = _mm_loadu_ps(&matrix[12]);
+
+      _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+      _mm_storeu_ps(&matrix[ 0], row0);
+      _mm_storeu_ps(&matrix[ 4], row1);
+      _mm_storeu_ps(&matrix[ 8], row2);
+      _mm_storeu_ps(&matrix[12], row3);
+   }
+
+   inline matrix<float,4,4> operator*(const matrix<float,4,4>& matrix1, const matrix<float,4,4>& matrix2)
+   {
+      matrix<float,4,4> matrix_;
+
+      const __m128 row0 = _mm_loadu_ps(&matrix2[ 0]);
+      const __m128 row1 = _mm_loadu_ps(&matrix2[ 4]);
+      const __m128 row2 = _mm_loadu_ps(&matrix2[ 8]);
+      const __m128 row3 = _mm_loadu_ps(&matrix2[12]);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         __m128 result =            _mm_mul_ps(_mm_set1_ps(matrix1[4 * i + 0]), row0);
+         result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(matrix1[4 * i + 1]), row1));
+         result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(matrix1[4 * i + 2]), row2));
+         result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(matrix1[4 * i + 3]), row3));
+
+         _mm_storeu_ps(&matrix_[4 * i], result);
+      }
+
+      return matrix_;
+   }
+
+   inline matrix<float,4,4> inverse(const matrix<float,4,4>& matrix)
+   {
+      /*
+         Cramer's rule over 2x2 sub-determinants, four cofactors at a time.
+      */
+      const float* src = &matrix[0];
+
+      __m128 tmp  = _mm_setzero_ps();
+      __m128 row0 = _mm_setzero_ps();
+      __m128 row1 = _mm_setzero_ps();
+      __m128 row2 = _mm_setzero_ps();
+      __m128 row3 = _mm_setzero_ps();
+
+      tmp  = _mm_loadh_pi(_mm_loadl_pi(tmp , reinterpret_cast<const __m64*>(src     )), reinterpret_cast<const __m64*>(src +  4));
+      row1 = _mm_loadh_pi(_mm_loadl_pi(row1, reinterpret_cast<const __m64*>(src +  8)), reinterpret_cast<const __m64*>(src + 12));
+      row0 = _mm_shuffle_ps(tmp , row1, 0x88);
+      row1 = _mm_shuffle_ps(row1, tmp , 0xDD);
+      tmp  = _mm_loadh_pi(_mm_loadl_pi(tmp , reinterpret_cast<const __m64*>(src +  2)), reinterpret_cast<const __m64*>(src +  6));
+      row3 = _mm_loadh_pi(_mm_loadl_pi(row3, reinterpret_cast<const __m64*>(src + 10)), reinterpret_cast<const __m64*>(src + 14));
+      row2 = _mm_shuffle_ps(tmp , row3, 0x88);
+      row3 = _mm_shuffle_ps(row3, tmp , 0xDD);
+
+      __m128 minor0;
+      __m128 minor1;
+      __m128 minor2;
+      __m128 minor3;
+
+      tmp    = _mm_mul_ps(row2, row3);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      minor0 = _mm_mul_ps(row1, tmp);
+      minor1 = _mm_mul_ps(row0, tmp);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+      minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+      minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+      tmp    = _mm_mul_ps(row1, row2);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+      minor3 = _mm_mul_ps(row0, tmp);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+      minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+      minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+      tmp    = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      row2   = _mm_shuffle_ps(row2, row2, 0x4E);
+      minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+      minor2 = _mm_mul_ps(row0, tmp);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+      minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+      minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+      tmp    = _mm_mul_ps(row0, row1);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+      minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+      minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+      tmp    = _mm_mul_ps(row0, row3);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+      minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+      minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+      tmp    = _mm_mul_ps(row0, row2);
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0xB1);
+      minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+      minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+      tmp    = _mm_shuffle_ps(tmp, tmp, 0x4E);
+      minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+      minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+      __m128 det = _mm_mul_ps(row0, minor0);
+      det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+      det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+
+      wykobi::matrix<float,4,4> matrix_;
+
+      if (_mm_cvtss_f32(det) == 0.0f)
+         return matrix_;
+
+      det = _mm_shuffle_ps(_mm_div_ss(_mm_set_ss(1.0f), det), _mm_div_ss(_mm_set_ss(1.0f), det), 0x00);
+
+      _mm_storeu_ps(&matrix_[ 0], _mm_mul_ps(det, minor0));
+      _mm_storeu_ps(&matrix_[ 4], _mm_mul_ps(det, minor1));
+      _mm_storeu_ps(&matrix_[ 8], _mm_mul_ps(det, minor2));
+      _mm_storeu_ps(&matrix_[12], _mm_mul_ps(det, minor3));
+
+      return matrix_;
+   }
+
+   template <typename InputIterator, typename OutputIterator>
+   inline void transform(const matrix<float,4,4>& matrix, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      __m128 column0 = _mm_loadu_ps(&matrix[ 0]);
+      __m128 column1 = _mm_loadu_ps(&matrix[ 4]);
+      __m128 column2 = _mm_loadu_ps(&matrix[ 8]);
+      __m128 column3 = _mm_loadu_ps(&matrix[12]);
+
+      _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+      WYKOBI_ALIGN(16) float result[4];
+
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         __m128 point =            _mm_mul_ps(_mm_set1_ps((*it).x), column0);
+         point = _mm_add_ps(point, _mm_mul_ps(_mm_set1_ps((*it).y), column1));
+         point = _mm_add_ps(point, _mm_mul_ps(_mm_set1_ps((*it).z), column2));
+         point = _mm_add_ps(point, column3);
+         point = _mm_div_ps(point, _mm_shuffle_ps(point, point, 0xFF));
+
+         _mm_store_ps(result, point);
+
+         (*out++) = make_point(result[0], result[1], result[2]);
+      }
+   }
+
+   #endif
+
+   #if defined(WYKOBI_AVX)
+
+   inline matrix<double,4,4> operator*(const matrix<double,4,4>& matrix1, const matrix<double,4,4>& matrix2)
+   {
+      matrix<double,4,4> matrix_;
+
+      const __m256d row0 = _mm256_loadu_pd(&matrix2[ 0]);
+      const __m256d row1 = _mm256_loadu_pd(&matrix2[ 4]);
+      const __m256d row2 = _mm256_loadu_pd(&matrix2[ 8]);
+      const __m256d row3 = _mm256_loadu_pd(&matrix2[12]);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         __m256d result =               _mm256_mul_pd(_mm256_set1_pd(matrix1[4 * i + 0]), row0);
+         result = _mm256_add_pd(result, _mm256_mul_pd(_mm256_set1_pd(matrix1[4 * i + 1]), row1));
+         result = _mm256_add_pd(result, _mm256_mul_pd(_mm256_set1_pd(matrix1[4 * i + 2]), row2));
+         result = _mm256_add_pd(result, _mm256_mul_pd(_mm256_set1_pd(matrix1[4 * i + 3]), row3));
+
+         _mm256_storeu_pd(&matrix_[4 * i], result);
+      }
+
+      return matrix_;
+   }
+
+   #endif
+
 } // namespace wykobi
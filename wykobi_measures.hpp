@@ -0,0 +1,271 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_MEASURES
+#define INCLUDE_WYKOBI_MEASURES
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Area, perimeter, volume, centroid, bounding volumes, edges and corners.
+   */
+
+   template <typename T> WYKOBI_INLINE segment<T,2> opposing_edge(const triangle<T,2>& triangle, const std::size_t& corner);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> opposing_edge(const triangle<T,3>& triangle, const std::size_t& corner);
+
+   template <typename T> WYKOBI_INLINE point2d<T> rectangle_corner(const rectangle<T>& rectangle, const std::size_t& corner_index);
+
+   template <typename T> WYKOBI_INLINE point3d<T> box_corner(const box<T,3>& box, const std::size_t& corner_index);
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const T&   x1, const T&   y1,
+                                 const T&   x2, const T&   y2,
+                                       T& midx,       T& midy);
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const segment<T,2>& segment, T& midx, T& midy);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> segment_mid_point(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> segment_mid_point(const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const T&   x1, const T&   y1, const T&   z1,
+                                 const T&   x2, const T&   y2, const T&   z2,
+                                       T& midx,       T& midy,       T& midz);
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const segment<T,3>& segment, T& midx, T& midy, T& midz);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> segment_mid_point(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> segment_mid_point(const segment<T,3>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                              T&  x,       T&  y);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                              T&  x,       T&  y);
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                              T&  x,       T&  y,       T& z);
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& x4, const T& y4,
+                              T&  x,       T&  y);
+
+   template <typename T> WYKOBI_INLINE void centroid(const triangle<T,2>& triangle, T& x, T& y);
+
+   template <typename T> WYKOBI_INLINE void centroid(const triangle<T,3>& triangle, T& x, T& y,T& z);
+
+   template <typename T> WYKOBI_INLINE void centroid(const quadix<T,2>& quadix, T& x, T& y);
+
+   template <typename T> WYKOBI_INLINE void centroid(const rectangle<T>& rectangle, T& x, T& y);
+
+   template <typename T> WYKOBI_INLINE void centroid(const box<T,3>& box, T& x, T& y, T& z);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE void centroid(const polygon<T,2,Allocator>& polygon, T& x, T& y);
+
+   template <typename T> WYKOBI_INLINE void centroid(const polygon_view<T,2>& polygon, T& x, T& y);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3, const point2d<T>& point4);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> centroid(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> centroid(const box<T,3>& box);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE point2d<T> centroid(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point2d<T> centroid(const polygon_view<T,2>& polygon);
+
+   template <typename T> WYKOBI_CONSTEXPR T area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE T area(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3);
+
+   template <typename T> WYKOBI_CONSTEXPR T area(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T area(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_CONSTEXPR T area(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE T area(const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE T area(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T area(const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE T area(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE T area(const polygon_view<T,2>& polygon);
+
+   template <typename T> WYKOBI_INLINE T area(const obb<T,2>& obb);
+
+   template <typename T> WYKOBI_INLINE T volume(const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE T volume(const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE T volume(const obb<T,3>& obb);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE T perimeter(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE T perimeter(const polygon_view<T,2>& polygon);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE rectangle<T> aabb(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const polygon_view<T,2>& polygon);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> aabb(const obb<T,2>& obb);
+
+   template <typename T> WYKOBI_INLINE void aabb(const segment<T,2>& segment,   T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const triangle<T,2>& triangle, T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const rectangle<T>& rectangle, T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const quadix<T,2>& quadix,     T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const circle<T>& circle,       T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE void aabb(const polygon<T,2,Allocator>& polygon,   T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const polygon_view<T,2>& polygon,   T& x1, T& y1, T& x2, T& y2);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const box<T,3>& rectangle);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const sphere<T>& sphere);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE box<T,3> aabb(const polygon<T,3,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE box<T,3> aabb(const obb<T,3>& obb);
+
+   template <typename T> WYKOBI_INLINE void aabb(const segment<T,3>& segment,   T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const triangle<T,3>& triangle, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const box<T,3>& box,             T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const quadix<T,3>& quadix,     T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T> WYKOBI_INLINE void aabb(const sphere<T>& sphere,       T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE void aabb(const polygon<T,3,Allocator>& polygon,   T& x1, T& y1, T& z1, T& x2, T& y2, T& z2);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> update_rectangle(const rectangle<T>& rectangle, point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE box<T,3> update_box(const box<T,3>& box, point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE circle<T> update_circle(const circle<T>& circle, point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE sphere<T> update_sphere(const sphere<T>& sphere, point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_point_on_segment(const segment<T,2>& segment, const T& t);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_point_on_segment(const segment<T,3>& segment, const T& t);
+
+   template <typename T> WYKOBI_INLINE line<T,2> make_line(const ray<T,2>& ray);
+
+   template <typename T> WYKOBI_INLINE line<T,3> make_line(const ray<T,3>& ray);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> make_quadix(const obb<T,2>& obb);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const obb<T,2>& obb);
+
+   template <typename T> WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const triangle<T,2>& triangle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const polygon_view<T,2>& polygon);
+
+} // wykobi namespace
+
+#include "wykobi_common.hpp"
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.hpp"
+#include "wykobi_measures.inl"
+
+#endif
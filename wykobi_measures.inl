@@ -0,0 +1,1309 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_measures.hpp"
+
+
+namespace wykobi
+{
+   namespace detail
+   {
+      /*
+         Polygon measures written against the point sequence interface
+         (size and operator[]) shared by polygon and polygon_view.
+      */
+      template <typename T, typename Polygon>
+      inline void polygon_centroid(const Polygon& polygon, T& x, T& y)
+      {
+         x = T(0.0);
+         y = T(0.0);
+
+         if (polygon.size() < 3) return;
+
+         T asum = T(0.0);
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            const T term  = ((polygon[j].x * polygon[i].y) - (polygon[j].y * polygon[i].x));
+
+            asum += term;
+            x    += ((polygon[j].x + polygon[i].x) * term);
+            y    += ((polygon[j].y + polygon[i].y) * term);
+            j     = i;
+         }
+
+         if (not_equal(asum,T(0.0)))
+         {
+            x /= (T(3.0) * asum);
+            y /= (T(3.0) * asum);
+         }
+      }
+
+      template <typename T, typename Polygon>
+      inline T polygon_area(const Polygon& polygon)
+      {
+         if (polygon.size() < 3) return T(0.0);
+
+         T result = T(0.0);
+
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            result += ((polygon[j].x * polygon[i].y) - (polygon[j].y * polygon[i].x));
+            j = i;
+         }
+
+         return abs<T>(result * T(0.5));
+      }
+
+      template <typename T, typename Polygon>
+      inline T polygon_perimeter(const Polygon& polygon)
+      {
+         if (polygon.size() < 3) return T(0.0);
+
+         T total_perimeter = T(0.0);
+
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            total_perimeter += distance(polygon[j],polygon[i]);
+            j = i;
+         }
+
+         return total_perimeter;
+      }
+
+      template <typename T, typename Polygon>
+      inline rectangle<T> polygon_aabb(const Polygon& polygon)
+      {
+         if (polygon.size() < 3) return make_rectangle(T(0.0),T(0.0),T(0.0),T(0.0));
+
+         rectangle<T> rectangle_;
+
+         rectangle_[0].x = polygon[0].x;
+         rectangle_[0].y = polygon[0].y;
+         rectangle_[1].x = polygon[0].x;
+         rectangle_[1].y = polygon[0].y;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            if (polygon[i].x < rectangle_[0].x)
+               rectangle_[0].x = polygon[i].x;
+            else if (polygon[i].x > rectangle_[1].x)
+               rectangle_[1].x = polygon[i].x;
+
+            if (polygon[i].y < rectangle_[0].y)
+               rectangle_[0].y = polygon[i].y;
+            else if (polygon[i].y > rectangle_[1].y)
+               rectangle_[1].y = polygon[i].y;
+         }
+
+         return rectangle_;
+      }
+
+      template <typename T, typename Polygon>
+      inline typename wide_type<T>::type polygon_doubled_signed_area(const Polygon& polygon)
+      {
+         typedef typename wide_type<T>::type W;
+
+         W result = W(0);
+
+         if (polygon.size() < 3) return result;
+
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            result += (W(polygon[j].x) * W(polygon[i].y)) - (W(polygon[j].y) * W(polygon[i].x));
+            j = i;
+         }
+
+         return result;
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> opposing_edge(const triangle<T,2>& triangle, const std::size_t& corner)
+   {
+      switch(corner)
+      {
+          case 0 : return edge(triangle,1);
+          case 1 : return edge(triangle,2);
+          case 2 : return edge(triangle,0);
+         default : return degenerate_segment2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> opposing_edge(const triangle<T,3>& triangle, const std::size_t& corner)
+   {
+      switch(corner)
+      {
+          case 0 : return edge(triangle,1);
+          case 1 : return edge(triangle,2);
+          case 2 : return edge(triangle,0);
+         default : return degenerate_segment3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> rectangle_corner(const rectangle<T>& rectangle, const std::size_t& corner_index)
+   {
+      switch(corner_index)
+      {
+          case 0 : return rectangle[0];
+          case 1 : return make_point(rectangle[1].x,rectangle[0].y);
+          case 2 : return make_point(rectangle[1].x,rectangle[1].y);
+          case 3 : return make_point(rectangle[0].x,rectangle[1].y);
+         default : return degenerate_point2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> box_corner(const box<T,3>& box, const std::size_t& corner_index)
+   {
+      switch(corner_index)
+      {
+          case 0 : return box[0];
+          case 1 : return make_point(box[1].x,box[0].y,box[0].z);
+          case 2 : return make_point(box[1].x,box[1].y,box[0].z);
+          case 3 : return make_point(box[0].x,box[1].y,box[0].z);
+          case 4 : return box[1];
+          case 5 : return make_point(box[1].x,box[0].y,box[1].z);
+          case 6 : return make_point(box[1].x,box[1].y,box[1].z);
+          case 7 : return make_point(box[0].x,box[1].y,box[1].z);
+         default : return degenerate_point3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const T&   x1, const T&   y1,
+                                 const T&   x2, const T&   y2,
+                                       T& midx,       T& midy)
+   {
+      midx = (x1 + x2) * T(0.5);
+      midy = (y1 + y2) * T(0.5);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const segment<T,2>& segment, T& midx, T& midy)
+   {
+      segment_mid_point(segment[0].x,segment[0].y,
+                        segment[1].x,segment[1].y,
+                                midx,        midy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> segment_mid_point(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      point2d<T> point_;
+      segment_mid_point(point1.x,point1.y,point2.x,point2.y,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> segment_mid_point(const segment<T,2>& segment)
+   {
+      return segment_mid_point(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const T&   x1, const T&   y1, const T&   z1,
+                                 const T&   x2, const T&   y2, const T&   z2,
+                                       T& midx,       T& midy,       T& midz)
+   {
+      midx = (x1 + x2) * T(0.5);
+      midy = (y1 + y2) * T(0.5);
+      midz = (z1 + z2) * T(0.5);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void segment_mid_point(const segment<T,3>& segment, T& midx, T& midy, T& midz)
+   {
+      segment_mid_point(segment[0].x, segment[0].y, segment[0].z,
+                        segment[1].x, segment[1].y, segment[1].z,
+                                midx,         midy,         midz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> segment_mid_point(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      point3d<T> point_;
+
+      segment_mid_point(point1.x, point1.y, point1.z,
+                        point2.x, point2.y, point2.z,
+                        point_.x, point_.y, point_.z);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> segment_mid_point(const segment<T,3>& segment)
+   {
+      return segment_mid_point(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                              T&  x,       T&  y)
+   {
+      x = (x1 + x2) * T(0.5);
+      y = (y1 + y2) * T(0.5);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      point2d<T> point_;
+      centroid(point1.x,point1.y,point2.x,point2.y,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const segment<T,2>& segment)
+   {
+      return segment_mid_point(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                              T&  x,       T&  y)
+   {
+      /* the medians meet at the vertex average */
+      x = (x1 + x2 + x3) / T(3.0);
+      y = (y1 + y2 + y3) / T(3.0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                              T&  x,       T&  y,       T& z)
+   {
+      x = (x1 + x2 + x3) / T(3.0);
+      y = (y1 + y2 + y3) / T(3.0);
+      z = (z1 + z2 + z3) / T(3.0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& x4, const T& y4,
+                              T&  x,       T&  y)
+   {
+      x = 0.0;
+      y = 0.0;
+
+      T asum = 0.0;
+      T term = 0.0;
+
+      term = ((x4 * y1) - (y4 * x1));
+      asum = asum + term;
+      x = x + (x4 + x1) * term;
+      y = y + (y4 + y1) * term;
+
+      term = ((x1 * y2) - (y1 * x2));
+      asum = asum + term;
+      x = x + (x1 + x2) * term;
+      y = y + (y1 + y2) * term;
+
+      term = ((x2 * y3) - (y2 * x3));
+      asum = asum + term;
+      x = x + (x2 + x3) * term;
+      y = y + (y2 + y3) * term;
+
+      term = ((x3 * y4) - (y3 * x4));
+      asum = asum + term;
+      x = x + (x3 + x4) * term;
+      y = y + (y3 + y4) * term;
+
+      if (asum != T(0.0))
+      {
+         x = x / (T(3.0) * asum);
+         y = y / (T(3.0) * asum);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const triangle<T,2>& triangle, T& x, T& y)
+   {
+      centroid(triangle[0].x,triangle[0].y,
+               triangle[1].x,triangle[1].y,
+               triangle[2].x,triangle[2].y,
+                           x,            y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const triangle<T,3>& triangle, T& x, T& y, T& z)
+   {
+      centroid(triangle[0].x,triangle[0].y,triangle[0].z,
+               triangle[1].x,triangle[1].y,triangle[1].z,
+               triangle[2].x,triangle[2].y,triangle[2].z,
+                           x,            y,            z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const quadix<T,2>& quadix, T& x, T& y)
+   {
+      centroid(quadix[0].x,quadix[0].y,
+               quadix[1].x,quadix[1].y,
+               quadix[2].x,quadix[2].y,
+               quadix[3].x,quadix[3].y,
+                         x,          y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const rectangle<T>& rectangle, T& x, T& y)
+   {
+      x = (rectangle[0].x + rectangle[1].x) * T(0.5);
+      y = (rectangle[0].y + rectangle[1].y) * T(0.5);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const box<T,3>& box, T& x, T& y, T& z)
+   {
+      x = (box[0].x + box[1].x) * T(0.5);
+      y = (box[0].y + box[1].y) * T(0.5);
+      z = (box[0].z + box[1].z) * T(0.5);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE void centroid(const polygon<T,2,Allocator>& polygon, T& x, T& y)
+   {
+      detail::polygon_centroid(polygon,x,y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void centroid(const polygon_view<T,2>& polygon, T& x, T& y)
+   {
+      detail::polygon_centroid(polygon,x,y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      point2d<T> point_;
+
+      centroid(point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y,
+               point_.x,point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const triangle<T,2>& triangle)
+   {
+      point2d<T> point_;
+      centroid(triangle,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> centroid(const triangle<T,3>& triangle)
+   {
+      point3d<T> point_;
+      centroid(triangle,point_.x,point_.y,point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const point2d<T>& point1,
+                              const point2d<T>& point2,
+                              const point2d<T>& point3,
+                              const point2d<T>& point4)
+   {
+      point2d<T> point_;
+
+      centroid
+      (
+        point1.x, point1.y,
+        point2.x, point2.y,
+        point3.x, point3.y,
+        point4.x, point4.y,
+        point_.x, point_.y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const quadix<T,2>& quadix)
+   {
+      point2d<T> point_;
+      centroid(quadix,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE point2d<T> centroid(const polygon<T,2,Allocator>& polygon)
+   {
+      point2d<T> point_;
+      centroid(polygon,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const polygon_view<T,2>& polygon)
+   {
+      point2d<T> point_;
+      centroid(polygon,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> centroid(const rectangle<T>& rectangle)
+   {
+      point2d<T> point_;
+      centroid(rectangle,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> centroid(const box<T,3>& box)
+   {
+      point3d<T> point_;
+      centroid(box,point_.x,point_.y,point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return T(0.5) * (
+                        (point1.x * (point2.y - point3.y)) +
+                        (point2.x * (point3.y - point1.y)) +
+                        (point3.x * (point1.y - point2.y))
+                      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3)
+   {
+      const T dx1 = point2.x - point1.x;
+      const T dy1 = point2.y - point1.y;
+      const T dz1 = point2.z - point1.z;
+
+      const T dx2 = point3.x - point1.x;
+      const T dy2 = point3.y - point1.y;
+      const T dz2 = point3.z - point1.z;
+
+      const T cx  = dy1 * dz2 - dy2 * dz1;
+      const T cy  = dx2 * dz1 - dx1 * dz2;
+      const T cz  = dx1 * dy2 - dx2 * dy1;
+
+      return (sqrt(cx * cx + cy * cy + cz * cz) * T(0.5));
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T area(const triangle<T,2>& triangle)
+   {
+      return T(0.5) * (
+                        (triangle[0].x * (triangle[1].y - triangle[2].y)) +
+                        (triangle[1].x * (triangle[2].y - triangle[0].y)) +
+                        (triangle[2].x * (triangle[0].y - triangle[1].y))
+                      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const triangle<T,3>& triangle)
+   {
+      const T dx1 = triangle[1].x - triangle[0].x;
+      const T dy1 = triangle[1].y - triangle[0].y;
+      const T dz1 = triangle[1].z - triangle[0].z;
+
+      const T dx2 = triangle[2].x - triangle[0].x;
+      const T dy2 = triangle[2].y - triangle[0].y;
+      const T dz2 = triangle[2].z - triangle[0].z;
+
+      const T cx  = dy1 * dz2 - dy2 * dz1;
+      const T cy  = dx2 * dz1 - dx1 * dz2;
+      const T cz  = dx1 * dy2 - dx2 * dy1;
+
+      return (sqrt(cx * cx + cy * cy + cz * cz) * T(0.5));
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T area(const quadix<T,2>& quadix)
+   {
+      return T(0.5) * (
+                        (quadix[0].x * (quadix[1].y - quadix[3].y)) +
+                        (quadix[1].x * (quadix[2].y - quadix[0].y)) +
+                        (quadix[2].x * (quadix[3].y - quadix[1].y)) +
+                        (quadix[3].x * (quadix[0].y - quadix[2].y))
+                      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const quadix<T,3>& quadix)
+   {
+      return (
+              area(make_triangle(quadix[0], quadix[1], quadix[2])) +
+              area(make_triangle(quadix[2], quadix[3], quadix[0]))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const rectangle<T>& rectangle)
+   {
+      return abs(rectangle[1].x - rectangle[0].x) * abs(rectangle[1].y - rectangle[0].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const circle<T>& circle)
+   {
+      return T(PI) * circle.radius * circle.radius;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE T area(const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::polygon_area<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const polygon_view<T,2>& polygon)
+   {
+      return detail::polygon_area<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T area(const obb<T,2>& obb)
+   {
+      return T(4.0) * obb.half_length[0] * obb.half_length[1];
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T volume(const box<T,3>& box)
+   {
+      return abs(box[1].x - box[0].x) * abs(box[1].y - box[0].y) * abs(box[1].z - box[0].z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T volume(const sphere<T>& sphere)
+   {
+      return T(4.0 / 3.0) * T(PI) * sphere.radius * sphere.radius * sphere.radius;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T volume(const obb<T,3>& obb)
+   {
+      return T(8.0) * obb.half_length[0] * obb.half_length[1] * obb.half_length[2];
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return distance(point1,point2) + distance(point2,point3) + distance(point3,point1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3)
+   {
+      return distance(point1,point2) + distance(point2,point3) + distance(point3,point1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const triangle<T,2>& triangle)
+   {
+      return perimeter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const triangle<T,3>& triangle)
+   {
+      return perimeter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const quadix<T,2>& quadix)
+   {
+      return distance(quadix[0], quadix[1]) +
+             distance(quadix[1], quadix[2]) +
+             distance(quadix[2], quadix[3]) +
+             distance(quadix[3], quadix[0]) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const quadix<T,3>& quadix)
+   {
+      return distance(quadix[0], quadix[1]) +
+             distance(quadix[1], quadix[2]) +
+             distance(quadix[2], quadix[3]) +
+             distance(quadix[3], quadix[0]) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const rectangle<T>& rectangle)
+   {
+      return T(2.0) * (abs(rectangle[1].x - rectangle[0].x) + abs(rectangle[1].y - rectangle[0].y));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const circle<T>& circle)
+   {
+      return T(2.0) * T(PI) * circle.radius;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE T perimeter(const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::polygon_perimeter<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T perimeter(const polygon_view<T,2>& polygon)
+   {
+      return detail::polygon_perimeter<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const segment<T,2>& segment)
+   {
+      rectangle<T> rectangle_;
+
+      if (segment[0].x < segment[1].x)
+      {
+         rectangle_[0].x = segment[0].x;
+         rectangle_[1].x = segment[1].x;
+      }
+      else
+      {
+         rectangle_[0].x = segment[1].x;
+         rectangle_[1].x = segment[0].x;
+      }
+
+      if (segment[0].y < segment[1].y)
+      {
+         rectangle_[0].y = segment[0].y;
+         rectangle_[1].y = segment[1].y;
+      }
+      else
+      {
+         rectangle_[0].y = segment[1].y;
+         rectangle_[1].y = segment[0].y;
+      }
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const triangle<T,2>& triangle)
+   {
+      rectangle<T> rectangle_;
+
+      rectangle_[0].x = triangle[0].x;
+      rectangle_[0].y = triangle[0].y;
+      rectangle_[1].x = triangle[0].x;
+      rectangle_[1].y = triangle[0].y;
+
+      for (std::size_t i = 1; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         if (triangle[i].x < rectangle_[0].x)
+            rectangle_[0].x = triangle[i].x;
+         else if (triangle[i].x > rectangle_[1].x)
+            rectangle_[1].x = triangle[i].x;
+         if (triangle[i].y < rectangle_[0].y)
+            rectangle_[0].y = triangle[i].y;
+         else if (triangle[i].y > rectangle_[1].y)
+            rectangle_[1].y = triangle[i].y;
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const rectangle<T>& rectangle)
+   {
+      wykobi::rectangle<T> rectangle_;
+
+      rectangle_[0].x = min(rectangle[0].x,rectangle[1].x);
+      rectangle_[0].y = min(rectangle[0].y,rectangle[1].y);
+      rectangle_[1].x = max(rectangle[0].x,rectangle[1].x);
+      rectangle_[1].y = max(rectangle[0].y,rectangle[1].y);
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const quadix<T,2>& quadix)
+   {
+      rectangle<T> rectangle_;
+
+      rectangle_[0].x = quadix[0].x;
+      rectangle_[0].y = quadix[0].y;
+      rectangle_[1].x = quadix[0].x;
+      rectangle_[1].y = quadix[0].y;
+
+      for (std::size_t i = 1; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         if (quadix[i].x < rectangle_[0].x)
+            rectangle_[0].x = quadix[i].x;
+         else if (quadix[i].x > rectangle_[1].x)
+            rectangle_[1].x = quadix[i].x;
+
+         if (quadix[i].y < rectangle_[0].y)
+            rectangle_[0].y = quadix[i].y;
+         else if (quadix[i].y > rectangle_[1].y)
+            rectangle_[1].y = quadix[i].y;
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const circle<T>& circle)
+   {
+      return make_rectangle(circle.x - circle.radius,circle.y - circle.radius,
+                            circle.x + circle.radius,circle.y + circle.radius);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE rectangle<T> aabb(const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::polygon_aabb<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const polygon_view<T,2>& polygon)
+   {
+      return detail::polygon_aabb<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> aabb(const obb<T,2>& obb)
+   {
+      const T dx = (obb.half_length[0] * abs(obb.axis[0].x)) + (obb.half_length[1] * abs(obb.axis[1].x));
+      const T dy = (obb.half_length[0] * abs(obb.axis[0].y)) + (obb.half_length[1] * abs(obb.axis[1].y));
+
+      return make_rectangle(obb.center.x - dx, obb.center.y - dy,
+                            obb.center.x + dx, obb.center.y + dy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const segment<T,2>& segment, T& x1, T& y1, T& x2, T& y2)
+   {
+      rectangle<T> rectangle_ = aabb(segment);
+
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const triangle<T,2>& triangle, T& x1, T& y1, T& x2, T& y2)
+   {
+      wykobi::rectangle<T> rectangle_ = aabb(triangle);
+
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const rectangle<T>& rectangle, T& x1, T& y1, T& x2, T& y2)
+   {
+      wykobi::rectangle<T> rectangle_ = aabb(rectangle);
+
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const quadix<T,2>& quadix, T& x1, T& y1, T& x2, T& y2)
+   {
+      wykobi::rectangle<T> rectangle_ = aabb(quadix);
+
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const circle<T>& circle, T& x1, T& y1, T& x2, T& y2)
+   {
+      wykobi::rectangle<T> rectangle_ = aabb(circle);
+
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE void aabb(const polygon<T,2,Allocator>& polygon, T& x1, T& y1, T& x2, T& y2)
+   {
+      rectangle<T> rectangle_ = aabb(polygon);
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const polygon_view<T,2>& polygon, T& x1, T& y1, T& x2, T& y2)
+   {
+      rectangle<T> rectangle_ = aabb(polygon);
+      x1 = rectangle_[0].x;
+      y1 = rectangle_[0].y;
+      x2 = rectangle_[1].x;
+      y2 = rectangle_[1].y;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const segment<T,3>& segment)
+   {
+      box<T,3> box_;
+
+      if (segment[0].x < segment[1].x)
+      {
+         box_[0].x = segment[0].x;
+         box_[1].x = segment[1].x;
+      }
+      else
+      {
+         box_[0].x = segment[1].x;
+         box_[1].x = segment[0].x;
+      }
+
+      if (segment[0].y < segment[1].y)
+      {
+         box_[0].y = segment[0].y;
+         box_[1].y = segment[1].y;
+      }
+      else
+      {
+         box_[0].y = segment[1].y;
+         box_[1].y = segment[0].y;
+      }
+
+      if (segment[0].z < segment[1].z)
+      {
+         box_[0].z = segment[0].z;
+         box_[1].z = segment[1].z;
+      }
+      else
+      {
+         box_[0].z = segment[1].z;
+         box_[1].z = segment[0].z;
+      }
+
+      return box_;
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const triangle<T,3>& triangle)
+   {
+      box<T,3> box_;
+
+      box_[0].x = triangle[0].x;
+      box_[0].y = triangle[0].y;
+      box_[0].z = triangle[0].z;
+      box_[1].x = triangle[0].x;
+      box_[1].y = triangle[0].y;
+      box_[1].z = triangle[0].z;
+
+      for (std::size_t i = 1; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         if (triangle[i].x < box_[0].x)
+            box_[0].x = triangle[i].x;
+         else if (triangle[i].x > box_[1].x)
+            box_[1].x = triangle[i].x;
+
+         if (triangle[i].y < box_[0].y)
+            box_[0].y = triangle[i].y;
+         else if (triangle[i].y > box_[1].y)
+            box_[1].y = triangle[i].y;
+
+         if (triangle[i].z < box_[0].z)
+            box_[0].z = triangle[i].z;
+         else if (triangle[i].z > box_[1].z)
+            box_[1].z = triangle[i].z;
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const box<T,3>& box)
+   {
+      wykobi::box<T,3> box_;
+
+      box_[0].x = min(box[0].x,box[1].x);
+      box_[0].y = min(box[0].y,box[1].y);
+      box_[0].z = min(box[0].z,box[1].z);
+      box_[1].x = max(box[0].x,box[1].x);
+      box_[1].y = max(box[0].y,box[1].y);
+      box_[1].z = max(box[0].z,box[1].z);
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const quadix<T,3>& quadix)
+   {
+      box<T,3> box_;
+
+      box_[0].x = quadix[0].x;
+      box_[0].y = quadix[0].y;
+      box_[0].z = quadix[0].z;
+      box_[1].x = quadix[0].x;
+      box_[1].y = quadix[0].y;
+      box_[1].z = quadix[0].z;
+
+      for (std::size_t i = 1; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         if (quadix[i].x < box_[0].x)
+            box_[0].x = quadix[i].x;
+         else if (quadix[i].x > box_[1].x)
+            box_[1].x = quadix[i].x;
+
+         if (quadix[i].y < box_[0].y)
+            box_[0].y = quadix[i].y;
+         else if (quadix[i].y > box_[1].y)
+            box_[1].y = quadix[i].y;
+
+         if (quadix[i].z < box_[0].z)
+            box_[0].z = quadix[i].z;
+         else if (quadix[i].z > box_[1].z)
+            box_[1].z = quadix[i].z;
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const sphere<T>& sphere)
+   {
+      return make_box(sphere.x - sphere.radius, sphere.y - sphere.radius, sphere.z - sphere.radius,
+                      sphere.x + sphere.radius, sphere.y + sphere.radius, sphere.z + sphere.radius);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE box<T,3> aabb(const polygon<T,3,Allocator>& polygon)
+   {
+      box<T,3> box_;
+
+      box_[0].x = polygon[0].x;
+      box_[0].y = polygon[0].y;
+      box_[0].z = polygon[0].z;
+      box_[1].x = polygon[0].x;
+      box_[1].y = polygon[0].y;
+      box_[1].z = polygon[0].z;
+
+      for (std::size_t i = 1; i < polygon.size(); ++i)
+      {
+         if (polygon[i].x < box_[0].x)
+            box_[0].x = polygon[i].x;
+         else if (polygon[i].x > box_[1].x)
+            box_[1].x = polygon[i].x;
+
+         if (polygon[i].y < box_[0].y)
+            box_[0].y = polygon[i].y;
+         else if (polygon[i].y > box_[1].y)
+            box_[1].y = polygon[i].y;
+
+         if (polygon[i].z < box_[0].z)
+            box_[0].z = polygon[i].z;
+         else if (polygon[i].z > box_[1].z)
+            box_[1].z = polygon[i].z;
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> aabb(const obb<T,3>& obb)
+   {
+      const T dx = (obb.half_length[0] * abs(obb.axis[0].x)) + (obb.half_length[1] * abs(obb.axis[1].x)) + (obb.half_length[2] * abs(obb.axis[2].x));
+      const T dy = (obb.half_length[0] * abs(obb.axis[0].y)) + (obb.half_length[1] * abs(obb.axis[1].y)) + (obb.half_length[2] * abs(obb.axis[2].y));
+      const T dz = (obb.half_length[0] * abs(obb.axis[0].z)) + (obb.half_length[1] * abs(obb.axis[1].z)) + (obb.half_length[2] * abs(obb.axis[2].z));
+
+      return make_box(obb.center.x - dx, obb.center.y - dy, obb.center.z - dz,
+                      obb.center.x + dx, obb.center.y + dy, obb.center.z + dz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const segment<T,3>& segment, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      box<T,3> box_ = aabb(segment);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const triangle<T,3>& triangle, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      box<T,3> box_ = aabb(triangle);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const box<T,3>& box, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      wykobi::box<T,3> box_ = aabb(box);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const quadix<T,3>& quadix, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      box<T,3> box_ = aabb(quadix);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void aabb(const sphere<T>& sphere, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      box<T,3> box_ = aabb(sphere);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE void aabb(const polygon<T,3,Allocator>& polygon, T& x1, T& y1, T& z1, T& x2, T& y2, T& z2)
+   {
+      box<T,3> box_ = aabb(polygon);
+      x1 = box_[0].x;
+      y1 = box_[0].y;
+      z1 = box_[0].z;
+      x2 = box_[1].x;
+      y2 = box_[1].y;
+      z2 = box_[1].z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> update_rectangle(const rectangle<T>& rectangle, point2d<T>& point)
+   {
+      if (!point_in_rectangle(point,rectangle))
+      {
+         return make_rectangle
+                (
+                  min(rectangle[0].x, rectangle[1].x, point.x),
+                  min(rectangle[0].y, rectangle[1].y, point.y),
+                  max(rectangle[0].x, rectangle[1].x, point.x),
+                  max(rectangle[0].y, rectangle[1].y, point.y)
+                );
+      }
+      else
+         return rectangle;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> update_box(const box<T,3>& box, point3d<T>& point)
+   {
+      if (!point_in_box(point,box))
+      {
+         return make_box
+                (
+                  min(box[0].x, box[1].x, point.x),
+                  min(box[0].y, box[1].y, point.y),
+                  min(box[0].z, box[1].z, point.z),
+                  max(box[0].x, box[1].x, point.x),
+                  max(box[0].y, box[1].y, point.y),
+                  max(box[0].z, box[1].z, point.z)
+                );
+      }
+      else
+         return box;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> update_circle(const circle<T>& circle, point2d<T>& point)
+   {
+      vector2d<T> d = point - make_point(circle.x,circle.y);
+
+      const T dist2 = dot_product(d,d);
+
+      if (dist2 > sqr(circle.radius))
+      {
+         const T dist       = sqrt(dist2);
+         const T new_radius = (circle.radius + dist) * T(0.5);
+         const T ratio      = (new_radius - circle.radius) / dist;
+
+         return make_circle
+                (
+                  circle.x + (d.x * ratio),
+                  circle.y + (d.y * ratio),
+                  new_radius
+                );
+      }
+      else
+         return circle;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> update_sphere(const sphere<T>& sphere, point3d<T>& point)
+   {
+      vector3d<T> d = point - make_point(sphere.x,sphere.y,sphere.z);
+
+      const T dist2 = dot_product(d,d);
+
+      if (dist2 > sqr(sphere.radius))
+      {
+         const T dist       = sqrt(dist2);
+         const T new_radius = (sphere.radius + dist) * T(0.5);
+         const T ratio      = (new_radius - sphere.radius) / dist;
+
+         return make_sphere
+                (
+                  sphere.x + (d.x * ratio),
+                  sphere.y + (d.y * ratio),
+                  sphere.z + (d.z * ratio),
+                  new_radius
+                );
+      }
+      else
+         return sphere;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_point_on_segment(const segment<T,2>& segment, const T& t)
+   {
+      if ((t < T(0.0)) || (t > T(1.0)))
+      {
+         return degenerate_point2d<T>();
+      }
+
+      return make_point
+             (
+               (T(1.0) - t) * segment[0].x + t * segment[1].x,
+               (T(1.0) - t) * segment[0].y + t * segment[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_point_on_segment(const segment<T,3>& segment, const T& t)
+   {
+      if ((t < T(0.0)) || (t > T(1.0)))
+      {
+         return degenerate_point3d<T>();
+      }
+
+      return make_point
+             (
+               (T(1.0) - t) * segment[0].x + t * segment[1].x,
+               (T(1.0) - t) * segment[0].y + t * segment[1].y,
+               (T(1.0) - t) * segment[0].z + t * segment[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> make_line(const ray<T,2>& ray)
+   {
+      return make_line(ray.origin,generate_point_on_ray(ray,T(1.0)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> make_line(const ray<T,3>& ray)
+   {
+      return make_line(ray.origin,generate_point_on_ray(ray,T(1.0)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> make_quadix(const obb<T,2>& obb)
+   {
+      return make_quadix(obb_corner(obb,0), obb_corner(obb,1), obb_corner(obb,2), obb_corner(obb,3));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const obb<T,2>& obb)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(4);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         polygon_.push_back(obb_corner(obb,i));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      /*
+         Twice the signed area, positive for counter-clockwise ordered
+         vertices. Unlike area it is exact for integer coordinates.
+      */
+      typedef typename wide_type<T>::type W;
+
+      return ((W(point2.x) - W(point1.x)) * (W(point3.y) - W(point1.y))) -
+             ((W(point3.x) - W(point1.x)) * (W(point2.y) - W(point1.y)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const triangle<T,2>& triangle)
+   {
+      return doubled_signed_area(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::polygon_doubled_signed_area<T>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE typename wide_type<T>::type doubled_signed_area(const polygon_view<T,2>& polygon)
+   {
+      return detail::polygon_doubled_signed_area<T>(polygon);
+   }
+
+} // wykobi namespace
@@ -0,0 +1,436 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_MEMORY
+#define INCLUDE_WYKOBI_MEMORY
+
+
+#include <cstddef>
+#include <new>
+#include <vector>
+#include <algorithm>
+
+
+namespace wykobi
+{
+   namespace detail
+   {
+      template <typename Allocator, typename U>
+      struct rebind_allocator
+      {
+         typedef typename Allocator::template rebind<U>::other type;
+      };
+
+      /*
+         Single parameter allocator templates (std::allocator included,
+         which has no rebind member as of C++20) are rebound directly,
+         sparing the dependency on <memory> for allocator_traits.
+      */
+      template <template <typename> class Allocator, typename T, typename U>
+      struct rebind_allocator<Allocator<T>,U>
+      {
+         typedef Allocator<U> type;
+      };
+
+      template <typename T>
+      struct alignment_of
+      {
+         struct holder { char c; T t; };
+         enum { value = sizeof(holder) - sizeof(T) };
+      };
+
+   } // namespace wykobi::detail
+
+   /*************[ Small Buffer Storage ]*************/
+   /*
+      Allocator adaptor selecting small buffer storage: a container using
+      small_buffer<N,Allocator> keeps up to N elements inline and obtains
+      anything beyond that from the wrapped allocator.
+   */
+   template <std::size_t N, typename Allocator = std::allocator<char> >
+   class small_buffer : public Allocator
+   {
+   public:
+
+      typedef Allocator allocator_type;
+
+      template <typename U>
+      struct rebind { typedef small_buffer<N,typename detail::rebind_allocator<Allocator,U>::type> other; };
+
+      small_buffer()
+      {}
+
+      small_buffer(const Allocator& allocator)
+      : Allocator(allocator)
+      {}
+
+      template <typename A>
+      small_buffer(const small_buffer<N,A>& buffer)
+      : Allocator(buffer.allocator())
+      {}
+
+      inline const Allocator& allocator() const
+      {
+         return *this;
+      }
+   };
+
+   template <std::size_t N, typename A1, typename A2>
+   inline bool operator==(const small_buffer<N,A1>& buffer1, const small_buffer<N,A2>& buffer2)
+   {
+      return buffer1.allocator() == buffer2.allocator();
+   }
+
+   template <std::size_t N, typename A1, typename A2>
+   inline bool operator!=(const small_buffer<N,A1>& buffer1, const small_buffer<N,A2>& buffer2)
+   {
+      return !(buffer1 == buffer2);
+   }
+
+   /*
+      Contiguous sequence keeping up to N elements inline, spilling to
+      storage obtained from Allocator once exceeded. T must be default
+      constructible and assignable.
+   */
+   template <typename T, std::size_t N, typename Allocator = std::allocator<T> >
+   class small_vector
+   {
+   public:
+
+      typedef T         value_type;
+      typedef T&        reference;
+      typedef const T&  const_reference;
+      typedef T*        iterator;
+      typedef const T*  const_iterator;
+      typedef Allocator allocator_type;
+
+      small_vector(const std::size_t initial_size = 0)
+      : size_(0)
+      {
+         resize(initial_size);
+      }
+
+      small_vector(const std::size_t initial_size, const T& value, const Allocator& allocator)
+      : size_(0),
+        heap_(allocator)
+      {
+         resize(initial_size,value);
+      }
+
+      small_vector(const small_vector& v)
+      : size_(0),
+        heap_(v.get_allocator())
+      {
+         assign(v.begin(),v.end());
+      }
+
+      small_vector& operator=(const small_vector& v)
+      {
+         if (this != &v)
+         {
+            assign(v.begin(),v.end());
+         }
+
+         return (*this);
+      }
+
+      inline reference       operator [](const std::size_t& index)       { return data()[index];       }
+      inline const_reference operator [](const std::size_t& index) const { return data()[index];       }
+      inline std::size_t     size       ()                         const { return size_;               }
+      inline bool            empty      ()                         const { return (0 == size_);        }
+      inline std::size_t     capacity   ()                         const { return heap_.empty() ? N : heap_.size(); }
+      inline bool            is_inline  ()                         const { return heap_.empty();       }
+      inline iterator        begin      ()                               { return data();              }
+      inline const_iterator  begin      ()                         const { return data();              }
+      inline iterator        end        ()                               { return data() + size_;      }
+      inline const_iterator  end        ()                         const { return data() + size_;      }
+      inline reference       front      ()                               { return data()[0];           }
+      inline const_reference front      ()                         const { return data()[0];           }
+      inline reference       back       ()                               { return data()[size_ - 1];   }
+      inline const_reference back       ()                         const { return data()[size_ - 1];   }
+      inline void            clear      ()                               { size_ = 0;                  }
+      inline allocator_type  get_allocator()                       const { return heap_.get_allocator(); }
+
+      inline void reserve(const std::size_t amount)
+      {
+         if (amount > capacity())
+         {
+            std::vector<T,Allocator> heap(amount,T(),heap_.get_allocator());
+            std::copy(begin(),end(),heap.begin());
+            heap_.swap(heap);
+         }
+      }
+
+      inline void resize(const std::size_t new_size, const T& value = T())
+      {
+         reserve(new_size);
+
+         if (new_size > size_)
+         {
+            std::fill(data() + size_, data() + new_size, value);
+         }
+
+         size_ = new_size;
+      }
+
+      inline void push_back(const T& value)
+      {
+         const T value_ = value;
+
+         if (size_ == capacity())
+         {
+            reserve(2 * capacity() + 1);
+         }
+
+         data()[size_++] = value_;
+      }
+
+      inline void pop_back()
+      {
+         --size_;
+      }
+
+      inline iterator erase(iterator position)
+      {
+         std::copy(position + 1, end(), position);
+         --size_;
+         return position;
+      }
+
+      template <typename InputIterator>
+      inline void assign(InputIterator first, InputIterator last)
+      {
+         clear();
+
+         for (InputIterator it = first; it != last; ++it)
+         {
+            push_back(*it);
+         }
+      }
+
+   private:
+
+      inline T*       data()       { return heap_.empty() ? inline_ : &heap_[0]; }
+      inline const T* data() const { return heap_.empty() ? inline_ : &heap_[0]; }
+
+      std::size_t              size_;
+      T                        inline_[N];
+      std::vector<T,Allocator> heap_;
+   };
+
+   /**************[ Monotonic Arena ]**************/
+   /*
+      Bump allocator over a list of blocks. Each allocation is aligned to
+      the requested alignment (a power of two). Individual deallocation is
+      a no-op, reset() rewinds to the first block and keeps every block for
+      reuse, so a steady-state per-frame pipeline performs no heap calls.
+   */
+   class monotonic_arena
+   {
+   public:
+
+      static const std::size_t DefaultAlignment = 16;
+
+      explicit monotonic_arena(const std::size_t block_size = 64 * 1024)
+      : block_size_(block_size),
+        current_(0),
+        offset_(0),
+        used_(0)
+      {}
+
+     ~monotonic_arena()
+      {
+         for (std::size_t i = 0; i < blocks_.size(); ++i)
+         {
+            ::operator delete(blocks_[i].data);
+         }
+      }
+
+      inline void* allocate(const std::size_t size, const std::size_t alignment = DefaultAlignment)
+      {
+         if (size > (static_cast<std::size_t>(-1) - alignment))
+         {
+            throw std::bad_alloc();
+         }
+
+         while (current_ < blocks_.size())
+         {
+            const std::size_t offset = aligned_offset(blocks_[current_].data,offset_,alignment);
+
+            if ((offset <= blocks_[current_].size) && (size <= (blocks_[current_].size - offset)))
+            {
+               used_   += (offset - offset_) + size;
+               offset_  = offset + size;
+               return blocks_[current_].data + offset;
+            }
+
+            ++current_;
+            offset_ = 0;
+         }
+
+         block block_;
+         block_.size = std::max(block_size_,size + alignment - 1);
+         block_.data = static_cast<char*>(::operator new(block_.size));
+
+         blocks_.push_back(block_);
+
+         const std::size_t offset = aligned_offset(block_.data,0,alignment);
+
+         current_ = blocks_.size() - 1;
+         offset_  = offset + size;
+         used_   += offset + size;
+
+         return block_.data + offset;
+      }
+
+      inline void deallocate(void*)
+      {}
+
+      inline void reset()
+      {
+         current_ = 0;
+         offset_  = 0;
+         used_    = 0;
+      }
+
+      inline std::size_t bytes_used() const
+      {
+         return used_;
+      }
+
+      inline std::size_t bytes_reserved() const
+      {
+         std::size_t total = 0;
+
+         for (std::size_t i = 0; i < blocks_.size(); ++i)
+         {
+            total += blocks_[i].size;
+         }
+
+         return total;
+      }
+
+   private:
+
+      monotonic_arena(const monotonic_arena&);
+      monotonic_arena& operator=(const monotonic_arena&);
+
+      static inline std::size_t aligned_offset(const char* data, const std::size_t offset, const std::size_t alignment)
+      {
+         const std::size_t address = reinterpret_cast<std::size_t>(data + offset);
+         return offset + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+      }
+
+      struct block
+      {
+         char*       data;
+         std::size_t size;
+      };
+
+      std::vector<block> blocks_;
+      std::size_t        block_size_;
+      std::size_t        current_;
+      std::size_t        offset_;
+      std::size_t        used_;
+   };
+
+   template <typename T>
+   class arena_allocator
+   {
+   public:
+
+      typedef T              value_type;
+      typedef T*             pointer;
+      typedef const T*       const_pointer;
+      typedef T&             reference;
+      typedef const T&       const_reference;
+      typedef std::size_t    size_type;
+      typedef std::ptrdiff_t difference_type;
+
+      template <typename U>
+      struct rebind { typedef arena_allocator<U> other; };
+
+      explicit arena_allocator(monotonic_arena& arena)
+      : arena_(&arena)
+      {}
+
+      template <typename U>
+      arena_allocator(const arena_allocator<U>& allocator)
+      : arena_(allocator.arena())
+      {}
+
+      inline pointer allocate(const size_type n, const void* = 0)
+      {
+         if (n > max_size())
+         {
+            throw std::bad_alloc();
+         }
+
+         return static_cast<pointer>(arena_->allocate(n * sizeof(T),detail::alignment_of<T>::value));
+      }
+
+      inline void deallocate(pointer p, const size_type)
+      {
+         arena_->deallocate(p);
+      }
+
+      inline void construct(pointer p, const T& value)
+      {
+         new (static_cast<void*>(p)) T(value);
+      }
+
+      inline void destroy(pointer p)
+      {
+         p->~T();
+      }
+
+      inline size_type max_size() const
+      {
+         return static_cast<size_type>(-1) / sizeof(T);
+      }
+
+      inline pointer       address(reference x)       const { return &x; }
+      inline const_pointer address(const_reference x) const { return &x; }
+
+      inline monotonic_arena* arena() const
+      {
+         return arena_;
+      }
+
+   private:
+
+      monotonic_arena* arena_;
+   };
+
+   template <typename T, typename U>
+   inline bool operator==(const arena_allocator<T>& allocator1, const arena_allocator<U>& allocator2)
+   {
+      return allocator1.arena() == allocator2.arena();
+   }
+
+   template <typename T, typename U>
+   inline bool operator!=(const arena_allocator<T>& allocator1, const arena_allocator<U>& allocator2)
+   {
+      return allocator1.arena() != allocator2.arena();
+   }
+
+} // namespace wykobi
+
+#endif
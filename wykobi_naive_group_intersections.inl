@@ -20,15 +20,76 @@
 
 #include "wykobi.hpp"
 #include "wykobi_algorithm.hpp"
+#include "wykobi_execution.hpp"
 
-#include <vector>
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 
 namespace wykobi
 {
    namespace algorithm
    {
+      namespace detail
+      {
+         template <typename Intersections, typename Point, typename RandomAccessIterator>
+         class group_intersections_block
+         {
+         public:
+
+            group_intersections_block(const RandomAccessIterator& begin, const RandomAccessIterator& end,
+                                      std::vector< std::vector<Point> >& point_list)
+            : begin_(begin),
+              end_(end),
+              point_list_(point_list)
+            {}
+
+            inline void operator()(const std::size_t& block, const std::size_t& first, const std::size_t& last)
+            {
+               std::back_insert_iterator< std::vector<Point> > out(point_list_[block]);
+
+               for (std::size_t i = first; i < last; ++i)
+               {
+                  out = Intersections::row(begin_ + i,end_,out);
+               }
+            }
+
+         private:
+
+            group_intersections_block& operator=(const group_intersections_block&);
+
+            RandomAccessIterator               begin_;
+            RandomAccessIterator               end_;
+            std::vector< std::vector<Point> >& point_list_;
+         };
+
+         /*
+            Rows of the pairwise test are cut into small blocks, whose
+            points are written out in block order: the output is the same
+            as that of the sequential version, whatever the thread count.
+         */
+         template <typename Intersections, typename Point, typename RandomAccessIterator, typename OutputIterator>
+         inline void parallel_group_intersections(const execution::policy& policy,
+                                                  RandomAccessIterator begin, RandomAccessIterator end,
+                                                  OutputIterator out)
+         {
+            const std::size_t block_size = 64;
+            const std::size_t count      = static_cast<std::size_t>(std::distance(begin,end));
+
+            std::vector< std::vector<Point> > point_list(execution::block_count(count,block_size));
+
+            group_intersections_block<Intersections,Point,RandomAccessIterator> task(begin,end,point_list);
+            execution::for_each_block(policy,count,block_size,task);
+
+            for (std::size_t i = 0; i < point_list.size(); ++i)
+            {
+               out = std::copy(point_list[i].begin(),point_list[i].end(),out);
+            }
+         }
+
+      } // namespace wykobi::algorithm::detail
+
       template <typename T>
       struct naive_group_intersections< segment<T,2> >
       {
@@ -39,14 +100,29 @@ namespace wykobi
          {
             for (InputIterator i = begin; i != end; ++i)
             {
-               for (InputIterator j = (i + 1); j != end; ++j)
+               out = row(i,end,out);
+            }
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         naive_group_intersections(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out)
+         {
+            detail::parallel_group_intersections<naive_group_intersections,point2d<T> >(policy,begin,end,out);
+         }
+
+         /* Intersections of *i with every later object of the range. */
+         template <typename InputIterator, typename OutputIterator>
+         static inline OutputIterator row(InputIterator i, InputIterator end, OutputIterator out)
+         {
+            for (InputIterator j = (i + 1); j != end; ++j)
+            {
+               if (intersect((*j),(*i)))
                {
-                  if (intersect((*j),(*i)))
-                  {
-                     (*out++) = intersection_point((*j),(*i));
-                  }
+                  (*out++) = intersection_point((*j),(*i));
                }
             }
+
+            return out;
          }
       };
 
@@ -60,14 +136,29 @@ namespace wykobi
          {
             for (InputIterator i = begin; i != end; ++i)
             {
-               for (InputIterator j = (i + 1); j != end; ++j)
+               out = row(i,end,out);
+            }
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         naive_group_intersections(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out)
+         {
+            detail::parallel_group_intersections<naive_group_intersections,point3d<T> >(policy,begin,end,out);
+         }
+
+         /* Intersections of *i with every later object of the range. */
+         template <typename InputIterator, typename OutputIterator>
+         static inline OutputIterator row(InputIterator i, InputIterator end, OutputIterator out)
+         {
+            for (InputIterator j = (i + 1); j != end; ++j)
+            {
+               if (intersect((*j),(*i)))
                {
-                  if (intersect((*j),(*i)))
-                  {
-                     (*out++) = intersection_point((*j),(*i));
-                  }
+                  (*out++) = intersection_point((*j),(*i));
                }
             }
+
+            return out;
          }
       };
 
@@ -81,24 +172,39 @@ namespace wykobi
          {
             for (InputIterator i = begin; i != end; ++i)
             {
-               for (InputIterator j = (i + 1); j != end; ++j)
-               {
+               out = row(i,end,out);
+            }
+         }
+
+         template <typename RandomAccessIterator, typename OutputIterator>
+         naive_group_intersections(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end, OutputIterator out)
+         {
+            detail::parallel_group_intersections<naive_group_intersections,point2d<T> >(policy,begin,end,out);
+         }
 
-                  if (
-                       (distance((*i).x,(*i).y,(*j).x,(*j).y) >= std::abs((*i).radius - (*j).radius)) &&
-                       intersect((*j),(*i))
-                     )
-                  {
-                     point2d<T> p1;
-                     point2d<T> p2;
+         /* Intersections of *i with every later object of the range. */
+         template <typename InputIterator, typename OutputIterator>
+         static inline OutputIterator row(InputIterator i, InputIterator end, OutputIterator out)
+         {
+            for (InputIterator j = (i + 1); j != end; ++j)
+            {
 
-                     intersection_point((*j),(*i),p1,p2);
+               if (
+                    (distance((*i).x,(*i).y,(*j).x,(*j).y) >= std::abs((*i).radius - (*j).radius)) &&
+                    intersect((*j),(*i))
+                  )
+               {
+                  point2d<T> p1;
+                  point2d<T> p2;
+
+                  intersection_point((*j),(*i),p1,p2);
 
-                     (*out++) = p1;
-                     (*out++) = p2;
-                  }
+                  (*out++) = p1;
+                  (*out++) = p2;
                }
             }
+
+            return out;
          }
       };
 
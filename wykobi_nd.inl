@@ -31,7 +31,7 @@ namespace wykobi
 {
 
    template <typename T, std::size_t D>
-   inline bool parallel(const line<T,D>& line1, const line<T,D>& line2)
+   WYKOBI_INLINE bool parallel(const line<T,D>& line1, const line<T,D>& line2)
    {
       const vectornd<T,D> v1 = line1[0] - line1[1];
       const vectornd<T,D> v2 = line2[0] - line2[1];
@@ -40,7 +40,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool parallel(const segment<T,D>& segment1, const segment<T,D>& segment2)
+   WYKOBI_INLINE bool parallel(const segment<T,D>& segment1, const segment<T,D>& segment2)
    {
       const vectornd<T,D> v1 = segment1[0] - segment1[1];
       const vectornd<T,D> v2 = segment2[0] - segment2[1];
@@ -49,19 +49,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool perpendicular(const line<T,D>& line1, const line<T,D>& line2)
+   WYKOBI_INLINE bool perpendicular(const line<T,D>& line1, const line<T,D>& line2)
    {
       return is_equal(dot_product(line1[0] - line1[1],line2[0] - line2[1]),T(0.0));
    }
 
    template <typename T, std::size_t D>
-   inline bool perpendicular(const segment<T,D>& segment1, const segment<T,D>& segment2)
+   WYKOBI_INLINE bool perpendicular(const segment<T,D>& segment1, const segment<T,D>& segment2)
    {
       return is_equal(dot_product(segment1[0] - segment1[1],segment2[0] - segment2[1]),T(0.0));
    }
 
    template <typename T, std::size_t D>
-   inline bool collinear(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
+   WYKOBI_INLINE bool collinear(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
    {
       const vectornd<T,D> v1 = point2 - point1;
       const vectornd<T,D> v2 = point3 - point1;
@@ -70,13 +70,13 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool robust_collinear(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
+   WYKOBI_INLINE bool robust_collinear(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
    {
       return (less_than_or_equal(lay_distance(closest_point_on_line_from_point(make_line(point1,point2),point3),point3),T(0.0)));
    }
 
    template <typename T, std::size_t D>
-   inline bool is_point_collinear(const segment<T,D>& segment, const pointnd<T,D>& point, const bool robust)
+   WYKOBI_INLINE bool is_point_collinear(const segment<T,D>& segment, const pointnd<T,D>& point, const bool robust)
    {
 
       for (std::size_t i = 0; i < D; ++i)
@@ -97,19 +97,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool intersect(const segment<T,D>& segment1, const segment<T,D>& segment2, const T& fuzzy)
+   WYKOBI_INLINE bool intersect(const segment<T,D>& segment1, const segment<T,D>& segment2, const T& fuzzy)
    {
       return is_equal(distance(segment1,segment2),fuzzy);
    }
 
    template <typename T, std::size_t D>
-   inline bool intersect(const line<T,D>& line1, const line<T,D>& line2, const T& fuzzy)
+   WYKOBI_INLINE bool intersect(const line<T,D>& line1, const line<T,D>& line2, const T& fuzzy)
    {
       return is_equal(distance(line1,line2),fuzzy);
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> intersection_point(const segment<T,D>& segment1, const segment<T,D>& segment2, const T& fuzzy)
+   WYKOBI_INLINE pointnd<T,D> intersection_point(const segment<T,D>& segment1, const segment<T,D>& segment2, const T& fuzzy)
    {
       const vectornd<T,D> u = segment1[1] - segment1[0];
       const vectornd<T,D> v = segment2[1] - segment2[0];
@@ -206,7 +206,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> intersection_point(const line<T,D>& line1, const line<T,D>& line2, const T& fuzzy)
+   WYKOBI_INLINE pointnd<T,D> intersection_point(const line<T,D>& line1, const line<T,D>& line2, const T& fuzzy)
    {
       const vectornd<T,D> u = line1[1] - line1[0];
       const vectornd<T,D> v = line2[1] - line2[0];
@@ -251,37 +251,37 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE T distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       return sqrt(lay_distance(point1,point2));
    }
 
    template <typename T, std::size_t D>
-   inline T distance(const pointnd<T,D>& point, const segment<T,D>& segment)
+   WYKOBI_INLINE T distance(const pointnd<T,D>& point, const segment<T,D>& segment)
    {
       return distance(closest_point_on_segment_from_point(segment,point),point);
    }
 
    template <typename T, std::size_t D>
-   inline T distance(const pointnd<T,D>& point, const line<T,D>& line)
+   WYKOBI_INLINE T distance(const pointnd<T,D>& point, const line<T,D>& line)
    {
       return distance(closest_point_on_line_from_point(line,point),point);
    }
 
    template <typename T, std::size_t D>
-   inline T distance(const segment<T,D>& segment1, const segment<T,D>& segment2)
+   WYKOBI_INLINE T distance(const segment<T,D>& segment1, const segment<T,D>& segment2)
    {
       return sqrt(lay_distance(segment1,segment2));
    }
 
    template <typename T, std::size_t D>
-   inline T distance(const line<T,D>& line1, const line<T,D>& line2)
+   WYKOBI_INLINE T distance(const line<T,D>& line1, const line<T,D>& line2)
    {
       return sqrt(lay_distance(line1,line2));
    }
 
    template <typename T, std::size_t D>
-   inline T lay_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE T lay_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       T sum = T(0.0);
 
@@ -294,19 +294,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T lay_distance(const pointnd<T,D>& point, const segment<T,D>& segment)
+   WYKOBI_INLINE T lay_distance(const pointnd<T,D>& point, const segment<T,D>& segment)
    {
       return lay_distance(closest_point_on_segment_from_point(segment,point),point);
    }
 
    template <typename T, std::size_t D>
-   inline T lay_distance(const pointnd<T,D>& point, const line<T,D>& line)
+   WYKOBI_INLINE T lay_distance(const pointnd<T,D>& point, const line<T,D>& line)
    {
       return lay_distance(closest_point_on_line_from_point(line,point),point);
    }
 
    template <typename T, std::size_t D>
-   inline T lay_distance(const segment<T,D>& segment1, const segment<T,D>& segment2)
+   WYKOBI_INLINE T lay_distance(const segment<T,D>& segment1, const segment<T,D>& segment2)
    {
       const vectornd<T,D> u = segment1[1] - segment1[0];
       const vectornd<T,D> v = segment2[1] - segment2[0];
@@ -399,7 +399,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T lay_distance(const line<T,D>& line1, const line<T,D>& line2)
+   WYKOBI_INLINE T lay_distance(const line<T,D>& line1, const line<T,D>& line2)
    {
       const vectornd<T,D> u = line1[1] - line1[0];
       const vectornd<T,D> v = line2[1] - line2[0];
@@ -437,7 +437,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T manhattan_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE T manhattan_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       T sum = T(0.0);
 
@@ -450,7 +450,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T chebyshev_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE T chebyshev_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       T max_diff = abs(point1[0] - point2[0]);
 
@@ -463,7 +463,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T inverse_chebyshev_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE T inverse_chebyshev_distance(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       T min_diff = abs(point1[0] - point2[0]);
 
@@ -476,7 +476,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool point_in_box(const pointnd<T,D>& point, const box<T,D>& box)
+   WYKOBI_INLINE bool point_in_box(const pointnd<T,D>& point, const box<T,D>& box)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -490,13 +490,13 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool point_in_sphere(const pointnd<T,D>& point, const hypersphere<T,D>& sphere)
+   WYKOBI_INLINE bool point_in_sphere(const pointnd<T,D>& point, const hypersphere<T,D>& sphere)
    {
       return less_than_or_equal(sqr(sphere.radius),lay_distance(point,pointnd<T,D>(sphere.center)));
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> closest_point_on_segment_from_point(const segment<T,D>& segment, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> closest_point_on_segment_from_point(const segment<T,D>& segment, const pointnd<T,D>& point)
    {
       const vectornd<T,D> v1 = segment[1] - segment[0];
       const vectornd<T,D> v2 =      point - segment[0];
@@ -528,7 +528,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> closest_point_on_line_from_point(const line<T,D>& line, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> closest_point_on_line_from_point(const line<T,D>& line, const pointnd<T,D>& point)
    {
       const vectornd<T,D> v1 = line[1] - line[0];
       const vectornd<T,D> v2 =   point - line[0];
@@ -549,13 +549,13 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> closest_point_on_sphere_from_point(const hypersphere<T,D>& sphere, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> closest_point_on_sphere_from_point(const hypersphere<T,D>& sphere, const pointnd<T,D>& point)
    {
       return sphere.center + sphere.radius / distance(sphere.center,point) * (point - sphere.center);
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> closest_point_on_plane_from_point(const plane<T,D>& plane, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> closest_point_on_plane_from_point(const plane<T,D>& plane, const pointnd<T,D>& point)
    {
       const T mu = dot_product(plane.normal,plane.normal) - plane.constant;
 
@@ -575,7 +575,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> closest_point_on_box_from_point(const box<T,D>& box, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> closest_point_on_box_from_point(const box<T,D>& box, const pointnd<T,D>& point)
    {
       pointnd<T,D> _point = point;
 
@@ -598,7 +598,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> project_point_t(const pointnd<T,D>& source_point,
+   WYKOBI_INLINE pointnd<T,D> project_point_t(const pointnd<T,D>& source_point,
                                        const pointnd<T,D>& destination_point,
                                        const T& t)
    {
@@ -613,7 +613,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> project_point(const pointnd<T,D>& source_point,
+   WYKOBI_INLINE pointnd<T,D> project_point(const pointnd<T,D>& source_point,
                                      const pointnd<T,D>& destination_point,
                                      const T& distance)
    {
@@ -626,13 +626,13 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> mirror(const pointnd<T,D>& point, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE pointnd<T,D> mirror(const pointnd<T,D>& point, const line<T,D>& mirror_axis)
    {
       return project_point_t(point,closest_point_on_line_from_point(mirror_axis, point), T(2.0));
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> mirror(const segment<T,D>& segment, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE segment<T,D> mirror(const segment<T,D>& segment, const line<T,D>& mirror_axis)
    {
       wykobi::segment<T,D> _segment;
 
@@ -645,7 +645,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline line<T,D> mirror(const line<T,D>& line, const wykobi::line<T,D>& mirror_axis)
+   WYKOBI_INLINE line<T,D> mirror(const line<T,D>& line, const wykobi::line<T,D>& mirror_axis)
    {
       wykobi::line<T,D> _line;
 
@@ -658,7 +658,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline box<T,D> mirror(const box<T,D>& box, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE box<T,D> mirror(const box<T,D>& box, const line<T,D>& mirror_axis)
    {
       wykobi::box<T,D> _box;
 
@@ -671,7 +671,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline triangle<T,D> mirror(const triangle<T,D>& triangle, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE triangle<T,D> mirror(const triangle<T,D>& triangle, const line<T,D>& mirror_axis)
    {
       wykobi::triangle<T,D> _triangle;
 
@@ -684,7 +684,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline quadix<T,D> mirror(const quadix<T,D>& quadix, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE quadix<T,D> mirror(const quadix<T,D>& quadix, const line<T,D>& mirror_axis)
    {
       wykobi::quadix<T,D> _quadix;
 
@@ -697,7 +697,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline hypersphere<T,D> mirror(const hypersphere<T,D>& sphere, const line<T,D>& mirror_axis)
+   WYKOBI_INLINE hypersphere<T,D> mirror(const hypersphere<T,D>& sphere, const line<T,D>& mirror_axis)
    {
       wykobi::hypersphere<T,D> _sphere;
 
@@ -707,10 +707,10 @@ namespace wykobi
       return _sphere;
    }
 
-   template <typename T, std::size_t D>
-   inline polygon<T,D> mirror(const polygon<T,D>& polygon, const line<T,D>& mirror_axis)
+   template <typename T, std::size_t D, typename Allocator>
+   WYKOBI_INLINE polygon<T,D,Allocator> mirror(const polygon<T,D,Allocator>& polygon, const line<T,D>& mirror_axis)
    {
-      wykobi::polygon<T,D> _polygon;
+      wykobi::polygon<T,D,Allocator> _polygon(polygon.get_allocator());
 
       _polygon.reserve(polygon.size());
 
@@ -723,7 +723,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const pointnd<T,D>& point, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const pointnd<T,D>& point, const line<T,D>& axis)
    {
       wykobi::pointnd<T,D> _point = closest_point_on_line_from_point(axis,point);
 
@@ -731,7 +731,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const triangle<T,D>& triangle, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const triangle<T,D>& triangle, const line<T,D>& axis)
    {
       std::vector< pointnd<T,D> > point_list;
 
@@ -748,7 +748,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const box<T,D>& box, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const box<T,D>& box, const line<T,D>& axis)
    {
       std::vector< pointnd<T,D> > point_list;
 
@@ -765,7 +765,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const quadix<T,D>& quadix, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const quadix<T,D>& quadix, const line<T,D>& axis)
    {
       std::vector< pointnd<T,D> > point_list;
 
@@ -782,7 +782,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const hypersphere<T,D>& sphere, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const hypersphere<T,D>& sphere, const line<T,D>& axis)
    {
       vectornd<T,D> v = normalize(axis[0] - axis[1]);
 
@@ -800,7 +800,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> project_onto_axis(const polygon<T,D>& polygon, const line<T,D>& axis)
+   WYKOBI_INLINE segment<T,D> project_onto_axis(const polygon<T,D>& polygon, const line<T,D>& axis)
    {
       if (polygon.size() == 0)
          return degenerate_segmentnd<T,D>();
@@ -820,7 +820,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T perimeter(const triangle<T,D>& triangle)
+   WYKOBI_INLINE T perimeter(const triangle<T,D>& triangle)
    {
       return distance(triangle[0],triangle[1]) +
              distance(triangle[1],triangle[2]) +
@@ -828,7 +828,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T perimeter(const quadix<T,D>& quadix)
+   WYKOBI_INLINE T perimeter(const quadix<T,D>& quadix)
    {
       return distance(quadix[0],quadix[1]) +
              distance(quadix[1],quadix[2]) +
@@ -836,8 +836,8 @@ namespace wykobi
              distance(quadix[3],quadix[0]) ;
    }
 
-   template <typename T, std::size_t D>
-   inline T perimeter(const polygon<T,D>& polygon)
+   template <typename T, std::size_t D, typename Allocator>
+   WYKOBI_INLINE T perimeter(const polygon<T,D,Allocator>& polygon)
    {
       T total_length = distance(polygon.back(),polygon[0]);
 
@@ -851,7 +851,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> generate_random_point(const segment<T,D>& segment)
+   WYKOBI_INLINE pointnd<T,D> generate_random_point(const segment<T,D>& segment)
    {
       const T t = generate_random_value(T(1.0));
 
@@ -859,7 +859,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> generate_random_point(const triangle<T,D>& triangle)
+   WYKOBI_INLINE pointnd<T,D> generate_random_point(const triangle<T,D>& triangle)
    {
       T a = generate_random_value(T(1.0));
       T b = generate_random_value(T(1.0));
@@ -876,7 +876,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> generate_random_point(const quadix<T,D>& quadix)
+   WYKOBI_INLINE pointnd<T,D> generate_random_point(const quadix<T,D>& quadix)
    {
       const T a = (2 * generate_random_value(T(1.0))) - 1;
       const T b = (2 * generate_random_value(T(1.0))) - 1;
@@ -896,7 +896,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> generate_random_point(const box<T,D>& box)
+   WYKOBI_INLINE pointnd<T,D> generate_random_point(const box<T,D>& box)
    {
       pointnd<T,D> _point;
 
@@ -909,7 +909,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline void generate_random_points(const box<T,D>& box, std::vector< pointnd<T,D> >& point_list)
+   WYKOBI_INLINE void generate_random_points(const box<T,D>& box, std::vector< pointnd<T,D> >& point_list)
    {
       for (std::size_t i = 0; i < point_list.size(); ++i)
       {
@@ -918,7 +918,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline void generate_random_points(const segment<T,D>& segment, std::vector< pointnd<T,D> >& point_list)
+   WYKOBI_INLINE void generate_random_points(const segment<T,D>& segment, std::vector< pointnd<T,D> >& point_list)
    {
       for (std::size_t i = 0; i < point_list.size(); ++i)
       {
@@ -927,7 +927,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline void generate_random_points(const triangle<T,D>& triangle, std::vector< pointnd<T,D> >& point_list)
+   WYKOBI_INLINE void generate_random_points(const triangle<T,D>& triangle, std::vector< pointnd<T,D> >& point_list)
    {
       for (std::size_t i = 0; i < point_list.size(); ++i)
       {
@@ -936,7 +936,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline void generate_random_points(const quadix<T,D>& quadix, std::vector< pointnd<T,D> >& point_list)
+   WYKOBI_INLINE void generate_random_points(const quadix<T,D>& quadix, std::vector< pointnd<T,D> >& point_list)
    {
       for (std::size_t i = 0; i < point_list.size(); ++i)
       {
@@ -945,19 +945,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T vector_norm(const vectornd<T,D>& v)
+   WYKOBI_INLINE T vector_norm(const vectornd<T,D>& v)
    {
       return sqrt(dot_product(v,v));
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> normalize(const vectornd<T,D>& v)
+   WYKOBI_INLINE vectornd<T,D> normalize(const vectornd<T,D>& v)
    {
       return v * (T(1.0) / vector_norm(v));
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator+(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
+   WYKOBI_INLINE vectornd<T,D> operator+(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
    {
       vectornd<T,D> v3;
 
@@ -970,7 +970,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator-(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
+   WYKOBI_INLINE vectornd<T,D> operator-(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
    {
       vectornd<T,D> v3;
 
@@ -983,7 +983,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline T dot_product(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
+   WYKOBI_INLINE T dot_product(const vectornd<T,D>& v1, const vectornd<T,D>& v2)
    {
       T result = T(0.0);
 
@@ -996,7 +996,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator*(const vectornd<T,D>& v1, const T& scale)
+   WYKOBI_INLINE vectornd<T,D> operator*(const vectornd<T,D>& v1, const T& scale)
    {
       vectornd<T,D> v3;
 
@@ -1009,7 +1009,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator*(const T& scale, const vectornd<T,D>& v1)
+   WYKOBI_INLINE vectornd<T,D> operator*(const T& scale, const vectornd<T,D>& v1)
    {
       vectornd<T,D> v3;
 
@@ -1022,7 +1022,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator*(const pointnd<T,D>& point, const T& scale)
+   WYKOBI_INLINE pointnd<T,D> operator*(const pointnd<T,D>& point, const T& scale)
    {
       pointnd<T,D> _point;
 
@@ -1035,7 +1035,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator*(const T& scale, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> operator*(const T& scale, const pointnd<T,D>& point)
    {
       pointnd<T,D> _point;
 
@@ -1048,7 +1048,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator/(const vectornd<T,D>& v1, const T& scale)
+   WYKOBI_INLINE vectornd<T,D> operator/(const vectornd<T,D>& v1, const T& scale)
    {
       vectornd<T,D> v2;
 
@@ -1061,7 +1061,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator/(const pointnd<T,D>& point, const T& scale)
+   WYKOBI_INLINE pointnd<T,D> operator/(const pointnd<T,D>& point, const T& scale)
    {
       pointnd<T,D> _point;
 
@@ -1074,7 +1074,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator+(const pointnd<T,D>& point, const vectornd<T,D>& v)
+   WYKOBI_INLINE pointnd<T,D> operator+(const pointnd<T,D>& point, const vectornd<T,D>& v)
    {
       pointnd<T,D> _point;
 
@@ -1087,7 +1087,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator+(const vectornd<T,D>& v, const pointnd<T,D>& point)
+   WYKOBI_INLINE pointnd<T,D> operator+(const vectornd<T,D>& v, const pointnd<T,D>& point)
    {
       pointnd<T,D> _point;
 
@@ -1100,7 +1100,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> operator-(const pointnd<T,D>& p1, const pointnd<T,D>& p2)
+   WYKOBI_INLINE vectornd<T,D> operator-(const pointnd<T,D>& p1, const pointnd<T,D>& p2)
    {
       vectornd<T,D> _v;
 
@@ -1113,13 +1113,13 @@ namespace wykobi
    }
 
    template <typename T>
-   inline T operator*(const vectornd<T,2>& v1, const vectornd<T,2>& v2)
+   WYKOBI_INLINE T operator*(const vectornd<T,2>& v1, const vectornd<T,2>& v2)
    {
       return T((v1[0] * v2[1]) - (v1[1] * v2[0]));
    }
 
    template <typename T>
-   inline vectornd<T,3> operator*(const vectornd<T,3>& v1, const vectornd<T,3>& v2)
+   WYKOBI_INLINE vectornd<T,3> operator*(const vectornd<T,3>& v1, const vectornd<T,3>& v2)
    {
       return vectornd<T,3>( v1[1] * v2[2] - v1[2] * v2[1],
                             v1[2] * v2[0] - v1[0] * v2[2],
@@ -1127,7 +1127,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> operator+(const pointnd<T,D>& p1, const pointnd<T,D>& p2)
+   WYKOBI_INLINE pointnd<T,D> operator+(const pointnd<T,D>& p1, const pointnd<T,D>& p2)
    {
       pointnd<T,D> _point;
 
@@ -1140,7 +1140,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool operator < (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE bool operator < (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -1158,7 +1158,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool operator > (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE bool operator > (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -1176,13 +1176,13 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool operator == (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE bool operator == (const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       return is_equal(point1,point2);
    }
 
    template <typename T, std::size_t D>
-   inline bool is_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const T& epsilon)
+   WYKOBI_INLINE bool is_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const T& epsilon)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -1196,7 +1196,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool is_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE bool is_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -1210,19 +1210,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline bool not_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const T& epsilon)
+   WYKOBI_INLINE bool not_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const T& epsilon)
    {
       return !is_equal(point1,point2,epsilon);
    }
 
    template <typename T, std::size_t D>
-   inline bool not_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE bool not_equal(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       return !is_equal(point1,point2);
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> degenerate_pointnd()
+   WYKOBI_INLINE pointnd<T,D> degenerate_pointnd()
    {
       pointnd<T,D> _point;
 
@@ -1235,7 +1235,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> degenerate_vectornd()
+   WYKOBI_INLINE vectornd<T,D> degenerate_vectornd()
    {
       vectornd<T,D> _vector;
 
@@ -1248,25 +1248,25 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline ray<T,D> degenerate_raynd()
+   WYKOBI_INLINE ray<T,D> degenerate_raynd()
    {
       return make_ray(degenerate_pointnd<T,D>(),degenerate_vectornd<T,D>());
    }
 
    template <typename T, std::size_t D>
-   inline line<T,D> degenerate_linend()
+   WYKOBI_INLINE line<T,D> degenerate_linend()
    {
       return make_line(degenerate_pointnd<T,D>(),degenerate_pointnd<T,D>());
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> degenerate_segmentnd()
+   WYKOBI_INLINE segment<T,D> degenerate_segmentnd()
    {
       return make_segment(degenerate_pointnd<T,D>(),degenerate_pointnd<T,D>());
    }
 
    template <typename T, std::size_t D>
-   inline triangle<T,D> degenerate_trianglend()
+   WYKOBI_INLINE triangle<T,D> degenerate_trianglend()
    {
       return make_triangle(degenerate_pointnd<T,D>(),
                            degenerate_pointnd<T,D>(),
@@ -1274,7 +1274,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline quadix<T,D> degenerate_quadixnd()
+   WYKOBI_INLINE quadix<T,D> degenerate_quadixnd()
    {
       return make_quadix(degenerate_pointnd<T,D>(),
                          degenerate_pointnd<T,D>(),
@@ -1283,19 +1283,19 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline box<T,D> degenerate_box()
+   WYKOBI_INLINE box<T,D> degenerate_box()
    {
       return make_box(degenerate_pointnd<T,D>(),degenerate_pointnd<T,D>());
    }
 
    template <typename T, std::size_t D>
-   inline hypersphere<T,D> degenerate_hypersphere()
+   WYKOBI_INLINE hypersphere<T,D> degenerate_hypersphere()
    {
       return make_sphere(degenerate_pointnd<T,D>(),+infinity<T>());
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> positive_infinite_pointnd()
+   WYKOBI_INLINE pointnd<T,D> positive_infinite_pointnd()
    {
       pointnd<T,D> _point;
 
@@ -1308,7 +1308,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline pointnd<T,D> negative_infinite_pointnd()
+   WYKOBI_INLINE pointnd<T,D> negative_infinite_pointnd()
    {
       pointnd<T,D> _point;
 
@@ -1321,7 +1321,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline void swap(pointnd<T,D>& point1, pointnd<T,D>& point2)
+   WYKOBI_INLINE void swap(pointnd<T,D>& point1, pointnd<T,D>& point2)
    {
       for (std::size_t i = 0; i < D; ++i)
       {
@@ -1332,7 +1332,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline vectornd<T,D> make_vector(const pointnd<T,D>& point)
+   WYKOBI_INLINE vectornd<T,D> make_vector(const pointnd<T,D>& point)
    {
       vectornd<T,D> vec;
 
@@ -1342,7 +1342,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline ray<T,D> make_ray(const pointnd<T,D>& origin, const vectornd<T,D>& direction)
+   WYKOBI_INLINE ray<T,D> make_ray(const pointnd<T,D>& origin, const vectornd<T,D>& direction)
    {
       ray<T,D> _ray;
 
@@ -1353,7 +1353,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline segment<T,D> make_segment(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE segment<T,D> make_segment(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       segment<T,D> _segment;
 
@@ -1364,7 +1364,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline line<T,D> make_line(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE line<T,D> make_line(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       line<T,D> _line;
 
@@ -1375,7 +1375,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline box<T,D> make_box(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE box<T,D> make_box(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       box<T,D> _box;
 
@@ -1386,7 +1386,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline triangle<T,D> make_triangle(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
+   WYKOBI_INLINE triangle<T,D> make_triangle(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3)
    {
       triangle<T,D> _triangle;
 
@@ -1398,7 +1398,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline quadix<T,D> make_quadix(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3, const pointnd<T,D>& point4)
+   WYKOBI_INLINE quadix<T,D> make_quadix(const pointnd<T,D>& point1, const pointnd<T,D>& point2, const pointnd<T,D>& point3, const pointnd<T,D>& point4)
    {
       quadix<T,D> _quadix;
 
@@ -1411,7 +1411,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline hypersphere<T,D> make_sphere(const pointnd<T,D>& point, const T& radius)
+   WYKOBI_INLINE hypersphere<T,D> make_sphere(const pointnd<T,D>& point, const T& radius)
    {
       hypersphere<T,D> sphere;
 
@@ -1422,7 +1422,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline hypersphere<T,D> make_sphere(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
+   WYKOBI_INLINE hypersphere<T,D> make_sphere(const pointnd<T,D>& point1, const pointnd<T,D>& point2)
    {
       hypersphere<T,D> sphere;
 
@@ -1433,7 +1433,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline polygon<T,D> make_polygon(const std::vector< pointnd<T,D> >& point_list)
+   WYKOBI_INLINE polygon<T,D> make_polygon(const std::vector< pointnd<T,D> >& point_list)
    {
       polygon<T,D> _polygon;
 
@@ -1448,7 +1448,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline polygon<T,D> make_polygon(const triangle<T,D>& triangle)
+   WYKOBI_INLINE polygon<T,D> make_polygon(const triangle<T,D>& triangle)
    {
       polygon<T,D> polygon;
 
@@ -1463,7 +1463,7 @@ namespace wykobi
    }
 
    template <typename T, std::size_t D>
-   inline polygon<T,D> make_polygon(const quadix<T,D>& quadix)
+   WYKOBI_INLINE polygon<T,D> make_polygon(const quadix<T,D>& quadix)
    {
       polygon<T,D> polygon;
 
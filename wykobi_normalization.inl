@@ -22,16 +22,250 @@
 #include "wykobi_algorithm.hpp"
 #include "wykobi_matrix.hpp"
 
+#include "wykobi_execution.hpp"
+
+#include <iterator>
+#include <vector>
+
 
 namespace wykobi
 {
    namespace algorithm
    {
+      namespace detail
+      {
+         /* Coordinate sums of each block, or with a mean given, sums of the distances to it. */
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         class coordinate_sum_block
+         {
+         public:
+
+            coordinate_sum_block(const RandomAccessIterator& begin, std::vector<T>& sum, const T* mean = 0)
+            : begin_(begin),
+              sum_(sum),
+              mean_(mean)
+            {}
+
+            inline void operator()(const std::size_t& block, const std::size_t& first, const std::size_t& last)
+            {
+               if (0 == mean_)
+               {
+                  T* sum = &sum_[block * Dimension];
+
+                  for (std::size_t i = first; i < last; ++i)
+                  {
+                     for (std::size_t k = 0; k < Dimension; ++k)
+                     {
+                        sum[k] += begin_[i][k];
+                     }
+                  }
+               }
+               else
+               {
+                  T sum = T(0.0);
+
+                  for (std::size_t i = first; i < last; ++i)
+                  {
+                     T distance = T(0.0);
+
+                     for (std::size_t k = 0; k < Dimension; ++k)
+                     {
+                        distance += sqr(begin_[i][k] - mean_[k]);
+                     }
+
+                     sum += sqrt(distance);
+                  }
+
+                  sum_[block] = sum;
+               }
+            }
+
+         private:
+
+            coordinate_sum_block& operator=(const coordinate_sum_block&);
+
+            RandomAccessIterator begin_;
+            std::vector<T>&      sum_;
+            const T*             mean_;
+         };
+
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         class comoment_block
+         {
+         public:
+
+            comoment_block(const RandomAccessIterator& begin, std::vector<T>& sum, const T* mean)
+            : begin_(begin),
+              sum_(sum),
+              mean_(mean)
+            {}
+
+            inline void operator()(const std::size_t& block, const std::size_t& first, const std::size_t& last)
+            {
+               T* sum = &sum_[block * Dimension * Dimension];
+
+               for (std::size_t i = first; i < last; ++i)
+               {
+                  T delta[Dimension];
+
+                  for (std::size_t k = 0; k < Dimension; ++k)
+                  {
+                     delta[k] = begin_[i][k] - mean_[k];
+                  }
+
+                  for (std::size_t j = 0; j < Dimension; ++j)
+                  {
+                     for (std::size_t k = 0; k < Dimension; ++k)
+                     {
+                        sum[(j * Dimension) + k] += delta[j] * delta[k];
+                     }
+                  }
+               }
+            }
+
+         private:
+
+            comoment_block& operator=(const comoment_block&);
+
+            RandomAccessIterator begin_;
+            std::vector<T>&      sum_;
+            const T*             mean_;
+         };
+
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         class scale_block
+         {
+         public:
+
+            scale_block(const RandomAccessIterator& begin, const T& scale, const T* translation)
+            : begin_(begin),
+              scale_(scale),
+              translation_(translation)
+            {}
+
+            inline void operator()(const std::size_t&, const std::size_t& first, const std::size_t& last)
+            {
+               for (std::size_t i = first; i < last; ++i)
+               {
+                  for (std::size_t k = 0; k < Dimension; ++k)
+                  {
+                     begin_[i][k] = begin_[i][k] * scale_ + translation_[k];
+                  }
+               }
+            }
+
+         private:
+
+            RandomAccessIterator begin_;
+            T                    scale_;
+            const T*             translation_;
+         };
+
+         /* Points per block of the policy driven routines below, fixed so results do not depend on the thread count. */
+         inline std::size_t moment_block_size()
+         {
+            return 1 << 14;
+         }
+
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         inline void parallel_mean(const execution::policy& policy, RandomAccessIterator begin, const std::size_t& count, T* mean)
+         {
+            std::vector<T> sum(Dimension * execution::block_count(count,moment_block_size()),T(0.0));
+
+            coordinate_sum_block<T,Dimension,RandomAccessIterator> block(begin,sum);
+            execution::for_each_block(policy,count,moment_block_size(),block);
+
+            for (std::size_t k = 0; k < Dimension; ++k)
+            {
+               mean[k] = T(0.0);
+            }
+
+            for (std::size_t i = 0; i < sum.size(); ++i)
+            {
+               mean[i % Dimension] += sum[i];
+            }
+
+            for (std::size_t k = 0; k < Dimension; ++k)
+            {
+               mean[k] /= T(1.0 * count);
+            }
+         }
+
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         inline void parallel_isotropic_normalization(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            const std::size_t count = static_cast<std::size_t>(std::distance(begin,end));
+
+            T mean[Dimension];
+
+            parallel_mean<T,Dimension>(policy,begin,count,mean);
+
+            std::vector<T> sum(execution::block_count(count,moment_block_size()),T(0.0));
+
+            coordinate_sum_block<T,Dimension,RandomAccessIterator> distance_block(begin,sum,mean);
+            execution::for_each_block(policy,count,moment_block_size(),distance_block);
+
+            T total_distance = T(0.0);
+
+            for (std::size_t i = 0; i < sum.size(); ++i)
+            {
+               total_distance += sum[i];
+            }
+
+            const T scale = T(1.0 * count) * sqrt(T(2.0)) / total_distance;
+
+            T translation[Dimension];
+
+            for (std::size_t k = 0; k < Dimension; ++k)
+            {
+               translation[k] = -mean[k] * scale;
+            }
+
+            scale_block<T,Dimension,RandomAccessIterator> block(begin,scale,translation);
+            execution::for_each_block(policy,count,moment_block_size(),block);
+         }
+
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         inline matrix<T,Dimension,Dimension> parallel_covariance_matrix(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            const std::size_t count = static_cast<std::size_t>(std::distance(begin,end));
+
+            T mean[Dimension];
+
+            parallel_mean<T,Dimension>(policy,begin,count,mean);
+
+            std::vector<T> sum(Dimension * Dimension * execution::block_count(count,moment_block_size()),T(0.0));
+
+            comoment_block<T,Dimension,RandomAccessIterator> block(begin,sum,mean);
+            execution::for_each_block(policy,count,moment_block_size(),block);
+
+            matrix<T,Dimension,Dimension> matrix_;
+
+            for (std::size_t i = 0; i < sum.size(); ++i)
+            {
+               const std::size_t j = i % (Dimension * Dimension);
+               matrix_(j / Dimension,j % Dimension) += sum[i];
+            }
+
+            matrix_ /= T(1.0 * count);
+
+            return matrix_;
+         }
+
+      } // namespace wykobi::algorithm::detail
+
       template <typename T>
       struct isotropic_normalization < point2d<T> >
       {
       public:
 
+         /* Same normalisation over a random access range, run under the execution policy. */
+         template <typename RandomAccessIterator>
+         isotropic_normalization(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            detail::parallel_isotropic_normalization<T,2>(policy,begin,end);
+         }
+
          template <typename InputIterator>
          isotropic_normalization(InputIterator begin, InputIterator end)
          {
@@ -72,6 +306,13 @@ namespace wykobi
       {
       public:
 
+         /* Same normalisation over a random access range, run under the execution policy. */
+         template <typename RandomAccessIterator>
+         isotropic_normalization(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            detail::parallel_isotropic_normalization<T,3>(policy,begin,end);
+         }
+
          template <typename InputIterator>
          isotropic_normalization(InputIterator begin, InputIterator end)
          {
@@ -117,6 +358,12 @@ namespace wykobi
       {
       public:
 
+         template <typename RandomAccessIterator>
+         matrix<T,2,2> operator()(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            return detail::parallel_covariance_matrix<T,2>(policy,begin,end);
+         }
+
          template <typename InputIterator>
          matrix<T,2,2> operator()(InputIterator begin, InputIterator end)
          {
@@ -152,6 +399,13 @@ namespace wykobi
       struct covariance_matrix< point3d<T> >
       {
       public:
+
+         template <typename RandomAccessIterator>
+         matrix<T,3,3> operator()(const execution::policy& policy, RandomAccessIterator begin, RandomAccessIterator end)
+         {
+            return detail::parallel_covariance_matrix<T,3>(policy,begin,end);
+         }
+
          template <typename InputIterator>
          matrix<T,3,3> operator()(InputIterator begin, InputIterator end)
          {
@@ -188,6 +442,225 @@ namespace wykobi
          }
       };
 
+      /*
+         Single pass mean and covariance of a point stream (Welford), with
+         merging of partial results (Chan et al.) so independent streams
+         or chunks can be accumulated separately and combined. covariance
+         is the population covariance, as covariance_matrix.
+      */
+      template <typename T, std::size_t Dimension>
+      class point_moments
+      {
+      public:
+
+         typedef typename define_point_type<T,Dimension>::PointType PointType;
+
+         point_moments()
+         : count_(0)
+         {
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               mean_[i] = T(0.0);
+            }
+
+            for (std::size_t i = 0; i < (Dimension * Dimension); ++i)
+            {
+               m2_[i] = T(0.0);
+            }
+         }
+
+         inline void add(const PointType& point)
+         {
+            T delta[Dimension];
+
+            ++count_;
+
+            const T n = T(1.0 * count_);
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               delta[i]  = point[i] - mean_[i];
+               mean_[i] += delta[i] / n;
+            }
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               const T residual = point[i] - mean_[i];
+
+               for (std::size_t j = 0; j < Dimension; ++j)
+               {
+                  m2_[(i * Dimension) + j] += delta[j] * residual;
+               }
+            }
+         }
+
+         template <typename InputIterator>
+         inline void add(InputIterator begin, InputIterator end)
+         {
+            for (InputIterator it = begin; it != end; ++it)
+            {
+               add(*it);
+            }
+         }
+
+         inline void merge(const point_moments& moments)
+         {
+            if (0 == moments.count_)
+               return;
+
+            if (0 == count_)
+            {
+               *this = moments;
+               return;
+            }
+
+            const T na = T(1.0 * count_);
+            const T nb = T(1.0 * moments.count_);
+            const T n  = na + nb;
+
+            T delta[Dimension];
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               delta[i]  = moments.mean_[i] - mean_[i];
+               mean_[i] += delta[i] * (nb / n);
+            }
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               for (std::size_t j = 0; j < Dimension; ++j)
+               {
+                  m2_[(i * Dimension) + j] += moments.m2_[(i * Dimension) + j] + (delta[i] * delta[j]) * ((na * nb) / n);
+               }
+            }
+
+            count_ += moments.count_;
+         }
+
+         inline std::size_t count() const
+         {
+            return count_;
+         }
+
+         inline PointType mean() const
+         {
+            PointType point_;
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               point_[i] = mean_[i];
+            }
+
+            return point_;
+         }
+
+         inline matrix<T,Dimension,Dimension> covariance() const
+         {
+            matrix<T,Dimension,Dimension> matrix_;
+
+            if (0 == count_)
+               return matrix_;
+
+            const T n = T(1.0 * count_);
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               for (std::size_t j = 0; j < Dimension; ++j)
+               {
+                  matrix_(i,j) = m2_[(i * Dimension) + j] / n;
+               }
+            }
+
+            return matrix_;
+         }
+
+         /*
+            Scale that brings the root mean square distance from the mean
+            to sqrt(2). This is the single pass counterpart of the mean
+            distance used by isotropic_normalization, which needs a
+            second pass over the points.
+         */
+         inline T isotropic_scale() const
+         {
+            T trace = T(0.0);
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               trace += m2_[(i * Dimension) + i];
+            }
+
+            return (trace > T(0.0)) ? sqrt(T(2.0) * T(1.0 * count_) / trace) : T(1.0);
+         }
+
+         inline PointType normalize(const PointType& point) const
+         {
+            const T scale = isotropic_scale();
+            PointType point_;
+
+            for (std::size_t i = 0; i < Dimension; ++i)
+            {
+               point_[i] = (point[i] - mean_[i]) * scale;
+            }
+
+            return point_;
+         }
+
+      private:
+
+         std::size_t count_;
+         T           mean_[Dimension];
+         T           m2_[Dimension * Dimension];
+      };
+
+      namespace detail
+      {
+         template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+         class moments_block
+         {
+         public:
+
+            moments_block(const RandomAccessIterator& begin, std::vector< point_moments<T,Dimension> >& moments)
+            : begin_(begin),
+              moments_(moments)
+            {}
+
+            inline void operator()(const std::size_t& block, const std::size_t& first, const std::size_t& last)
+            {
+               moments_[block].add(begin_ + first,begin_ + last);
+            }
+
+         private:
+
+            moments_block& operator=(const moments_block&);
+
+            RandomAccessIterator                        begin_;
+            std::vector< point_moments<T,Dimension> >& moments_;
+         };
+      } // namespace wykobi::algorithm::detail
+
+      /*
+         Accumulates a random access range into moments, in fixed size
+         blocks run under the execution policy and merged in range order.
+      */
+      template <typename T, std::size_t Dimension, typename RandomAccessIterator>
+      inline void accumulate_moments(const execution::policy& policy,
+                                     RandomAccessIterator begin, RandomAccessIterator end,
+                                     point_moments<T,Dimension>& moments)
+      {
+         const std::size_t block_size = 1 << 16;
+         const std::size_t size       = static_cast<std::size_t>(std::distance(begin,end));
+
+         std::vector< point_moments<T,Dimension> > block(execution::block_count(size,block_size));
+
+         detail::moments_block<T,Dimension,RandomAccessIterator> task(begin,block);
+         execution::for_each_block(policy,size,block_size,task);
+
+         for (std::size_t i = 0; i < block.size(); ++i)
+         {
+            moments.merge(block[i]);
+         }
+      }
+
    } // namespace wykobi::algorithm
 
 } // namespace wykobi
@@ -0,0 +1,176 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi.hpp"
+#include "wykobi_algorithm.hpp"
+#include "wykobi_matrix.hpp"
+
+
+namespace wykobi
+{
+   namespace algorithm
+   {
+      template <typename T>
+      struct fit_oriented_bounding_box< point3d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         fit_oriented_bounding_box(InputIterator begin, InputIterator end,
+                                   const vector3d<T>& axis1,
+                                   const vector3d<T>& axis2,
+                                   const vector3d<T>& axis3,
+                                   obb<T,3>& box)
+         {
+            const vector3d<T> axis[3] = { axis1, axis2, axis3 };
+
+            if (begin == end)
+            {
+               box = make_obb(degenerate_point3d<T>(),axis1,axis2,axis3,T(0.0),T(0.0),T(0.0));
+               return;
+            }
+
+            T min_value[3] = { +infinity<T>(), +infinity<T>(), +infinity<T>() };
+            T max_value[3] = { -infinity<T>(), -infinity<T>(), -infinity<T>() };
+
+            for (InputIterator it = begin; it != end; ++it)
+            {
+               for (std::size_t i = 0; i < 3; ++i)
+               {
+                  T projection = ((*it).x * axis[i].x) + ((*it).y * axis[i].y) + ((*it).z * axis[i].z);
+
+                  if (projection < min_value[i]) min_value[i] = projection;
+                  if (projection > max_value[i]) max_value[i] = projection;
+               }
+            }
+
+            point3d<T> center = make_point(T(0.0),T(0.0),T(0.0));
+
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+               center = center + (axis[i] * (T(0.5) * (min_value[i] + max_value[i])));
+            }
+
+            box = make_obb(center,
+                           axis1,axis2,axis3,
+                           T(0.5) * (max_value[0] - min_value[0]),
+                           T(0.5) * (max_value[1] - min_value[1]),
+                           T(0.5) * (max_value[2] - min_value[2]));
+         }
+      };
+
+      template <typename T>
+      struct pca_oriented_bounding_box< point3d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         pca_oriented_bounding_box(InputIterator begin, InputIterator end, obb<T,3>& box)
+         {
+            vector3d<T> axis1 = make_vector(T(1.0),T(0.0),T(0.0));
+            vector3d<T> axis2 = make_vector(T(0.0),T(1.0),T(0.0));
+            vector3d<T> axis3 = make_vector(T(0.0),T(0.0),T(1.0));
+
+            if (begin != end)
+            {
+               eigenvector(covariance_matrix< point3d<T> >()(begin,end),axis1,axis2,axis3);
+               axis3 = axis1 * axis2;
+            }
+
+            fit_oriented_bounding_box< point3d<T> >(begin,end,axis1,axis2,axis3,box);
+         }
+      };
+
+      template <typename T>
+      struct minimum_volume_oriented_bounding_box< point3d<T> >
+      {
+      public:
+
+         /*
+            Starts from the PCA fit, then repeatedly holds one axis of the
+            current box fixed and replaces the other two with the minimum
+            area rectangle of the points projected onto the orthogonal
+            plane, keeping the candidate with the smallest volume.
+         */
+         template <typename InputIterator>
+         minimum_volume_oriented_bounding_box(InputIterator begin, InputIterator end,
+                                              obb<T,3>& box,
+                                              const std::size_t max_iterations = 4)
+         {
+            std::vector< point3d<T> > point_list(begin,end);
+
+            pca_oriented_bounding_box< point3d<T> >(point_list.begin(),point_list.end(),box);
+
+            if (point_list.empty())
+               return;
+
+            T best_volume = volume(box);
+
+            std::vector< point2d<T> > projection;
+            projection.reserve(point_list.size());
+
+            for (std::size_t iteration = 0; iteration < max_iterations; ++iteration)
+            {
+               bool improved = false;
+
+               for (std::size_t i = 0; i < obb<T,3>::AxisCount; ++i)
+               {
+                  const vector3d<T> u = box.axis[(i + 1) % 3];
+                  const vector3d<T> v = box.axis[(i + 2) % 3];
+
+                  projection.clear();
+
+                  for (std::size_t j = 0; j < point_list.size(); ++j)
+                  {
+                     const point3d<T>& point = point_list[j];
+                     projection.push_back(make_point((point.x * u.x) + (point.y * u.y) + (point.z * u.z),
+                                                     (point.x * v.x) + (point.y * v.y) + (point.z * v.z)));
+                  }
+
+                  obb<T,2> rectangle;
+
+                  minimum_area_enclosing_rectangle_with_ch_filter< point2d<T> >(projection.begin(),projection.end(),rectangle);
+
+                  vector3d<T> axis1 = normalize((u * rectangle.axis[0].x) + (v * rectangle.axis[0].y));
+                  vector3d<T> axis2 = normalize((u * rectangle.axis[1].x) + (v * rectangle.axis[1].y));
+
+                  obb<T,3> candidate;
+
+                  fit_oriented_bounding_box< point3d<T> >(point_list.begin(),point_list.end(),axis1,axis2,axis1 * axis2,candidate);
+
+                  T candidate_volume = volume(candidate);
+
+                  if (candidate_volume < best_volume * (T(1.0) - T(Epsilon_Low)))
+                  {
+                     box         = candidate;
+                     best_volume = candidate_volume;
+                     improved    = true;
+                  }
+               }
+
+               if (!improved)
+                  break;
+            }
+         }
+      };
+
+   } // namespace wykobi::algorithm
+
+} // namespace wykobi
@@ -0,0 +1,970 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_PREDICATES
+#define INCLUDE_WYKOBI_PREDICATES
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Orientation, collinearity, containment (point in/on), parallel/perpendicular
+      and degeneracy predicates.
+   */
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3,
+                                            const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE int robust_orientation(const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE int robust_orientation(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3,
+                                 const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point2d<T>& point1, const point2d<T>& point2, const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const line<T,2>& line, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const segment<T,2>& segment, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4);
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const triangle<T,3>& triangle, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE bool differing_orientation(const T& x1,  const T& y1,
+                                     const T& x2,  const T& y2,
+                                     const T& p1x, const T& p1y,
+                                     const T& p2x, const T& p2y);
+
+   template <typename T>
+   WYKOBI_INLINE bool differing_orientation(const point2d<T>& p1, const point2d<T>& p2,
+                                     const point2d<T>& q1, const point2d<T>& q2);
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const point2d<T>& point1,
+                        const point2d<T>& point2,
+                        const point2d<T>& point3,
+                        const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                        const T& x4, const T& y4, const T& z4,
+                        const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const point3d<T>& point1,
+                        const point3d<T>& point2,
+                        const point3d<T>& point3,
+                        const point3d<T>& point4,
+                        const point2d<T>& point5);
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const quadix<T,3>& quadix, const point3d<T>& point);
+   template <typename T> WYKOBI_INLINE int in_sphere(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4, const point3d<T>& point5);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const point2d<T>& point1, const point2d<T>& point2, const T& px, const T& py);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const segment<T,2>& segment, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const T& x1, const T& y1, const T& z1,
+                          const T& x2, const T& y2, const T& z2,
+                          const T& x3, const T& y3, const T& z3,
+                          const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const T& px, const T& py, const T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const triangle<T,3>& triangle, const point3d<T>& point);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3,
+                         const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3,
+                         const T& epsilon = T(Epsilon));
+
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const line<T,2>& line, const point2d<T>& point, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const line<T,3>& line, const point3d<T>& point, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const T& x1, const T& y1, const T& z1,
+                                const T& x2, const T& y2, const T& z2,
+                                const T& x3, const T& y3, const T& z3, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& px, const T& py,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const T& px, const T& py,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const segment<T,2>& segment,
+                                  const point2d<T>&   point,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& px, const T& py, const T& pz,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3,
+                                  const bool robust = false);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const segment<T,3>& segment,
+                                  const point3d<T>& point,
+                                  const bool robust = false);
+
+   template <typename T> WYKOBI_INLINE bool robust_coplanar(const point3d<T> point1,
+                                                     const point3d<T> point2,
+                                                     const point3d<T> point3,
+                                                     const point3d<T> point4,
+                                                     const T& epsilon = T(Epsilon));
+
+   template <typename T> WYKOBI_INLINE bool coplanar(const ray<T,3>& ray1, const ray<T,3>& ray2);
+
+   template <typename T> WYKOBI_INLINE bool coplanar(const segment<T,3>& segment1, const segment<T,3>& segment2);
+
+   template <typename T> WYKOBI_INLINE bool coplanar(const line<T,3>& line1, const line<T,3>& line2);
+
+   template <typename T> WYKOBI_INLINE bool coplanar(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2);
+
+   template <typename T> WYKOBI_INLINE bool coplanar(const quadix<T,3>& quadix1, const quadix<T,3>& quadix2);
+
+   template <typename T>
+   WYKOBI_INLINE T normalize_angle(const T& angle);
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const T& angle);
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const T& x, const T& y);
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const point2d<T>& point1,
+                         const point2d<T>& point2,
+                         const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3);
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const point3d<T>& point1,
+                         const point3d<T>& point2,
+                         const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE T oriented_vertex_angle(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const int orient = Clockwise);
+
+   template <typename T>
+   WYKOBI_INLINE T oriented_vertex_angle(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const int orient = Clockwise);
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const T& x, const T& y);
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const T& x, const T& y);
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const T& x, const T& y, const T& ox, const T& oy);
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const point2d<T>& point, const point2d<T>& origin);
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const T& x, const T& y, const T& ox, const T& oy);
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const point2d<T>& point, const point2d<T>& origin);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& x4, const T& y4,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const point2d<T>& point1,
+                        const point2d<T>& point2,
+                        const point2d<T>& point3,
+                        const point2d<T>& point4,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const segment<T,2>& segment1,
+                        const segment<T,2>& segment2,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const line<T,2>& line1,
+                        const line<T,2>& line2,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                        const T& x4, const T& y4, const T& z4,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const point3d<T>& point1,
+                        const point3d<T>& point2,
+                        const point3d<T>& point3,
+                        const point3d<T>& point4,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const segment<T,3>& segment1,
+                        const segment<T,3>& segment2,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const line<T,3>& line1,
+                        const line<T,3>& line2,
+                        const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const segment<T,2>& segment1,
+                               const segment<T,2>& segment2,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,2>& line1,
+                               const line<T,2>& line2,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,2>& line,
+                               const segment<T,2>& segment,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const T& x1, const T& y1, const T& z1,
+                               const T& x2, const T& y2, const T& z2,
+                               const T& x3, const T& y3, const T& z3,
+                               const T& x4, const T& y4, const T& z4,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const point3d<T>& point1,
+                               const point3d<T>& point2,
+                               const point3d<T>& point3,
+                               const point3d<T>& point4,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const segment<T,3>& segment1,
+                               const segment<T,3>& segment2,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,3>& line1,
+                               const line<T,3>& line2,
+                               const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,3>& line,
+                               const segment<T,3>& segment,
+                               const T& epsilon = T(Epsilon));
+
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const T& x1, const T& y1,
+                             const T& x2, const T& y2,
+                             const T& x3, const T& y3,
+                             const T& x4, const T& y4,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const point2d<T>& point1,
+                             const point2d<T>& point2,
+                             const point2d<T>& point3,
+                             const point2d<T>& point4,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const segment<T,2>& segment1,
+                             const segment<T,2>& segment2,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,2>& line1,
+                             const line<T,2>& line2,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,2>& line,
+                             const segment<T,2>& segment,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const T& x1, const T& y1, const T& z1,
+                             const T& x2, const T& y2, const T& z2,
+                             const T& x3, const T& y3, const T& z3,
+                             const T& x4, const T& y4, const T& z4,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const point3d<T>& point1,
+                             const point3d<T>& point2,
+                             const point3d<T>& point3,
+                             const point3d<T>& point4,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const segment<T,3>& segment1,
+                             const segment<T,3>& segment2,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,3>& line1,
+                             const line<T,3>& line2,
+                             const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const T& x1, const T& y1,
+                                    const T& x2, const T& y2,
+                                    const T& x3, const T& y3,
+                                    const T& x4, const T& y4,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const point2d<T>& point1,
+                                    const point2d<T>& point2,
+                                    const point2d<T>& point3,
+                                    const point2d<T>& point4,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const segment<T,2>& segment1,
+                                    const segment<T,2>& segment2,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,2>& line1,
+                                    const line<T,2>& line2,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const T& x1, const T& y1, const T& z1,
+                                    const T& x2, const T& y2, const T& z2,
+                                    const T& x3, const T& y3, const T& z3,
+                                    const T& x4, const T& y4, const T& z4,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const point3d<T>& point1,
+                                    const point3d<T>& point2,
+                                    const point3d<T>& point3,
+                                    const point3d<T>& point4,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const segment<T,3>& segment1,
+                                    const segment<T,3>& segment2,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,3>& line1,
+                                    const line<T,3>& line2,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,2>& line,
+                                    const segment<T,2>& segment,
+                                    const T& epsilon = T(Epsilon));
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_within_rectangle(const T& x1, const T& y1,
+                                          const T& x2, const T& y2,
+                                          const T& x3, const T& y3,
+                                          const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_within_rectangle(const rectangle<T>& rectangle1,
+                                          const rectangle<T>& rectangle2);
+
+   template <typename T>
+   WYKOBI_INLINE bool box_within_box(const T& x1, const T& y1, const T& z1,
+                              const T& x2, const T& y2, const T& z2,
+                              const T& x3, const T& y3, const T& z3,
+                              const T& x4, const T& y4, const T& z4);
+
+   template <typename T>
+   WYKOBI_INLINE bool box_within_box(const box<T,3>& box1, const box<T,3>& box2);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_within_rectangle(const T&  x, const T&  y, const T& radius,
+                                       const T& x1, const T& y1,
+                                       const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_within_rectangle(const circle<T>& circle, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_rectangle(const T& x1, const T& y1,
+                                         const T& x2, const T& y2,
+                                         const T& x3, const T& y3,
+                                         const T& x4, const T& y4,
+                                         const T& x5, const T& y5);
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_rectangle(const triangle<T,2>& triangle, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_rectangle(const T& x1, const T& y1,
+                                        const T& x2, const T& y2,
+                                        const T& x3, const T& y3,
+                                        const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_rectangle(const segment<T,2>& segment, const rectangle<T>& rectangle);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_rectangle(const T& x1, const T& y1,
+                                       const T& x2, const T& y2,
+                                       const T& x3, const T& y3,
+                                       const T& x4, const T& y4,
+                                       const T& x5, const T& y5,
+                                       const T& x6, const T& y6);
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_rectangle(const quadix<T,2>& quadix, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool polygon_within_rectangle(const polygon<T,2>& polygon, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool sphere_within_box(const T&  x, const T&  y, const T&  z, const T& radius,
+                                 const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2);
+
+   template <typename T>
+   WYKOBI_INLINE bool sphere_within_box(const sphere<T>& sphere, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_box(const T& x1, const T& y1, const T& z1,
+                                   const T& x2, const T& y2, const T& z2,
+                                   const T& x3, const T& y3, const T& z3,
+                                   const T& x4, const T& y4, const T& z4,
+                                   const T& x5, const T& y5, const T& z5);
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_box(const triangle<T,3>& triangle, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_box(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4) ;
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_box(const segment<T,3>& segment, const box<T,3>& box);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_box(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3,
+                                 const T& x4, const T& y4, const T& z4,
+                                 const T& x5, const T& y5, const T& z5,
+                                 const T& x6, const T& y6, const T& z6);
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_box(const quadix<T,3>& quadix, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool polygon_within_box(const polygon<T,3>& polygon, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_in_circle(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const T& px, const T& py,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const T& px, const T& py, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const point2d<T>& rect_point1, point2d<T>& rect_point2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const T& px, const T& py, const T& pz,
+                            const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point,
+                            const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const T& px, const T& py, const T& pz, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const box<T,3>& box);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const point3d<T>& box_point1, const point3d<T>& box_point2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const segment<T,3>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const T& px, const T& py,
+                                 const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const point2d<T>& point,
+                                 const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const T& px, const T& py, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const T& px, const T& py,
+                               const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const point2d<T>& point,
+                               const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const T& px, const T& py,
+                               const quadix<T,2>& quadix);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const point2d<T>&  point,
+                               const quadix<T,2>& quadix);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const T& px, const T& py, const T& cx, const T& cy, const T& radius);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const T& px, const T& py, const circle<T>& circle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const T& px, const T& py, const T& pz, const T& cx, const T& cy, const T& cz, const T& radius);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const T& px, const T& py, const T& pz, const sphere<T>& sphere);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const point3d<T>& point, const sphere<T>& sphere);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const T& px, const T& py,
+                                           const T& x1, const T& y1,
+                                           const T& x2, const T& y2,
+                                           const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const point2d<T>& point,
+                                           const point2d<T>& point1,
+                                           const point2d<T>& point2,
+                                           const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const point2d<T>& point, const triangle<T,2> triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_focus_area(const T& px, const T& py,
+                                   const T& x1, const T& y1,
+                                   const T& x2, const T& y2,
+                                   const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_focus_area(const point2d<T>& point,
+                                   const point2d<T>& point1,
+                                   const point2d<T>& point2,
+                                   const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_segment(const point2d<T>& point, const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_segment(const point3d<T>& point, const segment<T,3>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const T& px, const T& py,
+                            const T& ox, const T& oy,
+                            const T& dx, const T& dy);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const T& px, const T& py, const T& pz,
+                            const T& ox, const T& oy, const T& oz,
+                            const T& dx, const T& dy, const T& dz);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const point2d<T>& point, const ray<T,2>& ray);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const point3d<T>& point, const ray<T,3>& ray);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const T& px, const T& py,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const point2d<T>& point,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const T& px, const T& py, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const point2d<T>& point, const rectangle<T>& rectangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const T& px, const T& py,
+                                 const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const point2d<T>& point,
+                                 const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3);
+
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const T& px, const T& py, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const T& px, const T& py,
+                               const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const point2d<T>& point,
+                               const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const T& px, const T& py,
+                               const quadix<T,2>& quadix);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const point2d<T>&  point,
+                               const quadix<T,2>& quadix);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const T& px, const T& py, const T& cx, const T& cy, const T& radius);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const T& px, const T& py, const circle<T>& circle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_convex_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_convex_polygon(const point2d<T>& point, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_on_polygon_edge(const T& px, const T& py, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_on_polygon_edge(const point2d<T>& point, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_polygon(const point2d<T>& point, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool point_in_polygon(const T& px, const T& py, const polygon_view<T,2>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool point_in_polygon(const point2d<T>& point, const polygon_view<T,2>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_polygon_winding_number(const T& px, const T& py, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool point_in_polygon_winding_number(const point2d<T>& point, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool convex_quadix(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE bool convex_quadix(const quadix<T,3>& quadix);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool is_convex_polygon(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool is_convex_polygon(const polygon_view<T,2>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> remove_consecutive_collinear_points(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void remove_consecutive_collinear_points(const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool convex_vertex(const std::size_t& index, const polygon<T,2,Allocator>& polygon, const int& polygon_orientation = LeftHandSide);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool collinear_vertex(const std::size_t& index, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool vertex_is_ear(const std::size_t& index, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE triangle<T,2> vertex_triangle(const std::size_t& index, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE int polygon_orientation(const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool is_equilateral_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_equilateral_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_isosceles_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_isosceles_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_right_triangle(const wykobi::triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_right_triangle(const wykobi::triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE bool is_degenerate(const circular_arc<T>& arc);
+
+   template <typename T>
+   WYKOBI_INLINE int exact_orientation(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& px, const T& py);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE bool exact_point_in_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE bool exact_point_in_polygon(const T& px, const T& py, const polygon_view<T,2>& polygon);
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+
+   template <> inline int orientation<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                                    const std::int32_t& x2, const std::int32_t& y2,
+                                                    const std::int32_t& px, const std::int32_t& py);
+
+   template <> inline int robust_orientation<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                                           const std::int32_t& x2, const std::int32_t& y2,
+                                                           const std::int32_t& px, const std::int32_t& py);
+
+   template <> inline int orientation<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                                    const std::int64_t& x2, const std::int64_t& y2,
+                                                    const std::int64_t& px, const std::int64_t& py);
+
+   template <> inline int robust_orientation<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                                           const std::int64_t& x2, const std::int64_t& y2,
+                                                           const std::int64_t& px, const std::int64_t& py);
+   #endif
+
+} // wykobi namespace
+
+#include "wykobi_common.hpp"
+#include "wykobi_predicates.inl"
+
+#endif
@@ -0,0 +1,2946 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_predicates.hpp"
+
+
+namespace wykobi
+{
+   namespace detail
+   {
+      /*
+         Polygon predicates written against the point sequence interface
+         (size and operator[]) shared by polygon and polygon_view.
+      */
+      template <typename T, typename Polygon>
+      inline bool point_in_polygon(const T& px, const T& py, const Polygon& polygon)
+      {
+         bool result = false;
+         if (polygon.size() < 3) return false;
+
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            if (
+                 ((polygon[i].y <= py) && (py < polygon[j].y)) || // an upward crossing
+                 ((polygon[j].y <= py) && (py < polygon[i].y))    // a downward crossing
+               )
+            {
+               /* compute the edge-ray intersect @ the x-coordinate */
+               if (px - polygon[i].x < ((polygon[j].x - polygon[i].x) * (py - polygon[i].y) / (polygon[j].y - polygon[i].y)))
+               {
+                  result = !result;
+               }
+            }
+
+            j = i;
+         }
+
+         return result;
+      }
+
+      template <typename Polygon>
+      inline bool is_convex_polygon(const Polygon& polygon)
+      {
+         if (polygon.size() < 3)
+         {
+            return false;
+         }
+
+         std::size_t i = 0;
+         std::size_t j = polygon.size() - 1;
+         std::size_t k = polygon.size() - 2;
+         int initial_orientation = 0;
+
+         while ((initial_orientation = orientation(polygon[k],polygon[j],polygon[i])) == CollinearOrientation)
+         {
+            k = j;
+            j = i++;
+
+            if (i >= polygon.size())
+            {
+               return false;
+            }
+         }
+
+         while (i < polygon.size())
+         {
+            if (orientation(polygon[k],polygon[j],polygon[i]) != initial_orientation)
+            {
+               return false;
+            }
+
+            k = j;
+            j = i++;
+
+            if (i >= polygon.size()) break;
+         }
+
+         return true;
+      }
+
+      template <typename T, typename Polygon>
+      inline bool exact_point_in_polygon(const T& px, const T& py, const Polygon& polygon)
+      {
+         /*
+            Crossing test with the edge-ray intersection comparison
+            multiplied through by the edge's y extent, hence free of
+            division and exact for integer coordinates.
+         */
+         typedef typename wide_type<T>::type W;
+
+         bool result = false;
+         if (polygon.size() < 3) return false;
+
+         std::size_t j = polygon.size() - 1;
+
+         for (std::size_t i = 0; i < polygon.size(); ++i)
+         {
+            const bool upward   = ((polygon[i].y <= py) && (py < polygon[j].y));
+            const bool downward = ((polygon[j].y <= py) && (py < polygon[i].y));
+
+            if (upward || downward)
+            {
+               const W lhs = (W(px) - W(polygon[i].x)) * (W(polygon[j].y) - W(polygon[i].y));
+               const W rhs = (W(polygon[j].x) - W(polygon[i].x)) * (W(py) - W(polygon[i].y));
+
+               if (upward ? (lhs < rhs) : (lhs > rhs))
+               {
+                  result = !result;
+               }
+            }
+
+            j = i;
+         }
+
+         return result;
+      }
+
+      #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+      template <typename Polygon>
+      inline bool point_in_polygon(const std::int32_t& px, const std::int32_t& py, const Polygon& polygon)
+      {
+         return exact_point_in_polygon(px,py,polygon);
+      }
+
+      template <typename Polygon>
+      inline bool point_in_polygon(const std::int64_t& px, const std::int64_t& py, const Polygon& polygon)
+      {
+         return exact_point_in_polygon(px,py,polygon);
+      }
+      #endif
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& px, const T& py)
+   {
+      WYKOBI_INSTRUMENT(orientation);
+
+      const T orin = (x2 - x1) * (py - y1) - (px - x1) * (y2 - y1);
+
+      if (orin > T(0.0))      return LeftHandSide;         /* Orientaion is to the left-hand side  */
+      else if (orin < T(0.0)) return RightHandSide;        /* Orientaion is to the right-hand side */
+      else                    return CollinearOrientation; /* Orientaion is neutral aka collinear  */
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3,
+                                            const T& px, const T& py, const T& pz)
+   {
+      WYKOBI_INSTRUMENT(orientation);
+
+      const T px1 = x1 - px;
+      const T px2 = x2 - px;
+      const T px3 = x3 - px;
+
+      const T py1 = y1 - py;
+      const T py2 = y2 - py;
+      const T py3 = y3 - py;
+
+      const T pz1 = z1 - pz;
+      const T pz2 = z2 - pz;
+      const T pz3 = z3 - pz;
+
+      const T orin = px1 * (py2 * pz3 - pz2 * py3) +
+                     px2 * (py3 * pz1 - pz3 * py1) +
+                     px3 * (py1 * pz2 - pz1 * py2) ;
+
+      if (orin < T(0.0))      return BelowOrientation;    /* Orientaion is below plane                      */
+      else if (orin > T(0.0)) return AboveOrientation;    /* Orientaion is above plane                      */
+      else                    return CoplanarOrientation; /* Orientaion is coplanar to plane if Result is 0 */
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int robust_orientation(const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& px, const T& py)
+   {
+      WYKOBI_INSTRUMENT(robust_orientation);
+
+      const T orin = (x2 - x1) * (py - y1) - (px - x1) * (y2 - y1);
+
+      /*
+         Calculation Policy:
+         if |Orin - Orin`| < Epsilon then Orin` is assumed to be equal to zero.
+         Where:
+           Orin : is the "real" mathematically precise orientation value, using infinite
+                  precision arithmetic (hypothetical)
+           Orin`: is the calculated imprecise orientation value, using finite precision
+                  arithmetic
+      */
+      if (is_equal(orin,T(0.0))) return CollinearOrientation; /* orientaion is neutral aka collinear  */
+      else if (orin < T(0.0))    return RightHandSide;        /* orientaion is to the right-hand side */
+      else                       return LeftHandSide;         /* orientaion is to the left-hand side  */
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int robust_orientation(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3,
+                                 const T& px, const T& py, const T& pz)
+   {
+      WYKOBI_INSTRUMENT(robust_orientation);
+
+      const T px1 = x1 - px;
+      const T px2 = x2 - px;
+      const T px3 = x3 - px;
+
+      const T py1 = y1 - py;
+      const T py2 = y2 - py;
+      const T py3 = y3 - py;
+
+      const T pz1 = z1 - pz;
+      const T pz2 = z2 - pz;
+      const T pz3 = z3 - pz;
+
+      const T orin = px1 * (py2 * pz3 - pz2 * py3) +
+                     px2 * (py3 * pz1 - pz3 * py1) +
+                     px3 * (py1 * pz2 - pz1 * py2) ;
+
+      if (is_equal(orin,T(0.0))) return CoplanarOrientation; /* Orientaion is coplanar to plane if Result is 0 */
+      else if (orin < T(0.0))    return BelowOrientation;    /* Orientaion is below plane                      */
+      else                       return AboveOrientation;    /* Orientaion is above plane                      */
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point2d<T>& point1,
+                                            const point2d<T>& point2,
+                                            const T&           px,
+                                            const T&           py)
+   {
+      return orientation(point1.x,point1.y,point2.x,point2.y,px,py);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point2d<T>& point1,
+                                            const point2d<T>& point2,
+                                            const point2d<T>& point3)
+   {
+      return orientation(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const line<T,2>&  line,
+                                            const point2d<T>& point)
+   {
+      return orientation(line[0],line[1],point);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const segment<T,2>& segment,
+                                            const point2d<T>&   point)
+   {
+      return orientation(segment[0],segment[1],point);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const triangle<T,2>& triangle)
+   {
+      return orientation(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point3d<T>& point1,
+                                            const point3d<T>& point2,
+                                            const point3d<T>& point3,
+                                            const T&           px,
+                                            const T&           py,
+                                            const T&           pz)
+   {
+      return orientation(point1.x, point1.y, point1.z,
+                         point2.x, point2.y, point2.z,
+                         point3.x, point3.y, point3.z,
+                               px,       py,       pz);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const point3d<T>& point1,
+                                            const point3d<T>& point2,
+                                            const point3d<T>& point3,
+                                            const point3d<T>& point4)
+   {
+      return orientation(point1.x, point1.y, point1.z,
+                         point2.x, point2.y, point2.z,
+                         point3.x, point3.y, point3.z,
+                         point4.x, point4.y, point4.z);
+   }
+
+   template <typename T>
+   WYKOBI_COUNTED_CONSTEXPR int orientation(const triangle<T,3>& triangle,
+                                            const point3d<T>&    point)
+   {
+      return orientation(triangle[0],triangle[1],triangle[2],point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool differing_orientation(const T& x1,  const T& y1,
+                                     const T& x2,  const T& y2,
+                                     const T& p1x, const T& p1y,
+                                     const T& p2x, const T& p2y)
+   {
+      /* Collinear orientation is not considered */
+      return ((orientation(x1,y1,x2,y2,p1x,p1y) * orientation(x1,y1,x2,y2,p2x,p2y)) == -1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool differing_orientation(const point2d<T>& p1, const point2d<T>& p2,
+                                     const point2d<T>& q1, const point2d<T>& q2)
+   {
+      return differing_orientation(p1.x,p1.y,p2.x,p2.y,q1.x,q1.y,q2.x,q2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& px, const T& py)
+   {
+      WYKOBI_INSTRUMENT(in_circle);
+
+      const T dx1 = x1 - px;
+      const T dy1 = y1 - py;
+      const T dx2 = x2 - px;
+      const T dy2 = y2 - py;
+      const T dx3 = x3 - px;
+      const T dy3 = y3 - py;
+
+      const T det1  = dx1 * dy2 - dx2 * dy1;
+      const T det2  = dx2 * dy3 - dx3 * dy2;
+      const T det3  = dx3 * dy1 - dx1 * dy3;
+      const T lift1 = dx1 * dx1 + dy1 * dy1;
+      const T lift2 = dx2 * dx2 + dy2 * dy2;
+      const T lift3 = dx3 * dx3 + dy3 * dy3;
+
+      const T result = lift1 * det2 + lift2 * det3 + lift3 * det1;
+
+      if (is_equal(result,T(0.0))) return Cocircular;
+      else if (result > T(0.0))    return PointInside;
+      else                         return PointOutside;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const point2d<T>& point1,
+                        const point2d<T>& point2,
+                        const point2d<T>& point3,
+                        const point2d<T>& point4)
+   {
+      return in_circle(point1.x, point1.y,
+                       point2.x, point2.y,
+                       point3.x, point3.y,
+                       point4.x, point4.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_circle(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      return in_circle(triangle[0],triangle[1],triangle[2],point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                        const T& x4, const T& y4, const T& z4,
+                        const T& px, const T& py, const T& pz)
+   {
+      const T dx1 = x1 - px;
+      const T dx2 = x2 - px;
+      const T dx3 = x3 - px;
+      const T dx4 = x4 - px;
+      const T dy1 = y1 - py;
+      const T dy2 = y2 - py;
+      const T dy3 = y3 - py;
+      const T dy4 = y4 - py;
+      const T dz1 = z1 - pz;
+      const T dz2 = z2 - pz;
+      const T dz3 = z3 - pz;
+      const T dz4 = z4 - pz;
+
+      const T ab = dx1 * dy2 - dx2 * dy1;
+      const T bc = dx2 * dy3 - dx3 * dy2;
+      const T cd = dx3 * dy4 - dx4 * dy3;
+      const T da = dx4 * dy1 - dx1 * dy4;
+      const T ac = dx1 * dy3 - dx3 * dy1;
+      const T bd = dx2 * dy4 - dx4 * dy2;
+
+      const T abc = dz1 * bc - dz2 * ac + dz3 * ab;
+      const T bcd = dz2 * cd - dz3 * bd + dz4 * bc;
+      const T cda = dz3 * da + dz4 * ac + dz1 * cd;
+      const T dab = dz4 * ab + dz1 * bd + dz2 * da;
+
+      const T alift = dx1 * dx1 + dy1 * dy1 + dz1 * dz1;
+      const T blift = dx2 * dx2 + dy2 * dy2 + dz2 * dz2;
+      const T clift = dx3 * dx3 + dy3 * dy3 + dz3 * dz3;
+      const T dlift = dx4 * dx4 + dy4 * dy4 + dz4 * dz4;
+
+      const T result = (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+
+      if (is_equal(result,T(0.0))) return Cospherical;
+      else if (result > T(0.0))    return PointInside;
+      else                         return PointOutside;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const point3d<T>& point1,
+                        const point3d<T>& point2,
+                        const point3d<T>& point3,
+                        const point3d<T>& point4,
+                        const point3d<T>& point5)
+   {
+      return in_sphere(point1.x,point1.y,point1.z,
+                       point2.x,point2.y,point2.z,
+                       point3.x,point3.y,point3.z,
+                       point4.x,point4.y,point4.z,
+                       point5.x,point5.y,point5.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int in_sphere(const quadix<T,3>& quadix, const point3d<T>& point)
+   {
+      return in_sphere(quadix[0],quadix[1],quadix[2],quadix[3],point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& px, const T& py)
+   {
+      return (x2 - x1) * (py - y1) - (px - x1) * (y2 - y1);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const point2d<T>& point1, const point2d<T>& point2, const T& px, const T& py)
+   {
+      return signed_area(point1.x,point1.y,point2.x,point2.y,px,py);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return signed_area(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_area(const segment<T,2>& segment, const point2d<T>& point)
+   {
+      return signed_area(segment[0],segment[1],point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const T& x1, const T& y1, const T& z1,
+                          const T& x2, const T& y2, const T& z2,
+                          const T& x3, const T& y3, const T& z3,
+                          const T& px, const T& py, const T& pz)
+   {
+      const T px1 = x1 - px;
+      const T px2 = x2 - px;
+      const T px3 = x3 - px;
+
+      const T py1 = y1 - py;
+      const T py2 = y2 - py;
+      const T py3 = y3 - py;
+
+      const T pz1 = z1 - pz;
+      const T pz2 = z2 - pz;
+      const T pz3 = z3 - pz;
+
+      return px1 * (py2 * pz3 - pz2 * py3) +
+             px2 * (py3 * pz1 - pz3 * py1) +
+             px3 * (py1 * pz2 - pz1 * py2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const T& px, const T& py, const T& pz)
+   {
+      return signed_volume(point1.x, point1.y, point1.z,
+                           point2.x, point2.y, point2.z,
+                           point3.x, point3.y, point3.z,
+                           px,       py,       pz      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4)
+   {
+      return signed_volume(point1.x, point1.y, point1.z,
+                           point2.x, point2.y, point2.z,
+                           point3.x, point3.y, point3.z,
+                           point4.x, point4.y, point4.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T signed_volume(const triangle<T,3>& triangle, const point3d<T>& point)
+   {
+      return signed_volume(triangle[0],triangle[1],triangle[2],point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3, const T& epsilon)
+   {
+      return is_equal((x2 - x1) * (y3 - y1) ,(x3 - x1) * (y2 - y1),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3,
+                         const T& epsilon)
+   {
+      const T dx1 = x2 - x1;
+      const T dy1 = y2 - y1;
+      const T dz1 = z2 - z1;
+      const T dx2 = x3 - x1;
+      const T dy2 = y3 - y1;
+      const T dz2 = z3 - z1;
+      const T cx = (dy1 * dz2) - (dy2 * dz1);
+      const T cy = (dx2 * dz1) - (dx1 * dz2);
+      const T cz = (dx1 * dy2) - (dx2 * dy1);
+
+      return is_equal(cx * cx + cy * cy + cz * cz,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return collinear(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool collinear(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3)
+   {
+      return collinear(point1.x,point1.y,point1.z,
+                       point2.x,point2.y,point2.z,
+                       point3.x,point3.y,point3.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3, const T& epsilon)
+   {
+      const T leydist1 = lay_distance(x1,y1,x2,y2);
+      const T leydist2 = lay_distance(x2,y2,x3,y3);
+      const T leydist3 = lay_distance(x3,y3,x1,y1);
+
+      if (leydist1 >= leydist2)
+         if (leydist1 >= leydist3)
+            return is_equal(minimum_distance_from_point_to_line(x3,y3,x1,y1,x2,y2),T(0.0),epsilon);
+         else
+            return is_equal(minimum_distance_from_point_to_line(x2,y2,x3,y3,x1,y1),T(0.0),epsilon);
+      else if (leydist2 >= leydist3)
+         return is_equal(minimum_distance_from_point_to_line(x1,y1,x2,y2,x3,y3),T(0.0),epsilon);
+      else
+         return is_equal(minimum_distance_from_point_to_line(x2,y2,x3,y3,x1,y1),T(0.0),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3, const T& epsilon)
+   {
+      return robust_collinear(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const T& x1, const T& y1, const T& z1,
+                                const T& x2, const T& y2, const T& z2,
+                                const T& x3, const T& y3, const T& z3, const T& epsilon)
+   {
+      const T leydist1 = lay_distance(x1,y1,z1,x2,y2,z2);
+      const T leydist2 = lay_distance(x2,y2,z2,x3,y3,z3);
+      const T leydist3 = lay_distance(x3,y3,z3,x1,y1,z1);
+
+      if (leydist1 >= leydist2)
+         if (leydist1 >= leydist3)
+            return is_equal(minimum_distance_from_point_to_line(x3,y3,z3,x1,y1,z1,x2,y2,z2),T(0.0),epsilon);
+         else
+            return is_equal(minimum_distance_from_point_to_line(x2,y2,z2,x3,y3,z3,x1,y1,z1),T(0.0),epsilon);
+      else if (leydist2 >= leydist3)
+         return is_equal(minimum_distance_from_point_to_line(x1,y1,z1,x2,y2,z2,x3,y3,z3),T(0.0),epsilon);
+      else
+         return is_equal(minimum_distance_from_point_to_line(x2,y2,z2,x3,y3,z3,x1,y1,z1),T(0.0),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const T& epsilon)
+   {
+      return robust_collinear(point1.x, point1.y, point1.z,
+                              point2.x, point2.y, point2.z,
+                              point3.x, point3.y, point3.z, epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const line<T,2>& line, const point2d<T>& point, const T& epsilon)
+   {
+      return robust_collinear(line[0],line[1],point,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_collinear(const line<T,3>& line, const point3d<T>& point, const T& epsilon)
+   {
+      return robust_collinear(line[0],line[1],point,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& px, const T& py,
+                                  const bool robust)
+   {
+      /*
+         This method will return true iff the point (px,py) is collinear
+         to points (x1,y1) and (x2,y2) and exists on the line segment A(x1,y1)->B(x2,y2)
+      */
+      if (
+           ((less_than_or_equal(x1,px) && less_than_or_equal(px,x2))  ||
+            (less_than_or_equal(x2,px) && less_than_or_equal(px,x1))) &&
+           ((less_than_or_equal(y1,py) && less_than_or_equal(py,y2))  ||
+            (less_than_or_equal(y2,py) && less_than_or_equal(py,y1)))
+         )
+      {
+         if (robust)
+           return robust_collinear(x1,y1,x2,y2,px,py);
+         else
+           return collinear(x1,y1,x2,y2,px,py);
+      }
+
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const bool robust)
+   {
+      return is_point_collinear(point1.x,point1.y,
+                                point2.x,point2.y,
+                                point3.x,point3.y,
+                                robust);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const T& px, const T& py,
+                                  const bool robust)
+   {
+      return is_point_collinear(point1.x,point1.y,
+                                point2.x,point2.y,
+                                px      ,py      ,
+                                robust);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const segment<T,2>& segment,
+                                  const point2d<T>&   point,
+                                  const bool robust)
+   {
+      return is_point_collinear(segment[0],segment[1],point,robust);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& px, const T& py, const T& pz,
+                                  const bool robust)
+   {
+      /*
+        This method will return true iff the point (px,py,pz) is collinear
+        to points (x1,y1,z1) and (x2,y2,z2) and exists on the line segment A(x1,y1,z1)->B(x2,y2,z2)
+      */
+      if (
+           ((less_than_or_equal(x1,px) && less_than_or_equal(px,x2))  ||
+            (less_than_or_equal(x2,px) && less_than_or_equal(px,x1))) &&
+           ((less_than_or_equal(y1,py) && less_than_or_equal(py,y2))  ||
+            (less_than_or_equal(y2,py) && less_than_or_equal(py,y1))) &&
+           ((less_than_or_equal(z1,pz) && less_than_or_equal(pz,z2))  ||
+            (less_than_or_equal(z2,pz) && less_than_or_equal(pz,z1)))
+         )
+      {
+         if (robust)
+            return robust_collinear(x1,y1,z1,x2,y2,z2,px,py,pz);
+         else
+            return collinear(x1,y1,z1,x2,y2,z2,px,py,pz);
+      }
+
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3,
+                                  const bool robust)
+   {
+      return is_point_collinear(point1.x, point1.y, point1.z,
+                                point2.x, point2.y, point2.z,
+                                point3.x, point3.y, point3.z, robust);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_point_collinear(const segment<T,3>& segment,
+                                  const point3d<T>&   point,
+                                  const bool robust)
+   {
+      return is_point_collinear(segment[0],segment[1],point,robust);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_coplanar(const point3d<T> point1,
+                               const point3d<T> point2,
+                               const point3d<T> point3,
+                               const point3d<T> point4,
+                               const T& epsilon)
+   {
+      return less_than_or_equal(lay_distance(point4,make_plane(point1,point2,point3)),sqr(epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool coplanar(const ray<T,3>& ray1, const ray<T,3>& ray2)
+   {
+      const point3d<T> pnt1 = generate_point_on_ray(ray1,T(1.0));
+      const point3d<T> pnt2 = generate_point_on_ray(ray2,T(1.0));
+
+      if (robust_collinear(ray1.origin,pnt1,pnt2) && robust_collinear(ray2.origin,pnt2,pnt1))
+         return true;
+      else
+         return robust_coplanar(ray1.origin,ray2.origin,pnt1,pnt2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool coplanar(const segment<T,3>& segment1, const segment<T,3>& segment2)
+   {
+      if (
+           robust_collinear(segment1[0],segment1[1],segment2[0]) &&
+           robust_collinear(segment1[0],segment1[1],segment2[1])
+         )
+         return true;
+      else
+         return robust_coplanar(segment1[0],segment1[1],segment2[0],segment2[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool coplanar(const line<T,3>& line1, const line<T,3>& line2)
+   {
+      if (
+           robust_collinear(line1[0],line1[1],line2[0]) &&
+           robust_collinear(line1[0],line1[1],line2[1])
+         )
+         return true;
+      else
+         return robust_coplanar(line1[0],line1[1],line2[0],line2[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool coplanar(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2)
+   {
+      return robust_coplanar(triangle1[0], triangle1[1], triangle1[2], triangle2[0]) &&
+             robust_coplanar(triangle1[0], triangle1[1], triangle1[2], triangle2[1]) &&
+             robust_coplanar(triangle1[0], triangle1[1], triangle1[2], triangle2[2]) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool coplanar(const quadix<T,3>& quadix1, const quadix<T,3>& quadix2)
+   {
+      return robust_coplanar(quadix1[0], quadix1[1], quadix1[2], quadix2[0]) &&
+             robust_coplanar(quadix1[0], quadix1[1], quadix1[2], quadix2[1]) &&
+             robust_coplanar(quadix1[0], quadix1[1], quadix1[2], quadix2[2]) &&
+             robust_coplanar(quadix1[0], quadix1[1], quadix1[2], quadix2[3]) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T normalize_angle(const T& angle)
+   {
+      T n_angle = angle;
+
+      if (n_angle > T(360.0))
+      {
+         n_angle = n_angle - (int(n_angle / T(360.0)) * T(360.0));
+      }
+      else if (n_angle < T(0.0))
+      {
+         while (n_angle < T(0.0))
+         {
+            n_angle = n_angle + T(360.0);
+         }
+      }
+
+      return n_angle;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const T& angle)
+   {
+           if ((angle >=   T(0.0)) && (angle <  T(90.0))) return 1;
+      else if ((angle >=  T(90.0)) && (angle < T(180.0))) return 2;
+      else if ((angle >= T(180.0)) && (angle < T(270.0))) return 3;
+      else if ((angle >= T(270.0)) && (angle < T(360.0))) return 4;
+      else if (angle  == T(360.0))                        return 1;
+      else                                                return 0;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const T& x, const T& y)
+   {
+      if      ((x >  T(0.0)) && (y >= T(0.0))) return 1;
+      else if ((x <= T(0.0)) && (y >  T(0.0))) return 2;
+      else if ((x <  T(0.0)) && (y <= T(0.0))) return 3;
+      else if ((x >= T(0.0)) && (y <  T(0.0))) return 4;
+      else                                     return 0;
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE unsigned int quadrant(const point2d<T>& point)
+   {
+      return quadrant(point.x,point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const T& x1, const T& y1,
+                         const T& x2, const T& y2,
+                         const T& x3, const T& y3)
+   {
+      /*
+         using the cosine identity:
+         cos(a) = (b^2 + c^2 - a^2) / (2*b*c)
+         a      = cos'((b^2 + c^2 - a^2) / (2*b*c))
+
+         where:
+         a,b and c : are edges in the triangle
+         a         : is the angle at the vertex opposite edge 'a'
+         aka the edge defined by the vertex <x1y1-x2y2-x3y3>
+      */
+
+      /* quantify coordinates */
+      const T x1_ = x1 - x2;
+      const T x3_ = x3 - x2;
+      const T y1_ = y1 - y2;
+      const T y3_ = y3 - y2;
+
+      /* calculate lay distance */
+      const T dist = (x1_ * x1_ + y1_ * y1_) * (x3_ * x3_ + y3_ * y3_);
+
+      if (is_equal(dist,T(0.0)))
+         return T(0.0);
+      else
+      {
+         const T input_term = (x1_ * x3_ + y1_ * y3_) / sqrt(dist);
+
+         if (is_equal(input_term,T(1.0)))
+            return T(0.0);
+         else if (is_equal(input_term,T(-1.0)))
+            return T(180.0);
+         else
+            return T(acos(input_term) * _180DivPI);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const point2d<T>& point1,
+                         const point2d<T>& point2,
+                         const point2d<T>& point3)
+   {
+      return vertex_angle
+             (
+               point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const T& x1, const T& y1, const T& z1,
+                         const T& x2, const T& y2, const T& z2,
+                         const T& x3, const T& y3, const T& z3)
+   {
+      /*
+        Method is the same as the one described in
+        the above routine.
+      */
+
+      /* Quantify coordinates */
+      const T x1_ = x1 - x2;
+      const T x3_ = x3 - x2;
+      const T y1_ = y1 - y2;
+      const T y3_ = y3 - y2;
+      const T z1_ = z1 - z2;
+      const T z3_ = z3 - z2;
+
+      /* Calculate Ley Distance */
+      const T dist = (x1_ * x1_ + y1_ * y1_ + z1_ * z1_) * (x3_ * x3_ + y3_ * y3_ + z3_ * z3_);
+
+      if (is_equal(dist,T(0.0)))
+         return T(0.0);
+      else
+         return T(acos((x1_ * x3_ + y1_ * y3_ + z1_ * z3_) / sqrt(dist)) * _180DivPI);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vertex_angle(const point3d<T>& point1,
+                         const point3d<T>& point2,
+                         const point3d<T>& point3)
+   {
+      return vertex_angle
+             (
+               point1.x,point1.y,point1.z,
+               point2.x,point2.y,point2.z,
+               point3.x,point3.y,point3.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T oriented_vertex_angle(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const int orient)
+   {
+      if (orientation(x1,y1,x2,y2,x3,y3) != orient)
+         return T(360.0) - vertex_angle(x1,y1,x2,y2,x3,y3);
+      else
+         return vertex_angle(x1,y1,x2,y2,x3,y3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T oriented_vertex_angle(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3,
+                                  const int orient)
+   {
+      return oriented_vertex_angle
+             (
+               point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y,
+               orient
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const T& x, const T& y)
+   {
+      if      ((x >  T(0.0)) && (y >  T(0.0))) return T(atan( y / x) * _180DivPI);
+      else if ((x <  T(0.0)) && (y >  T(0.0))) return T(atan(-x / y) * _180DivPI) +  T(90.0);
+      else if ((x <  T(0.0)) && (y <  T(0.0))) return T(atan( y / x) * _180DivPI) + T(180.0);
+      else if ((x >  T(0.0)) && (y <  T(0.0))) return T(atan(-x / y) * _180DivPI) + T(270.0);
+      else if ((x == T(0.0)) && (y >  T(0.0))) return T( 90.0);
+      else if ((x <  T(0.0)) && (y == T(0.0))) return T(180.0);
+      else if ((x == T(0.0)) && (y <  T(0.0))) return T(270.0);
+      else                                     return T(  0.0);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const point2d<T>& point)
+   {
+      return cartesian_angle(point.x,point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const T& x, const T& y)
+   {
+      if      (        (x >  T(0.0)) &&         (y >  T(0.0))) return T(atan( y / x) * _180DivPI);
+      else if (        (x <  T(0.0)) &&         (y >  T(0.0))) return T(atan(-x / y) * _180DivPI) +  T(90.0);
+      else if (        (x <  T(0.0)) &&         (y <  T(0.0))) return T(atan( y / x) * _180DivPI) + T(180.0);
+      else if (        (x >  T(0.0)) &&         (y <  T(0.0))) return T(atan(-x / y) * _180DivPI) + T(270.0);
+      else if (is_equal(x,   T(0.0)) &&         (y >  T(0.0))) return T( 90.0);
+      else if (        (x <  T(0.0)) && is_equal(y,   T(0.0))) return T(180.0);
+      else if (is_equal(x,   T(0.0)) &&         (y <  T(0.0))) return T(270.0);
+      else                                                     return T(  0.0);
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const point2d<T>& point)
+   {
+      return robust_cartesian_angle(point.x,point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const T& x, const T& y, const T& ox, const T& oy)
+   {
+      return cartesian_angle(x - ox, y - oy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T cartesian_angle(const point2d<T>& point, const point2d<T>& origin)
+   {
+      return cartesian_angle(point.x - origin.x, point.y - origin.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const T& x, const T& y, const T& ox, const T& oy)
+   {
+      return robust_cartesian_angle(x - ox, y - oy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T robust_cartesian_angle(const point2d<T>& point, const point2d<T>& origin)
+   {
+      return robust_cartesian_angle(point.x - origin.x, point.y - origin.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                        const T& x4, const T& y4,
+                        const T& epsilon)
+   {
+      return is_equal(((y1 - y2) * (x3 - x4)),((y3 - y4) * (x1 - x2)),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const point2d<T>& point1,
+                        const point2d<T>& point2,
+                        const point2d<T>& point3,
+                        const point2d<T>& point4,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const segment<T,2>& segment1,
+                        const segment<T,2>& segment2,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const line<T,2>& line1,
+                        const line<T,2>& line2,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                        const T& x4, const T& y4, const T& z4,
+                        const T& epsilon)
+   {
+      /*
+         Theory:
+         If the gradients in the following planes x-y, y-z, z-x are equal
+         then it can be said that the segments are parallel in 3d.
+         Worst case scenario: 6 multiplications and 9 subtractions
+      */
+
+      const T dx1 = x1 - x2;
+      const T dx2 = x3 - x4;
+
+      const T dy1 = y1 - y2;
+      const T dy2 = y3 - y4;
+
+      const T dz1 = z1 - z2;
+      const T dz2 = z3 - z4;
+
+      if (not_equal((dy1 * dx2),(dy2 * dx1),epsilon)) return false;
+      if (not_equal((dz1 * dy2),(dz2 * dy1),epsilon)) return false;
+      if (not_equal((dx1 * dz2),(dx2 * dz1),epsilon)) return false;
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const point3d<T>& point1,
+                        const point3d<T>& point2,
+                        const point3d<T>& point3,
+                        const point3d<T>& point4,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z,
+               point4.x, point4.y, point4.z, epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const segment<T,3>& segment1,
+                        const segment<T,3>& segment2,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               segment1[0],segment1[1],
+               segment2[0],segment2[1],epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool parallel(const line<T,3>& line1,
+                        const line<T,3>& line2,
+                        const T& epsilon)
+   {
+      return parallel
+             (
+               line1[0],line1[1],
+               line2[0],line2[1],epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4,
+                               const T& epsilon)
+   {
+      T px1 = T(0.0);
+      T py1 = T(0.0);
+      T px2 = T(0.0);
+      T py2 = T(0.0);
+
+      closest_point_on_line_from_point(x1,y1,x2,y2,x3,y3,px1,py1);
+      closest_point_on_line_from_point(x1,y1,x2,y2,x4,y4,px2,py2);
+
+      return is_equal
+             (
+               distance(x3, y3, px1, py1),
+               distance(x4, y4, px2, py2),
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const segment<T,2>& segment1,
+                               const segment<T,2>& segment2,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,2>& line1,
+                               const line<T,2>& line2,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,2>& line,
+                               const segment<T,2>& segment,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               line[0],   line[1],
+               segment[0],segment[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const T& x1, const T& y1, const T& z1,
+                               const T& x2, const T& y2, const T& z2,
+                               const T& x3, const T& y3, const T& z3,
+                               const T& x4, const T& y4, const T& z4,
+                               const T& epsilon)
+   {
+      T px1 = T(0.0);
+      T py1 = T(0.0);
+      T pz1 = T(0.0);
+      T px2 = T(0.0);
+      T py2 = T(0.0);
+      T pz2 = T(0.0);
+
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,x3,y3,z3,px1,py1,pz1);
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,x4,y4,z4,px2,py2,pz2);
+
+      return is_equal
+             (
+               distance(x3, y3, z3, px1, py1, pz1),
+               distance(x4, y4, z4, px2, py2, pz2),
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const point3d<T>& point1,
+                               const point3d<T>& point2,
+                               const point3d<T>& point3,
+                               const point3d<T>& point4,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z,
+               point4.x, point4.y, point4.z,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const segment<T,3>& segment1,
+                               const segment<T,3>& segment2,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,3>& line1,
+                               const line<T,3>& line2,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_parallel(const line<T,3>& line,
+                               const segment<T,3>& segment,
+                               const T& epsilon)
+   {
+      return robust_parallel
+             (
+               line   [0], line   [1],
+               segment[0], segment[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const T& x1, const T& y1,
+                             const T& x2, const T& y2,
+                             const T& x3, const T& y3,
+                             const T& x4, const T& y4,
+                             const T& epsilon)
+   {
+      return is_equal(T(-1.0) * (y2 - y1) * (y4 - y3),(x4 - x3) * (x2 - x1), epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const point2d<T>& point1,
+                             const point2d<T>& point2,
+                             const point2d<T>& point3,
+                             const point2d<T>& point4,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const segment<T,2>& segment1,
+                             const segment<T,2>& segment2,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,2>& line1,
+                             const line<T,2>& line2,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,2>& line,
+                             const segment<T,2>& segment,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               line   [0], line   [1],
+               segment[0], segment[1],
+               epsilon
+              );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const T& x1, const T& y1, const T& z1,
+                             const T& x2, const T& y2, const T& z2,
+                             const T& x3, const T& y3, const T& z3,
+                             const T& x4, const T& y4, const T& z4,
+                             const T& epsilon)
+   {
+      /*
+         The dot product of the vector forms of the segments will
+         be 0 if the segments are perpendicular
+      */
+
+      const T dx1 = x1 - x2;
+      const T dx2 = x3 - x4;
+
+      const T dy1 = y1 - y2;
+      const T dy2 = y3 - y4;
+
+      const T dz1 = z1 - z2;
+      const T dz2 = z3 - z4;
+
+      return is_equal((dx1 * dx2) + (dy1 * dy2) + (dz1 * dz2), T(0.0), epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const point3d<T>& point1,
+                             const point3d<T>& point2,
+                             const point3d<T>& point3,
+                             const point3d<T>& point4,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z,
+               point4.x, point4.y, point4.z,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const segment<T,3>& segment1,
+                             const segment<T,3>& segment2,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool perpendicular(const line<T,3>& line1,
+                             const line<T,3>& line2,
+                             const T& epsilon)
+   {
+      return perpendicular
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const T& x1, const T& y1,
+                                    const T& x2, const T& y2,
+                                    const T& x3, const T& y3,
+                                    const T& x4, const T& y4,
+                                    const T& epsilon)
+   {
+      T p1x = T(0.0);
+      T p1y = T(0.0);
+      T p2x = T(0.0);
+      T p2y = T(0.0);
+
+      closest_point_on_line_from_point(x1, y1, x2, y2, x3, y3, p1x, p1y);
+      closest_point_on_line_from_point(x1, y1, x2, y2, x4, y4, p2x, p2y);
+
+      return is_equal(distance(p1x,p1y,p2x,p2y),T(0.0),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const point2d<T>& point1,
+                                    const point2d<T>& point2,
+                                    const point2d<T>& point3,
+                                    const point2d<T>& point4,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const segment<T,2>& segment1,
+                                    const segment<T,2>& segment2,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,2>& line1,
+                                    const line<T,2>& line2,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,2>& line,
+                                    const segment<T,2>& segment,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               line   [0], line  [1],
+               segment[0],segment[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const T& x1, const T& y1, const T& z1,
+                                    const T& x2, const T& y2, const T& z2,
+                                    const T& x3, const T& y3, const T& z3,
+                                    const T& x4, const T& y4, const T& z4,
+                                    const T& epsilon)
+   {
+      T p1x = T(0.0);
+      T p1y = T(0.0);
+      T p1z = T(0.0);
+      T p2x = T(0.0);
+      T p2y = T(0.0);
+      T p2z = T(0.0);
+
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,x3,y3,z3,p1x,p1y,p1z);
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,x4,y4,z4,p2x,p2y,p2z);
+
+      return is_equal(distance(p1x,p1y,p1z,p2x,p2y,p2z),T(0.0),epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const point3d<T>& point1,
+                                    const point3d<T>& point2,
+                                    const point3d<T>& point3,
+                                    const point3d<T>& point4,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z,
+               point4.x, point4.y, point4.z,
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const segment<T,3>& segment1,
+                                    const segment<T,3>& segment2,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               segment1[0], segment1[1],
+               segment2[0], segment2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool robust_perpendicular(const line<T,3>& line1,
+                                    const line<T,3>& line2,
+                                    const T& epsilon)
+   {
+      return robust_perpendicular
+             (
+               line1[0], line1[1],
+               line2[0], line2[1],
+               epsilon
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_within_rectangle(const T& x1, const T& y1,
+                                          const T& x2, const T& y2,
+                                          const T& x3, const T& y3,
+                                          const T& x4, const T& y4)
+   {
+      return point_in_rectangle(x1, y1, x3, y3, x4, y4) &&
+             point_in_rectangle(x2, y2, x3, y3, x4, y4) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool rectangle_within_rectangle(const rectangle<T>& rectangle1,
+                                          const rectangle<T>& rectangle2)
+   {
+      return rectangle_within_rectangle
+             (
+               rectangle1[0].x, rectangle1[0].y,
+               rectangle1[1].x, rectangle1[1].y,
+               rectangle2[0].x, rectangle2[0].y,
+               rectangle2[1].x, rectangle2[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool box_within_box(const T& x1, const T& y1, const T& z1,
+                              const T& x2, const T& y2, const T& z2,
+                              const T& x3, const T& y3, const T& z3,
+                              const T& x4, const T& y4, const T& z4)
+   {
+      return point_in_box(x1, y1, z1, x3, y3, z3, x4, y4, z4) &&
+             point_in_box(x2, y2, z2, x3, y3, z3, x4, y4, z4) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool box_within_box(const box<T,3>& box1, const box<T,3>& box2)
+   {
+      return box_within_box
+             (
+               box1[0].x, box1[0].y, box1[0].z,
+               box1[1].x, box1[1].y, box1[1].z,
+               box2[0].x, box2[0].y, box2[0].z,
+               box2[1].x, box2[1].y, box2[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_within_rectangle(const T&  x, const T&  y, const T& radius,
+                                       const T& x1, const T& y1,
+                                       const T& x2, const T& y2)
+   {
+      return rectangle_within_rectangle
+             (
+               make_rectangle(x - radius, y - radius, x + radius, y + radius),
+               make_rectangle(x1, y1, x2, y2)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_within_rectangle(const circle<T>& circle, const rectangle<T>& rectangle)
+   {
+      return circle_within_rectangle
+             (
+               circle.x, circle.y, circle.radius,
+               rectangle[0].x, rectangle[0].y,
+               rectangle[1].x, rectangle[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_rectangle(const T& x1, const T& y1,
+                                         const T& x2, const T& y2,
+                                         const T& x3, const T& y3,
+                                         const T& x4, const T& y4,
+                                         const T& x5, const T& y5)
+   {
+      return point_in_rectangle(x1, y1, x4, y4, x5, y5) &&
+             point_in_rectangle(x2, y2, x4, y4, x5, y5) &&
+             point_in_rectangle(x3, y3, x4, y4, x5, y5) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_rectangle(const triangle<T,2>& triangle, const rectangle<T>& rectangle)
+   {
+      return triangle_within_rectangle
+             (
+               triangle [0].x,  triangle[0].y,
+               triangle [1].x,  triangle[1].y,
+               triangle [2].x,  triangle[2].y,
+               rectangle[0].x, rectangle[0].y,
+               rectangle[1].x, rectangle[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_rectangle(const T& x1, const T& y1,
+                                        const T& x2, const T& y2,
+                                        const T& x3, const T& y3,
+                                        const T& x4, const T& y4)
+   {
+      return point_in_rectangle(x1,y1,x3,y3,x4,y4) &&
+             point_in_rectangle(x2,y2,x3,y3,x4,y4) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_rectangle(const segment<T,2>& segment, const rectangle<T>& rectangle)
+   {
+      return segment_within_rectangle(  segment[0].x,   segment[0].y,
+                                        segment[1].x,   segment[1].y,
+                                      rectangle[0].x, rectangle[0].y,
+                                      rectangle[1].x, rectangle[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_rectangle(const T& x1, const T& y1,
+                                       const T& x2, const T& y2,
+                                       const T& x3, const T& y3,
+                                       const T& x4, const T& y4,
+                                       const T& x5, const T& y5,
+                                       const T& x6, const T& y6)
+   {
+      return point_in_rectangle(x1, y1, x5, y5, x6, y6) &&
+             point_in_rectangle(x2, y2, x5, y5, x6, y6) &&
+             point_in_rectangle(x3, y3, x5, y5, x6, y6) &&
+             point_in_rectangle(x4, y4, x5, y5, x6, y6);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_rectangle(const quadix<T,2>& quadix, const rectangle<T>& rectangle)
+   {
+      return quadix_within_rectangle(   quadix[0].x,    quadix[0].y,
+                                        quadix[1].x,    quadix[1].y,
+                                        quadix[2].x,    quadix[2].y,
+                                        quadix[3].x,    quadix[3].y,
+                                     rectangle[0].x, rectangle[0].y,
+                                     rectangle[1].x, rectangle[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool polygon_within_rectangle(const polygon<T,2>& polygon, const rectangle<T>& rectangle)
+   {
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if (!point_in_rectangle(polygon[i],rectangle))
+         {
+            return false;
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool sphere_within_box(const T&  x, const T&  y, const T&  z, const T& radius,
+                                 const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2)
+   {
+      return box_within_box
+             (
+               make_box(x - radius, y - radius, z - radius, x + radius, y + radius, z + radius),
+               make_box(x1, y1, z1, x2, y2, z2)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool sphere_within_box(const sphere<T>& sphere, const box<T,3>& box)
+   {
+      return sphere_within_box
+             (
+               sphere.x, sphere.y, sphere.z, sphere.radius,
+               box[0].x, box[0].y, box[0].z,
+               box[1].x, box[1].y, box[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_box(const T& x1, const T& y1, const T& z1,
+                                   const T& x2, const T& y2, const T& z2,
+                                   const T& x3, const T& y3, const T& z3,
+                                   const T& x4, const T& y4, const T& z4,
+                                   const T& x5, const T& y5, const T& z5)
+   {
+      return point_in_box(x1, y1, z1, x4, y4, z4, x5, y5, z5) &&
+             point_in_box(x2, y2, z2, x4, y4, z4, x5, y5, z5) &&
+             point_in_box(x3, y3, z3, x4, y4, z4, x5, y5, z5) ;
+
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool triangle_within_box(const triangle<T,3>& triangle, const box<T,3>& box)
+   {
+      return triangle_within_box(triangle[0].x, triangle[0].y, triangle[0].z,
+                                 triangle[1].x, triangle[1].y, triangle[1].z,
+                                 triangle[2].x, triangle[2].y, triangle[2].z,
+                                      box[0].x,      box[0].y, box[0].z,
+                                      box[1].x,      box[1].y, box[1].z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_box(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4)
+   {
+      return point_in_box(x1, y1, z1, x3, y3, z3, x4, y4, z4) &&
+             point_in_box(x2, y2, z2, x3, y3, z3, x4, y4, z4);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool segment_within_box(const segment<T,3>& segment, const box<T,3>& box)
+   {
+      return segment_within_box(segment[0].x, segment[0].y, segment[0].z,
+                                segment[1].x, segment[1].y, segment[1].z,
+                                    box[0].x,     box[0].y,     box[0].z,
+                                    box[1].x,     box[1].y,     box[1].z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_box(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3,
+                                 const T& x4, const T& y4, const T& z4,
+                                 const T& x5, const T& y5, const T& z5,
+                                 const T& x6, const T& y6, const T& z6)
+   {
+      return point_in_box(x1, y1, z1, x5, y5, z5, x6, y6, z6) &&
+             point_in_box(x2, y2, z2, x5, y5, z5, x6, y6, z6) &&
+             point_in_box(x3, y3, z3, x5, y5, z5, x6, y6, z6) &&
+             point_in_box(x4, y4, z4, x5, y5, z5, x6, y6, z6) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool quadix_within_box(const quadix<T,3>& quadix, const box<T,3>& box)
+   {
+      return quadix_within_box
+             (
+               quadix[0].x, quadix[0].y, quadix[0].z,
+               quadix[1].x, quadix[1].y, quadix[1].z,
+               quadix[2].x, quadix[2].y, quadix[2].z,
+               quadix[3].x, quadix[3].y, quadix[3].z,
+               box   [0].x, box   [0].y, box   [0].z,
+               box   [1].x, box   [1].y, box   [1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool polygon_within_box(const polygon<T,3>& polygon, const box<T,3>& box)
+   {
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if (!point_in_box(polygon[i],box))
+         {
+            return false;
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool circle_in_circle(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return greater_than_or_equal(circle2.radius - (distance(circle1.x,circle1.y,circle2.x,circle2.y) + circle1.radius),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const T& px, const T& py,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2)
+   {
+      return ((x1 <= px) && (px <= x2) && (y1 <= py) && (py <= y2)) ||
+             ((x2 <= px) && (px <= x1) && (y2 <= py) && (py <= y1)) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2)
+   {
+      return point_in_rectangle(point.x,point.y,x1,y1,x2,y2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const T& px, const T& py, const rectangle<T>& rectangle)
+   {
+      return point_in_rectangle(px,py,rectangle[0].x,rectangle[0].y,rectangle[1].x,rectangle[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const rectangle<T>& rectangle)
+   {
+      return point_in_rectangle(point.x,point.y,rectangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const point2d<T>& rect_point1, point2d<T>& rect_point2)
+   {
+      return point_in_rectangle
+             (
+               point.x, point.y,
+               rect_point1.x, rect_point1.y, rect_point2.x, rect_point2.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_rectangle(const point2d<T>& point, const segment<T,2>& segment)
+   {
+      return point_in_rectangle(point.x,point.y,segment[0].x,segment[0].y,segment[1].x,segment[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const T& px, const T& py, const T& pz,
+                            const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2)
+   {
+      return ((x1 <= px) && (px <= x2) && (y1 <= py) && (py <= y2) && (z1 <= pz) && (pz <= z2)) ||
+             ((x2 <= px) && (px <= x1) && (y2 <= py) && (py <= y1) && (z2 <= pz) && (pz <= z1)) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point,
+                            const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2)
+   {
+      return point_in_box(point.x,point.y,point.z,x1,y1,z1,x2,y2,z2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const T& px, const T& py, const T& pz, const box<T,3>& box)
+   {
+      return point_in_box(px,py,pz,box[0].x,box[0].y,box[0].z,box[1].x,box[1].y,box[1].z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const box<T,3>& box)
+   {
+      return point_in_box(point.x,point.y,point.z,box);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const point3d<T>& box_point1, const point3d<T>& box_point2)
+   {
+      return point_in_box
+             (
+               point.x,      point.y,      point.z,
+               box_point1.x, box_point1.y, box_point1.z,
+               box_point2.x, box_point2.y, box_point2.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_box(const point3d<T>& point, const segment<T,3>& segment)
+   {
+      return point_in_box(point,segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const T& px, const T& py,
+                                 const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3)
+   {
+      const int or1 = orientation(x1, y1, x2, y2, px, py);
+      const int or2 = orientation(x2, y2, x3, y3, px, py);
+
+      if ((or1 * or2) == -1)
+         return false;
+      else
+      {
+         int or3 = orientation(x3, y3, x1, y1, px, py);
+         if ((or1 == or3) || (0 == or3))
+            return true;
+         else if (0 == or1)
+            return ((or2 * or3) >= 0);
+         else if (0 == or2)
+            return ((or1 * or3) >= 0);
+         else
+            return false;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const T& px, const T& py, const triangle<T,2>& triangle)
+   {
+      return point_in_triangle
+             (
+               px,            py,
+               triangle[0].x, triangle[0].y,
+               triangle[1].x, triangle[1].y,
+               triangle[2].x, triangle[2].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const point2d<T>& point,
+                                 const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3)
+   {
+      return point_in_triangle( point.x,  point.y,
+                               point1.x, point1.y,
+                               point2.x, point2.y,
+                               point3.x, point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_triangle(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return point_in_triangle
+             (
+               point.x,       point.y,
+               triangle[0].x, triangle[0].y,
+               triangle[1].x, triangle[1].y,
+               triangle[2].x, triangle[2].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const T& px, const T& py,
+                               const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4)
+   {
+      const int or1 = orientation(x1, y1, x2, y2, px, py);
+      const int or2 = orientation(x2, y2, x3, y3, px, py);
+      const int or3 = orientation(x3, y3, x4, y4, px, py);
+      const int or4 = orientation(x4, y4, x1, y1, px, py);
+
+      if ((or1 == or2) && (or2 == or3) && (or3 == or4))
+         return true;
+      else if (0 == or1)
+         return (0 == (or2 * or4));
+      else if (0 == or2)
+         return (0 == (or1 * or3));
+      else if (0 == or3)
+         return (0 == (or2 * or4));
+      else if (0 == or4)
+         return (0 == (or1 * or3));
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const point2d<T>& point,
+                               const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4)
+   {
+      return point_in_quadix
+             (
+                point.x,  point.y,
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y,
+               point4.x, point4.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const T& px, const T& py,
+                               const quadix<T,2>& quadix)
+   {
+      return point_in_quadix
+             (
+               px,          py,
+               quadix[0].x, quadix[0].y,
+               quadix[1].x, quadix[1].y,
+               quadix[2].x, quadix[2].y,
+               quadix[3].x, quadix[3].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_quadix(const point2d<T>&  point,
+                               const quadix<T,2>& quadix)
+   {
+      return point_in_quadix(point.x, point.y, quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const T& px, const T& py, const T& cx, const T& cy, const T& radius)
+   {
+      return (lay_distance(px, py, cx, cy) <= (radius * radius));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const T& px, const T& py, const circle<T>& circle)
+   {
+      return point_in_circle(px, py, circle.x, circle.y, circle.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_circle(const point2d<T>& point, const circle<T>& circle)
+   {
+      return point_in_circle(point.x, point.y, circle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const T& px, const T& py, const T& pz, const T& cx, const T& cy, const T& cz, const T& radius)
+   {
+      return less_than_or_equal(lay_distance(px, py, pz, cx, cy, cz), radius * radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const T& px, const T& py, const T& pz, const sphere<T>& sphere)
+   {
+      return point_in_sphere(px,py,pz,sphere.x,sphere.y,sphere.z,sphere.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_sphere(const point3d<T>& point, const sphere<T>& sphere)
+   {
+      return point_in_sphere(point.x,point.y,point.z,sphere);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const T& px, const T& py,
+                                           const T& x1, const T& y1,
+                                           const T& x2, const T& y2,
+                                           const T& x3, const T& y3)
+   {
+      const T dx1 = x1 - px;
+      const T dx2 = x2 - px;
+      const T dx3 = x3 - px;
+      const T dy1 = y2 - py;
+      const T dy2 = y3 - py;
+      const T dy3 = y1 - py;
+      const T a11 = dx3 * dy1 - dx2 * dy2;
+      const T a12 = dx3 * dy3 - dx1 * dy2;
+      const T a21 = dx2 * (x2 - x3) + dy1 * (y2 - y3);
+      const T a22 = dx1 * (x1 - x3) + dy3 * (y1 - y3);
+
+      return less_than_or_equal(a11 * a22 - a21 * a12,T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const point2d<T>& point,
+                                           const point2d<T>& point1,
+                                           const point2d<T>& point2,
+                                           const point2d<T>& point3)
+   {
+      return point_in_three_point_circle
+             (
+               point .x, point .y,
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_three_point_circle(const point2d<T>& point, const triangle<T,2> triangle)
+   {
+      return point_in_three_point_circle(point, triangle[0], triangle[1], triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_focus_area(const T& px, const T& py,
+                                   const T& x1, const T& y1,
+                                   const T& x2, const T& y2,
+                                   const T& x3, const T& y3)
+   {
+      return (-1 == (orientation((x2 + x3) * T(0.5),(y2 + y3) * T(0.5),x1,y1,px,py) *
+                     orientation((x1 + x3) * T(0.5),(y1 + y3) * T(0.5),x2,y2,px,py)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_focus_area(const point2d<T>& point,
+                                   const point2d<T>& point1,
+                                   const point2d<T>& point2,
+                                   const point2d<T>& point3)
+   {
+      return point_in_focus_area
+             (
+                point.x, point.y,
+               point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_segment(const point2d<T>& point, const segment<T,2>& segment)
+   {
+      return is_point_collinear(segment,point,true);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_segment(const point3d<T>& point, const segment<T,3>& segment)
+   {
+      return is_point_collinear(segment,point,true);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const T& px, const T& py,
+                            const T& ox, const T& oy,
+                            const T& dx, const T& dy)
+   {
+      return point_on_ray(make_point(px,py),make_ray(ox,oy,dx,dy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const T& px, const T& py, const T& pz,
+                            const T& ox, const T& oy, const T& oz,
+                            const T& dx, const T& dy, const T& dz)
+   {
+      return point_on_ray
+             (
+               make_point(px, py, pz),
+               make_ray(ox, oy, oz, dx, dy, dz)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const point2d<T>& point, const ray<T,2>& ray)
+   {
+      const T t = dot_product(ray.direction,point - ray.origin);
+
+      if (greater_than_or_equal(t,T(0.0)))
+      {
+         return is_equal(point,generate_point_on_ray(ray,t));
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_ray(const point3d<T>& point, const ray<T,3>& ray)
+   {
+      const T t = dot_product(ray.direction,point - ray.origin);
+
+      if (greater_than_or_equal(t,T(0.0)))
+      {
+         return is_equal(point,generate_point_on_ray(ray,t),T(0.0));
+      }
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const T& px, const T& py,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2)
+   {
+      return (((x1 <= px) && (px <= x2)) && ((py == y1) || (py == y2))) ||
+             (((y1 <= py) && (py <= y2)) && ((px == x1) || (px == x2))) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const point2d<T>& point,
+                                  const T& x1, const T& y1,
+                                  const T& x2, const T& y2)
+   {
+      return point_on_rectangle(point.x, point.y, x1, y1, x2, y2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const T& px, const T& py, const rectangle<T>& rectangle)
+   {
+      return point_on_rectangle(px,py,rectangle[0].x,rectangle[0].y,rectangle[1].x,rectangle[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_rectangle(const point2d<T>& point, const rectangle<T>& rectangle)
+   {
+      return point_on_rectangle(point.x,point.y,rectangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const T& px, const T& py,
+                                 const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3)
+   {
+      return is_point_collinear(x1, y1, x2, y2, px, py, true) ||
+             is_point_collinear(x2, y2, x3, y3, px, py, true) ||
+             is_point_collinear(x3, y3, x1, y1, px, py, true) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const T& px, const T& py, const triangle<T,2>& triangle)
+   {
+      return point_on_triangle
+             (
+               px,            py,
+               triangle[0].x, triangle[0].y,
+               triangle[1].x, triangle[1].y,
+               triangle[2].x, triangle[2].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const point2d<T>& point,
+                                 const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3)
+   {
+      return point_on_triangle
+             (
+                point.x,  point.y,
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_triangle(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return point_on_triangle(      point.x,       point.y,
+                               triangle[0].x, triangle[0].y,
+                               triangle[1].x, triangle[1].y,
+                               triangle[2].x, triangle[2].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const T& px, const T& py,
+                               const T& x1, const T& y1,
+                               const T& x2, const T& y2,
+                               const T& x3, const T& y3,
+                               const T& x4, const T& y4)
+   {
+      return is_point_collinear(x1, y1, x2, y2, px, py, true) ||
+             is_point_collinear(x2, y2, x3, y3, px, py, true) ||
+             is_point_collinear(x3, y3, x4, y4, px, py, true) ||
+             is_point_collinear(x4, y4, x1, y1, px, py, true) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const point2d<T>& point,
+                               const point2d<T>& point1,
+                               const point2d<T>& point2,
+                               const point2d<T>& point3,
+                               const point2d<T>& point4)
+   {
+      return point_on_quadix( point.x,  point.y,
+                             point1.x, point1.y,
+                             point2.x, point2.y,
+                             point3.x, point3.y,
+                             point4.x, point4.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const T& px, const T& py,
+                               const quadix<T,2>& quadix)
+   {
+      return point_on_quadix(         px,          py,
+                             quadix[0].x, quadix[0].y,
+                             quadix[1].x, quadix[1].y,
+                             quadix[2].x, quadix[2].y,
+                             quadix[3].x, quadix[3].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_quadix(const point2d<T>&  point,
+                               const quadix<T,2>& quadix)
+   {
+      return point_on_quadix(point.x,point.y,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const T& px, const T& py, const T& cx, const T& cy, const T& radius)
+   {
+      return (lay_distance(px,py,cx,cy) == (radius * radius));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const T& px, const T& py, const circle<T>& circle)
+   {
+      return point_on_circle(px,py,circle.x,circle.y,circle.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_on_circle(const point2d<T>& point, const circle<T>& circle)
+   {
+      return point_on_circle(point.x,point.y,circle);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_convex_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon)
+   {
+      if (polygon.size() < 3) return false;
+
+      int initial_orientation = orientation
+                                (
+                                  polygon[0],
+                                  polygon[static_cast<int>(polygon.size()) - 1],
+                                  px, py
+                                );
+      std::size_t j = 0;
+
+      for (std::size_t i = 1; i < polygon.size(); ++i)
+      {
+         if (initial_orientation != orientation(polygon[i],polygon[j],px,py))
+         {
+            return false;
+         }
+
+         j = i;
+      }
+
+      return true;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_convex_polygon(const point2d<T>& point, const polygon<T,2,Allocator>& polygon)
+   {
+      return point_in_convex_polygon(point.x,point.y,polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_on_polygon_edge(const T& px, const T& py, const polygon<T,2,Allocator>& polygon)
+   {
+      if (polygon.size() < 3) return false;
+
+      std::size_t j = polygon.size() - 1;
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if (is_point_collinear(polygon[i],polygon[j],px,py,true))
+         {
+            return true;
+         }
+
+         j = i;
+      }
+
+      return false;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_on_polygon_edge(const point2d<T>& point, const polygon<T,2,Allocator>& polygon)
+   {
+      return point_on_polygon_edge(point.x,point.y,polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::point_in_polygon(px,py,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_polygon(const T& px, const T& py, const polygon_view<T,2>& polygon)
+   {
+      return detail::point_in_polygon(px,py,polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_polygon(const point2d<T>& point, const polygon<T,2,Allocator>& polygon)
+   {
+      return point_in_polygon(point.x,point.y,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_in_polygon(const point2d<T>& point, const polygon_view<T,2>& polygon)
+   {
+      return point_in_polygon(point.x,point.y,polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_polygon_winding_number(const T& px, const T& py, const polygon<T,2,Allocator>& polygon)
+   {
+      int winding_number = 0;
+      std::size_t j = polygon.size() - 1;
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if (polygon[j].y <= py)
+         {
+            if (
+                 (polygon[i].y > py) &&
+                 (orientation(polygon[j],polygon[i],px,py) == LeftHandSide)
+               )
+            {
+               winding_number++;
+            }
+         }
+         else
+         {
+            if (
+                 (polygon[i].y <= py) &&
+                 (orientation(polygon[j],polygon[i],px,py) == RightHandSide)
+               )
+            {
+               winding_number--;
+            }
+         }
+
+         j = i;
+      }
+
+      return (winding_number != 0);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool point_in_polygon_winding_number(const point2d<T>& point, const polygon<T,2,Allocator>& polygon)
+   {
+      return point_in_polygon_winding_number(point.x,point.y,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool convex_quadix(const quadix<T,2>& quadix)
+   {
+      const int orin = orientation(quadix[0],quadix[2],quadix[1]);
+
+      if (orin != orientation(quadix[1], quadix[3], quadix[2])) return false;
+      if (orin != orientation(quadix[2], quadix[0], quadix[3])) return false;
+      if (orin != orientation(quadix[3], quadix[1], quadix[0])) return false;
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool convex_quadix(const quadix<T,3>& quadix)
+   {
+      vector3d<T> bda = (quadix[3] - quadix[1]) * (quadix[0] - quadix[1]);
+      vector3d<T> bdc = (quadix[3] - quadix[1]) * (quadix[2] - quadix[1]);
+
+      if (greater_than_or_equal(dot_product(bda,bdc),T(0.0)))
+      {
+         return false;
+      }
+
+      vector3d<T> acd = (quadix[2] - quadix[0]) * (quadix[3] - quadix[0]);
+      vector3d<T> acb = (quadix[2] - quadix[0]) * (quadix[1] - quadix[0]);
+
+      return dot_product(acd,acb) < T(0.0);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool is_convex_polygon(const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::is_convex_polygon(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_convex_polygon(const polygon_view<T,2>& polygon)
+   {
+      return detail::is_convex_polygon(polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> remove_consecutive_collinear_points(const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      point2d<T> previous_point = polygon[polygon.size() - 1];
+
+      for (std::size_t i = 0; i < polygon.size() - 1; ++i)
+      {
+         if (orientation(previous_point,polygon[i],polygon[i + 1]) != CollinearOrientation)
+         {
+            polygon_.push_back(polygon[i]);
+            previous_point = polygon[i];
+         }
+      }
+
+      if (orientation(previous_point,polygon.back(),polygon.front()) != CollinearOrientation)
+      {
+         polygon_.push_back(polygon.back());
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void remove_consecutive_collinear_points(const InputIterator begin, const InputIterator end,
+                                                   OutputIterator out)
+   {
+      if (std::distance(begin,end) < 3)
+      {
+         std::copy(begin,end,out);
+         return;
+      }
+
+      InputIterator prev = begin;
+      InputIterator it   = begin + 1;
+      InputIterator next = begin + 2;
+
+      while (next != end)
+      {
+         if (orientation(*prev,*it,*next) != CollinearOrientation)
+         {
+            (*out++) = *it;
+            prev = it;
+         }
+
+         it = next;
+         ++next;
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool convex_vertex(const std::size_t& index, const polygon<T,2,Allocator>& polygon, const int& polygon_orientation)
+   {
+      if (0 == index)
+      {
+         return (orientation(polygon.back(),polygon.front(),polygon[1]) == polygon_orientation);
+      }
+      else if (index == (polygon.size() - 1))
+      {
+         return (orientation(polygon[polygon.size() - 2],polygon.back(),polygon.front()) == polygon_orientation);
+      }
+      else
+      {
+         return (orientation(polygon[index - 1],polygon[index],polygon[index + 1]) == polygon_orientation);
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool collinear_vertex(const std::size_t& index, const polygon<T,2,Allocator>& polygon)
+   {
+      if (0 == index)
+      {
+         return robust_collinear(polygon.back(),polygon.front(),polygon[1]);
+      }
+      else if (index == (polygon.size() - 1))
+      {
+         return robust_collinear(polygon[polygon.size() - 2],polygon.back(),polygon.front());
+      }
+      else
+      {
+         return robust_collinear(polygon[index - 1],polygon[index],polygon[index + 1]);
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool vertex_is_ear(const std::size_t& index, const polygon<T,2,Allocator>& polygon)
+   {
+      std::size_t pred_index;
+      std::size_t succ_index;
+
+      if (0 == index)
+      {
+         pred_index = polygon.size() - 1;
+         succ_index = 1;
+      }
+      else if (index == polygon.size() - 1)
+      {
+         pred_index = polygon.size() - 2;
+         succ_index = 0;
+      }
+      else
+      {
+         pred_index = index - 1;
+         succ_index = index + 1;
+      }
+
+      triangle<T,2> triangle = make_triangle(polygon[pred_index],polygon[index],polygon[succ_index]);
+
+      if (robust_collinear(triangle[0],triangle[1],triangle[2]))
+      {
+         return false;
+      }
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         if ((i != pred_index) && (i != succ_index) && (i != index))
+         {
+            if (point_in_triangle(polygon[i],triangle))
+            {
+               return false;
+            }
+         }
+      }
+
+      return true;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE triangle<T,2> vertex_triangle(const std::size_t& index, const polygon<T,2,Allocator>& polygon)
+   {
+      if (0 == index)
+      {
+         return make_triangle(polygon.back(),polygon.front(),polygon[1]);
+      }
+      else if (index == (polygon.size() - 1))
+      {
+         return make_triangle(polygon[polygon.size() - 2],polygon.back(),polygon.front());
+      }
+      else
+      {
+         return make_triangle(polygon[index - 1],polygon[index],polygon[index + 1]);
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE int polygon_orientation(const polygon<T,2,Allocator>& polygon)
+   {
+      if (polygon.size() < 3)
+      {
+         return 0;
+      }
+
+      T area = T(0.0);
+
+      std::size_t prev_index = polygon.size() - 1;
+
+      for (std::size_t index = 0; index < polygon.size(); ++index)
+      {
+         area += (polygon[prev_index].x * polygon[index].y - polygon[index].x * polygon[prev_index].y);
+         prev_index = index;
+      }
+
+      return ((greater_than_or_equal(area,T(0.0))) ? CounterClockwise : Clockwise);
+
+      /*
+      std::size_t anchor = 0;
+
+      for (std::size_t i = 1; i < polygon.size(); ++i)
+      {
+         if (polygon[i].x > polygon[anchor].x)
+            anchor = i;
+         else if ((polygon[i].x == polygon[anchor].x) && (polygon[i].y  < polygon[anchor].y))
+            anchor = i;
+      }
+
+      if (0 == anchor)
+      {
+         return orientation(*(polygon.end() - 1),*polygon.end(),*polygon.begin());
+      }
+      else if (anchor == (polygon.size() - 1))
+      {
+         return orientation(*(polygon.end() - 2),*(polygon.end() - 1),*polygon.end());
+      }
+      else
+      {
+         return orientation(polygon[anchor - 2],polygon[anchor - 1],polygon[anchor]);
+      }
+      */
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equilateral_triangle(const triangle<T,2>& triangle)
+   {
+      const T dist = distance(triangle[0],triangle[1]);
+
+      return is_equal(distance(triangle[1], triangle[2]), dist) &&
+             is_equal(distance(triangle[0], triangle[2]), dist);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equilateral_triangle(const triangle<T,3>& triangle)
+   {
+      const T dist = distance(triangle[0],triangle[1]);
+
+      return is_equal(distance(triangle[1], triangle[2]), dist) &&
+             is_equal(distance(triangle[0], triangle[2]), dist);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_isosceles_triangle(const triangle<T,2>& triangle)
+   {
+      const T dist1 = lay_distance(triangle[0],triangle[1]);
+      const T dist2 = lay_distance(triangle[1],triangle[2]);
+      const T dist3 = lay_distance(triangle[2],triangle[0]);
+
+      return is_equal(dist1,dist2) || is_equal(dist1,dist3) || is_equal(dist2,dist3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_isosceles_triangle(const triangle<T,3>& triangle)
+   {
+      const T dist1 = lay_distance(triangle[0],triangle[1]);
+      const T dist2 = lay_distance(triangle[1],triangle[2]);
+      const T dist3 = lay_distance(triangle[2],triangle[0]);
+
+      return is_equal(dist1,dist2) || is_equal(dist1,dist3) || is_equal(dist2,dist3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_right_triangle(const wykobi::triangle<T,2>& triangle)
+   {
+      const T a = wykobi::lay_distance(wykobi::edge(triangle,0));
+      const T b = wykobi::lay_distance(wykobi::edge(triangle,1));
+      const T c = wykobi::lay_distance(wykobi::edge(triangle,2));
+
+      return wykobi::is_equal(a + b,c) || wykobi::is_equal(a + c,b) || wykobi::is_equal(b + c,a);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_right_triangle(const wykobi::triangle<T,3>& triangle)
+   {
+      const T a = wykobi::lay_distance(wykobi::edge(triangle,0));
+      const T b = wykobi::lay_distance(wykobi::edge(triangle,1));
+      const T c = wykobi::lay_distance(wykobi::edge(triangle,2));
+
+      return wykobi::is_equal(a + b,c) || wykobi::is_equal(a + c,b) || wykobi::is_equal(b + c,a);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      return is_equal(x1,x2) && is_equal(y1,y2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const segment<T,2>& segment)
+   {
+      return is_degenerate
+             (
+               segment[0].x, segment[0].y,
+               segment[1].x, segment[1].y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const line<T,2>& line)
+   {
+      return is_degenerate(line[0].x,line[0].y,line[1].x,line[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      return is_equal(x1,x2) &&
+             is_equal(y1,y2) &&
+             is_equal(z1,z2) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const segment<T,3>& segment)
+   {
+      return is_degenerate
+             (
+               segment[0].x, segment[0].y, segment[0].z,
+               segment[1].x, segment[1].y, segment[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const line<T,3>& line)
+   {
+      return is_degenerate
+             (
+               line[0].x, line[0].y, line[0].z,
+               line[1].x, line[1].y, line[1].z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const triangle<T,2>& triangle)
+   {
+      return is_equal(triangle[0],triangle[1])                    ||
+             is_equal(triangle[0],triangle[2])                    ||
+             is_equal(triangle[1],triangle[2])                    ||
+             robust_collinear(triangle[0],triangle[1],triangle[2])||
+             is_equal(distance(edge(triangle,0)),(distance(edge(triangle,1)) + distance(edge(triangle,2)))) ||
+             is_equal(distance(edge(triangle,1)),(distance(edge(triangle,2)) + distance(edge(triangle,0)))) ||
+             is_equal(distance(edge(triangle,2)),(distance(edge(triangle,0)) + distance(edge(triangle,1))));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const triangle<T,3>& triangle)
+   {
+      return (is_equal(triangle[0],triangle[1]))                   ||
+             (is_equal(triangle[0],triangle[2]))                   ||
+             (is_equal(triangle[1],triangle[2]))                   ||
+             robust_collinear(triangle[0],triangle[1],triangle[2]) ||
+             is_equal(distance(edge(triangle,0)),(distance(edge(triangle,1)) + distance(edge(triangle,2)))) ||
+             is_equal(distance(edge(triangle,1)),(distance(edge(triangle,2)) + distance(edge(triangle,0)))) ||
+             is_equal(distance(edge(triangle,2)),(distance(edge(triangle,0)) + distance(edge(triangle,1))));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const rectangle<T>& rectangle)
+   {
+      return is_equal(rectangle[0],rectangle[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const circle<T>& circle)
+   {
+      return less_than_or_equal(circle.radius,T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const sphere<T>& sphere)
+   {
+      return less_than_or_equal(sphere.radius,T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_degenerate(const circular_arc<T>& arc)
+   {
+      return  is_degenerate(arc.x1, arc.y1, arc.x2, arc.y2)                                                ||
+              is_degenerate(arc.x1, arc.y1, arc.cx, arc.cy)                                                ||
+              is_degenerate(arc.x2, arc.y2, arc.cx, arc.cy)                                                ||
+              (lay_distance(arc.x1, arc.y1, arc.cx, arc.cy) != lay_distance(arc.x2,arc.y2,arc.cx,arc.cy))  ||
+              (lay_distance(arc.x1, arc.y1, arc.cx, arc.cy) != lay_distance(arc.px,arc.py,arc.cx,arc.cy))  ||
+              (cartesian_angle(arc.x1 - arc.cx, arc.y1 - arc.cy ) != arc.angle1)                           ||
+              (cartesian_angle(arc.x2 - arc.cx, arc.y2 - arc.cy ) != arc.angle2)                           ||
+              (cartesian_angle(arc.px - arc.cx, arc.py - arc.cy ) != abs(arc.angle1 - arc.angle2))         ||
+              (orientation (arc.x1,arc.y1,arc.x2,arc.y2,arc.px,arc.py) != arc.orientation);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE int exact_orientation(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& px, const T& py)
+   {
+      typedef typename wide_type<T>::type W;
+
+      const W orin = (W(x2) - W(x1)) * (W(py) - W(y1)) - (W(px) - W(x1)) * (W(y2) - W(y1));
+
+      if (orin > W(0))      return LeftHandSide;         /* Orientaion is to the left-hand side  */
+      else if (orin < W(0)) return RightHandSide;        /* Orientaion is to the right-hand side */
+      else                  return CollinearOrientation; /* Orientaion is neutral aka collinear  */
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE bool exact_point_in_polygon(const T& px, const T& py, const polygon<T,2,Allocator>& polygon)
+   {
+      return detail::exact_point_in_polygon(px,py,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool exact_point_in_polygon(const T& px, const T& py, const polygon_view<T,2>& polygon)
+   {
+      return detail::exact_point_in_polygon(px,py,polygon);
+   }
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+
+   template <>
+   inline int orientation<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                        const std::int32_t& x2, const std::int32_t& y2,
+                                        const std::int32_t& px, const std::int32_t& py)
+   {
+      WYKOBI_INSTRUMENT(orientation);
+
+      return exact_orientation(x1,y1,x2,y2,px,py);
+   }
+
+   template <>
+   inline int robust_orientation<std::int32_t>(const std::int32_t& x1, const std::int32_t& y1,
+                                               const std::int32_t& x2, const std::int32_t& y2,
+                                               const std::int32_t& px, const std::int32_t& py)
+   {
+      WYKOBI_INSTRUMENT(robust_orientation);
+
+      return exact_orientation(x1,y1,x2,y2,px,py);
+   }
+
+   template <>
+   inline int orientation<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                        const std::int64_t& x2, const std::int64_t& y2,
+                                        const std::int64_t& px, const std::int64_t& py)
+   {
+      WYKOBI_INSTRUMENT(orientation);
+
+      return exact_orientation(x1,y1,x2,y2,px,py);
+   }
+
+   template <>
+   inline int robust_orientation<std::int64_t>(const std::int64_t& x1, const std::int64_t& y1,
+                                               const std::int64_t& x2, const std::int64_t& y2,
+                                               const std::int64_t& px, const std::int64_t& py)
+   {
+      WYKOBI_INSTRUMENT(robust_orientation);
+
+      return exact_orientation(x1,y1,x2,y2,px,py);
+   }
+
+   #endif
+
+} // wykobi namespace
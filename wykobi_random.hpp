@@ -0,0 +1,96 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_RANDOM
+#define INCLUDE_WYKOBI_RANDOM
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Random value, point and object generation.
+   */
+
+   template <typename T> WYKOBI_INLINE T generate_random_value(const T& range);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_random_point(const T& dx, const  T& dy);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_random_point(const T& dx, const T& dy, const T& dz);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_random_point(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_random_point(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_random_point(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_random_point(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_random_point(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_random_point(const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE point2d<T> generate_random_point(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> generate_random_point(const box<T,3>& box);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const T& x1, const T& y1, const  T& x2, const  T& y2, const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const T& x1, const T& y1, const T& z1, const T& x2, const  T& y2, const  T& z2, const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const rectangle<T>& rectangle, const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const box<T,3>& box,           const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const segment<T,2>& segment,   const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const segment<T,3>& segment,   const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const triangle<T,2>& triangle, const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const triangle<T,3>& triangle, const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const quadix<T,2>& quadix,     const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const quadix<T,3>& quadix,     const std::size_t& point_count, OutputIterator out);
+
+   template <typename T, typename OutputIterator> WYKOBI_INLINE void generate_random_points(const circle<T>& circle,       const std::size_t& point_count, OutputIterator out);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2, box<T,3>& box);
+
+} // wykobi namespace
+
+#include "wykobi_predicates.hpp"
+#include "wykobi_transforms.hpp"
+#include "wykobi_random.inl"
+
+#endif
@@ -0,0 +1,470 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_random.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE T generate_random_value(const T& range)
+   {
+      return T((1.0 * range * rand()) / RAND_MAX);
+   }
+
+   namespace detail
+   {
+      /* Uniform values in [0,range] drawn from rand(), as generate_random_value. */
+      struct rand_source
+      {
+         template <typename T>
+         inline T operator()(const T& range)
+         {
+            return generate_random_value(range);
+         }
+      };
+
+      /*
+         Shape samplers shared by the rand() based generators and by
+         other sources of uniform values (see wykobi_execution.hpp).
+      */
+      template <typename T, typename Source>
+      inline point2d<T> random_point(const segment<T,2>& segment, Source& source)
+      {
+         const T t = source(T(1.0));
+
+         return make_point(((1 - t) * segment[0].x) + (t * segment[1].x),
+                           ((1 - t) * segment[0].y) + (t * segment[1].y));
+      }
+
+      template <typename T, typename Source>
+      inline point3d<T> random_point(const segment<T,3>& segment, Source& source)
+      {
+         const T t = source(T(1.0));
+
+         return make_point(((1 - t) * segment[0].x) + (t * segment[1].x),
+                           ((1 - t) * segment[0].y) + (t * segment[1].y),
+                           ((1 - t) * segment[0].z) + (t * segment[1].z));
+      }
+
+      template <typename T, typename Source>
+      inline point2d<T> random_point(const triangle<T,2>& triangle, Source& source)
+      {
+         T a = source(T(1.0));
+         T b = source(T(1.0));
+
+         if ((a + b) > T(1.0))
+         {
+            a = 1 - a;
+            b = 1 - b;
+         }
+
+         const T c = (1 - a - b);
+
+         return make_point((triangle[0].x * a) + (triangle[1].x * b) + (triangle[2].x * c),
+                           (triangle[0].y * a) + (triangle[1].y * b) + (triangle[2].y * c));
+      }
+
+      template <typename T, typename Source>
+      inline point3d<T> random_point(const triangle<T,3>& triangle, Source& source)
+      {
+         T a = source(T(1.0));
+         T b = source(T(1.0));
+
+         if ((a + b) > T(1.0))
+         {
+            a = 1 - a;
+            b = 1 - b;
+         }
+
+         const T c = (1 - a - b);
+
+         return make_point((triangle[0].x * a) + (triangle[1].x * b) + (triangle[2].x * c),
+                           (triangle[0].y * a) + (triangle[1].y * b) + (triangle[2].y * c),
+                           (triangle[0].z * a) + (triangle[1].z * b) + (triangle[2].z * c));
+      }
+
+      template <typename T, typename Source>
+      inline point2d<T> random_point(const quadix<T,2>& quadix, Source& source)
+      {
+         const T a = (2 * source(T(1.0))) - 1;
+         const T b = (2 * source(T(1.0))) - 1;
+
+         const T a1 = T(1.0) - a;
+         const T a2 = T(1.0) + a;
+
+         const T b1 = T(1.0) - b;
+         const T b2 = T(1.0) + b;
+
+         const T r1 = a1 * b1;
+         const T r2 = a2 * b1;
+         const T r3 = a2 * b2;
+         const T r4 = a1 * b2;
+
+         return make_point(((r1 * quadix[0].x) + (r2 * quadix[1].x) + (r3 * quadix[2].x) + (r4 * quadix[3].x)) * T(0.25),
+                           ((r1 * quadix[0].y) + (r2 * quadix[1].y) + (r3 * quadix[2].y) + (r4 * quadix[3].y)) * T(0.25));
+      }
+
+      template <typename T, typename Source>
+      inline point3d<T> random_point(const quadix<T,3>& quadix, Source& source)
+      {
+         const T a = (2 * source(T(1.0))) - 1;
+         const T b = (2 * source(T(1.0))) - 1;
+
+         const T a1 = T(1.0) - a;
+         const T a2 = T(1.0) + a;
+
+         const T b1 = T(1.0) - b;
+         const T b2 = T(1.0) + b;
+
+         const T r1 = a1 * b1;
+         const T r2 = a2 * b1;
+         const T r3 = a2 * b2;
+         const T r4 = a1 * b2;
+
+         return make_point(((r1 * quadix[0].x) + (r2 * quadix[1].x) + (r3 * quadix[2].x) + (r4 * quadix[3].x)) * T(0.25),
+                           ((r1 * quadix[0].y) + (r2 * quadix[1].y) + (r3 * quadix[2].y) + (r4 * quadix[3].y)) * T(0.25),
+                           ((r1 * quadix[0].z) + (r2 * quadix[1].z) + (r3 * quadix[2].z) + (r4 * quadix[3].z)) * T(0.25));
+      }
+
+      template <typename T, typename Source>
+      inline point2d<T> random_point(const rectangle<T>& rectangle, Source& source)
+      {
+         const T x = source(abs(rectangle[1].x - rectangle[0].x));
+         const T y = source(abs(rectangle[1].y - rectangle[0].y));
+
+         return make_point(min(rectangle[0].x,rectangle[1].x) + x,
+                           min(rectangle[0].y,rectangle[1].y) + y);
+      }
+
+      template <typename T, typename Source>
+      inline point3d<T> random_point(const box<T,3>& box, Source& source)
+      {
+         const T x = source(abs(box[1].x - box[0].x));
+         const T y = source(abs(box[1].y - box[0].y));
+         const T z = source(abs(box[1].z - box[0].z));
+
+         return make_point(min(box[0].x,box[1].x) + x,
+                           min(box[0].y,box[1].y) + y,
+                           min(box[0].z,box[1].z) + z);
+      }
+
+      template <typename T, typename Source>
+      inline point2d<T> random_point(const circle<T>& circle, Source& source)
+      {
+         const T random_angle = source(T(360.0));
+
+         point2d<T> point_;
+
+         point_.x = circle.x + circle.radius * sqrt(source(T(1.0)));
+         point_.y = circle.y;
+
+         return rotate(random_angle, point_, make_point(circle.x, circle.y));
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_random_point(const T& dx, const T& dy)
+   {
+      return make_point(generate_random_value(dx),generate_random_value(dy));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_random_point(const T& dx, const T& dy, const T& dz)
+   {
+      return make_point(generate_random_value(dx),generate_random_value(dy),generate_random_value(dz));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_random_point(const segment<T,2>& segment)
+   {
+      detail::rand_source source;
+      return detail::random_point(segment,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_random_point(const segment<T,3>& segment)
+   {
+      detail::rand_source source;
+      return detail::random_point(segment,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_random_point(const triangle<T,2>& triangle)
+   {
+      detail::rand_source source;
+      return detail::random_point(triangle,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_random_point(const triangle<T,3>& triangle)
+   {
+      detail::rand_source source;
+      return detail::random_point(triangle,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_random_point(const quadix<T,2>& quadix)
+   {
+      detail::rand_source source;
+      return detail::random_point(quadix,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_random_point(const quadix<T,3>& quadix)
+   {
+      detail::rand_source source;
+      return detail::random_point(quadix,source);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> generate_random_point(const rectangle<T>& rectangle)
+   {
+      return translate(min(rectangle[0].x,rectangle[1].x),min(rectangle[0].y,rectangle[1].y),
+                       generate_random_point(abs(rectangle[1].x - rectangle[0].x),
+                                             abs(rectangle[1].y - rectangle[0].y)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> generate_random_point(const box<T,3>& box)
+   {
+      return translate(min(box[0].x,box[1].x),min(box[0].y,box[1].y),min(box[0].z,box[1].z),
+                       generate_random_point(abs(box[1].x - box[0].x),
+                                             abs(box[1].y - box[0].y),
+                                             abs(box[1].z - box[0].z)));
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const std::size_t& point_count,
+                                      OutputIterator out)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = translate(x1,y1,generate_random_point(dx,dy));
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const T& x1, const T& y1, const T& z1,
+                                      const T& x2, const T& y2, const T& z2,
+                                      const std::size_t& point_count,
+                                      OutputIterator out)
+   {
+      T dx = abs(x2 - x1);
+      T dy = abs(y2 - y1);
+      T dz = abs(z2 - z1);
+
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = translate(x1,y1,z1,generate_random_point(dx,dy,dz));
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const rectangle<T>& rectangle, const std::size_t& point_count, OutputIterator out)
+   {
+      generate_random_points(rectangle[0].x, rectangle[0].y,
+                             rectangle[1].x, rectangle[1].y,
+                             point_count,
+                             out);
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const box<T,3>& box, const std::size_t& point_count, OutputIterator out)
+   {
+      generate_random_points(box[0].x, box[0].y, box[0].z,
+                             box[1].x, box[1].y, box[1].z,
+                             point_count,
+                             out);
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const segment<T,2>& segment, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(segment);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const segment<T,3>& segment, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(segment);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const triangle<T,2>& triangle, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(triangle);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const triangle<T,3>& triangle, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(triangle);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const quadix<T,2>& quadix, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(quadix);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const quadix<T,3>& quadix, const std::size_t& point_count, OutputIterator out)
+   {
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = generate_random_point(quadix);
+      }
+   }
+
+   template <typename T, typename OutputIterator>
+   WYKOBI_INLINE void generate_random_points(const circle<T>& circle, const std::size_t& point_count, OutputIterator out)
+   {
+      detail::rand_source source;
+
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         (*out++) = detail::random_point(circle,source);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, segment<T,2>& segment)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      do
+      {
+         for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+         {
+            segment[i].x = x1 + generate_random_value(dx);
+            segment[i].y = y1 + generate_random_value(dy);
+         }
+      }
+      while (is_degenerate(segment));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, rectangle<T>& rectangle)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      do
+      {
+         for (std::size_t i = 0; i < wykobi::rectangle<T>::PointCount; ++i)
+         {
+            rectangle[i].x = x1 + generate_random_value(dx);
+            rectangle[i].y = y1 + generate_random_value(dy);
+         }
+      }
+      while (is_degenerate(rectangle));
+
+      if (rectangle[1].x < rectangle[0].x)
+      {
+         T t = rectangle[1].x;
+         rectangle[1].x = rectangle[0].x;
+         rectangle[0].x = t;
+      }
+
+      if (rectangle[1].y < rectangle[0].y)
+      {
+         T t = rectangle[1].y;
+         rectangle[1].y = rectangle[0].y;
+         rectangle[0].y = t;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, triangle<T,2>& triangle)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      do
+      {
+         for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+         {
+            triangle[i].x = x1 + generate_random_value(dx);
+            triangle[i].y = y1 + generate_random_value(dy);
+         }
+      }
+      while (is_degenerate(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, quadix<T,2>& quadix)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      do
+      {
+         for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+         {
+            quadix[i].x = x1 + generate_random_value(dx);
+            quadix[i].y = y1 + generate_random_value(dy);
+         }
+      }
+      while (is_degenerate(quadix));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& x2, const T& y2, circle<T>& circle)
+   {
+      const T dx = abs(x2 - x1);
+      const T dy = abs(y2 - y1);
+
+      circle.radius = generate_random_value(min(dx,dy) * T(0.5));
+      circle.x      = x1 + circle.radius + generate_random_value(dx - (T(2.0) * circle.radius));
+      circle.y      = y1 + circle.radius + generate_random_value(dy - (T(2.0) * circle.radius));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void generate_random_object(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2, box<T,3>& box)
+   {
+      wykobi::box<T,3> region = make_box(x1,y1,z1,x2,y2,z2);
+      box[0] = generate_random_point(region);
+      box[1] = generate_random_point(region);
+   }
+
+} // wykobi namespace
@@ -0,0 +1,232 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_RAY_PACKET
+#define INCLUDE_WYKOBI_RAY_PACKET
+
+
+#include <cstddef>
+
+#include "wykobi.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Bundle of up to Width rays (4 or 8 suit SSE/AVX registers) stored as
+      structure of arrays, with precomputed inverse directions for slab
+      tests. Directions are expected to be of unit length, as made by
+      make_ray. Each lane carries a maximum distance t_max, hits further
+      away are not reported. Lanes that were never set are inactive and
+      never hit.
+   */
+   template <typename T, std::size_t Width>
+   class ray_packet
+   {
+   public:
+
+      typedef unsigned int mask_type;
+      typedef char width_must_be_between_1_and_32[((Width > 0) && (Width <= 32)) ? 1 : -1];
+
+      static const std::size_t width = Width;
+
+      ray_packet()
+      {
+         clear();
+      }
+
+      template <typename InputIterator>
+      ray_packet(InputIterator begin, InputIterator end)
+      {
+         clear();
+         load(begin,end);
+      }
+
+      inline void clear()
+      {
+         for (std::size_t i = 0; i < Width; ++i)
+         {
+            origin_x   [i] = T(0.0); origin_y   [i] = T(0.0); origin_z   [i] = T(0.0);
+            direction_x[i] = T(0.0); direction_y[i] = T(0.0); direction_z[i] = T(0.0);
+            inverse_x  [i] = T(0.0); inverse_y  [i] = T(0.0); inverse_z  [i] = T(0.0);
+            t_max      [i] = -infinity<T>();
+         }
+
+         active_ = 0;
+      }
+
+      inline void set(const std::size_t& lane, const ray<T,3>& ray, const T& max_distance = infinity<T>())
+      {
+         origin_x   [lane] = ray.origin.x;
+         origin_y   [lane] = ray.origin.y;
+         origin_z   [lane] = ray.origin.z;
+         direction_x[lane] = ray.direction.x;
+         direction_y[lane] = ray.direction.y;
+         direction_z[lane] = ray.direction.z;
+         inverse_x  [lane] = detail::slab_inverse(ray.direction.x);
+         inverse_y  [lane] = detail::slab_inverse(ray.direction.y);
+         inverse_z  [lane] = detail::slab_inverse(ray.direction.z);
+         t_max      [lane] = max_distance;
+
+         active_ |= (mask_type(1) << lane);
+      }
+
+      /* Fills lanes from the front with the rays of a range, returns the number of lanes used. */
+      template <typename InputIterator>
+      inline std::size_t load(InputIterator begin, InputIterator end)
+      {
+         std::size_t lane = 0;
+
+         for (InputIterator it = begin; (it != end) && (lane < Width); ++it, ++lane)
+         {
+            set(lane,*it);
+         }
+
+         return lane;
+      }
+
+      inline mask_type active() const { return active_; }
+
+      T origin_x   [Width];
+      T origin_y   [Width];
+      T origin_z   [Width];
+      T direction_x[Width];
+      T direction_y[Width];
+      T direction_z[Width];
+      T inverse_x  [Width];
+      T inverse_y  [Width];
+      T inverse_z  [Width];
+      T t_max      [Width];
+
+   private:
+
+      mask_type active_;
+   };
+
+   template <typename T, std::size_t Width>
+   const std::size_t ray_packet<T,Width>::width;
+
+   /*
+      Packet tests: bit i of the result is set when lane i hits, with the
+      hit distance in t[i] (entry distance for boxes and spheres, zero for
+      an origin inside). t of lanes that miss is unspecified. Each lane
+      uses the same kernel as the corresponding scalar intersect.
+   */
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const box<T,3>& box, T (&t)[Width]);
+
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const sphere<T>& sphere, T (&t)[Width]);
+
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const triangle<T,3>& triangle, T (&t)[Width]);
+
+   template <typename T, std::size_t Width, typename Primitive>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const Primitive& primitive);
+
+   namespace detail
+   {
+      /*
+         Lanes write their flags (as 0 or 1 of type T) and distances into
+         local arrays, which keeps the lane loops free of stores that may
+         alias the packet so that they vectorise, then this gathers them.
+      */
+      template <typename T, std::size_t Width>
+      inline unsigned int packet_result(const ray_packet<T,Width>& packet, const T (&hit)[Width], const T (&t_)[Width], T (&t)[Width])
+      {
+         unsigned int mask = 0;
+
+         for (std::size_t i = 0; i < Width; ++i)
+         {
+            mask |= ((hit[i] != T(0.0)) ? 1u : 0u) << i;
+            t[i]  = t_[i];
+         }
+
+         return mask & packet.active();
+      }
+
+   } // namespace wykobi::detail
+
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const box<T,3>& box, T (&t)[Width])
+   {
+      T hit[Width];
+      T t_ [Width];
+
+      for (std::size_t i = 0; i < Width; ++i)
+      {
+         T tmin = T(0.0);
+         T tmax = packet.t_max[i];
+
+         hit[i] = detail::ray_box_slab(packet.origin_x [i],packet.origin_y [i],packet.origin_z [i],
+                                       packet.inverse_x[i],packet.inverse_y[i],packet.inverse_z[i],
+                                       box,tmin,tmax) ? T(1.0) : T(0.0);
+         t_ [i] = tmin;
+      }
+
+      return detail::packet_result(packet,hit,t_,t);
+   }
+
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const sphere<T>& sphere, T (&t)[Width])
+   {
+      T hit[Width];
+      T t_ [Width];
+
+      for (std::size_t i = 0; i < Width; ++i)
+      {
+         const bool lane_hit = detail::ray_sphere(packet.origin_x   [i],packet.origin_y   [i],packet.origin_z   [i],
+                                                  packet.direction_x[i],packet.direction_y[i],packet.direction_z[i],
+                                                  sphere,t_[i]);
+
+         hit[i] = (lane_hit && (t_[i] <= packet.t_max[i])) ? T(1.0) : T(0.0);
+      }
+
+      return detail::packet_result(packet,hit,t_,t);
+   }
+
+   template <typename T, std::size_t Width>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const triangle<T,3>& triangle, T (&t)[Width])
+   {
+      T hit[Width];
+      T t_ [Width];
+
+      for (std::size_t i = 0; i < Width; ++i)
+      {
+         const bool lane_hit = detail::ray_triangle(packet.origin_x   [i],packet.origin_y   [i],packet.origin_z   [i],
+                                                    packet.direction_x[i],packet.direction_y[i],packet.direction_z[i],
+                                                    triangle,t_[i]);
+
+         hit[i] = (lane_hit && (t_[i] <= packet.t_max[i])) ? T(1.0) : T(0.0);
+      }
+
+      return detail::packet_result(packet,hit,t_,t);
+   }
+
+   template <typename T, std::size_t Width, typename Primitive>
+   inline typename ray_packet<T,Width>::mask_type intersect(const ray_packet<T,Width>& packet, const Primitive& primitive)
+   {
+      T t[Width];
+      return intersect(packet,primitive,t);
+   }
+
+} // namespace wykobi
+
+#endif
@@ -0,0 +1,372 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi.hpp"
+#include "wykobi_algorithm.hpp"
+
+
+namespace wykobi
+{
+   namespace algorithm
+   {
+      /*
+        Note: Input is expected to be a convex polygon such as the output
+              of the convex hull algorithms, in either orientation and
+              without consecutive collinear vertices. Every routine
+              is linear in the number of hull vertices and uses no
+              trigonometric functions.
+      */
+
+      template <typename T>
+      struct rotating_calipers< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         rotating_calipers(InputIterator begin, InputIterator end)
+         {
+            hull_.reserve(std::distance(begin,end));
+
+            for (InputIterator it = begin; it != end; ++it)
+            {
+               hull_.push_back(*it);
+            }
+
+            if (polygon_orientation(hull_) == Clockwise)
+            {
+               hull_.reverse();
+            }
+         }
+
+         segment<T,2> diameter() const
+         {
+            const std::size_t n = hull_.size();
+
+            if (0 == n)
+               return degenerate_segment2d<T>();
+            else if (n < 3)
+               return make_segment(hull_.front(),hull_.back());
+
+            segment<T,2> diameter_ = make_segment(hull_[0],hull_[1]);
+            T max_distance = lay_distance(hull_[0],hull_[1]);
+
+            std::size_t j = 1;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               const std::size_t i1 = next(i);
+
+               j = farthest_from_edge(i,j);
+
+               update_diameter(i ,j,max_distance,diameter_);
+               update_diameter(i1,j,max_distance,diameter_);
+
+               if (is_equal(height(i,next(j)),height(i,j)))
+               {
+                  update_diameter(i ,next(j),max_distance,diameter_);
+                  update_diameter(i1,next(j),max_distance,diameter_);
+               }
+            }
+
+            return diameter_;
+         }
+
+         T width() const
+         {
+            const std::size_t n = hull_.size();
+
+            if (n < 3)
+               return T(0.0);
+
+            T min_width = +infinity<T>();
+
+            std::size_t j = 1;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               j = farthest_from_edge(i,j);
+
+               const T edge_width = height(i,j) / distance(hull_[i],hull_[next(i)]);
+
+               if (edge_width < min_width)
+               {
+                  min_width = edge_width;
+               }
+            }
+
+            return min_width;
+         }
+
+         template <typename OutputIterator>
+         void antipodal_pairs(OutputIterator out) const
+         {
+            const std::size_t n = hull_.size();
+
+            if (n < 2)
+               return;
+            else if (n == 2)
+            {
+               (*out++) = make_segment(hull_[0],hull_[1]);
+               return;
+            }
+
+            /*
+               Vertex i lies between edges i - 1 and i (edge i runs from
+               vertex i to i + 1), so it is antipodal to every vertex from
+               the farthest vertex of edge i - 1 through to the farthest
+               vertex of edge i, or the second of two equally far ones.
+               j carries the farthest vertex of the previous edge into
+               the next iteration. Each pair is reported once, from its
+               lower index.
+            */
+            std::size_t j = farthest_from_edge(n - 1,1);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               const std::size_t first = j;
+
+               j = farthest_from_edge(i,j);
+
+               std::size_t last = j;
+
+               if (is_equal(height(i,next(j)),height(i,j)))
+               {
+                  last = next(j);
+               }
+
+               for (std::size_t k = first; ; k = next(k))
+               {
+                  if (i < k)
+                  {
+                     (*out++) = make_segment(hull_[i],hull_[k]);
+                  }
+
+                  if (k == last) break;
+               }
+            }
+         }
+
+         obb<T,2> minimum_area_rectangle() const
+         {
+            return enclosing_rectangle(eMinimumArea);
+         }
+
+         obb<T,2> minimum_perimeter_rectangle() const
+         {
+            return enclosing_rectangle(eMinimumPerimeter);
+         }
+
+      private:
+
+         enum rectangle_criteria
+         {
+            eMinimumArea,
+            eMinimumPerimeter
+         };
+
+         inline std::size_t next(const std::size_t& i) const
+         {
+            return ((i + 1) == hull_.size()) ? 0 : (i + 1);
+         }
+
+         /* twice the area of the triangle formed by edge i and vertex j */
+         inline T height(const std::size_t& i, const std::size_t& j) const
+         {
+            return abs(signed_area(hull_[i],hull_[next(i)],hull_[j]));
+         }
+
+         inline std::size_t farthest_from_edge(const std::size_t& i, std::size_t j) const
+         {
+            for (std::size_t k = 0; (k < hull_.size()) && (height(i,next(j)) > height(i,j)); ++k)
+            {
+               j = next(j);
+            }
+
+            return j;
+         }
+
+         inline void update_diameter(const std::size_t& i, const std::size_t& j, T& max_distance, segment<T,2>& diameter_) const
+         {
+            const T current_distance = lay_distance(hull_[i],hull_[j]);
+
+            if (current_distance > max_distance)
+            {
+               max_distance = current_distance;
+               diameter_    = make_segment(hull_[i],hull_[j]);
+            }
+         }
+
+         inline T project(const std::size_t& i, const vector2d<T>& v) const
+         {
+            return (hull_[i].x * v.x) + (hull_[i].y * v.y);
+         }
+
+         obb<T,2> enclosing_rectangle(const rectangle_criteria criteria) const
+         {
+            const std::size_t n = hull_.size();
+
+            if (0 == n)
+               return make_obb(degenerate_point2d<T>(),make_vector(T(1.0),T(0.0)),T(0.0),T(0.0));
+            else if (1 == n)
+               return make_obb(hull_[0],make_vector(T(1.0),T(0.0)),T(0.0),T(0.0));
+            else if (2 == n)
+               return make_obb(hull_[0] + (hull_[1] - hull_[0]) * T(0.5),hull_[1] - hull_[0],T(0.5) * distance(hull_[0],hull_[1]),T(0.0));
+
+            obb<T,2>    best_obb;
+            T           best_measure = +infinity<T>();
+
+            std::size_t r = 1;
+            std::size_t t = 1;
+            std::size_t l = 1;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+               const vector2d<T> u = normalize(hull_[next(i)] - hull_[i]);
+               const vector2d<T> v = make_vector(-u.y,u.x);
+
+               for (std::size_t k = 0; (k < n) && (project(next(r),u) > project(r,u)); ++k) r = next(r);
+
+               if (0 == i) t = r;
+
+               for (std::size_t k = 0; (k < n) && (project(next(t),v) > project(t,v)); ++k) t = next(t);
+
+               if (0 == i) l = t;
+
+               for (std::size_t k = 0; (k < n) && (project(next(l),u) < project(l,u)); ++k) l = next(l);
+
+               const T base    = project(i,u);
+               const T min_u   = project(l,u) - base;
+               const T max_u   = project(r,u) - base;
+               const T extent1 = max_u - min_u;
+               const T extent2 = project(t,v) - project(i,v);
+
+               const T measure = (eMinimumArea == criteria) ? (extent1 * extent2) : (extent1 + extent2);
+
+               if (measure < best_measure)
+               {
+                  best_measure = measure;
+                  best_obb     = make_obb(hull_[i] + u * (T(0.5) * (min_u + max_u)) + v * (T(0.5) * extent2),
+                                          u,
+                                          T(0.5) * extent1,
+                                          T(0.5) * extent2);
+               }
+            }
+
+            return best_obb;
+         }
+
+         polygon<T,2> hull_;
+      };
+
+      template <typename T>
+      struct polygon_diameter< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         polygon_diameter(InputIterator begin, InputIterator end, segment<T,2>& diameter)
+         {
+            diameter = rotating_calipers< point2d<T> >(begin,end).diameter();
+         }
+      };
+
+      template <typename T>
+      struct polygon_width< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         polygon_width(InputIterator begin, InputIterator end, T& width)
+         {
+            width = rotating_calipers< point2d<T> >(begin,end).width();
+         }
+      };
+
+      template <typename T>
+      struct antipodal_pairs< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator, typename OutputIterator>
+         antipodal_pairs(InputIterator begin, InputIterator end, OutputIterator out)
+         {
+            rotating_calipers< point2d<T> >(begin,end).antipodal_pairs(out);
+         }
+      };
+
+      template <typename T>
+      struct minimum_area_enclosing_rectangle< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         minimum_area_enclosing_rectangle(InputIterator begin, InputIterator end, obb<T,2>& rectangle)
+         {
+            rectangle = rotating_calipers< point2d<T> >(begin,end).minimum_area_rectangle();
+         }
+      };
+
+      template <typename T>
+      struct minimum_area_enclosing_rectangle_with_ch_filter< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         minimum_area_enclosing_rectangle_with_ch_filter(InputIterator begin, InputIterator end, obb<T,2>& rectangle)
+         {
+            std::vector< point2d<T> > convex_hull;
+
+            convex_hull_graham_scan< point2d<T> >(begin,end,std::back_inserter(convex_hull));
+
+            minimum_area_enclosing_rectangle< point2d<T> >(convex_hull.begin(),convex_hull.end(),rectangle);
+         }
+      };
+
+      template <typename T>
+      struct minimum_perimeter_enclosing_rectangle< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         minimum_perimeter_enclosing_rectangle(InputIterator begin, InputIterator end, obb<T,2>& rectangle)
+         {
+            rectangle = rotating_calipers< point2d<T> >(begin,end).minimum_perimeter_rectangle();
+         }
+      };
+
+      template <typename T>
+      struct minimum_perimeter_enclosing_rectangle_with_ch_filter< point2d<T> >
+      {
+      public:
+
+         template <typename InputIterator>
+         minimum_perimeter_enclosing_rectangle_with_ch_filter(InputIterator begin, InputIterator end, obb<T,2>& rectangle)
+         {
+            std::vector< point2d<T> > convex_hull;
+
+            convex_hull_graham_scan< point2d<T> >(begin,end,std::back_inserter(convex_hull));
+
+            minimum_perimeter_enclosing_rectangle< point2d<T> >(convex_hull.begin(),convex_hull.end(),rectangle);
+         }
+      };
+
+   } // namespace wykobi::algorithm
+
+} // namespace wykobi
@@ -0,0 +1,288 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi.hpp"
+#include "wykobi_algorithm.hpp"
+
+
+namespace wykobi
+{
+   namespace algorithm
+   {
+      /*
+        Note: Objects must be convex. An instance is intended to be
+              kept per object pair, the axis that last separated the
+              pair is tried first on the following query, which under
+              frame-to-frame coherence usually rejects after a single
+              projection.
+      */
+
+      template <typename T>
+      struct separating_axis_test< point2d<T> >
+      {
+      public:
+
+         separating_axis_test()
+         : axis_(make_vector(T(1.0),T(0.0))),
+           cached_(false)
+         {}
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool operator()(const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            if (cached_ && separated(axis_,object1,object2))
+               return false;
+
+            if (
+                 find_separating_axis(object1,object1,object2) ||
+                 find_separating_axis(object2,object1,object2)
+               )
+               return false;
+
+            cached_ = false;
+
+            return true;
+         }
+
+         inline bool               cached         () const { return cached_; }
+         inline const vector2d<T>& separating_axis() const { return axis_;   }
+         inline void               reset          ()       { cached_ = false; }
+
+      private:
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool separated(const vector2d<T>& axis, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            T min1 = T(0.0);
+            T max1 = T(0.0);
+            T min2 = T(0.0);
+            T max2 = T(0.0);
+
+            project_onto_axis(object1,axis,min1,max1);
+            project_onto_axis(object2,axis,min2,max2);
+
+            if ((max1 < min2) || (max2 < min1))
+            {
+               axis_   = axis;
+               cached_ = true;
+
+               return true;
+            }
+
+            return false;
+         }
+
+         template <typename Source, typename ConvexObject1, typename ConvexObject2>
+         bool vertex_edge_normals(const Source& source, const std::size_t point_count,
+                                  const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            if (point_count < 2)
+               return false;
+
+            std::size_t j = point_count - 1;
+
+            for (std::size_t i = 0; i < point_count; ++i)
+            {
+               if (separated(make_vector(source[j].y - source[i].y, source[i].x - source[j].x),object1,object2))
+                  return true;
+
+               j = i;
+            }
+
+            return false;
+         }
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool find_separating_axis(const triangle<T,2>& source, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            return vertex_edge_normals(source,triangle<T,2>::PointCount,object1,object2);
+         }
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool find_separating_axis(const quadix<T,2>& source, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            return vertex_edge_normals(source,quadix<T,2>::PointCount,object1,object2);
+         }
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool find_separating_axis(const polygon<T,2>& source, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            return vertex_edge_normals(source,source.size(),object1,object2);
+         }
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool find_separating_axis(const rectangle<T>&, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            return separated(make_vector(T(1.0),T(0.0)),object1,object2) ||
+                   separated(make_vector(T(0.0),T(1.0)),object1,object2);
+         }
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool find_separating_axis(const obb<T,2>& source, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            return separated(source.axis[0],object1,object2) ||
+                   separated(source.axis[1],object1,object2);
+         }
+
+         vector2d<T> axis_;
+         bool        cached_;
+      };
+
+      template <typename T>
+      struct separating_axis_test< point3d<T> >
+      {
+      public:
+
+         separating_axis_test()
+         : axis_(make_vector(T(1.0),T(0.0),T(0.0))),
+           cached_(false)
+         {}
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool operator()(const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            if (cached_ && separated(axis_,object1,object2))
+               return false;
+
+            axis_set set1;
+            axis_set set2;
+
+            generate_axis_set(object1,set1);
+            generate_axis_set(object2,set2);
+
+            for (std::size_t i = 0; i < set1.face_count; ++i)
+            {
+               if (separated(set1.face[i],object1,object2))
+                  return false;
+            }
+
+            for (std::size_t i = 0; i < set2.face_count; ++i)
+            {
+               if (separated(set2.face[i],object1,object2))
+                  return false;
+            }
+
+            for (std::size_t i = 0; i < set1.edge_count; ++i)
+            {
+               for (std::size_t j = 0; j < set2.edge_count; ++j)
+               {
+                  const vector3d<T> axis = set1.edge[i] * set2.edge[j];
+
+                  /* Near parallel edges, relative to the edge lengths so the test is scale free. */
+                  if (dot_product(axis,axis) <= (T(Epsilon) * dot_product(set1.edge[i],set1.edge[i]) * dot_product(set2.edge[j],set2.edge[j])))
+                     continue;
+
+                  if (separated(axis,object1,object2))
+                     return false;
+               }
+            }
+
+            cached_ = false;
+
+            return true;
+         }
+
+         inline bool               cached         () const { return cached_; }
+         inline const vector3d<T>& separating_axis() const { return axis_;   }
+         inline void               reset          ()       { cached_ = false; }
+
+      private:
+
+         struct axis_set
+         {
+            axis_set() : face_count(0), edge_count(0) {}
+
+            vector3d<T> face[4];
+            vector3d<T> edge[3];
+            std::size_t face_count;
+            std::size_t edge_count;
+         };
+
+         template <typename ConvexObject1, typename ConvexObject2>
+         bool separated(const vector3d<T>& axis, const ConvexObject1& object1, const ConvexObject2& object2)
+         {
+            T min1 = T(0.0);
+            T max1 = T(0.0);
+            T min2 = T(0.0);
+            T max2 = T(0.0);
+
+            project_onto_axis(object1,axis,min1,max1);
+            project_onto_axis(object2,axis,min2,max2);
+
+            if ((max1 < min2) || (max2 < min1))
+            {
+               axis_   = axis;
+               cached_ = true;
+
+               return true;
+            }
+
+            return false;
+         }
+
+         void generate_axis_set(const obb<T,3>& obb, axis_set& set)
+         {
+            for (std::size_t i = 0; i < wykobi::obb<T,3>::AxisCount; ++i)
+            {
+               set.face[i] = obb.axis[i];
+               set.edge[i] = obb.axis[i];
+            }
+
+            set.face_count = 3;
+            set.edge_count = 3;
+         }
+
+         void generate_axis_set(const box<T,3>&, axis_set& set)
+         {
+            set.face[0] = set.edge[0] = make_vector(T(1.0),T(0.0),T(0.0));
+            set.face[1] = set.edge[1] = make_vector(T(0.0),T(1.0),T(0.0));
+            set.face[2] = set.edge[2] = make_vector(T(0.0),T(0.0),T(1.0));
+
+            set.face_count = 3;
+            set.edge_count = 3;
+         }
+
+         void generate_axis_set(const triangle<T,3>& triangle, axis_set& set)
+         {
+            set.edge[0] = triangle[1] - triangle[0];
+            set.edge[1] = triangle[2] - triangle[1];
+            set.edge[2] = triangle[0] - triangle[2];
+            set.face[0] = set.edge[0] * set.edge[1];
+
+            /*
+               In-plane edge normals. For coplanar objects every edge cross
+               product is parallel to the face normal, so these are the only
+               axes that can separate them.
+            */
+            set.face[1] = set.face[0] * set.edge[0];
+            set.face[2] = set.face[0] * set.edge[1];
+            set.face[3] = set.face[0] * set.edge[2];
+
+            set.face_count = 4;
+            set.edge_count = 3;
+         }
+
+         vector3d<T> axis_;
+         bool        cached_;
+      };
+
+   } // namespace wykobi::algorithm
+
+} // namespace wykobi
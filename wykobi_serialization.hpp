@@ -0,0 +1,1293 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_SERIALIZATION
+#define INCLUDE_WYKOBI_SERIALIZATION
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "wykobi.hpp"
+#include "wykobi_format.hpp"
+
+
+namespace wykobi
+{
+   /*
+      OGC simple feature geometry types, numbered as in WKB. The Z, M and
+      ZM variants are carried as separate flags by well_known_geometry.
+   */
+   enum WellKnownType {
+                         eWKUnknown            = 0,
+                         eWKPoint              = 1,
+                         eWKLineString         = 2,
+                         eWKPolygon            = 3,
+                         eWKMultiPoint         = 4,
+                         eWKMultiLineString    = 5,
+                         eWKMultiPolygon       = 6,
+                         eWKGeometryCollection = 7
+                      };
+
+   template <typename T> class wkb_reader;
+   template <typename T> class wkt_reader;
+
+   namespace detail
+   {
+      template <typename T> struct is_double         { enum { value = 0 }; };
+      template <>           struct is_double<double> { enum { value = 1 }; };
+
+      inline bool host_little_endian()
+      {
+         const unsigned int one = 1;
+         unsigned char byte = 0;
+         std::memcpy(&byte,&one,1);
+         return (1 == byte);
+      }
+
+      inline unsigned long load_wkb_uint32(const unsigned char* data, const bool& little_endian)
+      {
+         if (little_endian)
+            return (static_cast<unsigned long>(data[0])      ) | (static_cast<unsigned long>(data[1]) <<  8) |
+                   (static_cast<unsigned long>(data[2]) << 16) | (static_cast<unsigned long>(data[3]) << 24);
+         else
+            return (static_cast<unsigned long>(data[3])      ) | (static_cast<unsigned long>(data[2]) <<  8) |
+                   (static_cast<unsigned long>(data[1]) << 16) | (static_cast<unsigned long>(data[0]) << 24);
+      }
+
+      inline double load_wkb_double(const unsigned char* data, const bool& swap)
+      {
+         unsigned char byte[sizeof(double)];
+         std::memcpy(byte,data,sizeof(double));
+
+         if (swap)
+         {
+            std::reverse(byte,byte + sizeof(double));
+         }
+
+         double value = 0.0;
+         std::memcpy(&value,byte,sizeof(double));
+         return value;
+      }
+
+      /* Text is parsed at double precision (or wider) then narrowed, so floats underflow to zero rather than fail. */
+      template <typename T> struct parse_type              { typedef double      type; };
+      template <>           struct parse_type<long double> { typedef long double type; };
+
+      #ifndef WYKOBI_CHARCONV
+      /* Length of word (lower case) if text starts with it in either case, otherwise zero. */
+      inline std::size_t match_word(const char* text, const char* word)
+      {
+         std::size_t i = 0;
+
+         for ( ; '\0' != word[i]; ++i)
+         {
+            if ((text[i] != word[i]) && (text[i] != (word[i] - ('a' - 'A'))))
+               return 0;
+         }
+
+         return i;
+      }
+      #endif
+
+      template <typename T>
+      inline bool parse_number(const char*& cursor, const char* end, T& value)
+      {
+         if ((cursor != end) && ('+' == *cursor))
+            ++cursor;
+
+         #ifdef WYKOBI_CHARCONV
+         typename parse_type<T>::type result_value = 0;
+         const std::from_chars_result result = std::from_chars(cursor,end,result_value);
+
+         if (std::errc() != result.ec)
+            return false;
+
+         cursor = result.ptr;
+         value  = T(result_value);
+         return true;
+         #else
+         char buffer[64];
+         std::size_t length = 0;
+
+         while (
+                 ((cursor + length) != end) && (length < (sizeof(buffer) - 1)) &&
+                 (std::strchr("0123456789+-.eEinfatyINFATY",cursor[length]) && ('\0' != cursor[length]))
+               )
+         {
+            buffer[length] = cursor[length];
+            ++length;
+         }
+
+         buffer[length] = '\0';
+
+         typedef typename parse_type<T>::type parse_value_type;
+
+         const std::size_t sign = ('-' == buffer[0]) ? 1 : 0;
+         parse_value_type result_value = 0;
+         std::size_t consumed = 0;
+
+         if ((0 != (consumed = match_word(buffer + sign,"infinity"))) || (0 != (consumed = match_word(buffer + sign,"inf"))))
+            result_value = std::numeric_limits<parse_value_type>::infinity();
+         else if (0 != (consumed = match_word(buffer + sign,"nan")))
+            result_value = std::numeric_limits<parse_value_type>::quiet_NaN();
+
+         if (0 != consumed)
+         {
+            consumed += sign;
+
+            if (sign)
+               result_value = -result_value;
+         }
+         else
+         {
+            /* The classic locale fixes the decimal point, strtod would follow the global C locale. */
+            std::istringstream stream(std::string(buffer,length));
+            stream.imbue(std::locale::classic());
+
+            if (!(stream >> result_value))
+               return false;
+
+            consumed = stream.eof() ? length : static_cast<std::size_t>(stream.tellg());
+         }
+
+         cursor += consumed;
+         value   = T(result_value);
+         return true;
+         #endif
+      }
+
+   } // namespace wykobi::detail
+
+   /*
+      One point, linestring or polygon produced by wkb_reader or
+      wkt_reader. Multi geometries and collections are flattened into
+      their members; record() identifies the top level geometry a member
+      belongs to. Points and linestrings have a single ring, polygons
+      have their exterior ring first followed by any interior rings.
+
+      A geometry read from WKB refers directly into the reader's input
+      buffer and remains valid only as long as that buffer does. Reusing
+      one geometry object across calls to next() reuses its storage.
+   */
+   template <typename T>
+   class well_known_geometry
+   {
+   public:
+
+      well_known_geometry()
+      : type_     (eWKUnknown),
+        dimension_(2),
+        has_z_    (false),
+        has_m_    (false),
+        data_     (0),
+        swap_     (false),
+        record_   (0)
+      {}
+
+      inline WellKnownType type      () const { return type_;              }
+      inline std::size_t   dimension () const { return dimension_;         }
+      inline bool          has_z     () const { return has_z_;             }
+      inline bool          has_m     () const { return has_m_;             }
+      inline std::size_t   record    () const { return record_;            }
+      inline std::size_t   ring_count() const { return ring_size_.size();  }
+
+      inline std::size_t size(const std::size_t& ring = 0) const
+      {
+         return (ring < ring_size_.size()) ? ring_size_[ring] : 0;
+      }
+
+      inline bool empty() const
+      {
+         return (0 == size(0));
+      }
+
+      /* k-th ordinate (x, y, then z and/or m) of a vertex. */
+      inline T ordinate(const std::size_t& index, const std::size_t& k, const std::size_t& ring = 0) const
+      {
+         if (0 != data_)
+            return T(detail::load_wkb_double(data_ + ring_offset_[ring] + sizeof(double) * (index * dimension_ + k),swap_));
+         else
+            return coordinate_[ring_offset_[ring] + (index * dimension_) + k];
+      }
+
+      inline point2d<T> vertex(const std::size_t& index, const std::size_t& ring = 0) const
+      {
+         return make_point(ordinate(index,0,ring),ordinate(index,1,ring));
+      }
+
+      inline point3d<T> vertex3d(const std::size_t& index, const std::size_t& ring = 0) const
+      {
+         return make_point(ordinate(index,0,ring),ordinate(index,1,ring),(has_z_ ? ordinate(index,2,ring) : T(0.0)));
+      }
+
+      /* Vertex count of a ring without the closing vertex repeated by polygon rings. */
+      inline std::size_t open_size(const std::size_t& ring = 0) const
+      {
+         const std::size_t count = size(ring);
+
+         if ((eWKPolygon == type_) && (count > 1))
+         {
+            const point2d<T> first = vertex(0,ring);
+            const point2d<T> last  = vertex(count - 1,ring);
+
+            if ((first.x == last.x) && (first.y == last.y))
+               return count - 1;
+         }
+
+         return count;
+      }
+
+      /*
+         Non-owning view of a ring (excluding a polygon ring's closing
+         vertex) directly over the coordinate storage. WKB input can only
+         be viewed when T is double and the byte order matches the host,
+         otherwise false is returned and the ring has to be copied.
+      */
+      inline bool view(polygon_view<T,2>& view_, const std::size_t& ring = 0) const
+      {
+         if (ring >= ring_size_.size())
+            return false;
+
+         if (0 != data_)
+         {
+            if (swap_ || !detail::is_double<T>::value)
+               return false;
+
+            view_ = polygon_view<T,2>(static_cast<const T*>(static_cast<const void*>(data_ + ring_offset_[ring])),
+                                      open_size(ring),
+                                      dimension_ * sizeof(T));
+         }
+         else if (0 == ring_size_[ring])
+            view_ = polygon_view<T,2>();
+         else
+            view_ = polygon_view<T,2>(&coordinate_[ring_offset_[ring]],open_size(ring),dimension_ * sizeof(T));
+
+         return true;
+      }
+
+   private:
+
+      friend class wkb_reader<T>;
+      friend class wkt_reader<T>;
+
+      inline void reset(const WellKnownType& type, const bool& has_z, const bool& has_m,
+                        const unsigned char* data, const bool& swap, const std::size_t& record)
+      {
+         type_      = type;
+         has_z_     = has_z;
+         has_m_     = has_m;
+         dimension_ = 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+         data_      = data;
+         swap_      = swap;
+         record_    = record;
+         ring_offset_.clear();
+         ring_size_  .clear();
+         coordinate_ .clear();
+      }
+
+      inline void add_ring(const std::size_t& offset, const std::size_t& count)
+      {
+         ring_offset_.push_back(offset);
+         ring_size_  .push_back(count);
+      }
+
+      WellKnownType            type_;
+      std::size_t              dimension_;
+      bool                     has_z_;
+      bool                     has_m_;
+      const unsigned char*     data_;
+      bool                     swap_;
+      std::size_t              record_;
+      std::vector<std::size_t> ring_offset_;
+      std::vector<std::size_t> ring_size_;
+      std::vector<T>           coordinate_;
+   };
+
+   /*
+      Streaming WKB reader over a buffer holding one or more concatenated
+      geometries. Accepts both byte orders, ISO (1000/2000/3000 offsets)
+      and extended (high bit flags, optional SRID) dimension encodings.
+      Coordinates are not copied, only the ring offsets of the current
+      geometry are recorded, so memory use is independent of input size.
+   */
+   template <typename T>
+   class wkb_reader
+   {
+   public:
+
+      wkb_reader(const unsigned char* data, const std::size_t& size)
+      : data_    (data),
+        size_    (size),
+        position_(0),
+        record_  (0),
+        failed_  (false),
+        host_little_endian_(detail::host_little_endian())
+      {}
+
+      /*
+         Advances to the next point, linestring or polygon. Returns false
+         at the end of the input, or on malformed input in which case
+         failed() is set and position() is where parsing stopped.
+      */
+      inline bool next(well_known_geometry<T>& geometry)
+      {
+         while (!failed_)
+         {
+            if (!pending_.empty())
+            {
+               if (0 == pending_.back())
+               {
+                  pending_.pop_back();
+
+                  if (pending_.empty())
+                     ++record_;
+
+                  continue;
+               }
+
+               --pending_.back();
+            }
+            else if (position_ >= size_)
+               return false;
+
+            WellKnownType type  = eWKUnknown;
+            bool          has_z = false;
+            bool          has_m = false;
+            bool          little_endian = true;
+
+            if (!read_header(type,has_z,has_m,little_endian))
+               break;
+
+            if (type >= eWKMultiPoint)
+            {
+               unsigned long count = 0;
+
+               if ((pending_.size() >= max_depth) || !read_uint32(count,little_endian))
+                  break;
+
+               pending_.push_back(count);
+               continue;
+            }
+
+            geometry.reset(type,has_z,has_m,data_,little_endian != host_little_endian_,record_);
+
+            if (!read_body(geometry,little_endian))
+               break;
+
+            if (pending_.empty())
+               ++record_;
+
+            return true;
+         }
+
+         failed_ = true;
+         return false;
+      }
+
+      inline bool        failed  () const { return failed_;   }
+      inline std::size_t position() const { return position_; }
+
+   private:
+
+      enum { max_depth = 32 };
+
+      inline bool read_header(WellKnownType& type, bool& has_z, bool& has_m, bool& little_endian)
+      {
+         if ((size_ - position_) < 5)
+            return false;
+
+         const unsigned char order = data_[position_];
+
+         if (order > 1)
+            return false;
+
+         little_endian = (1 == order);
+
+         unsigned long code = detail::load_wkb_uint32(data_ + position_ + 1,little_endian);
+         position_ += 5;
+
+         has_z = (0 != (code & 0x80000000UL));
+         has_m = (0 != (code & 0x40000000UL));
+
+         if (0 != (code & 0x20000000UL))
+         {
+            unsigned long srid = 0;
+
+            if (!read_uint32(srid,little_endian))
+               return false;
+         }
+
+         code &= 0x0FFFFFFFUL;
+
+         switch (code / 1000)
+         {
+            case 0 :                            break;
+            case 1 : has_z = true;              break;
+            case 2 : has_m = true;              break;
+            case 3 : has_z = true; has_m = true; break;
+            default: return false;
+         }
+
+         code %= 1000;
+
+         if ((code < eWKPoint) || (code > eWKGeometryCollection))
+            return false;
+
+         type = static_cast<WellKnownType>(code);
+         return true;
+      }
+
+      inline bool read_uint32(unsigned long& value, const bool& little_endian)
+      {
+         if ((size_ - position_) < 4)
+            return false;
+
+         value = detail::load_wkb_uint32(data_ + position_,little_endian);
+         position_ += 4;
+         return true;
+      }
+
+      inline bool read_ring(well_known_geometry<T>& geometry, const std::size_t& count)
+      {
+         const std::size_t vertex_size = geometry.dimension_ * sizeof(double);
+
+         if (count > ((size_ - position_) / vertex_size))
+            return false;
+
+         geometry.add_ring(position_,count);
+         position_ += count * vertex_size;
+         return true;
+      }
+
+      inline bool read_body(well_known_geometry<T>& geometry, const bool& little_endian)
+      {
+         if (eWKPoint == geometry.type_)
+         {
+            if (!read_ring(geometry,1))
+               return false;
+
+            /* An empty point is encoded with NaN coordinates. */
+            const double x = detail::load_wkb_double(data_ + geometry.ring_offset_[0]                 ,geometry.swap_);
+            const double y = detail::load_wkb_double(data_ + geometry.ring_offset_[0] + sizeof(double),geometry.swap_);
+
+            if ((x != x) && (y != y))
+               geometry.ring_size_[0] = 0;
+
+            return true;
+         }
+
+         unsigned long count = 0;
+
+         if (!read_uint32(count,little_endian))
+            return false;
+
+         if (eWKLineString == geometry.type_)
+            return read_ring(geometry,count);
+
+         if (count > ((size_ - position_) / 4))
+            return false;
+
+         for (unsigned long i = 0; i < count; ++i)
+         {
+            unsigned long ring_size = 0;
+
+            if (!read_uint32(ring_size,little_endian) || !read_ring(geometry,ring_size))
+               return false;
+         }
+
+         return true;
+      }
+
+      const unsigned char*       data_;
+      std::size_t                size_;
+      std::size_t                position_;
+      std::size_t                record_;
+      bool                       failed_;
+      bool                       host_little_endian_;
+      std::vector<unsigned long> pending_;
+   };
+
+   /*
+      Streaming WKT reader over a character range holding one or more
+      whitespace separated geometries. Keywords are case insensitive, Z,
+      M and ZM tags and an EWKT "SRID=n;" prefix are accepted, untagged
+      3 and 4 ordinate coordinates are read as Z and ZM. Coordinates of
+      the current geometry are parsed into the geometry's own storage.
+   */
+   template <typename T>
+   class wkt_reader
+   {
+   public:
+
+      wkt_reader(const char* begin, const char* end)
+      : begin_ (begin),
+        cursor_(begin),
+        end_   (end),
+        record_(0),
+        failed_(false)
+      {}
+
+      wkt_reader(const std::string& text)
+      : begin_ (text.data()),
+        cursor_(text.data()),
+        end_   (text.data() + text.size()),
+        record_(0),
+        failed_(false)
+      {}
+
+      /* As wkb_reader::next. */
+      inline bool next(well_known_geometry<T>& geometry)
+      {
+         while (!failed_)
+         {
+            skip_space();
+
+            WellKnownType type   = eWKUnknown;
+            unsigned int  layout = 0;
+
+            if (stack_.empty())
+            {
+               if (cursor_ == end_)
+                  return false;
+
+               if (!read_tag(type,layout))
+                  break;
+            }
+            else
+            {
+               level& top = stack_.back();
+
+               if (consume(')'))
+               {
+                  stack_.pop_back();
+
+                  if (stack_.empty())
+                     ++record_;
+
+                  continue;
+               }
+
+               if (!top.first && !consume(','))
+                  break;
+
+               top.first = false;
+               skip_space();
+
+               if (eWKGeometryCollection == top.type)
+               {
+                  if (!read_tag(type,layout))
+                     break;
+               }
+               else
+               {
+                  type   = static_cast<WellKnownType>(top.type - 3);
+                  layout = top.layout;
+               }
+            }
+
+            if (type >= eWKMultiPoint)
+            {
+               if (read_empty())
+               {
+                  if (stack_.empty())
+                     ++record_;
+
+                  continue;
+               }
+
+               if ((stack_.size() >= max_depth) || !consume('('))
+                  break;
+
+               stack_.push_back(level(type,layout));
+               continue;
+            }
+
+            geometry.reset(type,(0 != (layout & z_flag)),(0 != (layout & m_flag)),0,false,record_);
+
+            if (!read_body(geometry,layout))
+               break;
+
+            if (stack_.empty())
+               ++record_;
+
+            return true;
+         }
+
+         failed_ = true;
+         return false;
+      }
+
+      inline bool        failed  () const { return failed_;                                    }
+      inline std::size_t position() const { return static_cast<std::size_t>(cursor_ - begin_); }
+
+   private:
+
+      enum { max_depth = 32, z_flag = 1, m_flag = 2, tagged_flag = 4 };
+
+      struct level
+      {
+         level(const WellKnownType& t, const unsigned int& l) : type(t), layout(l), first(true) {}
+
+         WellKnownType type;
+         unsigned int  layout;
+         bool          first;
+      };
+
+      inline void skip_space()
+      {
+         while ((cursor_ != end_) && ((' ' == *cursor_) || ('\t' == *cursor_) || ('\n' == *cursor_) || ('\r' == *cursor_)))
+         {
+            ++cursor_;
+         }
+      }
+
+      inline bool consume(const char& c)
+      {
+         skip_space();
+
+         if ((cursor_ != end_) && (c == *cursor_))
+         {
+            ++cursor_;
+            return true;
+         }
+
+         return false;
+      }
+
+      /* Upper cased run of letters, at most 31 characters are kept. */
+      inline std::size_t read_word(char* word)
+      {
+         skip_space();
+
+         std::size_t length = 0;
+
+         while ((cursor_ != end_) && (((*cursor_ >= 'A') && (*cursor_ <= 'Z')) || ((*cursor_ >= 'a') && (*cursor_ <= 'z'))))
+         {
+            if (length < 31)
+            {
+               word[length++] = (*cursor_ >= 'a') ? static_cast<char>(*cursor_ - ('a' - 'A')) : *cursor_;
+            }
+
+            ++cursor_;
+         }
+
+         word[length] = '\0';
+         return length;
+      }
+
+      inline bool read_empty()
+      {
+         skip_space();
+
+         const char* mark = cursor_;
+         char word[32];
+
+         if ((5 == read_word(word)) && (0 == std::strcmp(word,"EMPTY")))
+            return true;
+
+         cursor_ = mark;
+         return false;
+      }
+
+      inline bool read_tag(WellKnownType& type, unsigned int& layout)
+      {
+         static const char* const name[] = {
+                                              "POINT", "LINESTRING", "POLYGON",
+                                              "MULTIPOINT", "MULTILINESTRING", "MULTIPOLYGON",
+                                              "GEOMETRYCOLLECTION"
+                                           };
+         char word[32];
+
+         if ((4 == read_word(word)) && (0 == std::strcmp(word,"SRID")))
+         {
+            if (!consume('='))
+               return false;
+
+            while ((cursor_ != end_) && (';' != *cursor_))
+            {
+               ++cursor_;
+            }
+
+            if (!consume(';'))
+               return false;
+
+            read_word(word);
+         }
+
+         type = eWKUnknown;
+
+         for (std::size_t i = 0; i < 7; ++i)
+         {
+            if (0 == std::strcmp(word,name[i]))
+            {
+               type = static_cast<WellKnownType>(i + 1);
+               break;
+            }
+         }
+
+         if (eWKUnknown == type)
+            return false;
+
+         const char* mark = cursor_;
+
+         read_word(word);
+
+         if      (0 == std::strcmp(word,"Z" )) layout = tagged_flag | z_flag;
+         else if (0 == std::strcmp(word,"M" )) layout = tagged_flag | m_flag;
+         else if (0 == std::strcmp(word,"ZM")) layout = tagged_flag | z_flag | m_flag;
+         else
+         {
+            layout  = 0;
+            cursor_ = mark;
+         }
+
+         return true;
+      }
+
+      /* One coordinate tuple, untagged geometries take their layout from the first tuple. */
+      inline bool read_tuple(well_known_geometry<T>& geometry, unsigned int& layout)
+      {
+         std::size_t count = 0;
+         T value[4];
+
+         for ( ; ; )
+         {
+            skip_space();
+
+            if ((cursor_ == end_) || (',' == *cursor_) || (')' == *cursor_))
+               break;
+
+            if ((count == 4) || !detail::parse_number(cursor_,end_,value[count]))
+               return false;
+
+            ++count;
+         }
+
+         if (0 == (layout & tagged_flag))
+         {
+            if ((count < 2) || (count > 4))
+               return false;
+
+            layout = tagged_flag | ((count > 2) ? z_flag : 0) | ((count > 3) ? m_flag : 0);
+            geometry.has_z_     = (count > 2);
+            geometry.has_m_     = (count > 3);
+            geometry.dimension_ = count;
+         }
+         else if (count != geometry.dimension_)
+            return false;
+
+         geometry.coordinate_.insert(geometry.coordinate_.end(),value,value + count);
+         return true;
+      }
+
+      inline bool read_sequence(well_known_geometry<T>& geometry, unsigned int& layout)
+      {
+         if (!consume('('))
+            return false;
+
+         const std::size_t offset = geometry.coordinate_.size();
+
+         do
+         {
+            if (!read_tuple(geometry,layout))
+               return false;
+         }
+         while (consume(','));
+
+         if (!consume(')'))
+            return false;
+
+         geometry.add_ring(offset,(geometry.coordinate_.size() - offset) / geometry.dimension_);
+         return true;
+      }
+
+      inline bool read_body(well_known_geometry<T>& geometry, unsigned int layout)
+      {
+         if (read_empty())
+         {
+            if (eWKPolygon != geometry.type_)
+               geometry.add_ring(0,0);
+
+            return true;
+         }
+
+         switch (geometry.type_)
+         {
+            case eWKPoint :
+            {
+               skip_space();
+
+               /* Multipoint members may omit their parentheses. */
+               if ((cursor_ != end_) && ('(' != *cursor_))
+               {
+                  if (!read_tuple(geometry,layout))
+                     return false;
+
+                  geometry.add_ring(0,1);
+                  return true;
+               }
+
+               return read_sequence(geometry,layout) && (1 == geometry.size(0));
+            }
+
+            case eWKLineString : return read_sequence(geometry,layout);
+
+            case eWKPolygon :
+            {
+               if (!consume('('))
+                  return false;
+
+               do
+               {
+                  if (!read_sequence(geometry,layout))
+                     return false;
+               }
+               while (consume(','));
+
+               return consume(')');
+            }
+
+            default : return false;
+         }
+      }
+
+      const char*        begin_;
+      const char*        cursor_;
+      const char*        end_;
+      std::size_t        record_;
+      bool               failed_;
+      std::vector<level> stack_;
+   };
+
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, point2d<T>& point)
+   {
+      if ((eWKPoint != geometry.type()) || geometry.empty())
+         return false;
+
+      point = geometry.vertex(0);
+      return true;
+   }
+
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, point3d<T>& point)
+   {
+      if ((eWKPoint != geometry.type()) || geometry.empty())
+         return false;
+
+      point = geometry.vertex3d(0);
+      return true;
+   }
+
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, segment<T,2>& segment)
+   {
+      if ((eWKLineString != geometry.type()) || (2 != geometry.size()))
+         return false;
+
+      segment[0] = geometry.vertex(0);
+      segment[1] = geometry.vertex(1);
+      return true;
+   }
+
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, segment<T,3>& segment)
+   {
+      if ((eWKLineString != geometry.type()) || (2 != geometry.size()))
+         return false;
+
+      segment[0] = geometry.vertex3d(0);
+      segment[1] = geometry.vertex3d(1);
+      return true;
+   }
+
+   /* A polygon ring (exterior by default) or the vertices of a linestring. */
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, polygon<T,2>& polygon, const std::size_t& ring = 0)
+   {
+      if (((eWKPolygon != geometry.type()) && (eWKLineString != geometry.type())) || (ring >= geometry.ring_count()))
+         return false;
+
+      const std::size_t count = geometry.open_size(ring);
+
+      polygon.clear();
+      polygon.reserve(count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         polygon.push_back(geometry.vertex(i,ring));
+      }
+
+      return true;
+   }
+
+   template <typename T>
+   inline bool assign(const well_known_geometry<T>& geometry, polygon<T,3>& polygon, const std::size_t& ring = 0)
+   {
+      if (((eWKPolygon != geometry.type()) && (eWKLineString != geometry.type())) || (ring >= geometry.ring_count()))
+         return false;
+
+      const std::size_t count = geometry.open_size(ring);
+
+      polygon.clear();
+      polygon.reserve(count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         polygon.push_back(geometry.vertex3d(i,ring));
+      }
+
+      return true;
+   }
+
+   /*
+      Geometry type and coordinate dimension written for each primitive.
+      Triangles, quadixes, rectangles and polygons are written as single
+      ring polygons, segments as two vertex linestrings.
+   */
+   template <typename Geometry> struct well_known_traits;
+
+   template <typename T> struct well_known_traits< point2d<T>         > { enum { type = eWKPoint,      dimension = 2 }; };
+   template <typename T> struct well_known_traits< point3d<T>         > { enum { type = eWKPoint,      dimension = 3 }; };
+   template <typename T> struct well_known_traits< segment<T,2>       > { enum { type = eWKLineString, dimension = 2 }; };
+   template <typename T> struct well_known_traits< segment<T,3>       > { enum { type = eWKLineString, dimension = 3 }; };
+   template <typename T> struct well_known_traits< triangle<T,2>      > { enum { type = eWKPolygon,    dimension = 2 }; };
+   template <typename T> struct well_known_traits< triangle<T,3>      > { enum { type = eWKPolygon,    dimension = 3 }; };
+   template <typename T> struct well_known_traits< quadix<T,2>        > { enum { type = eWKPolygon,    dimension = 2 }; };
+   template <typename T> struct well_known_traits< quadix<T,3>        > { enum { type = eWKPolygon,    dimension = 3 }; };
+   template <typename T> struct well_known_traits< rectangle<T>       > { enum { type = eWKPolygon,    dimension = 2 }; };
+   template <typename T> struct well_known_traits< polygon<T,2>       > { enum { type = eWKPolygon,    dimension = 2 }; };
+   template <typename T> struct well_known_traits< polygon<T,3>       > { enum { type = eWKPolygon,    dimension = 3 }; };
+   template <typename T> struct well_known_traits< polygon_view<T,2>  > { enum { type = eWKPolygon,    dimension = 2 }; };
+   template <typename T> struct well_known_traits< polygon_view<T,3>  > { enum { type = eWKPolygon,    dimension = 3 }; };
+
+   namespace detail
+   {
+      template <typename OutputIterator>
+      inline OutputIterator write_wkb_uint32(const unsigned long& value, OutputIterator out)
+      {
+         *out++ = static_cast<unsigned char>((value      ) & 0xFF);
+         *out++ = static_cast<unsigned char>((value >>  8) & 0xFF);
+         *out++ = static_cast<unsigned char>((value >> 16) & 0xFF);
+         *out++ = static_cast<unsigned char>((value >> 24) & 0xFF);
+         return out;
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_double(const T& value, OutputIterator out)
+      {
+         const double d = static_cast<double>(value);
+         unsigned char byte[sizeof(double)];
+         std::memcpy(byte,&d,sizeof(double));
+
+         if (!host_little_endian())
+         {
+            std::reverse(byte,byte + sizeof(double));
+         }
+
+         return std::copy(byte,byte + sizeof(double),out);
+      }
+
+      template <typename OutputIterator>
+      inline OutputIterator write_wkb_header(const unsigned long& type, const std::size_t& dimension, OutputIterator out)
+      {
+         *out++ = static_cast<unsigned char>(1);
+         return write_wkb_uint32(type + ((3 == dimension) ? 1000 : 0),out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_vertex(const point2d<T>& point, OutputIterator out)
+      {
+         out = write_wkb_double(point.x,out);
+         return write_wkb_double(point.y,out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_vertex(const point3d<T>& point, OutputIterator out)
+      {
+         out = write_wkb_double(point.x,out);
+         out = write_wkb_double(point.y,out);
+         return write_wkb_double(point.z,out);
+      }
+
+      /* Closed ring of any indexable vertex sequence, an empty sequence gives an empty polygon. */
+      template <typename Sequence, typename OutputIterator>
+      inline OutputIterator write_wkb_polygon_body(const Sequence& sequence, const std::size_t& count, OutputIterator out)
+      {
+         if (0 == count)
+            return write_wkb_uint32(0,out);
+
+         out = write_wkb_uint32(1,out);
+         out = write_wkb_uint32(static_cast<unsigned long>(count + 1),out);
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            out = write_wkb_vertex(sequence[i],out);
+         }
+
+         return write_wkb_vertex(sequence[0],out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const point2d<T>& point, OutputIterator out) { return write_wkb_vertex(point,out); }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const point3d<T>& point, OutputIterator out) { return write_wkb_vertex(point,out); }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const segment<T,Dimension>& segment, OutputIterator out)
+      {
+         out = write_wkb_uint32(2,out);
+         out = write_wkb_vertex(segment[0],out);
+         return write_wkb_vertex(segment[1],out);
+      }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const triangle<T,Dimension>& triangle, OutputIterator out) { return write_wkb_polygon_body(triangle,3,out); }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const quadix<T,Dimension>& quadix, OutputIterator out) { return write_wkb_polygon_body(quadix,4,out); }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const rectangle<T>& rectangle, OutputIterator out)
+      {
+         const point2d<T> corner[] = {
+                                        make_point(rectangle[0].x,rectangle[0].y),
+                                        make_point(rectangle[1].x,rectangle[0].y),
+                                        make_point(rectangle[1].x,rectangle[1].y),
+                                        make_point(rectangle[0].x,rectangle[1].y)
+                                     };
+
+         return write_wkb_polygon_body(corner,4,out);
+      }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const polygon<T,Dimension>& polygon, OutputIterator out) { return write_wkb_polygon_body(polygon,polygon.size(),out); }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkb_body(const polygon_view<T,Dimension>& polygon, OutputIterator out) { return write_wkb_polygon_body(polygon,polygon.size(),out); }
+
+   } // namespace wykobi::detail
+
+   /*
+      Writes a geometry as little endian ISO WKB (3D primitives use the Z
+      types) to an output iterator of bytes, e.g. std::back_inserter on a
+      std::vector<unsigned char>.
+   */
+   template <typename Geometry, typename OutputIterator>
+   inline OutputIterator write_wkb(const Geometry& geometry, OutputIterator out)
+   {
+      typedef well_known_traits<Geometry> traits;
+      out = detail::write_wkb_header(traits::type,traits::dimension,out);
+      return detail::write_wkb_body(geometry,out);
+   }
+
+   /* Writes a range of one primitive type as the corresponding multi geometry. */
+   template <typename InputIterator, typename OutputIterator>
+   inline OutputIterator write_wkb(InputIterator begin, InputIterator end, OutputIterator out)
+   {
+      typedef well_known_traits<typename std::iterator_traits<InputIterator>::value_type> traits;
+      out = detail::write_wkb_header(traits::type + 3,traits::dimension,out);
+      out = detail::write_wkb_uint32(static_cast<unsigned long>(std::distance(begin,end)),out);
+
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         out = write_wkb(*it,out);
+      }
+
+      return out;
+   }
+
+   namespace detail
+   {
+      template <typename OutputIterator>
+      inline OutputIterator write_wkt_text(const char* text, OutputIterator out)
+      {
+         while ('\0' != *text)
+         {
+            *out++ = *text++;
+         }
+
+         return out;
+      }
+
+      template <typename OutputIterator>
+      inline OutputIterator write_wkt_tag(const unsigned int& type, const std::size_t& dimension, OutputIterator out)
+      {
+         static const char* const name[] = {
+                                              "POINT", "LINESTRING", "POLYGON",
+                                              "MULTIPOINT", "MULTILINESTRING", "MULTIPOLYGON",
+                                              "GEOMETRYCOLLECTION"
+                                           };
+
+         out = write_wkt_text(name[type - 1],out);
+         return write_wkt_text(((3 == dimension) ? " Z " : " "),out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_number(const T& value, OutputIterator out)
+      {
+         char buffer[64];
+         return std::copy(buffer,format_number(buffer,buffer + sizeof(buffer),value),out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_vertex(const point2d<T>& point, OutputIterator out)
+      {
+         out    = write_wkt_number(point.x,out);
+         *out++ = ' ';
+         return write_wkt_number(point.y,out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_vertex(const point3d<T>& point, OutputIterator out)
+      {
+         out    = write_wkt_number(point.x,out);
+         *out++ = ' ';
+         out    = write_wkt_number(point.y,out);
+         *out++ = ' ';
+         return write_wkt_number(point.z,out);
+      }
+
+      template <typename Sequence, typename OutputIterator>
+      inline OutputIterator write_wkt_polygon_body(const Sequence& sequence, const std::size_t& count, OutputIterator out)
+      {
+         if (0 == count)
+            return write_wkt_text("EMPTY",out);
+
+         out = write_wkt_text("((",out);
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            out = write_wkt_vertex(sequence[i],out);
+            out = write_wkt_text(", ",out);
+         }
+
+         out = write_wkt_vertex(sequence[0],out);
+         return write_wkt_text("))",out);
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const point2d<T>& point, OutputIterator out)
+      {
+         *out++ = '(';
+         out    = write_wkt_vertex(point,out);
+         *out++ = ')';
+         return out;
+      }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const point3d<T>& point, OutputIterator out)
+      {
+         *out++ = '(';
+         out    = write_wkt_vertex(point,out);
+         *out++ = ')';
+         return out;
+      }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const segment<T,Dimension>& segment, OutputIterator out)
+      {
+         *out++ = '(';
+         out    = write_wkt_vertex(segment[0],out);
+         out    = write_wkt_text(", ",out);
+         out    = write_wkt_vertex(segment[1],out);
+         *out++ = ')';
+         return out;
+      }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const triangle<T,Dimension>& triangle, OutputIterator out) { return write_wkt_polygon_body(triangle,3,out); }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const quadix<T,Dimension>& quadix, OutputIterator out) { return write_wkt_polygon_body(quadix,4,out); }
+
+      template <typename T, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const rectangle<T>& rectangle, OutputIterator out)
+      {
+         const point2d<T> corner[] = {
+                                        make_point(rectangle[0].x,rectangle[0].y),
+                                        make_point(rectangle[1].x,rectangle[0].y),
+                                        make_point(rectangle[1].x,rectangle[1].y),
+                                        make_point(rectangle[0].x,rectangle[1].y)
+                                     };
+
+         return write_wkt_polygon_body(corner,4,out);
+      }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const polygon<T,Dimension>& polygon, OutputIterator out) { return write_wkt_polygon_body(polygon,polygon.size(),out); }
+
+      template <typename T, std::size_t Dimension, typename OutputIterator>
+      inline OutputIterator write_wkt_body(const polygon_view<T,Dimension>& polygon, OutputIterator out) { return write_wkt_polygon_body(polygon,polygon.size(),out); }
+
+   } // namespace wykobi::detail
+
+   /*
+      Writes a geometry as WKT to an output iterator of characters, e.g.
+      std::back_inserter on a std::string or std::ostreambuf_iterator.
+      Coordinates are written with the shortest representation that
+      reads back exactly when <charconv> is available (C++17), otherwise
+      with enough significant digits to round trip.
+   */
+   template <typename Geometry, typename OutputIterator>
+   inline OutputIterator write_wkt(const Geometry& geometry, OutputIterator out)
+   {
+      typedef well_known_traits<Geometry> traits;
+      out = detail::write_wkt_tag(traits::type,traits::dimension,out);
+      return detail::write_wkt_body(geometry,out);
+   }
+
+   /* Writes a range of one primitive type as the corresponding multi geometry. */
+   template <typename InputIterator, typename OutputIterator>
+   inline OutputIterator write_wkt(InputIterator begin, InputIterator end, OutputIterator out)
+   {
+      typedef well_known_traits<typename std::iterator_traits<InputIterator>::value_type> traits;
+      out = detail::write_wkt_tag(traits::type + 3,traits::dimension,out);
+
+      if (begin == end)
+         return detail::write_wkt_text("EMPTY",out);
+
+      *out++ = '(';
+
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         if (it != begin)
+            out = detail::write_wkt_text(", ",out);
+
+         out = detail::write_wkt_body(*it,out);
+      }
+
+      *out++ = ')';
+      return out;
+   }
+
+} // namespace wykobi
+
+#endif
@@ -0,0 +1,638 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_TRANSFORMS
+#define INCLUDE_WYKOBI_TRANSFORMS
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Rotation, translation, scaling, mirroring, affine transforms and
+      minkowski sums/differences.
+   */
+
+   template <typename T>
+   WYKOBI_INLINE T vertical_mirror(const T& angle);
+
+   template <typename T>
+   WYKOBI_INLINE T horizontal_mirror(const T& angle);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_of_reflection(const T& sx1, const T& sy1,
+                                   const T& sx2, const T& sy2,
+                                   const T& p1x, const T& p1y,
+                                   const T& p2x, const T& p2y,
+                                         T& rpx,       T& rpy);
+
+   template <typename T>
+   WYKOBI_INLINE bool point_of_reflection(const segment<T,2>& segment,
+                                   const point2d<T>&   point1,
+                                   const point2d<T>&   point2,
+                                         point2d<T>&   reflection_point);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> reverse_segment(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> reverse_segment(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_parallel_line_on_point(const line<T,2>& line, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,3> create_parallel_line_on_point(const line<T,3>& line, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> create_parallel_segment_on_point(const line<T,2>& line, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> create_parallel_segment_on_point(const line<T,3>& line, const point3d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE void mirror(const T& px, const T& py,
+                      const T& x1, const T& y1,
+                      const T& x2, const T& y2,
+                            T& nx,       T& ny);
+
+   template <typename T>
+   WYKOBI_INLINE void mirror(const T& px, const T& py, const T& pz,
+                      const T& x1, const T& y1, const T& z1,
+                      const T& x2, const T& y2, const T& z2,
+                            T& nx,       T& ny,       T& nz);
+
+   template <typename T> WYKOBI_INLINE point2d<T> mirror(const point2d<T>& point, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> mirror(const segment<T,2>& segment, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE line<T,2> mirror(const line<T,2>& line, const wykobi::line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> mirror(const rectangle<T>& rectangle, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> mirror(const triangle<T,2>& triangle, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> mirror(const quadix<T,2>& quadix, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE circle<T> mirror(const circle<T>& circle, const line<T,2>& mirror_axis);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> mirror(const polygon<T,2,Allocator>& polygon, const line<T,2>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE point3d<T> mirror(const point3d<T>& point, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> mirror(const segment<T,3>& segment, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE line<T,3> mirror(const line<T,3>& line, const wykobi::line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE box<T,3> mirror(const box<T,3>& box, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> mirror(const triangle<T,3>& triangle, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> mirror(const quadix<T,3>& quadix, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE sphere<T> mirror(const sphere<T>& sphere, const line<T,3>& mirror_axis);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> mirror(const polygon<T,3,Allocator>& polygon, const line<T,3>& mirror_axis);
+
+   template <typename T> WYKOBI_INLINE point3d<T> mirror(const point3d<T>& point, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> mirror(const segment<T,3>& segment, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE line<T,3> mirror(const line<T,3>& line, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE box<T,3> mirror(const box<T,3>& box, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> mirror(const triangle<T,3>& triangle, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> mirror(const quadix<T,3>& quadix, const plane<T,3>& mirror_plane);
+
+   template <typename T> WYKOBI_INLINE sphere<T> mirror(const sphere<T>& sphere, const plane<T,3>& mirror_plane);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> mirror(const polygon<T,3,Allocator>& polygon, const plane<T,3>& mirror_plane);
+
+   template <typename T>
+   WYKOBI_INLINE void nonsymmetric_mirror(const T& px, const T& py,
+                                   const T& x1, const T& y1,
+                                   const T& x2, const T& y2,
+                                   const T& ratio,
+                                         T& nx,       T& ny);
+
+   template <typename T> WYKOBI_INLINE point2d<T> nonsymmetric_mirror(const point2d<T>& point, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> nonsymmetric_mirror(const segment<T,2>& segment, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> nonsymmetric_mirror(const rectangle<T>& rectangle, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> nonsymmetric_mirror(const triangle<T,2>& triangle, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> nonsymmetric_mirror(const quadix<T,2>& quadix, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE circle<T> nonsymmetric_mirror(const circle<T>& circle, const T& ratio, const line<T,2>& line);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> nonsymmetric_mirror(const polygon<T,2,Allocator>& polygon, const T& ratio, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE point3d<T> nonsymmetric_mirror(const point3d<T>& point, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> nonsymmetric_mirror(const segment<T,3>& segment, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE box<T,3> nonsymmetric_mirror(const box<T,3>& box, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> nonsymmetric_mirror(const triangle<T,3>& triangle, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> nonsymmetric_mirror(const quadix<T,3>& quadix, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE circle<T> nonsymmetric_mirror(const sphere<T>& sphere, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> nonsymmetric_mirror(const polygon<T,3,Allocator>& polygon, const T& ratio, const plane<T,3>& plane);
+
+   template <typename T> WYKOBI_INLINE point2d<T> invert_point(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> invert_point(const point3d<T>& point, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE point2d<T> antipodal_point(const point2d<T>& point, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> antipodal_point(const point3d<T>& point, const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE point2d<T> minkowski_sum(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix1, const quadix<T,2>& quadix2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const circle<T>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const rectangle<T>& rectangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_sum(const polygon<T,2>& polygon1, const polygon<T,2>& polygon2);
+
+   template <typename T> WYKOBI_INLINE point2d<T> minkowski_difference(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix1, const quadix<T,2>& quadix2);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const circle<T>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const rectangle<T>& rectangle, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> minkowski_difference(const polygon<T,2>& polygon1, const polygon<T,2>& polygon2);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> center_at_location(const segment<T,2>& segment, const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> center_at_location(const segment<T,3>& segment, const T& x, const T& y, const T& z);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> center_at_location(const triangle<T,2>& triangle, const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> center_at_location(const rectangle<T>& rectangle, const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE box<T,3> center_at_location(const box<T,3>& box, const T& x, const T& y, const T& z);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> center_at_location(const quadix<T,2>& quadix, const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE circle<T> center_at_location(const circle<T>& circle, const T& x, const T& y);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> center_at_location(const polygon<T,2,Allocator>& polygon, const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> center_at_location(const segment<T,2>& segment, const point2d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> center_at_location(const segment<T,3>& segment, const point3d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> center_at_location(const triangle<T,2>& triangle, const point2d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> center_at_location(const rectangle<T>& rectangle, const point2d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE box<T,3> center_at_location(const box<T,3>& box, const point3d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> center_at_location(const quadix<T,2>& quadix, const point2d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE circle<T> center_at_location(const circle<T>& circle, const point2d<T>& center_point);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> center_at_location(const polygon<T,2,Allocator>& polygon, const point2d<T>& center_point);
+
+   template <typename T> WYKOBI_INLINE void shorten_segment(T& x1, T& y1, T& x2, T& y2, const T& amount);
+
+   template <typename T> WYKOBI_INLINE void shorten_segment(T& x1, T& y1, T& z1, T& x2, T& y2, T& z2, const T& amount);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> shorten_segment(const segment<T,2>& segment, const T& amount);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> shorten_segment(const segment<T,3>& segment, const T& amount);
+
+   template <typename T> WYKOBI_INLINE void lengthen_segment(T& x1, T& y1, T& x2, T& y2, const T& amount);
+
+   template <typename T> WYKOBI_INLINE void lengthen_segment(T& x1, T& y1, T& z1, T& x2, T& y2, T& z2, const T& amount);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> lengthen_segment(const segment<T,2>& segment, const T& amount);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> lengthen_segment(const segment<T,3>& segment, const T& amount);
+
+   template <typename T> WYKOBI_INLINE void rotate(const T& rotation_angle, const T& x, const T& y, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void rotate(const T& rotation_angle, const T& x, const T& y, const T& ox, const T& oy, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE point2d<T> rotate(const T& rotation_angle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point2d<T> rotate(const T& rotation_angle, const point2d<T>& point, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> rotate(const T& rotation_angle, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> rotate(const T& rotation_angle, const segment<T,2>& segment, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> rotate(const T& rotation_angle, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> rotate(const T& rotation_angle, const triangle<T,2>& triangle, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> rotate(const T& rotation_angle, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> rotate(const T& rotation_angle, const quadix<T,2>& quadix, const point2d<T>& opoint);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> rotate(const T& rotation_angle, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> rotate(const T& rotation_angle, const polygon<T,2,Allocator>& polygon, const point2d<T>& opoint);
+   template <typename T> WYKOBI_INLINE void rotate(const T& rx, const T& ry, const T& rz, const T& x, const T& y, const T& z, T& nx, T& ny, T& nz);
+   template <typename T> WYKOBI_INLINE void rotate(const T& rx, const T& ry, const T& rz, const T& x, const T& y, const T& z, const T& ox, const T& oy, const T& oz, T& nx, T& ny, T& nz);
+   template <typename T> WYKOBI_INLINE point3d<T> rotate(const T& rx, const T& ry, const T& rz, const point3d<T>& point);
+   template <typename T> WYKOBI_INLINE point3d<T> rotate(const T& rx, const T& ry, const T& rz, const point3d<T>& point, const point3d<T>& opoint);
+   template <typename T> WYKOBI_INLINE segment<T,3> rotate(const T& rx, const T& ry, const T& rz, const segment<T,3>& segment);
+   template <typename T> WYKOBI_INLINE segment<T,3> rotate(const T& rx, const T& ry, const T& rz, const segment<T,3>& segment, const point3d<T>& opoint);
+   template <typename T> WYKOBI_INLINE triangle<T,3> rotate(const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle);
+   template <typename T> WYKOBI_INLINE triangle<T,3> rotate(const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle, const point3d<T>& opoint);
+   template <typename T> WYKOBI_INLINE quadix<T,3> rotate(const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix);
+   template <typename T> WYKOBI_INLINE quadix<T,3> rotate(const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix, const point3d<T>& opoint);
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> rotate(const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon);
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> rotate(const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon, const point3d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                                                 const int rotation_angle,
+                                                 const T& x, const T& y, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                                                 const int rotation_angle,
+                                                 const T& x, const T& y, const T& ox, const T& oy, T& nx, T& ny);
+
+   template <typename T> WYKOBI_INLINE point2d<T> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point2d<T> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const point2d<T>& point, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const segment<T,2>& segment, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const triangle<T,2>& triangle, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const quadix<T,2>& quadix, const point2d<T>& opoint);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_luts<T>& lut, const int rotation_angle, const polygon<T,2,Allocator>& polygon, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                                                 const int rx, const int ry, const int rz,
+                                                 const T& x, const T& y, const T& z, T& nx, T& ny, T& nz);
+
+   template <typename T> WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                                                 const int rx, const int ry, const int rz,
+                                                 const T& x, const T& y, const T& z, const T& ox, const T& oy, const T& oz, T& nx, T& ny, T& nz);
+
+   template <typename T> WYKOBI_INLINE point3d<T> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point3d<T> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const point3d<T>& point, const point3d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const segment<T,3>& segment, const point3d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const triangle<T,3>& triangle, const point3d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const quadix<T,3>& quadix, const point3d<T>& opoint);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_luts<T>& lut, const int rx, const int ry, const int rz, const polygon<T,3,Allocator>& polygon, const point3d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                                                                         const T& rotation_angle,
+                                                                         const T& x, const T& y, T& nx, T& ny);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                                                                         const T& rotation_angle,
+                                                                         const T& x, const T& y, const T& ox, const T& oy, T& nx, T& ny);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE point2d<T> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const point2d<T>& point);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE point2d<T> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const point2d<T>& point, const point2d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE segment<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const segment<T,2>& segment);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE segment<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const segment<T,2>& segment, const point2d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const triangle<T,2>& triangle);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const triangle<T,2>& triangle, const point2d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const quadix<T,2>& quadix);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const quadix<T,2>& quadix, const point2d<T>& opoint);
+
+   template <typename T, std::size_t Resolution, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T, std::size_t Resolution, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_table<T,Resolution>& lut, const T& rotation_angle, const polygon<T,2,Allocator>& polygon, const point2d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                                                                         const T& rx, const T& ry, const T& rz,
+                                                                         const T& x, const T& y, const T& z, T& nx, T& ny, T& nz);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                                                                         const T& rx, const T& ry, const T& rz,
+                                                                         const T& x, const T& y, const T& z, const T& ox, const T& oy, const T& oz, T& nx, T& ny, T& nz);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE point3d<T> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const point3d<T>& point);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE point3d<T> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const point3d<T>& point, const point3d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE segment<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const segment<T,3>& segment);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE segment<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const segment<T,3>& segment, const point3d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle, const point3d<T>& opoint);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix);
+
+   template <typename T, std::size_t Resolution> WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix, const point3d<T>& opoint);
+
+   template <typename T, std::size_t Resolution, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T, std::size_t Resolution, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_table<T,Resolution>& lut, const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon, const point3d<T>& opoint);
+
+
+   template <typename T> WYKOBI_INLINE point2d<T> translate(const T& dx, const T& dy, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,2> translate(const T& dx, const T& dy, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> translate(const T& dx, const T& dy, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> translate(const T& dx, const T& dy, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> translate(const T& dx, const T& dy, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> translate(const T& dx, const T& dy, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE circle<T> translate(const T& dx, const T& dy, const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> translate(const T& dx, const T& dy, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point2d<T> translate(const T& delta, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,2> translate(const T& delta, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> translate(const T& delta, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> translate(const T& delta, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> translate(const T& delta, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> translate(const T& delta, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE circle<T> translate(const T& delta, const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> translate(const T& delta, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point2d<T> translate(const vector2d<T>& v, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,2> translate(const vector2d<T>& v, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> translate(const vector2d<T>& v, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> translate(const vector2d<T>& v, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> translate(const vector2d<T>& v, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> translate(const vector2d<T>& v, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE circle<T> translate(const vector2d<T>& v, const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> translate(const vector2d<T>& v, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point3d<T> translate(const T& dx, const T& dy, const T& dz, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,3> translate(const T& dx, const T& dy, const T& dz, const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> translate(const T& dx, const T& dy, const T& dz, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> translate(const T& dx, const T& dy, const T& dz, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> translate(const T& dx, const T& dy, const T& dz, const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE box<T,3> translate(const T& dx, const T& dy, const T& dz, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE sphere<T> translate(const T& dx, const T& dy, const T& dz, const sphere<T>& sphere);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> translate(const T& dx, const T& dy, const T& dz, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point3d<T> translate(const T& delta, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,3> translate(const T& delta, const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> translate(const T& delta, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> translate(const T& delta, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> translate(const T& delta, const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE box<T,3> translate(const T& delta, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE sphere<T> translate(const T& delta, const sphere<T>& sphere);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> translate(const T& delta, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point3d<T> translate(const vector3d<T>& v, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,3> translate(const vector3d<T>& v, const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> translate(const vector3d<T>& v, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> translate(const vector3d<T>& v, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> translate(const vector3d<T>& v, const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE box<T,3> translate(const vector3d<T>& v, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE sphere<T> translate(const vector3d<T>& v, const sphere<T>& sphere);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> translate(const vector3d<T>& v, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point2d<T> scale(const T& dx, const T& dy, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,2> scale(const T& dx, const T& dy, const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> scale(const T& dx, const T& dy, const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> scale(const T& dx, const T& dy, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> scale(const T& dx, const T& dy, const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> scale(const T& dx, const T& dy, const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE circle<T> scale(const T& dr, const circle<T>& circle);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator> scale(const T& dx, const T& dy, const polygon<T,2,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE point3d<T> scale(const T& dx, const T& dy, const T& dz, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE line<T,3> scale(const T& dx, const T& dy, const T& dz, const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> scale(const T& dx, const T& dy, const T& dz, const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> scale(const T& dx, const T& dy, const T& dz, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> scale(const T& dx, const T& dy, const T& dz, const quadix<T,3>& quadix);
+
+   template <typename T> WYKOBI_INLINE box<T,3> scale(const T& dx, const T& dy, const T& dz, const box<T,3>& box);
+
+   template <typename T> WYKOBI_INLINE sphere<T> scale(const T& dr, const sphere<T>& sphere);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator> scale(const T& dx, const T& dy, const T& dz, const polygon<T,3,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> identity_affine2d();
+
+   template <typename T> WYKOBI_INLINE affine3d<T> identity_affine3d();
+
+   template <typename T> WYKOBI_INLINE affine2d<T> make_translation(const T& dx, const T& dy);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> make_translation(const vector2d<T>& v);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_translation(const T& dx, const T& dy, const T& dz);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_translation(const vector3d<T>& v);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> make_scaling(const T& dx, const T& dy);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_scaling(const T& dx, const T& dy, const T& dz);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> make_rotation(const T& rotation_angle);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> make_rotation(const T& rotation_angle, const point2d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_rotation(const T& rx, const T& ry, const T& rz);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_rotation(const T& rx, const T& ry, const T& rz, const point3d<T>& opoint);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> make_rotation(const T& rotation_angle, const vector3d<T>& axis);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> operator*(const affine2d<T>& affine1, const affine2d<T>& affine2);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> operator*(const affine3d<T>& affine1, const affine3d<T>& affine2);
+
+   template <typename T> WYKOBI_INLINE affine2d<T> inverse(const affine2d<T>& affine);
+
+   template <typename T> WYKOBI_INLINE affine3d<T> inverse(const affine3d<T>& affine);
+
+   template <typename T> WYKOBI_INLINE point2d<T>    transform(const affine2d<T>& affine, const point2d<T>&    point);
+
+   template <typename T> WYKOBI_INLINE segment<T,2>  transform(const affine2d<T>& affine, const segment<T,2>&  segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> transform(const affine2d<T>& affine, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2>   transform(const affine2d<T>& affine, const quadix<T,2>&   quadix);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,2,Allocator>  transform(const affine2d<T>& affine, const polygon<T,2,Allocator>&  polygon);
+
+   template <typename T> WYKOBI_INLINE point3d<T>    transform(const affine3d<T>& affine, const point3d<T>&    point);
+
+   template <typename T> WYKOBI_INLINE segment<T,3>  transform(const affine3d<T>& affine, const segment<T,3>&  segment);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> transform(const affine3d<T>& affine, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3>   transform(const affine3d<T>& affine, const quadix<T,3>&   quadix);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE polygon<T,3,Allocator>  transform(const affine3d<T>& affine, const polygon<T,3,Allocator>&  polygon);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, point2d<T>&    point);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, segment<T,2>&  segment);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, quadix<T,2>&   quadix);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, polygon<T,2,Allocator>&  polygon);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, point3d<T>&    point);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, segment<T,3>&  segment);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, quadix<T,3>&   quadix);
+
+   template <typename T, typename Allocator> WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, polygon<T,3,Allocator>&  polygon);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void transform(const affine2d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void transform(const affine3d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out);
+
+   template <typename T, typename Iterator>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, const Iterator begin, const Iterator end);
+
+   template <typename T, typename Iterator>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, const Iterator begin, const Iterator end);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const circle<T>& circle, const unsigned int point_count = 360);
+
+} // wykobi namespace
+
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.hpp"
+#include "wykobi_measures.hpp"
+#include "wykobi_intersection.hpp"
+#include "wykobi_transforms.inl"
+
+#endif
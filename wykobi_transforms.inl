@@ -0,0 +1,3455 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_transforms.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE T vertical_mirror(const T& angle)
+   {
+      if (
+           is_equal(angle,   T(0.0)) ||
+           is_equal(angle, T(180.0)) ||
+           is_equal(angle, T(360.0))
+         )
+         return angle;
+
+      return (T(360.0) - angle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T horizontal_mirror(const T& angle)
+   {
+      if (angle <= T(180.0))
+         return (T(180.0) - angle);
+      else
+         return (T(540.0) - angle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_of_reflection(const T& sx1, const T& sy1,
+                                   const T& sx2, const T& sy2,
+                                   const T& p1x, const T& p1y,
+                                   const T& p2x, const T& p2y,
+                                         T& rpx,       T& rpy)
+   {
+      if (
+           (!collinear (sx1, sy1, sx2, sy2, p1x, p1y)) &&
+           (!collinear (sx1, sy1, sx2, sy2, p2x, p2y)) &&
+           (
+             orientation(sx1, sy1, sx2, sy2, p1x, p1y) ==
+             orientation(sx1, sy1, sx2, sy2, p2x, p2y)
+           )
+         )
+      {
+         T   ix = T(0.0);
+         T   iy = T(0.0);
+         T p1px = T(0.0);
+         T p1py = T(0.0);
+         T p2px = T(0.0);
+         T p2py = T(0.0);
+
+         closest_point_on_line_from_point(sx1, sy1, sx2, sy2, p1x, p1y, p1px, p1py);
+         closest_point_on_line_from_point(sx1, sy1, sx2, sy2, p2x, p2y, p2px, p2py);
+
+         intersect(p1x,p1y,p2px,p2py,p2x,p2y,p1px,p1py,ix,iy);
+
+         closest_point_on_line_from_point(sx1,sy1,sx2,sy2,ix,iy,rpx,rpy);
+
+         if (is_point_collinear(sx1,sy1,sx2,sy2,rpx,rpy))
+         {
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool point_of_reflection(const segment<T,2>& segment,
+                                   const point2d<T>&   point1,
+                                   const point2d<T>&   point2,
+                                         point2d<T>&   reflection_point)
+   {
+      return point_of_reflection(      segment[0].x,       segment[0].y,
+                                       segment[1].x,       segment[1].y,
+                                           point1.x,           point1.y,
+                                           point2.x,           point2.y,
+                                 reflection_point.x, reflection_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> reverse_segment(const segment<T,2>& segment)
+   {
+      return make_segment(segment[1],segment[0]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> reverse_segment(const segment<T,3>& segment)
+   {
+      return make_segment(segment[1],segment[0]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_parallel_line_on_point(const line<T,2>& line, const point2d<T>& point)
+   {
+      return make_line(point, point + (line[1] - line[0]));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> create_parallel_line_on_point(const line<T,3>& line, const point3d<T>& point)
+   {
+      return make_line(point, point + (line[1] - line[0]));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> create_parallel_segment_on_point(const line<T,2>& line, const point2d<T>& point)
+   {
+      return make_segment(point, point + (line[1] - line[0]));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> create_parallel_segment_on_point(const line<T,3>& line, const point3d<T>& point)
+   {
+      return make_segment(point, point + (line[1] - line[0]));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void mirror(const T& px, const T& py,
+                      const T& x1, const T& y1,
+                      const T& x2, const T& y2,
+                            T& nx,       T& ny)
+   {
+      closest_point_on_line_from_point(x1,y1,x2,y2,px,py,nx,ny);
+
+      nx = px + T(2.0) * (nx - px);
+      ny = py + T(2.0) * (ny - py);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void mirror(const T& px, const T& py, const T& pz,
+                      const T& x1, const T& y1, const T& z1,
+                      const T& x2, const T& y2, const T& z2,
+                            T& nx,       T& ny,       T& nz)
+   {
+      closest_point_on_line_from_point(x1,y1,z1,x2,y2,z2,px,py,pz,nx,ny,nz);
+
+      nx = px + T(2.0) * (nx - px);
+      ny = py + T(2.0) * (ny - py);
+      nz = pz + T(2.0) * (nz - pz);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> mirror(const point2d<T>& point, const line<T,2>& mirror_axis)
+   {
+      wykobi::point2d<T> point_;
+
+      mirror(point.x,          point.y,
+             mirror_axis[0].x, mirror_axis[0].y,
+             mirror_axis[1].x, mirror_axis[1].y,
+             point_.x,         point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> mirror(const segment<T,2>& segment, const line<T,2>& mirror_axis)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = mirror(segment[i],mirror_axis);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> mirror(const line<T,2>& line, const wykobi::line<T,2>& mirror_axis)
+   {
+      wykobi::line<T,2> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,2>::PointCount; ++i)
+      {
+         line_[i] = mirror(line[i],mirror_axis);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> mirror(const rectangle<T>& rectangle, const line<T,2>& mirror_axis)
+   {
+      wykobi::rectangle<T> rectangle_;
+
+      for (std::size_t i = 0; i < wykobi::rectangle<T>::PointCount; ++i)
+      {
+         rectangle_[i] = mirror(rectangle[i],mirror_axis);
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> mirror(const triangle<T,2>& triangle, const line<T,2>& mirror_axis)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = mirror(triangle[i],mirror_axis);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> mirror(const quadix<T,2>& quadix, const line<T,2>& mirror_axis)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = mirror(quadix[i],mirror_axis);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> mirror(const circle<T>& circle, const line<T,2>& mirror_axis)
+   {
+      wykobi::circle<T> circle_ = circle;
+
+      mirror(circle.x,         circle.y,
+             mirror_axis[0].x, mirror_axis[0].y,
+             mirror_axis[1].x, mirror_axis[1].y,
+             circle_.x,        circle_.y);
+
+      return circle_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> mirror(const polygon<T,2,Allocator>& polygon, const line<T,2>& mirror_axis)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(mirror(polygon[i],mirror_axis));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> mirror(const point3d<T>& point, const line<T,3>& mirror_axis)
+   {
+      wykobi::point3d<T> point_;
+
+      mirror(point.x,          point.y,
+             mirror_axis[0].x, mirror_axis[0].y,
+             mirror_axis[1].x, mirror_axis[1].y,
+             point_.x,         point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> mirror(const segment<T,3>& segment, const line<T,3>& mirror_axis)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = mirror(segment[i],mirror_axis);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> mirror(const line<T,3>& line, const wykobi::line<T,3>& mirror_axis)
+   {
+      wykobi::line<T,3> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,3>::PointCount; ++i)
+      {
+         line_[i] = mirror(line[i],mirror_axis);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> mirror(const box<T,3>& box, const line<T,3>& mirror_axis)
+   {
+      wykobi::box<T,3> box_;
+
+      for (std::size_t i = 0; i < wykobi::box<T,3>::PointCount; ++i)
+      {
+         box_[i] = mirror(box[i],mirror_axis);
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> mirror(const triangle<T,3>& triangle, const line<T,3>& mirror_axis)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = mirror(triangle[i],mirror_axis);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> mirror(const quadix<T,3>& quadix, const line<T,3>& mirror_axis)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = mirror(quadix[i],mirror_axis);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> mirror(const sphere<T>& sphere, const line<T,3>& mirror_axis)
+   {
+      wykobi::sphere<T> sphere_ = sphere;
+
+      mirror(sphere.x,         sphere.y,         sphere.z,
+             mirror_axis[0].x, mirror_axis[0].y, mirror_axis[0].z,
+             mirror_axis[1].x, mirror_axis[1].y, mirror_axis[1].z,
+             sphere_.x,        sphere_.y,        sphere_.z);
+
+      return sphere_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> mirror(const polygon<T,3,Allocator>& polygon, const line<T,3>& mirror_axis)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(mirror(polygon[i],mirror_axis));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> mirror(const point3d<T>& point, const plane<T,3>& plane)
+   {
+      return point + T(2.0) * closest_point_on_plane_from_point(plane,point) - point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> mirror(const segment<T,3>& segment, const plane<T,3>& plane)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = mirror(segment[i],plane);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> mirror(const line<T,3>& line, const plane<T,3>& plane)
+   {
+      wykobi::line<T,3> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,3>::PointCount; ++i)
+      {
+         line_[i] = mirror(line[i],plane);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> mirror(const box<T,3>& box, const plane<T,3>& plane)
+   {
+      wykobi::box<T,3> box_;
+
+      for (std::size_t i = 0; i < wykobi::box<T,3>::PointCount; ++i)
+      {
+         box_[i] = mirror(box[i],plane);
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> mirror(const triangle<T,3>& triangle, const plane<T,3>& plane)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = mirror(triangle[i],plane);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> mirror(const quadix<T,3>& quadix, const plane<T,3>& plane)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = mirror(quadix[i],plane);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> mirror(const sphere<T>& sphere, const plane<T,3>& plane)
+   {
+      point3d<T> center = make_point(sphere);
+      return make_sphere(mirror(center,plane),sphere.radius);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> mirror(const polygon<T,3,Allocator>& polygon, const plane<T,3>& plane)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(mirror(polygon[i],plane));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void nonsymmetric_mirror(const T& px, const T& py,
+                                   const T& x1, const T& y1,
+                                   const T& x2, const T& y2,
+                                   const T& ratio,
+                                         T& nx,       T& ny)
+   {
+      closest_point_on_line_from_point(x1, y1, x2, y2, px, py, nx, ny);
+
+      const T general_ratio = T(2.0) * ratio;
+
+      nx = px + general_ratio * (nx - px);
+      ny = py + general_ratio * (ny - py);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> nonsymmetric_mirror(const point2d<T>& point, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::point2d<T> point_;
+
+      nonsymmetric_mirror(point.x,point.y,line[0].x,line[0].y,ratio,line[1].x,line[1].y,point_.x,point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> nonsymmetric_mirror(const segment<T,2>& segment, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = nonsymmetric_mirror(segment[i],ratio,line);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> nonsymmetric_mirror(const rectangle<T>& rectangle, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::rectangle<T> rectangle_;
+
+      for (std::size_t i = 0; i < wykobi::rectangle<T>::PointCount; ++i)
+      {
+         rectangle_[i] = nonsymmetric_mirror(rectangle[i],ratio,line);
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> nonsymmetric_mirror(const triangle<T,2>& triangle, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = nonsymmetric_mirror(triangle[i],ratio,line);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> nonsymmetric_mirror(const quadix<T,2>& quadix, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = nonsymmetric_mirror(quadix[i],ratio,line);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nonsymmetric_mirror(const circle<T>& circle, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::circle<T> circle_ = circle;
+      nonsymmetric_mirror(circle.x,circle.y,line[0].x,line[0].y,line[1].x,line[1].y,ratio,circle_.x,circle_.y);
+      return circle_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> nonsymmetric_mirror(const polygon<T,2,Allocator>& polygon, const T& ratio, const line<T,2>& line)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(nonsymmetric_mirror(polygon[i],ratio,line));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> nonsymmetric_mirror(const point3d<T>& point, const T& ratio, const plane<T,3>& plane)
+   {
+      return point + T(2.0) * ratio * closest_point_on_plane_from_point(plane,point) - point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> nonsymmetric_mirror(const segment<T,3>& segment, const T& ratio, const plane<T,3>& plane)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = nonsymmetric_mirror(segment[i],ratio,plane);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> nonsymmetric_mirror(const box<T,3>& box, const T& ratio, const plane<T,3>& plane)
+   {
+      wykobi::box<T,3> box_;
+
+      for (std::size_t i = 0; i < wykobi::box<T,3>::PointCount; ++i)
+      {
+         box_[i] = nonsymmetric_mirror(box[i],ratio,plane);
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> nonsymmetric_mirror(const triangle<T,3>& triangle, const T& ratio, const plane<T,3>& plane)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = nonsymmetric_mirror(triangle[i],ratio,plane);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> nonsymmetric_mirror(const quadix<T,3>& quadix, const T& ratio, const plane<T,3>& plane)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = nonsymmetric_mirror(quadix[i],ratio,plane);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> nonsymmetric_mirror(const sphere<T>& sphere, const T& ratio, const plane<T,3>& plane)
+   {
+      point3d<T> center = make_point(sphere);
+      return make_sphere(nonsymmetric_mirror(center,ratio,plane),sphere.radius);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> nonsymmetric_mirror(const polygon<T,3,Allocator>& polygon, const T& ratio, const plane<T,3>& plane)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(nonsymmetric_mirror(polygon[i],ratio,plane));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> invert_point(const point2d<T>& point, const circle<T>& circle)
+   {
+      return project_point_t(make_point(circle),point,sqr(circle.radius) / (sqr(point.x - circle.x) + sqr(point.y - circle.y)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> invert_point(const point3d<T>& point, const sphere<T>& sphere)
+   {
+      return project_point_t
+             (
+               make_point(sphere),
+               point,
+               sqr(sphere.radius) / (sqr(point.x - sphere.x) + sqr(point.y - sphere.y) + sqr(point.z - sphere.z))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> antipodal_point(const point2d<T>& point, const circle<T>& circle)
+   {
+      return project_point_t(point,make_point(circle),T(2.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> antipodal_point(const point3d<T>& point, const sphere<T>& sphere)
+   {
+      return project_point_t(point,make_point(sphere),T(2.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> minkowski_sum(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return point1 + point2;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         point2d<T> point = rectangle_corner(rectangle1,i);
+
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_sum(point,rectangle_corner(rectangle2,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(9);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::triangle<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_sum(triangle1[i],triangle2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix1, const quadix<T,2>& quadix2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::quadix<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_sum(quadix1[i],quadix2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return minkowski_sum(make_polygon(circle1),make_polygon(circle2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const rectangle<T>& rectangle)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(12);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_sum(triangle[i],rectangle_corner(rectangle,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const quadix<T,2>& quadix)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(12);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::quadix<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_sum(triangle[i],quadix[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const triangle<T,2>& triangle, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+      polygon.reserve(1080);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_sum(triangle[i],circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+      polygon.reserve(1440);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_sum(quadix[i],circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const quadix<T,2>& quadix, const rectangle<T>& rectangle)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_sum(quadix[i],rectangle_corner(rectangle,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const rectangle<T>& rectangle, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+      polygon.reserve(1440);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_sum(rectangle_corner(rectangle,i),circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_sum(const polygon<T,2>& polygon1, const polygon<T,2>& polygon2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(polygon1.size() * polygon2.size());
+
+      for (std::size_t i = 0; i < polygon1.size(); ++i)
+      {
+         for (std::size_t j = 0; j < polygon2.size(); ++j)
+         {
+            polygon.push_back(minkowski_sum(polygon1[i],polygon2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> minkowski_difference(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return make_point(point1.x - point2.x, point1.y - point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         point2d<T> point = rectangle_corner(rectangle1,i);
+
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_difference(point,rectangle_corner(rectangle2,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(9);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::triangle<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_difference(triangle1[i],triangle2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix1, const quadix<T,2>& quadix2)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::quadix<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_difference(quadix1[i],quadix2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return minkowski_difference(make_polygon(circle1),make_polygon(circle2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const rectangle<T>& rectangle)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(12);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_difference(triangle[i],rectangle_corner(rectangle,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const quadix<T,2>& quadix)
+   {
+      polygon<T,2> polygon;
+      polygon.reserve(12);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < wykobi::quadix<T,2>::PointCount; ++j)
+         {
+            polygon.push_back(minkowski_difference(triangle[i],quadix[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const triangle<T,2>& triangle, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+
+      polygon.reserve(1080);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_difference(triangle[i],circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+
+      polygon.reserve(1440);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_difference(quadix[i],circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const quadix<T,2>& quadix, const rectangle<T>& rectangle)
+   {
+      polygon<T,2> polygon;
+
+      polygon.reserve(16);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            polygon.push_back(minkowski_difference(quadix[i],rectangle_corner(rectangle,j)));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const rectangle<T>& rectangle, const circle<T>& circle)
+   {
+      wykobi::polygon<T,2> polygon;
+      wykobi::polygon<T,2> circle_polygon = make_polygon(circle);
+
+      polygon.reserve(1440);
+
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+         for (std::size_t j = 0; j < circle_polygon.size(); ++j)
+         {
+            polygon.push_back(minkowski_difference(rectangle_corner(rectangle,i),circle_polygon[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> minkowski_difference(const polygon<T,2>& polygon1, const polygon<T,2>& polygon2)
+   {
+      polygon<T,2> polygon;
+
+      polygon.reserve(polygon1.size() * polygon2.size());
+
+      for (std::size_t i = 0; i < polygon1.size(); ++i)
+      {
+         for (std::size_t j = 0; j < polygon2.size(); ++j)
+         {
+            polygon.push_back(minkowski_difference(polygon1[i],polygon2[j]));
+         }
+      }
+
+      return polygon;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> center_at_location(const segment<T,2>& segment, const T& x, const T& y)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      segment_mid_point(segment,cx,cy);
+
+      return translate(x - cx,y - cy,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> center_at_location(const segment<T,3>& segment, const T& x, const T& y, const T& z)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+      T cz = T(0.0);
+
+      segment_mid_point(segment,cx,cy,cz);
+
+      return translate(x - cx,y - cy,z - cz,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> center_at_location(const triangle<T,2>& triangle, const T& x, const T& y)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      centroid(triangle,cx,cy);
+
+      return translate(x - cx,y - cy,triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> center_at_location(const rectangle<T>& rectangle, const T& x, const T& y)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      centroid(rectangle,cx,cy);
+
+      return translate(x - cx,y - cy,rectangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> center_at_location(const box<T,3>& box, const T& x, const T& y, const T& z)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+      T cz = T(0.0);
+
+      centroid(box,cx,cy,cz);
+
+      return translate(x - cx, y - cy, z - cz, box);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> center_at_location(const quadix<T,2>& quadix, const T& x, const T& y)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      centroid(quadix,cx,cy);
+
+      return translate(x - cx,y - cy,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> center_at_location(const circle<T>& circle, const T& x, const T& y)
+   {
+      wykobi::circle<T> circle_;
+
+      circle_.x      = x;
+      circle_.y      = y;
+      circle_.radius = circle.radius;
+
+      return circle_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> center_at_location(const polygon<T,2,Allocator>& polygon, const T& x, const T& y)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      centroid(polygon,cx,cy);
+
+      return translate(x - cx,y - cy,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> center_at_location(const segment<T,2>& segment, const point2d<T>& center_point)
+   {
+      return center_at_location(segment,center_point.x,center_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> center_at_location(const segment<T,3>& segment, const point3d<T>& center_point)
+   {
+      return center_at_location(segment,center_point.x,center_point.y,center_point.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> center_at_location(const triangle<T,2>& triangle, const point2d<T>& center_point)
+   {
+      return center_at_location(triangle,center_point.x,center_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> center_at_location(const rectangle<T>& rectangle, const point2d<T>& center_point)
+   {
+      return center_at_location(rectangle,center_point.x,center_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> center_at_location(const box<T,3>& box, const point3d<T>& center_point)
+   {
+      return center_at_location(box,center_point.x,center_point.y,center_point.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> center_at_location(const quadix<T,2>& quadix, const point2d<T>& center_point)
+   {
+      return center_at_location(quadix,center_point.x,center_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> center_at_location(const circle<T>& circle, const point2d<T>& center_point)
+   {
+      return center_at_location(circle,center_point.x,center_point.y);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> center_at_location(const polygon<T,2,Allocator>& polygon, const point2d<T>& center_point)
+   {
+      return center_at_location(polygon,center_point.x,center_point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void shorten_segment(T& x1, T& y1, T& x2, T& y2, const T& amount)
+   {
+      const T segment_length = distance(x1,y1,x2,y2);
+
+      if (segment_length < amount)
+      {
+         segment_mid_point(x1,y1,x2,y2,x1,y1);
+
+         x2 = x1;
+         y2 = y1;
+
+         return;
+      }
+
+      const T dist_ratio = amount / (2 * segment_length);
+      const T dx         = x2 - x1;
+      const T dy         = y2 - y1;
+
+      x1 = x1 + dist_ratio * dx;
+      y1 = y1 + dist_ratio * dy;
+      x2 = x2 - dist_ratio * dx;
+      y2 = y2 - dist_ratio * dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void shorten_segment(T& x1, T& y1, T& z1, T& x2, T& y2, T& z2, const T& amount)
+   {
+      const T segment_length = distance(x1,y1,x2,y2);
+
+      if (segment_length < amount)
+      {
+         segment_mid_point(x1,y1,z1,x2,y2,z2,x1,y1,z1);
+
+         x2 = x1;
+         y2 = y1;
+         z2 = y1;
+
+         return;
+      }
+
+      const T dist_ratio = amount / (2 * segment_length);
+      const T dx         = x2 - x1;
+      const T dy         = y2 - y1;
+
+      x1 = x1 + dist_ratio * dx;
+      y1 = y1 + dist_ratio * dy;
+      x2 = x2 - dist_ratio * dx;
+      y2 = y2 - dist_ratio * dy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> shorten_segment(const segment<T,2>& segment, const T& amount)
+   {
+      wykobi::segment<T,2> segment_ = segment;
+      shorten_segment(segment_[0].x,segment_[0].y,segment_[1].x,segment_[1].y,amount);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> shorten_segment(const segment<T,3>& segment, const T& amount)
+   {
+      wykobi::segment<T,3> segment_ = segment;
+      shorten_segment(segment_[0].x,segment_[0].y,segment_[0].z,segment_[1].x,segment_[1].y,segment_[1].z,amount);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void lengthen_segment(T& x1, T& y1, T& x2, T& y2, const T& amount)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      segment_mid_point(x1,y1,x2,y2,cx,cy);
+
+      const T segment_length = distance(x1,y1,x2,y2);
+      const T ratio = (amount + segment_length) / segment_length;
+
+      x1 = cx + ratio * (x1 - cx);
+      y1 = cy + ratio * (y1 - cy);
+      x2 = cx + ratio * (x2 - cx);
+      y2 = cy + ratio * (y2 - cy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void lengthen_segment(T& x1, T& y1, T& z1, T& x2, T& y2, T& z2, const T& amount)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+      T cz = T(0.0);
+
+      segment_mid_point(x1,y1,z1,x2,y2,z2,cx,cy,cz);
+
+      const T segment_length = distance(x1,y1,z1,x2,y2,z2);
+      const T ratio = (amount + segment_length) / segment_length;
+
+      x1 = cx + ratio * (x1 - cx);
+      y1 = cy + ratio * (y1 - cy);
+      z1 = cy + ratio * (z1 - cy);
+      x2 = cx + ratio * (x2 - cx);
+      y2 = cy + ratio * (y2 - cy);
+      z2 = cy + ratio * (z2 - cy);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> lengthen_segment(const segment<T,2>& segment, const T& amount)
+   {
+      wykobi::segment<T,2> segment_ = segment;
+      lengthen_segment(segment_[0].x,segment_[0].y,segment_[1].x,segment_[1].y,amount);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> lengthen_segment(const segment<T,3>& segment, const T& amount)
+   {
+      wykobi::segment<T,3> segment_ = segment;
+      lengthen_segment(segment_[0].x,segment_[0].y,segment_[0].z,segment_[1].x,segment_[1].y,segment_[1].z,amount);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void rotate(const T& rotation_angle, const T& x, const T& y, T& nx, T& ny)
+   {
+      const T sin_val = sin(rotation_angle * T(PIDiv180));
+      const T cos_val = cos(rotation_angle * T(PIDiv180));
+
+      nx = (x * cos_val) - (y * sin_val);
+      ny = (y * cos_val) + (x * sin_val);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void rotate(const T& rotation_angle, const T& x, const T& y, const T& ox, const T& oy, T& nx, T& ny)
+   {
+      rotate(rotation_angle, x - ox, y - oy, nx, ny);
+
+      nx += ox;
+      ny += oy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> rotate(const T& rotation_angle, const point2d<T>& point)
+   {
+      point2d<T> point_;
+      rotate(rotation_angle,point.x,point.y,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> rotate(const T& rotation_angle, const point2d<T>& point, const point2d<T>& opoint)
+   {
+      point2d<T> point_;
+      rotate(rotation_angle,point.x, point.y,opoint.x,opoint.y,point_.x,point_.y);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> rotate(const T& rotation_angle, const segment<T,2>& segment)
+   {
+      return transform(make_rotation(rotation_angle),segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> rotate(const T& rotation_angle, const segment<T,2>& segment, const point2d<T>& opoint)
+   {
+      return transform(make_rotation(rotation_angle,opoint),segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> rotate(const T& rotation_angle, const triangle<T,2>& triangle)
+   {
+      return transform(make_rotation(rotation_angle),triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> rotate(const T& rotation_angle, const triangle<T,2>& triangle, const point2d<T>& opoint)
+   {
+      return transform(make_rotation(rotation_angle,opoint),triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> rotate(const T& rotation_angle, const quadix<T,2>& quadix)
+   {
+      return transform(make_rotation(rotation_angle),quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> rotate(const T& rotation_angle, const quadix<T,2>& quadix, const point2d<T>& opoint)
+   {
+      return transform(make_rotation(rotation_angle,opoint),quadix);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> rotate(const T& rotation_angle, const polygon<T,2,Allocator>& polygon)
+   {
+      return transform(make_rotation(rotation_angle),polygon);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> rotate(const T& rotation_angle, const polygon<T,2,Allocator>& polygon, const point2d<T>& opoint)
+   {
+      return transform(make_rotation(rotation_angle,opoint),polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void rotate(const T& rx, const T& ry, const T& rz,
+                      const T&  x, const T&  y, const T&  z,
+                            T& nx,       T& ny,       T& nz)
+   {
+      const T xradang = rx * T(PIDiv180);
+      const T yradang = ry * T(PIDiv180);
+      const T zradang = rz * T(PIDiv180);
+
+      const T sinx  = sin(xradang);
+      const T siny  = sin(yradang);
+      const T sinz  = sin(zradang);
+
+      const T cosx  = cos(xradang);
+      const T cosy  = cos(yradang);
+      const T cosz  = cos(zradang);
+
+      const T tempy = y * cosy -     z * siny;
+      const T tempz = y * siny +     z * cosy;
+      const T tempx = x * cosx - tempz * sinx;
+
+      nz =     x * sinx + tempz * cosx;
+      nx = tempx * cosz - tempy * sinz;
+      ny = tempx * sinz + tempy * cosz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void rotate(const T& rx, const T& ry, const T& rz,
+                      const T&  x, const T&  y, const T&  z,
+                      const T& ox, const T& oy, const T& oz,
+                            T& nx,       T& ny,       T& nz)
+   {
+      rotate(rx,ry,rz,x - ox,y - oy,z - oz,nx,ny,nz);
+
+      nx += ox;
+      ny += oy;
+      nz += oz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> rotate(const T& rx, const T& ry, const T& rz, const point3d<T>& point)
+   {
+      point3d<T> point_;
+      rotate(rx,ry,rz,point.x,point.y,point.z,point_.x,point_.y,point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> rotate(const T& rx, const T& ry, const T& rz, const point3d<T>& point, const point3d<T>& opoint)
+   {
+      point3d<T> point_;
+      rotate(rx,ry,rz,point.x,point.y,point.z,opoint.x,opoint.y,opoint.z,point_.x,point_.y,point_.z);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> rotate(const T& rx, const T& ry, const T& rz, const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = rotate(rx,ry,rz,segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> rotate(const T& rx, const T& ry, const T& rz, const segment<T,3>& segment, const point3d<T>& opoint)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = rotate(rx,ry,rz,segment[i],opoint);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> rotate(const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = rotate(rx,ry,rz,triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> rotate(const T& rx, const T& ry, const T& rz, const triangle<T,3>& triangle, const point3d<T>& opoint)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = rotate(rx,ry,rz,triangle[i],opoint);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> rotate(const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = rotate(rx,ry,rz,quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> rotate(const T& rx, const T& ry, const T& rz, const quadix<T,3>& quadix, const point3d<T>& opoint)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = rotate(rx,ry,rz,quadix[i],opoint);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> rotate(const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(rotate(rx,ry,rz,polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> rotate(const T& rx, const T& ry, const T& rz, const polygon<T,3,Allocator>& polygon, const point3d<T>& opoint)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(rotate(rx,ry,rz,polygon[i],opoint));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                           const int rotation_angle,
+                           const T& x, const T& y,
+                           T& nx, T& ny)
+   {
+      int rot_ang = rotation_angle % 360;
+
+      if (rot_ang < 0)
+      {
+         rot_ang = 360 + rot_ang;
+      }
+
+      const T sin_val = T(lut.sin(static_cast<unsigned int>(rot_ang)));
+      const T cos_val = T(lut.cos(static_cast<unsigned int>(rot_ang)));
+
+      nx = (x * cos_val) - (y * sin_val);
+      ny = (y * cos_val) + (x * sin_val);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                           const int rotation_angle,
+                           const T& x, const T& y, const T& ox, const T& oy,
+                           T& nx, T& ny)
+   {
+      fast_rotate(lut, rotation_angle, x - ox, y - oy, nx, ny);
+
+      nx += ox;
+      ny += oy;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> fast_rotate(const trig_luts<T>& lut,
+                                 const int rotation_angle,
+                                 const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      fast_rotate(lut,
+                  rotation_angle,
+                  point .x, point .y,
+                  point_.x, point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> fast_rotate(const trig_luts<T>& lut,
+                                 const int rotation_angle,
+                                 const point2d<T>& point,
+                                 const point2d<T>& opoint)
+   {
+      point2d<T> point_;
+
+      fast_rotate(lut,
+                  rotation_angle,
+                  point .x, point .y,
+                  opoint.x, opoint.y,
+                  point_.x, point_.y);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> fast_rotate(const trig_luts<T>& lut,
+                                   const int rotation_angle,
+                                   const segment<T,2>& segment)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rotation_angle, segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> fast_rotate(const trig_luts<T>& lut,
+                                   const int rotation_angle,
+                                   const segment<T,2>& segment,
+                                   const point2d<T>& opoint)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rotation_angle, segment[i], opoint);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_luts<T>& lut,
+                                    const int rotation_angle,
+                                    const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rotation_angle, triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_luts<T>& lut,
+                                    const int rotation_angle,
+                                    const triangle<T,2>& triangle,
+                                    const point2d<T>& opoint)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rotation_angle, triangle[i], opoint);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_luts<T>& lut,
+                                  const int rotation_angle,
+                                  const quadix<T,2>& quadix)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rotation_angle, quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_luts<T>& lut,
+                                  const int rotation_angle,
+                                  const quadix<T,2>& quadix,
+                                  const point2d<T>& opoint)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rotation_angle, quadix[i], opoint);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_luts<T>& lut,
+                                   const int rotation_angle,
+                                   const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rotation_angle, polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_luts<T>& lut,
+                                   const int rotation_angle,
+                                   const polygon<T,2,Allocator>& polygon,
+                                   const point2d<T>& opoint)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rotation_angle, polygon[i], opoint));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                           const int rx, const int ry, const int rz,
+                           const T&   x, const T&   y, const T&   z,
+                                 T&  nx,        T& ny,        T& nz)
+   {
+      int rx_ = rx % 360;
+      int ry_ = ry % 360;
+      int rz_ = rz % 360;
+
+      if (rx_ < 0) rx_ += 360;
+      if (ry_ < 0) ry_ += 360;
+      if (rz_ < 0) rz_ += 360;
+
+      const T sin_x = T(lut.sin(static_cast<unsigned int>(rx_)));
+      const T sin_y = T(lut.sin(static_cast<unsigned int>(ry_)));
+      const T sin_z = T(lut.sin(static_cast<unsigned int>(rz_)));
+
+      const T cos_x = T(lut.cos(static_cast<unsigned int>(rx_)));
+      const T cos_y = T(lut.cos(static_cast<unsigned int>(ry_)));
+      const T cos_z = T(lut.cos(static_cast<unsigned int>(rz_)));
+
+      const T tmp_y = y * cos_y -     z * sin_y;
+      const T tmp_z = y * sin_y +     z * cos_y;
+      const T tmp_x = x * cos_x - tmp_z * sin_x;
+
+      nz =     x * sin_x + tmp_z * cos_x;
+      nx = tmp_x * cos_z - tmp_y * sin_z;
+      ny = tmp_x * sin_z + tmp_y * cos_z;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void fast_rotate(const trig_luts<T>& lut,
+                           const int rx, const int ry, const int rz,
+                           const T&   x, const T&   y, const T&   z,
+                           const T&  ox, const T&  oy, const T&  oz,
+                                 T&  nx,       T&  ny,       T&  nz)
+   {
+      fast_rotate(lut, rx, ry, rz, x - ox, y - oy, z - oz, nx, ny, nz);
+
+      nx += ox;
+      ny += oy;
+      nz += oz;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> fast_rotate(const trig_luts<T>& lut,
+                                 const int rx, const int ry, const int rz,
+                                 const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      fast_rotate(lut,
+                  rx, ry, rz,
+                  point .x, point .y, point .z,
+                  point_.x, point_.y, point_.z);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> fast_rotate(const trig_luts<T>& lut,
+                                 const int rx, const int ry, const int rz,
+                                 const point3d<T>& point,
+                                 const point3d<T>& opoint)
+   {
+      point3d<T> point_;
+
+      fast_rotate(lut,
+                  rx, ry, rz,
+                  point .x, point .y, point .z,
+                  opoint.x, opoint.y, opoint.z,
+                  point_.x, point_.y, point_.z);
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> fast_rotate(const trig_luts<T>& lut,
+                                   const int rx, const int ry, const int rz,
+                                   const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rx, ry, rz, segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> fast_rotate(const trig_luts<T>& lut,
+                                   const int rx, const int ry, const int rz,
+                                   const segment<T,3>& segment,
+                                   const point3d<T>& opoint)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rx, ry, rz, segment[i], opoint);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_luts<T>& lut,
+                                    const int rx, const int ry, const int rz,
+                                    const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rx, ry, rz, triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_luts<T>& lut,
+                                    const int rx, const int ry, const int rz,
+                                    const triangle<T,3>& triangle,
+                                    const point3d<T>& opoint)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rx, ry, rz, triangle[i], opoint);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_luts<T>& lut,
+                                  const int rx, const int ry, const int rz,
+                                  const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rx, ry, rz, quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_luts<T>& lut,
+                                  const int rx, const int ry, const int rz,
+                                  const quadix<T,3>& quadix,
+                                  const point3d<T>& opoint)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rx, ry, rz, quadix[i], opoint);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_luts<T>& lut,
+                                   const int rx, const int ry, const int rz,
+                                   const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rx, ry, rz, polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_luts<T>& lut,
+                                   const int rx, const int ry, const int rz,
+                                   const polygon<T,3,Allocator>& polygon,
+                                   const point3d<T>& opoint)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rx, ry, rz, polygon[i], opoint));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                           const T& rotation_angle,
+                           const T& x, const T& y,
+                           T& nx, T& ny)
+   {
+      T sin_val = T(0.0);
+      T cos_val = T(0.0);
+
+      lut.sin_cos(rotation_angle,sin_val,cos_val);
+
+      nx = (x * cos_val) - (y * sin_val);
+      ny = (y * cos_val) + (x * sin_val);
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                           const T& rotation_angle,
+                           const T& x, const T& y, const T& ox, const T& oy,
+                           T& nx, T& ny)
+   {
+      fast_rotate(lut, rotation_angle, x - ox, y - oy, nx, ny);
+
+      nx += ox;
+      ny += oy;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE point2d<T> fast_rotate(const trig_table<T,Resolution>& lut,
+                                 const T& rotation_angle,
+                                 const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      fast_rotate(lut,
+                  rotation_angle,
+                  point .x, point .y,
+                  point_.x, point_.y);
+
+      return point_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE point2d<T> fast_rotate(const trig_table<T,Resolution>& lut,
+                                 const T& rotation_angle,
+                                 const point2d<T>& point,
+                                 const point2d<T>& opoint)
+   {
+      point2d<T> point_;
+
+      fast_rotate(lut,
+                  rotation_angle,
+                  point .x, point .y,
+                  opoint.x, opoint.y,
+                  point_.x, point_.y);
+
+      return point_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE segment<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rotation_angle,
+                                   const segment<T,2>& segment)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rotation_angle, segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE segment<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rotation_angle,
+                                   const segment<T,2>& segment,
+                                   const point2d<T>& opoint)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rotation_angle, segment[i], opoint);
+      }
+
+      return segment_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                    const T& rotation_angle,
+                                    const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rotation_angle, triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE triangle<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                    const T& rotation_angle,
+                                    const triangle<T,2>& triangle,
+                                    const point2d<T>& opoint)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rotation_angle, triangle[i], opoint);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                  const T& rotation_angle,
+                                  const quadix<T,2>& quadix)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rotation_angle, quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE quadix<T,2> fast_rotate(const trig_table<T,Resolution>& lut,
+                                  const T& rotation_angle,
+                                  const quadix<T,2>& quadix,
+                                  const point2d<T>& opoint)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rotation_angle, quadix[i], opoint);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, std::size_t Resolution, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rotation_angle,
+                                   const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rotation_angle, polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, std::size_t Resolution, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rotation_angle,
+                                   const polygon<T,2,Allocator>& polygon,
+                                   const point2d<T>& opoint)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rotation_angle, polygon[i], opoint));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                           const T& rx, const T& ry, const T& rz,
+                           const T&   x, const T&   y, const T&   z,
+                                 T&  nx,        T& ny,        T& nz)
+   {
+      T sin_x = T(0.0);
+      T sin_y = T(0.0);
+      T sin_z = T(0.0);
+
+      T cos_x = T(0.0);
+      T cos_y = T(0.0);
+      T cos_z = T(0.0);
+
+      lut.sin_cos(rx,sin_x,cos_x);
+      lut.sin_cos(ry,sin_y,cos_y);
+      lut.sin_cos(rz,sin_z,cos_z);
+
+      const T tmp_y = y * cos_y -     z * sin_y;
+      const T tmp_z = y * sin_y +     z * cos_y;
+      const T tmp_x = x * cos_x - tmp_z * sin_x;
+
+      nz =     x * sin_x + tmp_z * cos_x;
+      nx = tmp_x * cos_z - tmp_y * sin_z;
+      ny = tmp_x * sin_z + tmp_y * cos_z;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE void fast_rotate(const trig_table<T,Resolution>& lut,
+                           const T& rx, const T& ry, const T& rz,
+                           const T&   x, const T&   y, const T&   z,
+                           const T&  ox, const T&  oy, const T&  oz,
+                                 T&  nx,       T&  ny,       T&  nz)
+   {
+      fast_rotate(lut, rx, ry, rz, x - ox, y - oy, z - oz, nx, ny, nz);
+
+      nx += ox;
+      ny += oy;
+      nz += oz;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE point3d<T> fast_rotate(const trig_table<T,Resolution>& lut,
+                                 const T& rx, const T& ry, const T& rz,
+                                 const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      fast_rotate(lut,
+                  rx, ry, rz,
+                  point .x, point .y, point .z,
+                  point_.x, point_.y, point_.z);
+
+      return point_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE point3d<T> fast_rotate(const trig_table<T,Resolution>& lut,
+                                 const T& rx, const T& ry, const T& rz,
+                                 const point3d<T>& point,
+                                 const point3d<T>& opoint)
+   {
+      point3d<T> point_;
+
+      fast_rotate(lut,
+                  rx, ry, rz,
+                  point .x, point .y, point .z,
+                  opoint.x, opoint.y, opoint.z,
+                  point_.x, point_.y, point_.z);
+
+      return point_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE segment<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rx, const T& ry, const T& rz,
+                                   const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rx, ry, rz, segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE segment<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rx, const T& ry, const T& rz,
+                                   const segment<T,3>& segment,
+                                   const point3d<T>& opoint)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = fast_rotate(lut, rx, ry, rz, segment[i], opoint);
+      }
+
+      return segment_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                    const T& rx, const T& ry, const T& rz,
+                                    const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rx, ry, rz, triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE triangle<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                    const T& rx, const T& ry, const T& rz,
+                                    const triangle<T,3>& triangle,
+                                    const point3d<T>& opoint)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = fast_rotate(lut, rx, ry, rz, triangle[i], opoint);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                  const T& rx, const T& ry, const T& rz,
+                                  const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rx, ry, rz, quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, std::size_t Resolution>
+   WYKOBI_INLINE quadix<T,3> fast_rotate(const trig_table<T,Resolution>& lut,
+                                  const T& rx, const T& ry, const T& rz,
+                                  const quadix<T,3>& quadix,
+                                  const point3d<T>& opoint)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = fast_rotate(lut, rx, ry, rz, quadix[i], opoint);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T, std::size_t Resolution, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rx, const T& ry, const T& rz,
+                                   const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rx, ry, rz, polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T, std::size_t Resolution, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> fast_rotate(const trig_table<T,Resolution>& lut,
+                                   const T& rx, const T& ry, const T& rz,
+                                   const polygon<T,3,Allocator>& polygon,
+                                   const point3d<T>& opoint)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(fast_rotate(lut, rx, ry, rz, polygon[i], opoint));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> translate(const T& dx, const T& dy, const point2d<T>& point)
+   {
+      wykobi::point2d<T> point_;
+
+      point_.x = point.x + dx;
+      point_.y = point.y + dy;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> translate(const T& dx, const T& dy, const line<T,2>& line)
+   {
+      wykobi::line<T,2> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,2>::PointCount; ++i)
+      {
+         line_[i] = translate(dx,dy,line[i]);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> translate(const T& dx, const T& dy, const segment<T,2>& segment)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = translate(dx,dy,segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> translate(const T& dx, const T& dy, const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = translate(dx,dy,triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> translate(const T& dx, const T& dy, const quadix<T,2>& quadix)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = translate(dx,dy,quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> translate(const T& dx, const T& dy, const rectangle<T>& rectangle)
+   {
+      wykobi::rectangle<T> rectangle_;
+
+      for (std::size_t i = 0; i < wykobi::rectangle<T>::PointCount; ++i)
+      {
+         rectangle_[i] = translate(dx,dy,rectangle[i]);
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> translate(const T& dx, const T& dy, const circle<T>& circle)
+   {
+      wykobi::circle<T> circle_;
+
+      circle_.x      = circle.x + dx;
+      circle_.y      = circle.y + dy;
+      circle_.radius = circle.radius;
+
+      return circle_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> translate(const T& dx, const T& dy, const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(translate(dx,dy,polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> translate(const T& delta, const point2d<T>& point)
+   {
+      return translate(delta,delta,point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> translate(const T& delta, const line<T,2>& line)
+   {
+      return translate(delta,delta,line);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> translate(const T& delta, const segment<T,2>& segment)
+   {
+      return translate(delta,delta,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> translate(const T& delta, const triangle<T,2>& triangle)
+   {
+      return translate(delta,delta,triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> translate(const T& delta, const quadix<T,2>& quadix)
+   {
+      return translate(delta,delta,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> translate(const T& delta, const rectangle<T>& rectangle)
+   {
+      return translate(delta,delta,rectangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> translate(const T& delta, const circle<T>& circle)
+   {
+      return translate(delta,delta,circle);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> translate(const T& delta, const polygon<T,2,Allocator>& polygon)
+   {
+      return translate(delta,delta,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> translate(const vector2d<T>& v, const point2d<T>& point)
+   {
+      return translate(v.x,v.y,point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> translate(const vector2d<T>& v, const line<T,2>& line)
+   {
+      return translate(v.x,v.y,line);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> translate(const vector2d<T>& v, const segment<T,2>& segment)
+   {
+      return translate(v.x,v.y,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> translate(const vector2d<T>& v, const triangle<T,2>& triangle)
+   {
+      return translate(v.x,v.y,triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> translate(const vector2d<T>& v, const quadix<T,2>& quadix)
+   {
+      return translate(v.x,v.y,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> translate(const vector2d<T>& v, const rectangle<T>& rectangle)
+   {
+      return translate(v.x,v.y,rectangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> translate(const vector2d<T>& v, const circle<T>& circle)
+   {
+      return translate(v.x,v.y,circle);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> translate(const vector2d<T>& v, const polygon<T,2,Allocator>& polygon)
+   {
+      return translate(v.x,v.y,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> translate(const T& dx, const T& dy, const T& dz, const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x + dx;
+      point_.y = point.y + dy;
+      point_.z = point.z + dz;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> translate(const T& dx, const T& dy, const T& dz, const line<T,3>& line)
+   {
+      wykobi::line<T,3> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,3>::PointCount; ++i)
+      {
+         line_[i] = translate(dx,dy,dz,line[i]);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> translate(const T& dx, const T& dy, const T& dz, const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = translate(dx,dy,dz,segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> translate(const T& dx, const T& dy, const T& dz, const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = translate(dx,dy,dz,triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> translate(const T& dx, const T& dy, const T& dz, const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = translate(dx,dy,dz,quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> translate(const T& dx, const T& dy, const T& dz, const box<T,3>& box)
+   {
+      wykobi::box<T,3> box_;
+
+      for (std::size_t i = 0; i < wykobi::box<T,3>::PointCount; ++i)
+      {
+         box_[i] = translate(dx,dy,dz,box[i]);
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> translate(const T& dx, const T& dy, const T& dz, const sphere<T>& sphere)
+   {
+      wykobi::sphere<T> sphere_;
+
+      sphere_.x = sphere.x + dx;
+      sphere_.y = sphere.y + dy;
+      sphere_.z = sphere.z + dz;
+      sphere_.radius = sphere.radius;
+
+      return sphere_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> translate(const T& dx, const T& dy, const T& dz, const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(translate(dx,dy,dz,polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> translate(const T& delta, const point3d<T>& point)
+   {
+      return translate(delta,delta,delta,point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> translate(const T& delta, const line<T,3>& line)
+   {
+      return translate(delta,delta,delta,line);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> translate(const T& delta, const segment<T,3>& segment)
+   {
+      return translate(delta,delta,delta,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> translate(const T& delta, const triangle<T,3>& triangle)
+   {
+      return translate(delta,delta,delta,triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> translate(const T& delta, const quadix<T,3>& quadix)
+   {
+      return translate(delta,delta,delta,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> translate(const T& delta, const box<T,3>& box)
+   {
+      return translate(delta,delta,delta,box);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> translate(const T& delta, const sphere<T>& sphere)
+   {
+      return translate(delta,delta,delta,sphere);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> translate(const T& delta, const polygon<T,3,Allocator>& polygon)
+   {
+      return translate(delta,delta,delta,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> translate(const vector3d<T>& v, const point3d<T>& point)
+   {
+      return translate(v.x,v.y,v.z,point);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> translate(const vector3d<T>& v, const line<T,3>& line)
+   {
+      return translate(v.x,v.y,v.z,line);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> translate(const vector3d<T>& v, const segment<T,3>& segment)
+   {
+      return translate(v.x,v.y,v.z,segment);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> translate(const vector3d<T>& v, const triangle<T,3>& triangle)
+   {
+      return translate(v.x,v.y,v.z,triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> translate(const vector3d<T>& v, const quadix<T,3>& quadix)
+   {
+      return translate(v.x,v.y,v.z,quadix);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> translate(const vector3d<T>& v, const box<T,3>& box)
+   {
+      return translate(v.x,v.y,v.z,box);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> translate(const vector3d<T>& v, const sphere<T>& sphere)
+   {
+      return translate(v.x,v.y,v.z,sphere);
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> translate(const vector3d<T>& v, const polygon<T,3,Allocator>& polygon)
+   {
+      return translate(v.x,v.y,v.z,polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> scale(const T& dx, const T& dy, const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      point_.x = point.x * dx;
+      point_.y = point.y * dy;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> scale(const T& dx, const T& dy, const line<T,2>& line)
+   {
+      wykobi::line<T,2> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,2>::PointCount; ++i)
+      {
+         line_[i] = scale(dx,dy,line[i]);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> scale(const T& dx, const T& dy, const segment<T,2>& segment)
+   {
+      wykobi::segment<T,2> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         segment_[i] = scale(dx,dy,segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> scale(const T& dx, const T& dy, const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         triangle_[i] = scale(dx,dy,triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> scale(const T& dx, const T& dy, const quadix<T,2>& quadix)
+   {
+      wykobi::quadix<T,2> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         quadix_[i] = scale(dx,dy,quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> scale(const T& dx, const T& dy, const rectangle<T>& rectangle)
+   {
+      wykobi::rectangle<T> rectangle_;
+
+      for (std::size_t i = 0; i < wykobi::rectangle<T>::PointCount; ++i)
+      {
+         rectangle_[i] = scale(dx,dy,rectangle[i]);
+      }
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> scale(const T& dr, const circle<T>& circle)
+   {
+      wykobi::circle<T> circle_;
+
+      circle_.x      = circle.x;
+      circle_.y      = circle.y;
+      circle_.radius = circle.radius * dr;
+
+      return circle_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> scale(const T& dx, const T& dy, const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(scale(dx,dy,polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> scale(const T& dx, const T& dy, const T& dz, const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x * dx;
+      point_.y = point.y * dy;
+      point_.z = point.z * dz;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> scale(const T& dx, const T& dy, const T& dz, const line<T,3>& line)
+   {
+      wykobi::line<T,3> line_;
+
+      for (std::size_t i = 0; i < wykobi::line<T,3>::PointCount; ++i)
+      {
+         line_[i] = scale(dx,dy,dz,line[i]);
+      }
+
+      return line_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> scale(const T& dx, const T& dy, const T& dz, const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_;
+
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         segment_[i] = scale(dx,dy,dz,segment[i]);
+      }
+
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> scale(const T& dx, const T& dy, const T& dz, const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_;
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         triangle_[i] = scale(dx,dy,dz,triangle[i]);
+      }
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> scale(const T& dx, const T& dy, const T& dz, const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_;
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         quadix_[i] = scale(dx,dy,dz,quadix[i]);
+      }
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> scale(const T& dx, const T& dy, const T& dz, const box<T,3>& box)
+   {
+      wykobi::box<T,3> box_;
+
+      for (std::size_t i = 0; i < wykobi::box<T,3>::PointCount; ++i)
+      {
+         box_[i] = scale(dx,dy,dz,box[i]);
+      }
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> scale(const T& dr, const sphere<T>& sphere)
+   {
+      wykobi::sphere<T> sphere_;
+      sphere_.x = sphere.x;
+      sphere_.y = sphere.y;
+      sphere_.z = sphere.z;
+      sphere_.radius = sphere.radius * dr;
+      return sphere_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> scale(const T& dx, const T& dy, const T& dz, const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_(polygon.get_allocator());
+
+      polygon_.reserve(polygon.size());
+
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+         polygon_.push_back(scale(dx,dy,dz,polygon[i]));
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> identity_affine2d()
+   {
+      affine2d<T> affine_;
+
+      affine_.m[0][0] = T(1.0); affine_.m[0][1] = T(0.0); affine_.m[0][2] = T(0.0);
+      affine_.m[1][0] = T(0.0); affine_.m[1][1] = T(1.0); affine_.m[1][2] = T(0.0);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> identity_affine3d()
+   {
+      affine3d<T> affine_;
+
+      affine_.m[0][0] = T(1.0); affine_.m[0][1] = T(0.0); affine_.m[0][2] = T(0.0); affine_.m[0][3] = T(0.0);
+      affine_.m[1][0] = T(0.0); affine_.m[1][1] = T(1.0); affine_.m[1][2] = T(0.0); affine_.m[1][3] = T(0.0);
+      affine_.m[2][0] = T(0.0); affine_.m[2][1] = T(0.0); affine_.m[2][2] = T(1.0); affine_.m[2][3] = T(0.0);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> make_translation(const T& dx, const T& dy)
+   {
+      affine2d<T> affine_ = identity_affine2d<T>();
+
+      affine_.m[0][2] = dx;
+      affine_.m[1][2] = dy;
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> make_translation(const vector2d<T>& v)
+   {
+      return make_translation(v.x,v.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_translation(const T& dx, const T& dy, const T& dz)
+   {
+      affine3d<T> affine_ = identity_affine3d<T>();
+
+      affine_.m[0][3] = dx;
+      affine_.m[1][3] = dy;
+      affine_.m[2][3] = dz;
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_translation(const vector3d<T>& v)
+   {
+      return make_translation(v.x,v.y,v.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> make_scaling(const T& dx, const T& dy)
+   {
+      affine2d<T> affine_ = identity_affine2d<T>();
+
+      affine_.m[0][0] = dx;
+      affine_.m[1][1] = dy;
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_scaling(const T& dx, const T& dy, const T& dz)
+   {
+      affine3d<T> affine_ = identity_affine3d<T>();
+
+      affine_.m[0][0] = dx;
+      affine_.m[1][1] = dy;
+      affine_.m[2][2] = dz;
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> make_rotation(const T& rotation_angle)
+   {
+      const T sin_val = sin(rotation_angle * T(PIDiv180));
+      const T cos_val = cos(rotation_angle * T(PIDiv180));
+
+      affine2d<T> affine_;
+
+      affine_.m[0][0] = cos_val; affine_.m[0][1] = -sin_val; affine_.m[0][2] = T(0.0);
+      affine_.m[1][0] = sin_val; affine_.m[1][1] =  cos_val; affine_.m[1][2] = T(0.0);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> make_rotation(const T& rotation_angle, const point2d<T>& opoint)
+   {
+      return make_translation(opoint.x,opoint.y) * make_rotation(rotation_angle) * make_translation(-opoint.x,-opoint.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_rotation(const T& rx, const T& ry, const T& rz)
+   {
+      /* Same rotation order and convention as fast_rotate */
+      const T sin_x = sin(rx * T(PIDiv180));
+      const T sin_y = sin(ry * T(PIDiv180));
+      const T sin_z = sin(rz * T(PIDiv180));
+
+      const T cos_x = cos(rx * T(PIDiv180));
+      const T cos_y = cos(ry * T(PIDiv180));
+      const T cos_z = cos(rz * T(PIDiv180));
+
+      affine3d<T> affine_;
+
+      affine_.m[0][0] = cos_z * cos_x;
+      affine_.m[0][1] = -(cos_z * sin_x * sin_y) - (sin_z * cos_y);
+      affine_.m[0][2] = -(cos_z * sin_x * cos_y) + (sin_z * sin_y);
+      affine_.m[0][3] = T(0.0);
+
+      affine_.m[1][0] = sin_z * cos_x;
+      affine_.m[1][1] = -(sin_z * sin_x * sin_y) + (cos_z * cos_y);
+      affine_.m[1][2] = -(sin_z * sin_x * cos_y) - (cos_z * sin_y);
+      affine_.m[1][3] = T(0.0);
+
+      affine_.m[2][0] = sin_x;
+      affine_.m[2][1] = cos_x * sin_y;
+      affine_.m[2][2] = cos_x * cos_y;
+      affine_.m[2][3] = T(0.0);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_rotation(const T& rx, const T& ry, const T& rz, const point3d<T>& opoint)
+   {
+      return make_translation(opoint.x,opoint.y,opoint.z) * make_rotation(rx,ry,rz) * make_translation(-opoint.x,-opoint.y,-opoint.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> make_rotation(const T& rotation_angle, const vector3d<T>& axis)
+   {
+      const vector3d<T> u = normalize(axis);
+
+      const T sin_val = sin(rotation_angle * T(PIDiv180));
+      const T cos_val = cos(rotation_angle * T(PIDiv180));
+      const T one_cos = T(1.0) - cos_val;
+
+      affine3d<T> affine_;
+
+      affine_.m[0][0] = cos_val + u.x * u.x * one_cos;
+      affine_.m[0][1] = u.x * u.y * one_cos - u.z * sin_val;
+      affine_.m[0][2] = u.x * u.z * one_cos + u.y * sin_val;
+      affine_.m[0][3] = T(0.0);
+
+      affine_.m[1][0] = u.y * u.x * one_cos + u.z * sin_val;
+      affine_.m[1][1] = cos_val + u.y * u.y * one_cos;
+      affine_.m[1][2] = u.y * u.z * one_cos - u.x * sin_val;
+      affine_.m[1][3] = T(0.0);
+
+      affine_.m[2][0] = u.z * u.x * one_cos - u.y * sin_val;
+      affine_.m[2][1] = u.z * u.y * one_cos + u.x * sin_val;
+      affine_.m[2][2] = cos_val + u.z * u.z * one_cos;
+      affine_.m[2][3] = T(0.0);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> operator*(const affine2d<T>& affine1, const affine2d<T>& affine2)
+   {
+      /* affine1 * affine2 applies affine2 first, then affine1 */
+      affine2d<T> affine_;
+
+      for (std::size_t i = 0; i < 2; ++i)
+      {
+         for (std::size_t j = 0; j < 3; ++j)
+         {
+            affine_.m[i][j] = affine1.m[i][0] * affine2.m[0][j] +
+                              affine1.m[i][1] * affine2.m[1][j];
+         }
+
+         affine_.m[i][2] += affine1.m[i][2];
+      }
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> operator*(const affine3d<T>& affine1, const affine3d<T>& affine2)
+   {
+      /* affine1 * affine2 applies affine2 first, then affine1 */
+      affine3d<T> affine_;
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         for (std::size_t j = 0; j < 4; ++j)
+         {
+            affine_.m[i][j] = affine1.m[i][0] * affine2.m[0][j] +
+                              affine1.m[i][1] * affine2.m[1][j] +
+                              affine1.m[i][2] * affine2.m[2][j];
+         }
+
+         affine_.m[i][3] += affine1.m[i][3];
+      }
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine2d<T> inverse(const affine2d<T>& affine)
+   {
+      affine2d<T> affine_;
+
+      T d = affine.m[0][0] * affine.m[1][1] - affine.m[0][1] * affine.m[1][0];
+
+      if (d == T(0.0))
+      {
+         affine_.m[0][0] = affine_.m[0][1] = affine_.m[0][2] = T(0.0);
+         affine_.m[1][0] = affine_.m[1][1] = affine_.m[1][2] = T(0.0);
+
+         return affine_;
+      }
+
+      d = T(1.0) / d;
+
+      affine_.m[0][0] =  affine.m[1][1] * d;
+      affine_.m[0][1] = -affine.m[0][1] * d;
+      affine_.m[1][0] = -affine.m[1][0] * d;
+      affine_.m[1][1] =  affine.m[0][0] * d;
+
+      affine_.m[0][2] = -(affine_.m[0][0] * affine.m[0][2] + affine_.m[0][1] * affine.m[1][2]);
+      affine_.m[1][2] = -(affine_.m[1][0] * affine.m[0][2] + affine_.m[1][1] * affine.m[1][2]);
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE affine3d<T> inverse(const affine3d<T>& affine)
+   {
+      affine3d<T> affine_;
+
+      const T (&m)[3][4] = affine.m;
+
+      T c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+      T c01 = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+      T c02 = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+
+      T d = m[0][0] * c00 + m[1][0] * c01 + m[2][0] * c02;
+
+      if (d == T(0.0))
+      {
+         for (std::size_t i = 0; i < 3; ++i)
+         {
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+               affine_.m[i][j] = T(0.0);
+            }
+         }
+
+         return affine_;
+      }
+
+      d = T(1.0) / d;
+
+      affine_.m[0][0] = c00 * d;
+      affine_.m[0][1] = c01 * d;
+      affine_.m[0][2] = c02 * d;
+
+      affine_.m[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * d;
+      affine_.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * d;
+      affine_.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * d;
+
+      affine_.m[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * d;
+      affine_.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * d;
+      affine_.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * d;
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         affine_.m[i][3] = -(affine_.m[i][0] * m[0][3] + affine_.m[i][1] * m[1][3] + affine_.m[i][2] * m[2][3]);
+      }
+
+      return affine_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> transform(const affine2d<T>& affine, const point2d<T>& point)
+   {
+      point2d<T> point_ = point;
+      transform_in_place(affine,point_);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> transform(const affine2d<T>& affine, const segment<T,2>& segment)
+   {
+      wykobi::segment<T,2> segment_ = segment;
+      transform_in_place(affine,segment_);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> transform(const affine2d<T>& affine, const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_ = triangle;
+      transform_in_place(affine,triangle_);
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> transform(const affine2d<T>& affine, const quadix<T,2>& quadix)
+   {
+      wykobi::quadix<T,2> quadix_ = quadix;
+      transform_in_place(affine,quadix_);
+      return quadix_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,2,Allocator> transform(const affine2d<T>& affine, const polygon<T,2,Allocator>& polygon)
+   {
+      wykobi::polygon<T,2,Allocator> polygon_ = polygon;
+      transform_in_place(affine,polygon_);
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> transform(const affine3d<T>& affine, const point3d<T>& point)
+   {
+      point3d<T> point_ = point;
+      transform_in_place(affine,point_);
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> transform(const affine3d<T>& affine, const segment<T,3>& segment)
+   {
+      wykobi::segment<T,3> segment_ = segment;
+      transform_in_place(affine,segment_);
+      return segment_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> transform(const affine3d<T>& affine, const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_ = triangle;
+      transform_in_place(affine,triangle_);
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> transform(const affine3d<T>& affine, const quadix<T,3>& quadix)
+   {
+      wykobi::quadix<T,3> quadix_ = quadix;
+      transform_in_place(affine,quadix_);
+      return quadix_;
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE polygon<T,3,Allocator> transform(const affine3d<T>& affine, const polygon<T,3,Allocator>& polygon)
+   {
+      wykobi::polygon<T,3,Allocator> polygon_ = polygon;
+      transform_in_place(affine,polygon_);
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, point2d<T>& point)
+   {
+      const T x = point.x;
+      const T y = point.y;
+
+      point.x = affine.m[0][0] * x + affine.m[0][1] * y + affine.m[0][2];
+      point.y = affine.m[1][0] * x + affine.m[1][1] * y + affine.m[1][2];
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, segment<T,2>& segment)
+   {
+      for (std::size_t i = 0; i < wykobi::segment<T,2>::PointCount; ++i)
+      {
+         transform_in_place(affine,segment[i]);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, triangle<T,2>& triangle)
+   {
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         transform_in_place(affine,triangle[i]);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, quadix<T,2>& quadix)
+   {
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         transform_in_place(affine,quadix[i]);
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, polygon<T,2,Allocator>& polygon)
+   {
+      transform_in_place(affine,polygon.begin(),polygon.end());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, point3d<T>& point)
+   {
+      const T x = point.x;
+      const T y = point.y;
+      const T z = point.z;
+
+      point.x = affine.m[0][0] * x + affine.m[0][1] * y + affine.m[0][2] * z + affine.m[0][3];
+      point.y = affine.m[1][0] * x + affine.m[1][1] * y + affine.m[1][2] * z + affine.m[1][3];
+      point.z = affine.m[2][0] * x + affine.m[2][1] * y + affine.m[2][2] * z + affine.m[2][3];
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, segment<T,3>& segment)
+   {
+      for (std::size_t i = 0; i < wykobi::segment<T,3>::PointCount; ++i)
+      {
+         transform_in_place(affine,segment[i]);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, triangle<T,3>& triangle)
+   {
+      for (std::size_t i = 0; i < wykobi::triangle<T,3>::PointCount; ++i)
+      {
+         transform_in_place(affine,triangle[i]);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, quadix<T,3>& quadix)
+   {
+      for (std::size_t i = 0; i < wykobi::quadix<T,3>::PointCount; ++i)
+      {
+         transform_in_place(affine,quadix[i]);
+      }
+   }
+
+   template <typename T, typename Allocator>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, polygon<T,3,Allocator>& polygon)
+   {
+      transform_in_place(affine,polygon.begin(),polygon.end());
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void transform(const affine2d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         (*out++) = transform(affine,(*it));
+      }
+   }
+
+   template <typename T, typename InputIterator, typename OutputIterator>
+   WYKOBI_INLINE void transform(const affine3d<T>& affine, const InputIterator begin, const InputIterator end, OutputIterator out)
+   {
+      for (InputIterator it = begin; it != end; ++it)
+      {
+         (*out++) = transform(affine,(*it));
+      }
+   }
+
+   template <typename T, typename Iterator>
+   WYKOBI_INLINE void transform_in_place(const affine2d<T>& affine, const Iterator begin, const Iterator end)
+   {
+      for (Iterator it = begin; it != end; ++it)
+      {
+         transform_in_place(affine,(*it));
+      }
+   }
+
+   template <typename T, typename Iterator>
+   WYKOBI_INLINE void transform_in_place(const affine3d<T>& affine, const Iterator begin, const Iterator end)
+   {
+      for (Iterator it = begin; it != end; ++it)
+      {
+         transform_in_place(affine,(*it));
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const circle<T>& circle, const unsigned int point_count)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(point_count);
+
+      T angle = T(360.0 / (1.0 * point_count));
+
+      for (std::size_t i = 0; i < point_count; ++i)
+      {
+         point2d<T> point_;
+         rotate(angle * T(1.0 * i), circle.x + circle.radius, circle.y, circle.x, circle.y, point_.x, point_.y);
+         polygon_.push_back(point_);
+      }
+
+      return polygon_;
+   }
+
+} // wykobi namespace
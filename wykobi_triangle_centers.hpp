@@ -0,0 +1,518 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_TRIANGLE_CENTERS
+#define INCLUDE_WYKOBI_TRIANGLE_CENTERS
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   /*
+      Triangle centers, special triangles, circles and tangents.
+   */
+
+   template <typename T> WYKOBI_INLINE bool cocircular(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& x3, const T& y3,
+                                                const T& x4, const T& y4,
+                                                const T& epsilon = T(Epsilon));
+
+   template <typename T> WYKOBI_INLINE bool cocircular(const point2d<T>& point1,
+                                                const point2d<T>& point2,
+                                                const point2d<T>& point3,
+                                                const point2d<T>& point4,
+                                                const T& epsilon = T(Epsilon));
+
+   template <typename T> WYKOBI_INLINE bool cocircular(const triangle<T,2>& triangle,
+                                                const point2d<T>& point,
+                                                const T& epsilon = T(Epsilon));
+
+   template <typename T> WYKOBI_INLINE bool cocircular(const circle<T>& circle,
+                                                const point2d<T>& point,
+                                                const T& epsilon = T(Epsilon));
+
+   template <typename T> WYKOBI_INLINE bool is_skinny_triangle(const T& x1, const T& y1,
+                                                        const T& x2, const T& y2,
+                                                        const T& x3, const T& y3);
+
+   template <typename T> WYKOBI_INLINE bool is_skinny_triangle(const point2d<T>& point1,
+                                                        const point2d<T>& point2,
+                                                        const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE bool is_skinny_triangle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE bool is_tangent(const segment<T,2>& segment, const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE line<T,2> triangle_bisector(const triangle<T,2>& triangle, const std::size_t& bisector);
+
+   template <typename T> WYKOBI_INLINE line<T,3> triangle_bisector(const triangle<T,3>& triangle, const std::size_t& bisector);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> triangle_external_bisector(const triangle<T,2>& triangle,
+                                               const std::size_t& corner,
+                                               const std::size_t& opposing_corner);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> triangle_external_bisector(const triangle<T,3>& triangle,
+                                               const std::size_t& corner,
+                                               const std::size_t& opposing_corner);
+
+   template <typename T> WYKOBI_INLINE line<T,2> triangle_median(const triangle<T,2>& triangle, const std::size_t& median);
+
+   template <typename T> WYKOBI_INLINE line<T,3> triangle_median(const triangle<T,3>& triangle, const std::size_t& median);
+
+   template <typename T> WYKOBI_INLINE line<T,2> triangle_symmedian(const triangle<T,2>& triangle, const std::size_t& symmedian);
+
+   template <typename T> WYKOBI_INLINE line<T,3> triangle_symmedian(const triangle<T,3>& triangle, const std::size_t& symmedian);
+
+   template <typename T> WYKOBI_INLINE line<T,2> euler_line(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE line<T,3> euler_line(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE point2d<T> exmedian_point(const triangle<T,2>& triangle, const std::size_t& corner);
+
+   template <typename T> WYKOBI_INLINE point3d<T> exmedian_point(const triangle<T,3>& triangle, const std::size_t& corner);
+
+   template <typename T> WYKOBI_INLINE point2d<T> feuerbach_point(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> confined_triangle_median(const triangle<T,2>& triangle,const point2d<T>& point, const std::size_t& median);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> confined_triangle_median(const triangle<T,3>& triangle,const point3d<T>& point, const std::size_t& median);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> isogonal_conjugate(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> isogonal_conjugate(const point3d<T>& point, const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> cyclocevian_conjugate(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> symmedian_point(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> symmedian_point(const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_triangle(const T& x1, const T& y1,
+                                           const T& x2, const T& y2,
+                                                 T& x3,       T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_triangle(const point2d<T>& point1,
+                                           const point2d<T>& point2,
+                                                 point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const point2d<T>& point1,
+                                                    const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const T& cx, const T& cy, const T& side_length);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const point2d<T>& center_point, const T& side_length);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_isosceles_triangle(const point2d<T>& point1, const point2d<T>& point2, const T& angle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_isosceles_triangle(const segment<T,2>& segment, const T& angle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_triangle(const point2d<T>& point1, const point2d<T>& point2, const T& angle1, const T& angle2);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_triangle(const segment<T,2>& segment, const T& angle1, const T& angle2);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_morley_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_cevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_cevian_triangle(const triangle<T,3>& triangle, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_anticevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_anticevian_triangle(const triangle<T,3>& triangle, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_anticomplementary_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_anticomplementary_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_inner_napoleon_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_outer_napoleon_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_inner_vecten_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_outer_vecten_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_medial_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_medial_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_contact_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_contact_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_symmedial_triangle(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_orthic_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_orthic_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_pedal_triangle(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_pedal_triangle(const point3d<T>& point, const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_antipedal_triangle(const point2d<T>& point, const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_excentral_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_excentral_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_incentral_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_incentral_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_intouch_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_extouch_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> create_extouch_triangle(const triangle<T,3>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_feuerbach_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_circumcevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_circummedial_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> create_first_brocard_triangle(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE void create_right_triangle(const wykobi::point2d<T>& p1, const wykobi::point2d<T>& p2,
+                                                          wykobi::point2d<T>& c1, wykobi::point2d<T>& c2);
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_quadix(const T& x1, const T& y1,
+                                         const T& x2, const T& y2,
+                                               T& x3,       T& y3,
+                                               T& x4,       T& y4);
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_quadix(const point2d<T>& point1,
+                                         const point2d<T>& point2,
+                                               point2d<T>& point3,
+                                               point2d<T>& point4);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const T& x1, const T& y1,
+                                                const T& x2, const T& y2);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const point2d<T>& point1,
+                                                const point2d<T>& point2);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const segment<T,2>& segment);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const T& cx, const T& cy, const T& side_length);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const point2d<T>& center_point, const T& side_length);
+
+   template <typename T>
+   WYKOBI_INLINE void torricelli_point(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3,
+                                      T& px,       T& py);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> torricelli_point(const point2d<T>& point1,
+                                      const point2d<T>& point2,
+                                      const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> torricelli_point(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE bool trilateration(const T& c0x, const T& c0y, const T& c0r,
+                                                   const T& c1x, const T& c1y, const T& c1r,
+                                                   const T& c2x, const T& c2y, const T& c2r,
+                                                         T&  px,       T&  py);
+
+   template <typename T> WYKOBI_INLINE point2d<T> trilateration(const circle<T>& c0, const circle<T>& c1, const circle<T>& c2);
+
+   template <typename T>
+   WYKOBI_INLINE void incenter(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                              T& px,       T& py);
+
+   template <typename T>
+   WYKOBI_INLINE void incenter(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                              T& px,       T& py,       T& pz);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> incenter(const point2d<T>& point1,
+                              const point2d<T>& point2,
+                              const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> incenter(const point3d<T>& point1,
+                              const point3d<T>& point2,
+                              const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> incenter(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> incenter(const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE void circumcenter(const T& x1, const T& y1,
+                            const T& x2, const T& y2,
+                            const T& x3, const T& y3,
+                                  T& px,       T& py);
+
+   template <typename T>
+   WYKOBI_INLINE void circumcenter(const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2,
+                            const T& x3, const T& y3, const T& z3,
+                                  T& px,       T& py,       T& pz);
+
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> circumcenter(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> circumcenter(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> circumcenter(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> circumcenter(const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const point3d<T>& point1,
+                                 const point3d<T>& point2,
+                                 const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const triangle<T,3>& triangle);
+
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const T& x1, const T& y1,
+                                     const T& x2, const T& y2,
+                                     const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const point2d<T>& point1,
+                                     const point2d<T>& point2,
+                                     const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const T& x1, const T& y1, const T& z1,
+                                     const T& x2, const T& y2, const T& z2,
+                                     const T& x3, const T& y3, const T& z3);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const point3d<T>& point1,
+                                     const point3d<T>& point2,
+                                     const point3d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const point2d<T>& point1,
+                                      const point2d<T>& point2,
+                                      const point2d<T>& point3);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> orthocenter(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> orthocenter(const triangle<T,3>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> excenter(const triangle<T,2>& triangle, const std::size_t& corner);
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> excenter(const triangle<T,3>& triangle, const std::size_t& corner);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> excircle(const triangle<T,2>& triangle, const std::size_t& i);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> mandart_circle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> brocard_circle(const triangle<T,2>& triangle);
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> invert_circle_across_circle(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> invert_sphere_across_sphere(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T>
+   WYKOBI_INLINE void circle_tangent_points(const circle<T>& circle, const point2d<T>& point, point2d<T>& point1, point2d<T>& point2);
+
+   template <typename T>
+   WYKOBI_INLINE void circle_internal_tangent_lines(const circle<T>& circle0,
+                                             const circle<T>& circle1,
+                                             std::vector< line<T,2> >& lines);
+
+   template <typename T>
+   WYKOBI_INLINE void circle_internal_tangent_segments(const circle<T>& circle0,
+                                                const circle<T>& circle1,
+                                                std::vector< segment<T,2> >& segments);
+
+   template <typename T>
+   WYKOBI_INLINE void circle_outer_tangent_lines(const circle<T>& circle0,
+                                          const circle<T>& circle1,
+                                          std::vector< line<T,2> >& lines);
+
+   template <typename T>
+   WYKOBI_INLINE void circle_outer_tangent_segments(const circle<T>& circle0,
+                                             const circle<T>& circle1,
+                                             std::vector< segment<T,2> >& segments);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> tangent_line(const circle<T>& circle, const point2d<T>& point);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_line_from_bisector(const T& x1, const T& y1,
+                                              const T& x2, const T& y2,
+                                              const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> create_segment_from_bisector(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> create_ray_from_bisector(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& x3, const T& y3);
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> create_line_from_bisector(const T& x1, const T& y1, const T& z1,
+                                              const T& x2, const T& y2, const T& z2,
+                                              const T& x3, const T& y3, const T& z3);
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> create_segment_from_bisector(const T& x1, const T& y1, const T& z1,
+                                                    const T& x2, const T& y2, const T& z2,
+                                                    const T& x3, const T& y3, const T& z3);
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> create_ray_from_bisector(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_line_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE segment<T,2> create_segment_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE ray<T,2> create_ray_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE line<T,3> create_line_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE segment<T,3> create_segment_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE ray<T,3> create_ray_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const T& x1, const T& y1,const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE line<T,2> create_perpendicular_line_at_end_point(const line<T,2>& line);
+
+   template <typename T> WYKOBI_INLINE bool common_center(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE bool common_center(const sphere<T>& sphere1, const sphere<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE bool are_perspective_triangles(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE bool are_perspective_triangles(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2);
+
+   template <typename T> WYKOBI_INLINE line<T,2> perspectrix(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2);
+
+   template <typename T> WYKOBI_INLINE line<T,3> perspectrix(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2);
+
+   template <typename T> WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE circle<T> make_circle(const triangle<T,2>& triangle);
+
+} // wykobi namespace
+
+#include "wykobi_predicates.hpp"
+#include "wykobi_distance.hpp"
+#include "wykobi_measures.hpp"
+#include "wykobi_intersection.hpp"
+#include "wykobi_transforms.hpp"
+#include "wykobi_triangle_centers.inl"
+
+#endif
@@ -0,0 +1,2114 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_triangle_centers.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE bool cocircular(const T& x1, const T& y1,
+                          const T& x2, const T& y2,
+                          const T& x3, const T& y3,
+                          const T& x4, const T& y4,
+                          const T& epsilon)
+   {
+      const circle<T> circle = circumcircle(x1,y1,x2,y2,x3,y3);
+
+      return is_equal(distance(x4,y4,circle.x,circle.y),circle.radius,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool cocircular(const point2d<T>& point1,
+                          const point2d<T>& point2,
+                          const point2d<T>& point3,
+                          const point2d<T>& point4,
+                          const T& epsilon)
+   {
+      return cocircular(point1.x, point1.y,
+                        point2.x, point2.y,
+                        point3.x, point3.y,
+                        point4.x, point4.y,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool cocircular(const triangle<T,2>& triangle, const point2d<T>& point, const T& epsilon)
+   {
+      return cocircular(triangle[0],triangle[1],triangle[2],point,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool cocircular(const circle<T>& circle, const point2d<T>& point, const T& epsilon)
+   {
+      return is_equal(distance(point.x,point.y,circle.x,circle.y),circle.radius,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_skinny_triangle(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3)
+   {
+      /*
+         L. Paul Chew, Guaranteed-Quality Triangular Meshes,
+         Technical Report TR-89-983,
+         Department of Computer Science, Cornell University, 1989.
+         Skinny only if circumradius-to-shortest edge ratio > 1.
+      */
+      const circle<T> cir_circle = circumcircle(x1,y1,x2,y2,x3,y3);
+
+      const T shortest_length = sqrt(min(lay_distance(x1, y1, x2, y2),
+                                         lay_distance(x1, y1, x3, y3),
+                                         lay_distance(x2, y2, x3, y3)));
+
+      return ((cir_circle.radius / shortest_length) > T(1.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_skinny_triangle(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3)
+   {
+      return is_skinny_triangle(point1.x,point1.y,
+                                point2.x,point2.y,
+                                point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_skinny_triangle(const triangle<T,2>& triangle)
+   {
+     return is_skinny_triangle(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_tangent(const segment<T,2>& segment, const circle<T>& circle)
+   {
+      wykobi::segment<T,2> tmp_segment = translate(-circle.x, -circle.y, segment);
+
+      const T rsqr  = wykobi::sqr(circle.radius);
+      const T drsqr = lay_distance(tmp_segment);
+      const T dsqr  = wykobi::sqr(tmp_segment[0].x * tmp_segment[1].y - tmp_segment[1].x * tmp_segment[0].y);
+
+      return is_equal((rsqr * drsqr - dsqr),T(0.0));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> triangle_bisector(const triangle<T,2>& triangle, const std::size_t& bisector)
+   {
+      switch(bisector)
+      {
+          case 0 : return create_line_from_bisector(triangle[2],triangle[0],triangle[1]);
+          case 1 : return create_line_from_bisector(triangle[0],triangle[1],triangle[2]);
+          case 2 : return create_line_from_bisector(triangle[0],triangle[2],triangle[1]);
+         default : return degenerate_line2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> triangle_bisector(const triangle<T,3>& triangle, const std::size_t& bisector)
+   {
+      switch(bisector)
+      {
+          case 0 : return create_line_from_bisector(triangle[2],triangle[0],triangle[1]);
+          case 1 : return create_line_from_bisector(triangle[0],triangle[1],triangle[2]);
+          case 2 : return create_line_from_bisector(triangle[0],triangle[2],triangle[1]);
+         default : return degenerate_line3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> triangle_external_bisector(const triangle<T,2>& triangle,
+                                               const std::size_t& corner,
+                                               const std::size_t& opposing_corner)
+   {
+      return create_line_from_bisector(project_point_t(triangle[corner],triangle[opposing_corner],T(2.0)),
+                                       triangle[opposing_corner],
+                                       triangle[(opposing_corner + 1) % 3]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> triangle_external_bisector(const triangle<T,3>& triangle,
+                                               const std::size_t& corner,
+                                               const std::size_t& opposing_corner)
+   {
+      return create_line_from_bisector(project_point_t(triangle[corner],triangle[opposing_corner],T(2.0)),
+                                       triangle[opposing_corner],
+                                       triangle[(opposing_corner + 1) % 3]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> triangle_median(const triangle<T,2>& triangle, const std::size_t& median)
+   {
+      switch(median)
+      {
+          case 0 : return make_line(triangle[0],segment_mid_point(triangle[1],triangle[2]));
+          case 1 : return make_line(triangle[1],segment_mid_point(triangle[0],triangle[2]));
+          case 2 : return make_line(triangle[2],segment_mid_point(triangle[0],triangle[1]));
+         default : return degenerate_line2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> triangle_median(const triangle<T,3>& triangle, const std::size_t& median)
+   {
+      switch(median)
+      {
+          case 0 : return make_line(triangle[0],segment_mid_point(triangle[1],triangle[2]));
+          case 1 : return make_line(triangle[1],segment_mid_point(triangle[0],triangle[2]));
+          case 2 : return make_line(triangle[2],segment_mid_point(triangle[0],triangle[1]));
+         default : return degenerate_line3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> triangle_symmedian(const triangle<T,2>& triangle, const std::size_t& symmedian)
+   {
+      if (symmedian < 3)
+         return mirror(triangle_median(triangle,symmedian),triangle_bisector(triangle,symmedian));
+      else
+         return degenerate_line2d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> triangle_symmedian(const triangle<T,3>& triangle, const std::size_t& symmedian)
+   {
+      if (symmedian < 3)
+         return mirror(triangle_median(triangle,symmedian),triangle_bisector(triangle,symmedian));
+      else
+         return degenerate_line3d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> euler_line(const triangle<T,2>& triangle)
+   {
+      return make_line(centroid(triangle),orthocenter(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> euler_line(const triangle<T,3>& triangle)
+   {
+      return make_line(centroid(triangle),orthocenter(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> exmedian_point(const triangle<T,2>& triangle, const std::size_t& corner)
+   {
+      line<T,2> line1 = create_parallel_line_on_point(make_line(triangle[corner],triangle[(corner + 1) % 3]),triangle[(corner + 2) % 3]);
+      line<T,2> line2 = create_parallel_line_on_point(make_line(triangle[corner],triangle[(corner + 2) % 3]),triangle[(corner + 1) % 3]);
+
+      return intersection_point(line1,line2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> exmedian_point(const triangle<T,3>& triangle, const std::size_t& corner)
+   {
+      line<T,3> line1 = create_parallel_line_on_point(make_line(triangle[corner],triangle[(corner + 1) % 3]),triangle[(corner + 2) % 3]);
+      line<T,3> line2 = create_parallel_line_on_point(make_line(triangle[corner],triangle[(corner + 2) % 3]),triangle[(corner + 1) % 3]);
+
+      return intersection_point(line1,line2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> feuerbach_point(const triangle<T,2>& triangle)
+   {
+     point2d<T> ipoint1 = degenerate_point2d<T>();
+     point2d<T> ipoint2 = degenerate_point2d<T>();
+
+     intersection_point(inscribed_circle(triangle),nine_point_circle(triangle),ipoint1,ipoint2);
+
+     return ipoint1;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> confined_triangle_median(const triangle<T,2>& triangle,const point2d<T>& point, const std::size_t& median)
+   {
+      switch(median)
+      {
+         case 0 : return make_line(triangle[0],intersection_point(edge(triangle,1),make_line(triangle[0],point)));
+         case 1 : return make_line(triangle[1],intersection_point(edge(triangle,2),make_line(triangle[1],point)));
+         case 2 : return make_line(triangle[2],intersection_point(edge(triangle,0),make_line(triangle[2],point)));
+         default: return degenerate_line2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> confined_triangle_median(const triangle<T,3>& triangle,const point3d<T>& point, const std::size_t& median)
+   {
+      switch(median)
+      {
+         case 0 : return make_line(triangle[0],intersection_point(edge(triangle,1),make_line(triangle[0],point)));
+         case 1 : return make_line(triangle[1],intersection_point(edge(triangle,2),make_line(triangle[1],point)));
+         case 2 : return make_line(triangle[2],intersection_point(edge(triangle,0),make_line(triangle[2],point)));
+         default: return degenerate_line3d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> isogonal_conjugate(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return intersection_point
+             (
+               mirror(make_line(triangle[0], point),triangle_median(triangle, 0)),
+               mirror(make_line(triangle[1], point),triangle_median(triangle, 1))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> isogonal_conjugate(const point3d<T>& point, const triangle<T,3>& triangle)
+   {
+      return intersection_point
+             (
+               mirror(make_line(triangle[0], point), triangle_median(triangle, 0)),
+               mirror(make_line(triangle[1], point), triangle_median(triangle, 1))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> cyclocevian_conjugate(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      point2d<T> a_prime = intersection_point(make_line(triangle[0],point),make_line(edge(triangle,1)));
+      point2d<T> b_prime = intersection_point(make_line(triangle[1],point),make_line(edge(triangle,2)));
+      point2d<T> c_prime = intersection_point(make_line(triangle[2],point),make_line(edge(triangle,0)));
+
+      circle<T> circle = circumcircle(a_prime,b_prime,c_prime);
+
+      std::vector< point2d<T> > point_set1;
+      std::vector< point2d<T> > point_set2;
+
+      intersection_point(edge(triangle,1),circle,std::back_inserter(point_set1));
+      intersection_point(edge(triangle,2),circle,std::back_inserter(point_set2));
+
+      line<T,2> line_prime_a = degenerate_line2d<T>();
+      line<T,2> line_prime_b = degenerate_line2d<T>();
+
+      if (point_set1.size() == 2)
+      {
+         if (is_equal(point_set1[0],a_prime))
+            line_prime_a = make_line(triangle[0],point_set1[1]);
+         else
+            line_prime_a = make_line(triangle[0],point_set1[0]);
+      }
+      else if (point_set1.size() == 1)
+         line_prime_a = make_line(triangle[0],point_set1[0]);
+
+      if (point_set2.size() == 2)
+      {
+         if (is_equal(point_set2[0],b_prime))
+            line_prime_b = make_line(triangle[0],point_set2[1]);
+         else
+            line_prime_b = make_line(triangle[0],point_set2[0]);
+      }
+      else if (point_set2.size() == 1)
+         line_prime_b = make_line(triangle[0],point_set2[0]);
+
+      return intersection_point(line_prime_a,line_prime_b);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> symmedian_point(const triangle<T,2>& triangle)
+   {
+      return isogonal_conjugate(centroid(triangle),triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> symmedian_point(const triangle<T,3>& triangle)
+   {
+      return isogonal_conjugate(centroid(triangle),triangle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_triangle(const T& x1, const T& y1,
+                                           const T& x2, const T& y2,
+                                                 T& x3,       T& y3)
+   {
+      const T sin60 = T(0.86602540378443864676372317075294);
+      const T cos60 = T(0.50000000000000000000000000000000);
+
+      /* translate for x1,y1 to be origin */
+      const T tx = x2 - x1;
+      const T ty = y2 - y1;
+
+      /* rotate 60 degrees and translate back */
+      x3 = ((tx * cos60) - (ty * sin60)) + x1;
+      y3 = ((ty * cos60) + (tx * sin60)) + y1;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_triangle(const point2d<T>& point1,
+                                           const point2d<T>& point2,
+                                                 point2d<T>& point3)
+   {
+      return create_equilateral_triangle
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2)
+   {
+      triangle<T,2> triangle_;
+
+      triangle_[0].x = x1;
+      triangle_[0].y = y1;
+      triangle_[1].x = x2;
+      triangle_[1].y = y2;
+
+      create_equilateral_triangle(x1, y1, x2, y2, triangle_[2].x, triangle_[2].y);
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const point2d<T>& point1,
+                                                    const point2d<T>& point2)
+   {
+      return create_equilateral_triangle(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const T& cx, const T& cy, const T& side_length)
+   {
+      return center_at_location
+             (
+               create_equilateral_triangle(-side_length * T(0.5), T(0.0), side_length * T(0.5), T(0.0)),
+               cx, cy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_equilateral_triangle(const point2d<T>& center_point, const T& side_length)
+   {
+      return create_equilateral_triangle(center_point.x,center_point.y,side_length);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_isosceles_triangle(const point2d<T>& point1, const point2d<T>& point2, const T& angle)
+   {
+      return create_triangle(point1,point2,angle,angle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_isosceles_triangle(const segment<T,2>& segment, const T& angle)
+   {
+      return create_isosceles_triangle(segment[0],segment[1],angle);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_triangle(const point2d<T>& point1, const point2d<T>& point2, const T& angle1, const T& angle2)
+   {
+      if (greater_than_or_equal(angle1 + angle2, T(180.0)))
+      {
+         return degenerate_triangle2d<T>();
+      }
+
+      const T bearing = cartesian_angle(point2.x - point1.x,point2.y - point1.y);
+
+      T theta_a = T(0.0);
+      T theta_b = T(0.0);
+
+      switch(quadrant(bearing))
+      {
+         case 1 : {
+                     theta_a = normalize_angle(bearing - angle1);
+                     theta_b = normalize_angle(T(180.0) + bearing + angle2);
+                  }
+                  break;
+
+         case 2 : {
+                     theta_a = normalize_angle(bearing - angle1);
+                     theta_b = normalize_angle(T(180.0) + bearing + angle2);
+                  }
+                  break;
+
+         case 3 : {
+                     theta_a = normalize_angle(bearing - angle1);
+                     theta_b = normalize_angle(bearing - T(180.0) + angle2);
+                  }
+                  break;
+
+         case 4 : {
+                     theta_a = normalize_angle(bearing - angle1);
+                     theta_b = normalize_angle(T(180.0) - (T(360.0) - bearing) + angle2);
+                  }
+                  break;
+      }
+
+      const ray<T,2> ray1 = make_ray(point1,theta_a);
+      const ray<T,2> ray2 = make_ray(point2,theta_b);
+
+      return make_triangle
+             (
+               intersection_point(ray1,ray2),
+               point1,
+               point2
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_triangle(const segment<T,2>& segment, const T& angle1, const T& angle2)
+   {
+      return create_triangle(segment[0],segment[1],angle1,angle2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_morley_triangle(const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> tri = triangle;
+
+      if (orientation(tri[0],tri[1],tri[2]) == LeftHandSide)
+      {
+        swap(tri[0],tri[1]);
+      }
+
+      const T angle1 = vertex_angle<T>(tri[2], tri[0], tri[1]) * T(1.0 / 3.0);
+      const T angle2 = vertex_angle<T>(tri[0], tri[1], tri[2]) * T(1.0 / 3.0);
+      const T angle3 = vertex_angle<T>(tri[1], tri[2], tri[0]) * T(1.0 / 3.0);
+
+      const wykobi::triangle<T,2> triangle1 = create_triangle(edge(tri, 0), angle1, angle2);
+      const wykobi::triangle<T,2> triangle2 = create_triangle(edge(tri, 1), angle2, angle3);
+      const wykobi::triangle<T,2> triangle3 = create_triangle(edge(tri, 2), angle3, angle1);
+
+      return make_triangle(triangle1[0], triangle2[0], triangle3[0]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_cevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      return make_triangle
+            (
+              intersection_point(make_segment(triangle[0], point), edge(triangle, 1)),
+              intersection_point(make_segment(triangle[1], point), edge(triangle, 2)),
+              intersection_point(make_segment(triangle[2], point), edge(triangle, 0))
+            );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_cevian_triangle(const triangle<T,3>& triangle, const point3d<T>& point)
+   {
+      return make_triangle
+             (
+               intersection_point(make_segment(triangle[0], point), edge(triangle, 1)),
+               intersection_point(make_segment(triangle[1], point), edge(triangle, 2)),
+               intersection_point(make_segment(triangle[2], point), edge(triangle, 0))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_anticevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      std::vector< point2d<T> > point_list(3,degenerate_point2d<T>());
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         typedef const wykobi::line<T,2> line2d_t;
+
+         line2d_t opp_edge    = wykobi::make_line(opposing_edge(triangle,i));
+         line2d_t cevian_edge = wykobi::make_line(triangle[i],point);
+         line2d_t orthic_edge = wykobi::make_line
+                                        (
+                                          triangle[i],
+                                          wykobi::closest_point_on_line_from_point(opp_edge,triangle[i])
+                                        );
+
+         //if (!robust_collinear(orthic_edge,point))
+         {
+            point_list[i] = wykobi::intersection_point(cevian_edge, make_line(orthic_edge[i], wykobi::mirror(point,opp_edge)));
+         }
+         //else
+         //   point_list[i] = triangle[i];
+      }
+
+      /* Note: Buggy - DO NOT USE !*/
+      return make_triangle(point_list[0], point_list[1], point_list[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_anticevian_triangle(const triangle<T,3>& triangle, const point3d<T>& point)
+   {
+      return make_triangle
+             (
+               intersection_point
+               (
+                 make_line(triangle[0],point),
+                 make_line
+                 (
+                   closest_point_on_line_from_point(make_line(opposing_edge(triangle,0)),triangle[0]),
+                   mirror(point,make_line(opposing_edge(triangle,0)))
+                 )
+               ),
+               intersection_point
+               (
+                 make_line(triangle[1],point),
+                 make_line
+                 (
+                   closest_point_on_line_from_point(make_line(opposing_edge(triangle,1)),triangle[1]),
+                   mirror(point,make_line(opposing_edge(triangle,1)))
+                 )
+               ),
+               intersection_point
+               (
+                 make_line(triangle[2],point),
+                 make_line
+                 (
+                   closest_point_on_line_from_point(make_line(opposing_edge(triangle,2)),triangle[2]),
+                   mirror(point,make_line(opposing_edge(triangle,2)))
+                 )
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_anticomplementary_triangle(const triangle<T,2>& triangle)
+   {
+      return make_triangle
+             (
+               exmedian_point(triangle,0),
+               exmedian_point(triangle,1),
+               exmedian_point(triangle,2)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_anticomplementary_triangle(const triangle<T,3>& triangle)
+   {
+      return make_triangle
+             (
+               exmedian_point(triangle,0),
+               exmedian_point(triangle,1),
+               exmedian_point(triangle,2)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_inner_napoleon_triangle(const triangle<T,2>& triangle)
+   {
+      if (orientation(triangle) == RightHandSide)
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_triangle(triangle[1], triangle[0])),
+                  centroid(create_equilateral_triangle(triangle[2], triangle[1])),
+                  centroid(create_equilateral_triangle(triangle[0], triangle[2]))
+                );
+      }
+      else
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_triangle(triangle[0], triangle[1])),
+                  centroid(create_equilateral_triangle(triangle[1], triangle[2])),
+                  centroid(create_equilateral_triangle(triangle[2], triangle[0]))
+                );
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_outer_napoleon_triangle(const triangle<T,2>& triangle)
+   {
+      if (orientation(triangle) == RightHandSide)
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_triangle(triangle[0], triangle[1])),
+                  centroid(create_equilateral_triangle(triangle[1], triangle[2])),
+                  centroid(create_equilateral_triangle(triangle[2], triangle[0]))
+                );
+      }
+      else
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_triangle(triangle[1], triangle[0])),
+                  centroid(create_equilateral_triangle(triangle[2], triangle[1])),
+                  centroid(create_equilateral_triangle(triangle[0], triangle[2]))
+                );
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_inner_vecten_triangle(const triangle<T,2>& triangle)
+   {
+      if (orientation(triangle) == RightHandSide)
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 0)))),
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 1)))),
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 2))))
+                );
+      }
+      else
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_quadix(edge(triangle, 0))),
+                  centroid(create_equilateral_quadix(edge(triangle, 1))),
+                  centroid(create_equilateral_quadix(edge(triangle, 2)))
+                );
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_outer_vecten_triangle(const triangle<T,2>& triangle)
+   {
+      if (orientation(triangle) == RightHandSide)
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_quadix(edge(triangle, 0))),
+                  centroid(create_equilateral_quadix(edge(triangle, 1))),
+                  centroid(create_equilateral_quadix(edge(triangle, 2)))
+                );
+      }
+      else
+      {
+         return make_triangle
+                (
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 0)))),
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 1)))),
+                  centroid(create_equilateral_quadix(reverse_segment(edge(triangle, 2))))
+                );
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_medial_triangle(const triangle<T,2>& triangle)
+   {
+      return make_triangle
+             (
+               segment_mid_point(triangle[0], triangle[1]),
+               segment_mid_point(triangle[1], triangle[2]),
+               segment_mid_point(triangle[2], triangle[0])
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_medial_triangle(const triangle<T,3>& triangle)
+   {
+      return make_triangle
+             (
+               segment_mid_point(triangle[0], triangle[1]),
+               segment_mid_point(triangle[1], triangle[2]),
+               segment_mid_point(triangle[2], triangle[0])
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_contact_triangle(const triangle<T,2>& triangle)
+   {
+      point2d<T> center = incenter(triangle);
+
+      return make_triangle
+             (
+               closest_point_on_line_from_point(make_line(edge(triangle, 0)), center),
+               closest_point_on_line_from_point(make_line(edge(triangle, 1)), center),
+               closest_point_on_line_from_point(make_line(edge(triangle, 2)), center)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_contact_triangle(const triangle<T,3>& triangle)
+   {
+      point3d<T> center = incenter(triangle);
+
+      return make_triangle
+             (
+               closest_point_on_line_from_point(make_line(edge(triangle, 0)),center),
+               closest_point_on_line_from_point(make_line(edge(triangle, 1)),center),
+               closest_point_on_line_from_point(make_line(edge(triangle, 2)),center)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_symmedial_triangle(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      return make_triangle
+             (
+               intersection_point(make_line(triangle[0], point),make_line(edge(triangle, 1))),
+               intersection_point(make_line(triangle[1], point),make_line(edge(triangle, 2))),
+               intersection_point(make_line(triangle[2], point),make_line(edge(triangle, 0)))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_orthic_triangle(const triangle<T,2>& triangle)
+   {
+      return make_triangle
+            (
+              closest_point_on_line_from_point(make_line(edge(triangle, 0)),triangle[2]),
+              closest_point_on_line_from_point(make_line(edge(triangle, 1)),triangle[0]),
+              closest_point_on_line_from_point(make_line(edge(triangle, 2)),triangle[1])
+            );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_orthic_triangle(const triangle<T,3>& triangle)
+   {
+      return make_triangle
+             (
+               closest_point_on_line_from_point(make_line(edge(triangle, 0)), triangle[2]),
+               closest_point_on_line_from_point(make_line(edge(triangle, 1)), triangle[0]),
+               closest_point_on_line_from_point(make_line(edge(triangle, 2)), triangle[1])
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_pedal_triangle(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      return make_triangle
+             (
+               closest_point_on_line_from_point(make_line(edge(triangle, 0)), point),
+               closest_point_on_line_from_point(make_line(edge(triangle, 1)), point),
+               closest_point_on_line_from_point(make_line(edge(triangle, 2)), point)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_pedal_triangle(const point3d<T>& point, const triangle<T,3>& triangle)
+   {
+      return make_triangle
+             (
+               closest_point_on_line_from_point(make_line(edge(triangle, 0)), point),
+               closest_point_on_line_from_point(make_line(edge(triangle, 1)), point),
+               closest_point_on_line_from_point(make_line(edge(triangle, 2)), point)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_antipedal_triangle(const point2d<T>& point, const triangle<T,2>& triangle)
+   {
+      typedef const line<T,2> line_t;
+
+      line_t line1 = create_perpendicular_line_at_end_point(make_line(point,closest_point_on_line_from_point(make_line(edge(triangle,0)),point)));
+      line_t line2 = create_perpendicular_line_at_end_point(make_line(point,closest_point_on_line_from_point(make_line(edge(triangle,1)),point)));
+      line_t line3 = create_perpendicular_line_at_end_point(make_line(point,closest_point_on_line_from_point(make_line(edge(triangle,2)),point)));
+
+      return make_triangle
+             (
+               intersection_point(line1, line2),
+               intersection_point(line1, line3),
+               intersection_point(line2, line3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_excentral_triangle(const triangle<T,2>& triangle)
+   {
+      return make_triangle(excenter(triangle,0),excenter(triangle,1),excenter(triangle,2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_excentral_triangle(const triangle<T,3>& triangle)
+   {
+      return make_triangle(excenter(triangle,0),excenter(triangle,1),excenter(triangle,2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_incentral_triangle(const triangle<T,2>& triangle)
+   {
+      return create_cevian_triangle(triangle,incenter(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_incentral_triangle(const triangle<T,3>& triangle)
+   {
+      return create_cevian_triangle(triangle,incenter(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_intouch_triangle(const triangle<T,2>& triangle)
+   {
+      const point2d<T> p = make_point(wykobi::inscribed_circle(triangle));
+
+      return make_triangle
+             (
+               closest_point_on_segment_from_point(opposing_edge(triangle,0), p),
+               closest_point_on_segment_from_point(opposing_edge(triangle,1), p),
+               closest_point_on_segment_from_point(opposing_edge(triangle,2), p)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_extouch_triangle(const triangle<T,2>& triangle)
+   {
+      wykobi::triangle<T,2> triangle_ = create_excentral_triangle(triangle);
+
+      triangle_[0] = closest_point_on_segment_from_point(opposing_edge(triangle,0), triangle_[0]);
+      triangle_[1] = closest_point_on_segment_from_point(opposing_edge(triangle,1), triangle_[1]);
+      triangle_[2] = closest_point_on_segment_from_point(opposing_edge(triangle,2), triangle_[2]);
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> create_extouch_triangle(const triangle<T,3>& triangle)
+   {
+      wykobi::triangle<T,3> triangle_ = create_excentral_triangle(triangle);
+
+      triangle_[0] = closest_point_on_segment_from_point(opposing_edge(triangle,0), triangle_[0]);
+      triangle_[1] = closest_point_on_segment_from_point(opposing_edge(triangle,1), triangle_[1]);
+      triangle_[2] = closest_point_on_segment_from_point(opposing_edge(triangle,2), triangle_[2]);
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_feuerbach_triangle(const triangle<T,2>& triangle)
+   {
+      circle<T> circle = nine_point_circle(triangle);
+
+      return make_triangle
+             (
+               project_point(make_point(circle), make_point(excircle(triangle, 0)), circle.radius),
+               project_point(make_point(circle), make_point(excircle(triangle, 1)), circle.radius),
+               project_point(make_point(circle), make_point(excircle(triangle, 2)), circle.radius)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_circumcevian_triangle(const triangle<T,2>& triangle, const point2d<T>& point)
+   {
+      circle<T> circum_circle = make_circle(triangle);
+
+      wykobi::triangle<T,2> triangle_ = degenerate_triangle2d<T>();
+
+      std::vector< point2d<T> > ipoint;
+
+      intersection_point
+      (
+        make_line(triangle[0], point),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size())) return triangle_;
+
+      triangle_[0] = (is_equal(ipoint[0],triangle[0])) ? ipoint[1] : ipoint[0];
+
+      ipoint.clear();
+
+      intersection_point
+      (
+        make_line(triangle[1], point),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size())) return triangle_;
+
+      triangle_[1] = (is_equal(ipoint[0],triangle[1])) ? ipoint[1] : ipoint[0];
+
+      ipoint.clear();
+
+      intersection_point
+      (
+        make_line(triangle[2], point),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size())) return triangle_;
+
+      triangle_[2] = (is_equal(ipoint[0],triangle[2])) ? ipoint[1] : ipoint[0];
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_circummedial_triangle(const triangle<T,2>& triangle)
+   {
+      circle<T> circum_circle = make_circle(triangle);
+
+      wykobi::triangle<T,2> triangle_ = degenerate_triangle2d<T>();
+
+      point2d<T> point_ = centroid(triangle);
+
+      std::vector< point2d<T> > ipoint;
+
+      intersection_point
+      (
+        make_line(triangle[0], point_),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size()))
+         return triangle_;
+
+      triangle_[0] = (is_equal(ipoint[0],triangle[0])) ? ipoint[1] : ipoint[0];
+
+      ipoint.clear();
+
+      intersection_point
+      (
+        make_line(triangle[1], point_),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size()))
+         return triangle_;
+
+      triangle_[1] = (is_equal(ipoint[0], triangle[1])) ? ipoint[1] : ipoint[0];
+
+      ipoint.clear();
+
+      intersection_point
+      (
+        make_line(triangle[2], point_),
+        circum_circle,
+        std::back_inserter(ipoint)
+      );
+
+      if (ipoint.empty() || (2 != ipoint.size()))
+         return triangle_;
+
+      triangle_[2] = (is_equal(ipoint[0],triangle[2])) ? ipoint[1] : ipoint[0];
+
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> create_first_brocard_triangle(const triangle<T,2>& triangle)
+   {
+      point2d<T> o = circumcenter(triangle);
+      point2d<T> k = symmedian_point(triangle);
+      circle<T> circle = make_circle(o,k);
+
+      point2d<T> closest_point;
+
+      wykobi::triangle<T,2> result;
+
+      std::vector< point2d<T> > int_pts;
+
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         closest_point = closest_point_on_segment_from_point(edge(triangle, i), o);
+
+         intersection_point
+         (
+           make_segment(o, closest_point),
+           circle,
+           std::back_inserter(int_pts)
+         );
+
+         result[i] = (is_equal(o,int_pts[0]) ? int_pts[1] : int_pts[2]);
+
+         int_pts.resize(0);
+      }
+
+      return result;
+   }
+
+   template <typename T> WYKOBI_INLINE void create_right_triangle(const wykobi::point2d<T>& p1, const wykobi::point2d<T>& p2,
+                                                                 wykobi::point2d<T>& c1,       wykobi::point2d<T>& c2)
+   {
+      const T distance = wykobi::distance(p1,p2);
+
+      const wykobi::point2d <T> mid = wykobi::segment_mid_point(p1,p2);
+      const wykobi::vector2d<T>   v = wykobi::normalize(wykobi::perpendicular(p1 - p2)) * (distance / T(2.0));
+
+      c1 = mid + v;
+      c2 = mid - v;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_quadix(const T& x1, const T& y1,
+                                         const T& x2, const T& y2,
+                                               T& x3,       T& y3,
+                                               T& x4,       T& y4)
+   {
+      const T tx = x2 - x1;
+      const T ty = y2 - y1;
+
+      x4 = x1 - ty;
+      y4 = y1 + tx;
+      x3 = x2 - ty;
+      y3 = y2 + tx;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void create_equilateral_quadix(const point2d<T>& point1,
+                                         const point2d<T>& point2,
+                                               point2d<T>& point3,
+                                               point2d<T>& point4)
+   {
+      return create_equilateral_quadix
+             (
+               point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y,
+               point4.x,point4.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const T& x1, const T& y1,
+                                                const T& x2, const T& y2)
+   {
+      quadix<T,2> quadix_;
+
+      quadix_[0].x = x1;
+      quadix_[0].y = y1;
+      quadix_[1].x = x2;
+      quadix_[1].y = y2;
+
+      create_equilateral_quadix(x1, y1, x2, y2, quadix_[2].x, quadix_[2].y, quadix_[3].x, quadix_[3].y);
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const point2d<T>& point1,
+                                                const point2d<T>& point2)
+   {
+      return create_equilateral_quadix(point1.x, point1.y, point2.x, point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const segment<T,2>& segment)
+   {
+      return create_equilateral_quadix(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const T& cx, const T& cy, const T& side_length)
+   {
+      return center_at_location
+             (
+               create_equilateral_quadix(-side_length * T(0.5), T(0.0), side_length * T(0.5), T(0.0)),
+               cx, cy
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> create_equilateral_quadix(const point2d<T>& center_point, const T& side_length)
+   {
+      return create_equilateral_quadix(center_point.x, center_point.y, side_length);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void torricelli_point(const T& x1, const T& y1,
+                                const T& x2, const T& y2,
+                                const T& x3, const T& y3,
+                                      T& px,       T& py)
+   {
+      /*
+         Proven by Bonaventura Francesco Cavalieri in the book
+         "Exercitationes geometricae sex" 1647. The theory goes,
+         if the triangle has an angle of 120 degrees or more the
+         toricelli point lies at the vertex of the large angle.
+         Otherwise the point at which the simpson lines intersect
+         is said to be the optimal solution.
+         To find an intersection in 2D, all that is needed is 2
+         lines (segments), hence not all three of the simpson
+         lines are calculated.
+      */
+      if (greater_than_or_equal(vertex_angle(x1,y1,x2,y2,x3,y3),T(120.0)))
+      {
+         px = x2;
+         py = y2;
+
+         return;
+      }
+      else if (greater_than_or_equal(vertex_angle(x3,y3,x1,y1,x2,y2),T(120.0)))
+      {
+         px = x1;
+         py = y1;
+
+         return;
+      }
+      else if (greater_than_or_equal(vertex_angle(x2,y2,x3,y3,x1,y1),T(120.0)))
+      {
+         px = x3;
+         py = y3;
+
+         return;
+      }
+      else
+      {
+         T oetx1 = T(0.0);
+         T oety1 = T(0.0);
+         T oetx2 = T(0.0);
+         T oety2 = T(0.0);
+
+         if (orientation(x1,y1,x2,y2,x3,y3) == RightHandSide)
+         {
+            create_equilateral_triangle(x1, y1, x2, y2, oetx1, oety1);
+            create_equilateral_triangle(x2, y2, x3, y3, oetx2, oety2);
+         }
+         else
+         {
+            create_equilateral_triangle(x2, y2, x1, y1, oetx1, oety1);
+            create_equilateral_triangle(x3, y3, x2, y2, oetx2, oety2);
+         }
+
+         intersection_point(oetx1,oety1,x3,y3,oetx2,oety2,x1,y1,px,py);
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> torricelli_point(const point2d<T>& point1,
+                                      const point2d<T>& point2,
+                                      const point2d<T>& point3)
+   {
+      point2d<T> point_;
+
+      torricelli_point
+      (
+        point1.x,point1.y,
+        point2.x,point2.y,
+        point3.x,point3.y,
+        point_.x,point_.y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> torricelli_point(const triangle<T,2>& triangle)
+   {
+      return torricelli_point(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool trilateration(const T& c0x, const T& c0y, const T& c0r,
+                             const T& c1x, const T& c1y, const T& c1r,
+                             const T& c2x, const T& c2y, const T& c2r,
+                                   T&  px,       T&  py)
+   {
+
+      if (
+           (lay_distance(c0x, c0y, c1x, c1y) > sqr(c0r + c1r)) ||
+           (lay_distance(c0x, c0y, c2x, c2y) > sqr(c0r + c2r)) ||
+           (lay_distance(c1x, c1y, c2x, c2y) > sqr(c1r + c2r))
+         )
+         return false;
+
+      const T eqn0 = T(2.0) * (c1x - c0x);
+      const T eqn1 = T(2.0) * (c1y - c0y);
+      const T eqn2 = sqr(c0r) - sqr(c1r) - sqr(c0x) + sqr(c1x) - sqr(c0y) + sqr(c1y);
+      const T eqn3 = T(2.0) * (c2x - c1x);
+      const T eqn4 = T(2.0) * (c2y - c1y);
+      const T eqn5 = sqr(c1r) - sqr(c2r) - sqr(c1x) + sqr(c2x) - sqr(c1y) + sqr(c2y);
+
+      const T det = (eqn0 * eqn4) - (eqn1 * eqn3);
+
+      if (is_equal(det,T(0.0)))
+      {
+         return false;
+      }
+
+      px = ((eqn2 * eqn4) - (eqn5 * eqn1)) / det;
+      py = ((eqn0 * eqn5) - (eqn2 * eqn3)) / det;
+
+      return true;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> trilateration(const circle<T>& c0, const circle<T>& c1, const circle<T>& c2)
+   {
+      point2d<T> p;
+
+      const bool result = trilateration
+                          (
+                            c0.x, c0.y, c0.radius,
+                            c1.x, c1.y, c1.radius,
+                            c2.x, c2.y, c2.radius,
+                            p.x,   p.y
+                          );
+
+      return result ? p : degenerate_point2d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void incenter(const T& x1, const T& y1,
+                        const T& x2, const T& y2,
+                        const T& x3, const T& y3,
+                              T& px,       T& py)
+   {
+      /* Using Heron's s=ur */
+      const T side12 = distance(x1,y1,x2,y2);
+      const T side23 = distance(x2,y2,x3,y3);
+      const T side31 = distance(x3,y3,x1,y1);
+      const T perim  = T(1.0) / (side12 + side23 + side31);
+
+      px = (side23 * x1 + side31 * x2 + side12 * x3) * perim;
+      py = (side23 * y1 + side31 * y2 + side12 * y3) * perim;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void incenter(const T& x1, const T& y1, const T& z1,
+                        const T& x2, const T& y2, const T& z2,
+                        const T& x3, const T& y3, const T& z3,
+                              T& px,       T& py,       T& pz)
+   {
+      /* Using Heron's s=ur */
+      const T side12 = distance(x1,y1,z1,x2,y2,z2);
+      const T side23 = distance(x2,y2,z2,x3,y3,z3);
+      const T side31 = distance(x3,y3,z3,x1,y1,z1);
+      const T perim  = T(1.0) / (side12 + side23 + side31);
+
+      px = (side23 * x1 + side31 * x2 + side12 * x3) * perim;
+      py = (side23 * y1 + side31 * y2 + side12 * y3) * perim;
+      pz = (side23 * z1 + side31 * z2 + side12 * z3) * perim;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> incenter(const point2d<T>& point1,
+                              const point2d<T>& point2,
+                              const point2d<T>& point3)
+   {
+      point2d<T> point_;
+
+      incenter
+      (
+        point1.x, point1.y,
+        point2.x, point2.y,
+        point3.x, point3.y,
+        point_.x, point_.y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> incenter(const point3d<T>& point1,
+                              const point3d<T>& point2,
+                              const point3d<T>& point3)
+   {
+      point3d<T> point_;
+
+      incenter
+      (
+        point1.x, point1.y, point1.z,
+        point2.x, point2.y, point2.z,
+        point3.x, point3.y, point3.z,
+        point_.x, point_.y, point_.z
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> incenter(const triangle<T,2>& triangle)
+   {
+      return incenter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> incenter(const triangle<T,3>& triangle)
+   {
+      return incenter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circumcenter(const T& x1, const T& y1,
+                            const T& x2, const T& y2,
+                            const T& x3, const T& y3,
+                                  T& px,       T& py)
+   {
+      const T a = x2 - x1;
+      const T b = y2 - y1;
+      const T c = x3 - x1;
+      const T d = y3 - y1;
+      const T e = a * (x1 + x2) + b * (y1 + y2);
+      const T f = c * (x1 + x3) + d * (y1 + y3);
+      const T g = T(2.0) * (a * (y3 - y2) - b * (x3 - x2));
+
+      if (is_equal(g,T(0.0)))
+      {
+         px = infinity<T>();
+         py = infinity<T>();
+      }
+      else
+      {
+         px = (d * e - b * f) / g;
+         py = (a * f - c * e) / g;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circumcenter(const T& x1, const T& y1, const T& z1,
+                            const T& x2, const T& y2, const T& z2,
+                            const T& x3, const T& y3, const T& z3,
+                                  T& px,       T& py,       T& pz)
+   {
+      const plane<T,3> tri_plane = make_plane(x1,y1,z1,x2,y2,z2,x3,y3,z3);
+
+      const vector3d<T> vec1 = make_vector(x1 - x2,y1 - y2,z1 - z2);
+      const vector3d<T> vec2 = make_vector(x3 - x2,y3 - y2,z3 - z2);
+
+      const point3d<T> p1 = make_point((x1 + x2) * T (0.5),(y1 + y2) * T (0.5),(z1 + z2) * T (0.5));
+      const point3d<T> p2 = make_point((x3 + x2) * T (0.5),(y3 + y2) * T (0.5),(z3 + z2) * T (0.5));
+
+      const point3d<T> p1_ = p1 + (vec1 * tri_plane.normal);
+      const point3d<T> p2_ = p2 + (vec2 * tri_plane.normal);
+
+      intersection_point_line_to_line
+      (
+        p1.x , p1.y , p1.z ,
+        p1_.x, p1_.y, p1_.z,
+        p2.x , p2.y , p2.z ,
+        p2_.x, p2_.y, p2_.z,
+        px   , py   , pz   , T(Epsilon)
+      );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> circumcenter(const point2d<T>& point1,
+                                  const point2d<T>& point2,
+                                  const point2d<T>& point3)
+   {
+      point2d<T> point_;
+
+      circumcenter
+      (
+        point1.x, point1.y,
+        point2.x, point2.y,
+        point3.x, point3.y,
+        point_.x, point_.y
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> circumcenter(const point3d<T>& point1,
+                                  const point3d<T>& point2,
+                                  const point3d<T>& point3)
+   {
+      point3d<T> point_;
+
+      circumcenter
+      (
+        point1.x, point1.y, point1.z,
+        point2.x, point2.y, point2.z,
+        point3.x, point3.y, point3.z,
+        point_.x, point_.y, point_.z
+      );
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> circumcenter(const triangle<T,2>& triangle)
+   {
+      return circumcenter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> circumcenter(const triangle<T,3>& triangle)
+   {
+      return circumcenter(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const T& x1, const T& y1,
+                                 const T& x2, const T& y2,
+                                 const T& x3, const T& y3)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+
+      circumcenter(x1,y1,x2,y2,x3,y3,cx,cy);
+
+      return make_circle(cx,cy,distance(cx,cy,x1,y1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const point2d<T>& point1,
+                                 const point2d<T>& point2,
+                                 const point2d<T>& point3)
+   {
+      return circumcircle
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> circumcircle(const triangle<T,2>& triangle)
+   {
+      return circumcircle(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3)
+   {
+      T cx = T(0.0);
+      T cy = T(0.0);
+      T cz = T(0.0);
+
+      circumcenter(x1, y1, z1, x2, y2, z2, x3, y3, z3, cx, cy, cz);
+
+      return make_sphere
+             (
+               cx, cy, cz,
+               distance(cx, cy, cz, x1, y1, z2)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const point3d<T>& point1,
+                                 const point3d<T>& point2,
+                                 const point3d<T>& point3)
+   {
+      return circumsphere
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> circumsphere(const triangle<T,3>& triangle)
+   {
+      return circumsphere(triangle[0], triangle[1], triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const T& x1, const T& y1,
+                                     const T& x2, const T& y2,
+                                     const T& x3, const T& y3)
+   {
+      /* using heron's s = ur */
+      const T side12    = distance(x1,y1,x2,y2);
+      const T side23    = distance(x2,y2,x3,y3);
+      const T side31    = distance(x3,y3,x1,y1);
+      const T perimeter = T(1.0) / (side12 + side23 + side31);
+
+      return make_circle(
+                          (side23 * x1 + side31 * x2 + side12 * x3) * perimeter,
+                          (side23 * y1 + side31 * y2 + side12 * y3) * perimeter,
+                          T(0.5) * sqrt((-side12 + side23 + side31) * (side12 - side23 + side31) * (side12 + side23 - side31) * perimeter)
+                        );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const point2d<T>& point1,
+                                     const point2d<T>& point2,
+                                     const point2d<T>& point3)
+   {
+      return inscribed_circle
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> inscribed_circle(const triangle<T,2>& triangle)
+   {
+      return inscribed_circle(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const T& x1, const T& y1, const T& z1,
+                                     const T& x2, const T& y2, const T& z2,
+                                     const T& x3, const T& y3, const T& z3)
+   {
+      point3d<T> int_point = intersection_point
+                             (
+                               create_line_from_bisector(x1, y1, z1, x2, y2, z2, x3, y3, z3),
+                               create_line_from_bisector(x2, y2, z2, x3, y3, z3, x1, y1, z1),
+                               T(Epsilon)
+                             );
+
+      return make_sphere
+             (
+               int_point,
+               distance
+               (
+                 int_point,
+                 closest_point_on_line_from_point
+                 (
+                   make_line(x1, y1, z1, x2, y2, z2),
+                   int_point
+                 )
+               )
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const point3d<T>& point1,
+                                     const point3d<T>& point2,
+                                     const point3d<T>& point3)
+   {
+      return inscribed_sphere
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> inscribed_sphere(const triangle<T,3>& triangle)
+   {
+      return inscribed_sphere(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const T& x1, const T& y1,
+                                      const T& x2, const T& y2,
+                                      const T& x3, const T& y3)
+   {
+      T hx1 = T(0.0);
+      T hy1 = T(0.0);
+      T hx2 = T(0.0);
+      T hy2 = T(0.0);
+      T hx3 = T(0.0);
+      T hy3 = T(0.0);
+
+      closest_point_on_line_from_point(x2, y2, x3, y3, x1, y1, hx1, hy1);
+      closest_point_on_line_from_point(x1, y1, x3, y3, x2, y2, hx2, hy2);
+      closest_point_on_line_from_point(x1, y1, x2, y2, x3, y3, hx3, hy3);
+
+      return circumcircle(hx1, hy1, hx2, hy2, hx3, hy3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const point2d<T>& point1,
+                                      const point2d<T>& point2,
+                                      const point2d<T>& point3)
+   {
+      return nine_point_circle
+             (
+               point1.x, point1.y,
+               point2.x, point2.y,
+               point3.x, point3.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> nine_point_circle(const triangle<T,2>& triangle)
+   {
+      return nine_point_circle(triangle[0],triangle[1],triangle[2]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> orthocenter(const triangle<T,2>& triangle)
+   {
+      return intersection_point
+             (
+               make_line(triangle[0], closest_point_on_line_from_point(make_line(opposing_edge(triangle, 0)), triangle[0])),
+               make_line(triangle[1], closest_point_on_line_from_point(make_line(opposing_edge(triangle, 1)), triangle[0]))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> orthocenter(const triangle<T,3>& triangle)
+   {
+      return intersection_point
+             (
+               make_line(triangle[0], closest_point_on_line_from_point(make_line(opposing_edge(triangle, 0)), triangle[0])),
+               make_line(triangle[1], closest_point_on_line_from_point(make_line(opposing_edge(triangle, 1)), triangle[0]))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> excenter(const triangle<T,2>& triangle, const std::size_t& corner)
+   {
+      return intersection_point
+             (
+               triangle_bisector(triangle, corner),
+               triangle_external_bisector(triangle, corner,(corner + 1) % 3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> excenter(const triangle<T,3>& triangle, const std::size_t& corner)
+   {
+      return intersection_point
+             (
+               triangle_bisector(triangle, corner),
+               triangle_external_bisector(triangle, corner,(corner + 1) % 3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> excircle(const triangle<T,2>& triangle, const std::size_t& i)
+   {
+      if (i < 3)
+      {
+         const point2d<T> center = excenter(triangle,i);
+         const T          radius = minimum_distance_from_point_to_segment
+                                   (
+                                     center,
+                                     opposing_edge(triangle,i)
+                                   );
+
+         return make_circle(center,radius);
+      }
+      else
+         return degenerate_circle<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> mandart_circle(const triangle<T,2>& triangle)
+   {
+      return circumcircle(create_extouch_triangle(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> brocard_circle(const triangle<T,2>& triangle)
+   {
+      return make_circle(circumcenter(triangle),symmedian_point(triangle));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> invert_circle_across_circle(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      const T t = sqr(circle2.radius) /
+                     (
+                       sqr(circle2.x - circle1.x) +
+                       sqr(circle2.y - circle1.y) -
+                       sqr(circle1.radius)
+                     );
+
+      return make_circle(project_point_t(make_point(circle2),make_point(circle1),t),t * circle1.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> invert_sphere_across_sphere(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      const T t = sqr(sphere2.radius) /
+                  (
+                    sqr(sphere2.x - sphere1.x) +
+                    sqr(sphere2.y - sphere1.y) +
+                    sqr(sphere2.z - sphere1.z) -
+                    sqr(sphere1.radius)
+                  );
+
+      return make_sphere(project_point_t(make_point(sphere2),make_point(sphere1),t),t * sphere1.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circle_tangent_points(const circle<T>& circle, const point2d<T>& point, point2d<T>& point1, point2d<T>& point2)
+   {
+      const vector2d<T> v = point - make_point(circle);
+      const T sqr_length  = sqr(v.x) + sqr(v.y);
+      const T radius_sqr  = sqr(circle.radius);
+
+      if (greater_than_or_equal(sqr_length,radius_sqr))
+      {
+         const T ratio = T(1.0) / sqr_length;
+         const T delta_dist  = sqrt(abs(sqr_length - radius_sqr));
+
+         point1.x = circle.x + circle.radius * (circle.radius * v.x - v.y * delta_dist) * ratio;
+         point1.y = circle.y + circle.radius * (circle.radius * v.y + v.x * delta_dist) * ratio;
+         point2.x = circle.x + circle.radius * (circle.radius * v.x + v.y * delta_dist) * ratio;
+         point2.y = circle.y + circle.radius * (circle.radius * v.y - v.x * delta_dist) * ratio;
+      }
+      else
+      {
+         point1 = degenerate_point2d<T>();
+         point2 = degenerate_point2d<T>();
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circle_internal_tangent_lines(const circle<T>& circle0,
+                                             const circle<T>& circle1,
+                                             std::vector<line<T,2> >& lines)
+   {
+      const point2d<T> c0 = make_point(circle0.x, circle0.y);
+      const point2d<T> c1 = make_point(circle1.x, circle1.y);
+
+      const T dist = distance(c0,c1);
+
+      if ((dist - (circle0.radius + circle1.radius)) < T(0))
+         return;
+      else if (is_equal(std::abs(dist - (circle0.radius + circle1.radius)),T(0.0)))
+         lines.push_back(create_perpendicular_bisector(make_segment(c0, c1)));
+      else
+      {
+         const T m  = circle0.radius / circle1.radius;
+         const T h0 = (m * dist) / (m + T(1));
+         const T h1 =      dist  / (m + T(1));
+
+         const point2d<T> i = make_point<T>
+                              (
+                                (h1 * circle0.x + h0 * circle1.x) / dist,
+                                (h1 * circle0.y + h0 * circle1.y) / dist
+                              );
+
+         wykobi::point2d<T> c0pnt0;
+         wykobi::point2d<T> c0pnt1;
+         wykobi::point2d<T> c1pnt0;
+         wykobi::point2d<T> c1pnt1;
+
+         wykobi::circle_tangent_points(circle0, i, c0pnt0, c0pnt1);
+         wykobi::circle_tangent_points(circle1, i, c1pnt0, c1pnt1);
+
+         lines.push_back(make_line(c0pnt0, c1pnt0));
+         lines.push_back(make_line(c0pnt1, c1pnt1));
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circle_internal_tangent_segments(const circle<T>& circle0,
+                                                const circle<T>& circle1,
+                                                std::vector< segment<T,2> >& segments)
+   {
+      std::vector< line<T,2> > lines;
+
+      circle_internal_tangent_lines(circle0, circle1, lines);
+
+      switch (lines.size())
+      {
+         case 0 : return;
+
+         case 1 : segments.push_back(make_segment(lines[0]));
+                  return;
+
+         case 2 : segments.push_back(make_segment(lines[0]));
+                  segments.push_back(make_segment(lines[1]));
+                  return;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circle_outer_tangent_lines(const circle<T>& circle0,
+                                          const circle<T>& circle1,
+                                          std::vector< line<T,2> >& lines)
+   {
+      const point2d<T> c0 = make_point(circle0.x, circle0.y);
+      const point2d<T> c1 = make_point(circle1.x, circle1.y);
+
+      const T dist = distance(c0,c1);
+
+      if (dist < std::abs(circle0.radius - circle1.radius))
+         return;
+      else if (is_equal(std::abs(dist - std::abs(circle0.radius - circle1.radius)),T(0.0)))
+         lines.push_back(create_perpendicular_bisector(make_segment(c0, c1)));
+      else if (is_equal(circle0.radius - circle1.radius,T(0.0)))
+      {
+         const point2d<T> c0pnt0 = c0 + (+circle0.radius * perpendicular(normalize(c1 - c0)));
+         const point2d<T> c0pnt1 = c0 + (-circle0.radius * perpendicular(normalize(c1 - c0)));
+         const point2d<T> c1pnt0 = c1 + (+circle1.radius * perpendicular(normalize(c0 - c1)));
+         const point2d<T> c1pnt1 = c1 + (-circle1.radius * perpendicular(normalize(c0 - c1)));
+
+         lines.push_back(make_line(c0pnt0, c1pnt1));
+         lines.push_back(make_line(c0pnt1, c1pnt0));
+      }
+      else
+      {
+         point2d<T> p;
+
+         if (circle0.radius > circle1.radius)
+            p = make_point
+                (
+                  c1.x * circle0.radius -  c0.x * circle1.radius,
+                  c1.y * circle0.radius -  c0.y * circle1.radius
+                );
+         else
+            p = make_point
+                (
+                  c0.x * circle1.radius -  c1.x * circle0.radius,
+                  c0.y * circle1.radius -  c1.y * circle0.radius
+                );
+
+         const T diff = std::abs(circle1.radius - circle0.radius);
+
+         p.x /= diff;
+         p.y /= diff;
+
+         wykobi::point2d<T> c0pnt0;
+         wykobi::point2d<T> c0pnt1;
+         wykobi::point2d<T> c1pnt0;
+         wykobi::point2d<T> c1pnt1;
+
+         wykobi::circle_tangent_points(circle0, p, c0pnt0, c0pnt1);
+         wykobi::circle_tangent_points(circle1, p, c1pnt0, c1pnt1);
+
+         lines.push_back(make_line(c0pnt0, c1pnt0));
+         lines.push_back(make_line(c0pnt1, c1pnt1));
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void circle_outer_tangent_segments(const circle<T>& circle0,
+                                             const circle<T>& circle1,
+                                             std::vector< segment<T,2> >& segments)
+   {
+      std::vector< line<T,2> > lines;
+
+      circle_outer_tangent_lines(circle0, circle1, lines);
+
+      switch (lines.size())
+      {
+         case 0 : return;
+
+         case 1 : segments.push_back(make_segment(lines[0]));
+                  return;
+
+         case 2 : segments.push_back(make_segment(lines[0]));
+                  segments.push_back(make_segment(lines[1]));
+                  return;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> tangent_line(const circle<T>& circle, const point2d<T>& point)
+   {
+      return make_line(point,point + perpendicular(point - make_point(circle)));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_line_from_bisector(const T& x1, const T& y1,
+                                              const T& x2, const T& y2,
+                                              const T& x3, const T& y3)
+   {
+      /*
+         Bisector angle theorem:
+         D: bisector intersect point along (x1y1)(x3,y3)
+         |(x1y1)(x2-y2)| : |(x2y2)(x3y3)| == |(x1y1)D| : |D(x3y3)|
+      */
+      const T dist1 = distance(x1,y1,x2,y2);
+      const T dist2 = distance(x2,y2,x3,y3);
+      const T ratio = dist2 / (dist1 + dist2);
+
+      return make_line(x2,y2,x3 + ratio * (x1 - x3), y3 + ratio * (y1 - y3));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> create_segment_from_bisector(const T& x1, const T& y1,
+                                                    const T& x2, const T& y2,
+                                                    const T& x3, const T& y3)
+   {
+      const T dist1 = distance(x1,y1,x2,y2);
+      const T dist2 = distance(x2,y2,x3,y3);
+      const T ratio = dist2 / (dist1 + dist2);
+
+      return make_segment(x2,y2,x3 + ratio * (x1 - x3), y3 + ratio * (y1 - y3));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> create_ray_from_bisector(const T& x1, const T& y1,
+                                            const T& x2, const T& y2,
+                                            const T& x3, const T& y3)
+   {
+      segment<T,2> segment = create_segment_from_bisector(x1,y1,x2,y2,x3,y3);
+
+      return make_ray(segment[0],segment[1] - segment[0]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> create_line_from_bisector(const T& x1, const T& y1, const T& z1,
+                                              const T& x2, const T& y2, const T& z2,
+                                              const T& x3, const T& y3, const T& z3)
+   {
+      const T dist1 = distance(x1,y1,z1,x2,y2,z2);
+      const T dist2 = distance(x2,y2,z2,x3,y3,z3);
+      const T ratio = dist2 / (dist1 + dist2);
+
+      return make_line(x2,y2,z2,x3 + ratio * (x1 - x3), y3 + ratio * (y1 - y3), z3 + ratio * (z1 - z3));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> create_segment_from_bisector(const T& x1, const T& y1, const T& z1,
+                                                    const T& x2, const T& y2, const T& z2,
+                                                    const T& x3, const T& y3, const T& z3)
+   {
+      const T dist1 = distance(x1,y1,z1,x2,y2,z2);
+      const T dist2 = distance(x2,y2,z2,x3,y3,z3);
+      const T ratio = dist2 / (dist1 + dist2);
+
+      return make_segment
+             (
+               x2, y2, z2,
+               x3 + ratio * (x1 - x3), y3 + ratio * (y1 - y3), z3 + ratio * (z1 - z3)
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> create_ray_from_bisector(const T& x1, const T& y1, const T& z1,
+                                            const T& x2, const T& y2, const T& z2,
+                                            const T& x3, const T& y3, const T& z3)
+   {
+      segment<T,3> segment = create_segment_from_bisector(x1,y1,z1,x2,y2,z2,x3,y3,z3);
+
+      return make_ray(segment[0],segment[1] - segment[0]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_line_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3)
+   {
+      return create_line_from_bisector(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> create_segment_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3)
+   {
+      return create_segment_from_bisector(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> create_ray_from_bisector(const point2d<T>& point1,const point2d<T>& point2,const point2d<T>& point3)
+   {
+      return create_ray_from_bisector(point1.x,point1.y,point2.x,point2.y,point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> create_line_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3)
+   {
+      return create_line_from_bisector(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z,point3.x,point3.y,point3.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> create_segment_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3)
+   {
+      return create_segment_from_bisector(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z,point3.x,point3.y,point3.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> create_ray_from_bisector(const point3d<T>& point1,const point3d<T>& point2,const point3d<T>& point3)
+   {
+      return create_ray_from_bisector(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z,point3.x,point3.y,point3.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const T& x1, const T& y1,const T& x2, const T& y2)
+   {
+      const T mx = (x1 + x2) * T(0.5);
+      const T my = (y1 + y2) * T(0.5);
+
+      return make_line(mx, my, mx + (y1 - y2), my + (x2 - x1));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return create_perpendicular_bisector(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_perpendicular_bisector(const segment<T,2>& segment)
+   {
+      return create_perpendicular_bisector(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> create_perpendicular_line_at_end_point(const line<T,2>& line)
+   {
+      return make_line(line[1],perpendicular(line[1] - line[0]) + line[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool are_perspective_triangles(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         if (robust_parallel(edge(triangle1,i),edge(triangle2,i)))
+         {
+            return false;
+         }
+      }
+
+      return robust_collinear
+             (
+               intersection_point(make_line(edge(triangle1,0)),make_line(edge(triangle2,0))),
+               intersection_point(make_line(edge(triangle1,1)),make_line(edge(triangle2,1))),
+               intersection_point(make_line(edge(triangle1,2)),make_line(edge(triangle2,2)))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool are_perspective_triangles(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2)
+   {
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         if (robust_parallel(edge(triangle1,i),edge(triangle2,i)))
+         {
+            return false;
+         }
+      }
+
+      return robust_collinear
+             (
+               intersection_point(make_line(edge(triangle1,0)),make_line(edge(triangle2,0))),
+               intersection_point(make_line(edge(triangle1,1)),make_line(edge(triangle2,1))),
+               intersection_point(make_line(edge(triangle1,2)),make_line(edge(triangle2,2)))
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> perspectrix(const triangle<T,2>& triangle1, const triangle<T,2>& triangle2)
+   {
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         if (robust_parallel(edge(triangle1,i),edge(triangle2,i)))
+         {
+            return degenerate_line2d<T>();
+         }
+      }
+
+      point2d<T> ipoint0 = intersection_point(make_line(edge(triangle1,0)),make_line(edge(triangle2,0)));
+      point2d<T> ipoint1 = intersection_point(make_line(edge(triangle1,1)),make_line(edge(triangle2,1)));
+      point2d<T> ipoint2 = intersection_point(make_line(edge(triangle1,2)),make_line(edge(triangle2,2)));
+
+      return (robust_collinear(ipoint0,ipoint1,ipoint2)) ? make_line(ipoint0,ipoint1) : degenerate_line2d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> perspectrix(const triangle<T,3>& triangle1, const triangle<T,3>& triangle2)
+   {
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+         if (robust_parallel(edge(triangle1,i),edge(triangle2,i)))
+         {
+            return degenerate_line3d<T>();
+         }
+      }
+
+      point3d<T> ipoint0 = intersection_point(make_line(edge(triangle1,0)),make_line(edge(triangle2,0)));
+      point3d<T> ipoint1 = intersection_point(make_line(edge(triangle1,1)),make_line(edge(triangle2,1)));
+      point3d<T> ipoint2 = intersection_point(make_line(edge(triangle1,2)),make_line(edge(triangle2,2)));
+
+      if (robust_collinear(ipoint0, ipoint1, ipoint2))
+         return make_line(ipoint0, ipoint1);
+      else
+         return degenerate_line3d<T>();
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return circumcircle(point1,point2,point3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> make_circle(const triangle<T,2>& triangle)
+   {
+      return make_circle(triangle[0], triangle[1], triangle[2]);
+   }
+
+} // wykobi namespace
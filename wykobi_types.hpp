@@ -0,0 +1,1505 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_TYPES
+#define INCLUDE_WYKOBI_TYPES
+
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <cassert>
+
+#include "wykobi_math.hpp"
+#include "wykobi_memory.hpp"
+#include "wykobi_instrumentation.hpp"
+
+
+namespace wykobi
+{
+
+   static const char VERSION_INFORMATION[] = "Wykobi Version 0.0.5";
+   static const char AUTHOR_INFORMATION[]  = "Arash Partow";
+   static const char EPOCH_VERSION[]       = "C578AC5A:35A4123B:DF32F721";
+
+   #ifndef WYKOBI
+    #define WYKOBI
+   #endif
+
+
+   /****************************************************************************/
+   /********************[ Basic Geometric Structure Types ]*********************/
+   /****************************************************************************/
+
+   /************[ Geometric Entity ]*************/
+    class geometric_entity{};
+
+    enum geometric_type  {
+                          ePoint2D,
+                          ePoint3D,
+                          eSegment2D,
+                          eSegment3D,
+                          eRectangle,
+                          eBox,
+                          eLine2D,
+                          eLine3D,
+                          eTriangle2D,
+                          eTriangle3D,
+                          eQuadix2D,
+                          eQuadix3D,
+                          eRay2D,
+                          eRay3D,
+                          eCircle,
+                          eSphere
+                         };
+
+
+   /**************[ Vertex type ]***************/
+
+   template <typename T, std::size_t D>
+   class pointnd;
+
+   template <typename T = Float>
+   class point2d : public geometric_entity
+   {
+   public:
+
+      typedef T           type;
+      typedef const type& const_reference;
+      typedef       type& reference;
+
+      WYKOBI_CONSTEXPR point2d() : x(T(0.0)), y(T(0.0)){}
+      point2d(const pointnd<T,2>& point) : x(point[0]), y(point[1]){}
+
+      inline point2d<T>& operator=(const pointnd<T,2>& point)
+      {
+         x = point[0];
+         y = point[1];
+         return *this;
+      }
+
+      WYKOBI_CONSTEXPR reference       operator()(const std::size_t& index)       { return ((0 == index)? x : y); }
+      WYKOBI_CONSTEXPR const_reference operator()(const std::size_t& index) const { return ((0 == index)? x : y); }
+
+      WYKOBI_CONSTEXPR reference       operator[](const std::size_t& index)       { return ((0 == index)? x : y); }
+      WYKOBI_CONSTEXPR const_reference operator[](const std::size_t& index) const { return ((0 == index)? x : y); }
+
+      T x,y;
+   };
+
+   template <typename T = Float>
+   class point3d : public geometric_entity
+   {
+   public:
+
+      typedef T           Type;
+      typedef const Type& const_reference;
+      typedef       Type& reference;
+
+      WYKOBI_CONSTEXPR point3d() : x(T(0.0)), y(T(0.0)), z(T(0.0)){}
+      point3d(const pointnd<T,3>& point) : x(point[0]), y(point[1]), z(point[2]){}
+
+      inline point3d<T>& operator=(const pointnd<T,3>& point)
+      {
+         x = point[0];
+         y = point[1];
+         z = point[2];
+         return *this;
+      }
+
+      WYKOBI_CONSTEXPR reference       operator()(const std::size_t& index)       { return value(index); }
+      WYKOBI_CONSTEXPR const_reference operator()(const std::size_t& index) const { return value(index); }
+
+      WYKOBI_CONSTEXPR reference       operator[](const std::size_t& index)       { return value(index); }
+      WYKOBI_CONSTEXPR const_reference operator[](const std::size_t& index) const { return value(index); }
+
+      T x,y,z;
+   private:
+      WYKOBI_CONSTEXPR reference value(const std::size_t& index)
+      {
+         switch(index)
+         {
+            case 0  : return x;
+            case 1  : return y;
+            case 2  : return z;
+            default : return x;
+         }
+      }
+
+      WYKOBI_CONSTEXPR const_reference value(const std::size_t& index) const
+      {
+         switch(index)
+         {
+            case 0  : return x;
+            case 1  : return y;
+            case 2  : return z;
+            default : return x;
+         }
+      }
+   };
+
+   template <typename T, std::size_t D>
+   class pointnd : public geometric_entity
+   {
+   public:
+
+      typedef const T& const_reference;
+      typedef       T& reference;
+
+      pointnd(){ clear(); }
+      pointnd(const T& v0) { v[0] = v0; }
+      pointnd(const T& v0, const T& v1) { v[0] = v0; v[1] = v1; }
+      pointnd(const T& v0,const T& v1, const T& v2) { v[0] = v0; v[1] = v1; v[2] = v2; }
+      pointnd(const T& v0,const T& v1, const T& v2, const T& v3) { v[0] = v0; v[1] = v1; v[2] = v2; v[3] = v3; }
+      pointnd(const pointnd<T,D>& point)
+      {
+         for (std::size_t i = 0; i < D; ++i) v[i] = point.v[i];
+      }
+
+      pointnd(const point2d<T>& point)
+      {
+         for (std::size_t i = 0; i < D; ++i) v[i] = point[i];
+      }
+
+      pointnd(const point3d<T>& point)
+      {
+         for (std::size_t i = 0; i < D; ++i) v[i] = point[i];
+      }
+
+     ~pointnd(){}
+
+      void clear()
+      {
+         for (std::size_t i = 0; i < D; ++i) v[i] = T(0.0);
+      }
+
+      inline pointnd<T,D>& operator=(const pointnd<T,D>& point)
+      {
+         if (this == &point) return *this;
+         for (std::size_t i = 0; i < D; ++i) v[i] = point.v[i];
+         return *this;
+      }
+
+      inline pointnd<T,D>& operator=(const point2d<T>& point)
+      {
+         if (D == 2)
+         {
+            v[0] = point.x;
+            v[1] = point.y;
+         }
+         return *this;
+      }
+
+      inline pointnd<T,D>& operator=(const point3d<T>& point)
+      {
+         if (D == 3)
+         {
+            v[0] = point.x;
+            v[1] = point.y;
+            v[2] = point.z;
+         }
+         return *this;
+      }
+
+      inline reference       operator()(const std::size_t& index)       { return v[index]; }
+      inline const_reference operator()(const std::size_t& index) const { return v[index]; }
+
+      inline reference       operator[](const std::size_t& index)       { return v[index]; }
+      inline const_reference operator[](const std::size_t& index) const { return v[index]; }
+
+   protected:
+      T v[D];
+   };
+
+   template <typename T, std::size_t Dimension>
+   class define_point_type      { public: typedef pointnd<T,Dimension> PointType; };
+
+   template <typename T>
+   class define_point_type<T,2> { public: typedef point2d<T> PointType; };
+
+   template <typename T>
+   class define_point_type<T,3> { public: typedef point3d<T> PointType; };
+
+
+   /************[      Segment Type     ]************/
+   template <typename T, std::size_t Dimension>
+   class segment : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 2;
+
+      WYKOBI_CONSTEXPR segment(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      WYKOBI_CONSTEXPR reference       operator [](const std::size_t& index)       { return _data[index]; }
+      WYKOBI_CONSTEXPR const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      WYKOBI_CONSTEXPR std::size_t     size       ()                               { return PointCount;   }
+   };
+
+
+   /************[       Line Type       ]************/
+   template <typename T, std::size_t Dimension>
+   class line : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 2;
+
+      WYKOBI_CONSTEXPR line(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      WYKOBI_CONSTEXPR reference       operator [](const std::size_t& index)       { return _data[index]; }
+      WYKOBI_CONSTEXPR const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      WYKOBI_CONSTEXPR std::size_t     size       ()                               { return PointCount;   }
+   };
+
+
+   /************[     Triangle Type     ]************/
+   template <typename T, std::size_t Dimension>
+   class triangle : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 3;
+
+      WYKOBI_CONSTEXPR triangle(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+      PointType _data[PointCount];
+
+   public:
+      WYKOBI_CONSTEXPR reference       operator [](const std::size_t& index)       { return _data[index]; }
+      WYKOBI_CONSTEXPR const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      WYKOBI_CONSTEXPR std::size_t     size       ()                         const { return PointCount;   }
+   };
+
+
+   /************[       Rectangle       ]************/
+   template <typename T>
+   class rectangle : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 2;
+
+      WYKOBI_CONSTEXPR rectangle(){}
+
+      typedef typename define_point_type<T,2>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      WYKOBI_CONSTEXPR reference       operator [](const std::size_t& index)       { return _data[index]; }
+      WYKOBI_CONSTEXPR const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      WYKOBI_CONSTEXPR std::size_t     size       ()                         const { return PointCount;   }
+   };
+
+
+   /************[      Quadix Type      ]************/
+   template <typename T, std::size_t Dimension>
+   class quadix : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 4;
+
+      WYKOBI_CONSTEXPR quadix(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      WYKOBI_CONSTEXPR reference       operator [](const std::size_t& index)       { return _data[index]; }
+      WYKOBI_CONSTEXPR const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      WYKOBI_CONSTEXPR std::size_t     size       ()                         const { return PointCount;   }
+   };
+
+   /************[     Polygon Type      ]************/
+   template <typename PointType, typename Allocator>
+   class define_polygon_storage
+   {
+   public:
+      typedef std::vector<PointType,typename detail::rebind_allocator<Allocator,PointType>::type> StorageType;
+      enum { InlineCapacity = 0 };
+   };
+
+   template <typename PointType, std::size_t N, typename Allocator>
+   class define_polygon_storage< PointType,small_buffer<N,Allocator> >
+   {
+   public:
+      typedef small_vector<PointType,N,typename detail::rebind_allocator<Allocator,PointType>::type> StorageType;
+      enum { InlineCapacity = N };
+   };
+
+   /*
+      Allocator is either a standard allocator (eg: the default std::allocator
+      or arena_allocator), or small_buffer<N,Allocator> which keeps up to N
+      vertices inline before spilling to the wrapped allocator. Algorithms
+      returning a polygon construct it with the input's allocator.
+   */
+   template <typename T, std::size_t Dimension,
+             typename Allocator = std::allocator<typename define_point_type<T,Dimension>::PointType> >
+   class polygon : public geometric_entity
+   {
+   public:
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef PointType& reference;
+      typedef Allocator allocator_type;
+
+      polygon(const std::size_t initial_size = 0) : _data(initial_size){ count_allocation(0); }
+      explicit polygon(const Allocator& allocator, const std::size_t initial_size = 0) : _data(initial_size,PointType(),allocator){ count_allocation(0); }
+      polygon(const polygon& polygon) : geometric_entity(polygon), _data(polygon._data){ count_allocation(0); }
+     ~polygon(){}
+
+      polygon& operator=(const polygon& polygon)
+      {
+         const std::size_t capacity = _data.capacity();
+         _data = polygon._data;
+         count_allocation(capacity);
+         return *this;
+      }
+
+   private:
+
+      typedef typename define_polygon_storage<PointType,Allocator>::StorageType StorageType;
+
+      StorageType _data;
+
+      /*
+         Counts an acquisition of heap storage for the vertices, being any
+         growth in capacity beyond the previous capacity and beyond what
+         the storage holds inline.
+      */
+      inline void count_allocation(const std::size_t previous_capacity) const
+      {
+         #ifdef WYKOBI_INSTRUMENTATION
+         if (
+              (_data.capacity() > previous_capacity) &&
+              (_data.capacity() > static_cast<std::size_t>(define_polygon_storage<PointType,Allocator>::InlineCapacity))
+            )
+         {
+            WYKOBI_INSTRUMENT(polygon_allocations);
+         }
+         #else
+         (void)previous_capacity;
+         #endif
+      }
+
+   public:
+
+      typedef typename StorageType::iterator iterator;
+      typedef typename StorageType::const_iterator const_iterator;
+      typedef PointType value_type;
+
+   public:
+
+      inline reference       operator [](const std::size_t& index)       { return _data[index];                }
+      inline const_reference operator [](const std::size_t& index) const { return _data[index];                }
+      inline void            clear      ()                         const { _data.clear();                      }
+      inline void            clear      ()                               { _data.clear();                      }
+      inline void            erase      (const std::size_t index)        { _data.erase(_data.begin() + index); }
+      inline std::size_t     size       ()                         const { return _data.size();                }
+      inline const_iterator  begin      ()                         const { return _data.begin();               }
+      inline iterator        begin      ()                               { return _data.begin();               }
+      inline const_iterator  end        ()                         const { return _data.end();                 }
+      inline iterator        end        ()                               { return _data.end();                 }
+      inline reference       front      ()                               { return _data.front();               }
+      inline const_reference front      ()                         const { return _data.front();               }
+      inline reference       back       ()                               { return _data.back();                }
+      inline const_reference back       ()                         const { return _data.back();                }
+      inline void            reverse    ()                               { std::reverse(_data.begin(),_data.end());}
+      inline Allocator       get_allocator()                       const { return Allocator(_data.get_allocator()); }
+
+      inline void push_back(const PointType& value)
+      {
+         const std::size_t capacity = _data.capacity();
+         _data.push_back(value);
+         count_allocation(capacity);
+      }
+
+      inline void reserve(const std::size_t amount)
+      {
+         const std::size_t capacity = _data.capacity();
+         _data.reserve(amount);
+         count_allocation(capacity);
+      }
+   };
+
+   /************[  Polygon View Type   ]*************/
+   /*
+      Non-owning read-only view over externally held vertex data. The view
+      consists of a pointer to the first coordinate of the first vertex, a
+      vertex count and a stride in bytes between consecutive vertices, so it
+      may reference packed point arrays as well as interleaved vertex formats
+      (eg: position followed by normal/uv/colour attributes). The referenced
+      memory must outlive the view.
+   */
+   template <typename T, std::size_t Dimension>
+   class polygon_view : public geometric_entity
+   {
+   public:
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef PointType const_reference;
+      typedef PointType value_type;
+
+      class const_iterator
+      {
+      public:
+
+         typedef std::random_access_iterator_tag iterator_category;
+         typedef PointType                       value_type;
+         typedef std::ptrdiff_t                  difference_type;
+         typedef const PointType*                pointer;
+         typedef PointType                       reference;
+
+         const_iterator() : _data(0), _stride(0){}
+         const_iterator(const unsigned char* data, const std::size_t stride) : _data(data), _stride(stride){}
+
+         inline reference       operator* ()                                const { return polygon_view::load(_data);                                }
+         inline reference       operator[](const difference_type& n)       const { return polygon_view::load(_data + (n * static_cast<difference_type>(_stride))); }
+         inline const_iterator& operator++()                                      { _data += _stride; return *this;                                   }
+         inline const_iterator& operator--()                                      { _data -= _stride; return *this;                                   }
+         inline const_iterator  operator++(int)                                   { const_iterator it = *this; _data += _stride; return it;           }
+         inline const_iterator  operator--(int)                                   { const_iterator it = *this; _data -= _stride; return it;           }
+         inline const_iterator& operator+=(const difference_type& n)             { _data += n * static_cast<difference_type>(_stride); return *this; }
+         inline const_iterator& operator-=(const difference_type& n)             { _data -= n * static_cast<difference_type>(_stride); return *this; }
+         inline const_iterator  operator+ (const difference_type& n)       const { const_iterator it = *this; return (it += n);                       }
+         inline const_iterator  operator- (const difference_type& n)       const { const_iterator it = *this; return (it -= n);                       }
+         inline difference_type operator- (const const_iterator& it)       const { return (_data - it._data) / static_cast<difference_type>(_stride); }
+         inline bool            operator==(const const_iterator& it)       const { return _data == it._data;                                         }
+         inline bool            operator!=(const const_iterator& it)       const { return _data != it._data;                                         }
+         inline bool            operator< (const const_iterator& it)       const { return _data <  it._data;                                         }
+         inline bool            operator> (const const_iterator& it)       const { return _data >  it._data;                                         }
+         inline bool            operator<=(const const_iterator& it)       const { return _data <= it._data;                                         }
+         inline bool            operator>=(const const_iterator& it)       const { return _data >= it._data;                                         }
+
+      private:
+
+         const unsigned char* _data;
+         std::size_t          _stride;
+      };
+
+      friend class const_iterator;
+
+      typedef const_iterator iterator;
+
+      polygon_view()
+      : _data(0),
+        _size(0),
+        _stride(sizeof(PointType))
+      {}
+
+      polygon_view(const PointType* points, const std::size_t size, const std::size_t stride = sizeof(PointType))
+      : _data(reinterpret_cast<const unsigned char*>(points)),
+        _size(size),
+        _stride(stride)
+      {}
+
+      polygon_view(const T* coordinates, const std::size_t size, const std::size_t stride = Dimension * sizeof(T))
+      : _data(reinterpret_cast<const unsigned char*>(coordinates)),
+        _size(size),
+        _stride(stride)
+      {}
+
+      template <typename Allocator>
+      polygon_view(const polygon<T,Dimension,Allocator>& polygon)
+      : _data((0 == polygon.size()) ? 0 : reinterpret_cast<const unsigned char*>(&polygon[0])),
+        _size(polygon.size()),
+        _stride(sizeof(PointType))
+      {}
+
+      inline const_reference operator [](const std::size_t& index) const { return load(_data + (index * _stride));  }
+
+      inline std::size_t     size       ()                         const { return _size;                           }
+      inline std::size_t     stride     ()                         const { return _stride;                         }
+      inline bool            empty      ()                         const { return (0 == _size);                    }
+      inline const_iterator  begin      ()                         const { return const_iterator(_data,_stride);   }
+      inline const_iterator  end        ()                         const { return const_iterator(_data + (_size * _stride),_stride); }
+      inline const_reference front      ()                         const { return (*this)[0];                      }
+      inline const_reference back       ()                         const { return (*this)[_size - 1];              }
+
+   private:
+
+      /* Copied rather than dereferenced so views over unaligned buffers (e.g. WKB) are valid. */
+      static inline PointType load(const unsigned char* data)
+      {
+         T coordinate[Dimension];
+         std::memcpy(coordinate,data,sizeof(coordinate));
+         PointType point_;
+
+         for (std::size_t i = 0; i < Dimension; ++i)
+         {
+            point_[i] = coordinate[i];
+         }
+
+         return point_;
+      }
+
+      const unsigned char* _data;
+      std::size_t          _size;
+      std::size_t          _stride;
+   };
+
+   /************[      Circle Type      ]************/
+   template <typename T>
+   class circle : public geometric_entity { public: T x,y,radius; };
+
+
+   /************[      Sphere Type      ]************/
+   template <typename T>
+   class sphere : public geometric_entity { public: T x,y,z,radius; };
+
+   /************[   Hypersphere Type    ]************/
+   template <typename T, std::size_t Dimension>
+   class hypersphere : public geometric_entity
+   {
+   public:
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef PointType& reference;
+
+      PointType center;
+      T radius;
+   };
+
+   /************[  CircularArc Type   ]**************/
+   template <typename T>
+   class circular_arc : public geometric_entity
+   {
+   public:
+
+      T   x1,y1;
+      T   x2,y2;
+      T   cx,cy;
+      T   px,py;
+      T   angle1;
+      T   angle2;
+      int orientation;
+   };
+
+   /************[      Bezier Type      ]************/
+   enum BezierType {
+                    eQuadraticBezier = 2,
+                    eCubicBezier     = 3
+                   };
+
+   /************[ Quadratic Bezier Type ]************/
+   template <typename T, std::size_t Dimension>
+   class quadratic_bezier : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 3;
+      const static BezierType  Type       = eQuadraticBezier;
+
+      quadratic_bezier(){}
+     ~quadratic_bezier(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      inline reference       operator [](const std::size_t& index)       { return _data[index]; }
+      inline const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      inline std::size_t     size     ()                           const { return PointCount;   }
+   };
+
+
+   /************[   Cubic Bezier Type   ]************/
+   template <typename T, std::size_t Dimension>
+   class cubic_bezier : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 4;
+      const static BezierType  Type       = eCubicBezier;
+
+      cubic_bezier(){}
+     ~cubic_bezier(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      inline reference       operator [](const std::size_t& index)       { return _data[index]; }
+      inline const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      inline std::size_t     size     ()                           const { return PointCount;   }
+   };
+
+   template <typename T, unsigned int Dimension, BezierType BType>
+   class define_bezier_type;
+
+   template <typename T>
+   class define_bezier_type<T,2,eQuadraticBezier> { public: typedef quadratic_bezier<T,2> BezierType; };
+
+   template <typename T>
+   class define_bezier_type<T,3,eQuadraticBezier> { public: typedef quadratic_bezier<T,3> BezierType; };
+
+   template <typename T>
+   class define_bezier_type<T,2,eCubicBezier>     { public: typedef cubic_bezier<T,2> BezierType;     };
+
+   template <typename T>
+   class define_bezier_type<T,3,eCubicBezier>     { public: typedef cubic_bezier<T,3> BezierType;     };
+
+
+   /************[  Bezier Coefficients  ]************/
+   template <typename T, unsigned int Dimension, BezierType Type>
+   struct bezier_coefficients
+   {
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+      PointType value[Type];
+   };
+
+
+   /************[    Curve Point Type   ]************/
+   template <typename T, std::size_t Dimension>
+   class curve_point : public geometric_entity
+   {
+   public:
+
+      curve_point(){}
+     ~curve_point(){}
+
+      const static std::size_t PointCount = 1;
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      inline reference       operator ()()       { return _data[0];     }
+      inline const_reference operator ()() const { return _data[0];     }
+      inline std::size_t     size     ()   const { return PointCount;   }
+
+      T t;
+   };
+
+
+   /************[      Vector Type      ]************/
+
+   template <typename T, std::size_t D>
+   class vectornd;
+
+   template <typename T>
+   class vector2d : public point2d<T>
+   {
+   public:
+
+      WYKOBI_CONSTEXPR vector2d(const T& _x = T(0.0), const T& _y = T(0.0))
+      {
+         point2d<T>::x = _x;
+         point2d<T>::y = _y;
+      }
+
+      inline vector2d<T>& operator=(const vectornd<T,2>& vec)
+      {
+         point2d<T>::x = vec[0];
+         point2d<T>::y = vec[1];
+         return *this;
+      }
+   };
+
+   template <typename T>
+   class vector3d : public point3d<T>
+   {
+   public:
+
+      WYKOBI_CONSTEXPR vector3d(const T& _x = T(0.0), const T& _y = T(0.0), const T& _z = T(0.0))
+      {
+         point3d<T>::x = _x;
+         point3d<T>::y = _y;
+         point3d<T>::z = _z;
+      }
+
+      inline vector3d<T>& operator=(const vectornd<T,3>& vec)
+      {
+         point3d<T>::x = vec[0];
+         point3d<T>::y = vec[1];
+         point3d<T>::z = vec[2];
+         return *this;
+      }
+   };
+
+   template <typename T, std::size_t D>
+   class vectornd : public pointnd<T,D>
+   {
+   public:
+
+      vectornd()
+      {
+         pointnd<T,D>::clear();
+      }
+
+      vectornd(const T& v0)
+      {
+         pointnd<T,D>::v[0] = v0;
+      }
+
+      vectornd(const T& v0, const T& v1)
+      {
+         pointnd<T,D>::v[0] = v0;
+         pointnd<T,D>::v[1] = v1;
+      }
+
+      vectornd(const T& v0,const T& v1, const T& v2)
+      {
+         pointnd<T,D>::v[0] = v0;
+         pointnd<T,D>::v[1] = v1;
+         pointnd<T,D>::v[2] = v2;
+      }
+
+      vectornd(const T& v0,const T& v1, const T& v2, const T& v3)
+      {
+         pointnd<T,D>::v[0] = v0;
+         pointnd<T,D>::v[1] = v1;
+         pointnd<T,D>::v[2] = v2;
+         pointnd<T,D>::v[3] = v3;
+      }
+
+      vectornd(const vectornd<T,D>& vec)
+      : pointnd<T,D>()
+      {
+         for (std::size_t i = 0; i < D; ++i) (*this)[i] = vec[i];
+      }
+
+      vectornd(const vector2d<T>& vec)
+      {
+         (*this)[0] = vec.x;
+         (*this)[1] = vec.y;
+      }
+
+      vectornd(const vector3d<T>& vec)
+      {
+         (*this)[0] = vec.x;
+         (*this)[1] = vec.y;
+         (*this)[2] = vec.z;
+      }
+   };
+
+   template <typename T, std::size_t Dimension>
+   class define_vector_type { public: typedef vectornd<T,Dimension> VectorType; };
+
+   template <typename T>
+   class define_vector_type<T,2> { public: typedef vector2d<T> VectorType; };
+
+   template <typename T>
+   class define_vector_type<T,3> { public: typedef vector3d<T> VectorType; };
+
+   /************[        Ray Type       ]************/
+   template <typename T, std::size_t Dimension>
+   class ray : public geometric_entity
+   {
+   public:
+
+      ray(){}
+     ~ray(){}
+
+     typedef typename define_point_type<T,Dimension>::PointType   PointType;
+     typedef typename define_vector_type<T,Dimension>::VectorType VectorType;
+
+      PointType  origin;
+      VectorType direction;
+   };
+
+   /************[       Plane Type      ]************/
+   template <typename T,std::size_t Dimension>
+   class plane : public geometric_entity
+   {
+   public:
+
+      plane(){}
+     ~plane(){}
+
+     typedef typename define_point_type<T,Dimension>::PointType   PointType;
+     typedef typename define_vector_type<T,Dimension>::VectorType VectorType;
+
+      T          constant;
+      VectorType normal;
+   };
+
+   /************[        Box Type       ]************/
+   template <typename T, std::size_t Dimension>
+   class box : public geometric_entity
+   {
+   public:
+
+      const static std::size_t PointCount = 2;
+
+      box(){}
+     ~box(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType PointType;
+      typedef const PointType& const_reference;
+      typedef       PointType& reference;
+
+   private:
+
+      PointType _data[PointCount];
+
+   public:
+
+      inline reference       operator [](const std::size_t& index)       { return _data[index]; }
+      inline const_reference operator [](const std::size_t& index) const { return _data[index]; }
+      inline std::size_t     size     ()                           const { return PointCount;   }
+   };
+
+   /************[   Oriented Box Type   ]************/
+   template <typename T, std::size_t Dimension>
+   class obb : public geometric_entity
+   {
+   public:
+
+      const static std::size_t AxisCount = Dimension;
+
+      obb(){}
+     ~obb(){}
+
+      typedef typename define_point_type<T,Dimension>::PointType   PointType;
+      typedef typename define_vector_type<T,Dimension>::VectorType VectorType;
+
+      /*
+         axis[i] are mutually orthogonal unit vectors, the box
+         spans [-half_length[i],+half_length[i]] along axis[i]
+         about the center.
+      */
+      PointType  center;
+      VectorType axis[Dimension];
+      T          half_length[Dimension];
+   };
+
+   enum eInclusion {
+                    eFully,
+                    ePartially,
+                    eOutside,
+                    eUnknown
+                   };
+
+   enum eTriangleType {
+                       etEquilateral,
+                       etIsosceles,
+                       etRight,
+                       etScalene,
+                       etObtuse,
+                       etUnknown
+                      };
+
+
+   /**********[ Orientation constants ]**********/
+   const int RightHandSide        = -1;
+   const int LeftHandSide         = +1;
+   const int Clockwise            = -1;
+   const int CounterClockwise     = +1;
+   const int CollinearOrientation =  0;
+   const int AboveOrientation     = +1;
+   const int BelowOrientation     = -1;
+   const int CoplanarOrientation  =  0;
+   const int PointInside          = +1;
+   const int PointOutside         = -1;
+   const int Cocircular           =  0;
+   const int Cospherical          =  0;
+
+   /********[       Clipping Codes        ]********/
+   const int CLIP_BOTTOM = 1;
+   const int CLIP_TOP    = 2;
+   const int CLIP_LEFT   = 4;
+   const int CLIP_RIGHT  = 8;
+
+   /************[ Trigonometry Tables ]************/
+   template <typename T>
+   class trig_luts
+   {
+   public:
+
+      const static unsigned int TableSize = 360;
+
+      trig_luts()
+      {
+         for (std::size_t i = 0; i < 360; ++i)
+         {
+            sin_[i] = T(std::sin((1.0 * i) * PIDiv180));
+            cos_[i] = T(std::cos((1.0 * i) * PIDiv180));
+            tan_[i] = T(std::tan((1.0 * i) * PIDiv180));
+         }
+      }
+
+      inline const T& sin(const unsigned int angle) const { return sin_[angle]; }
+      inline const T& cos(const unsigned int angle) const { return cos_[angle]; }
+      inline const T& tan(const unsigned int angle) const { return tan_[angle]; }
+
+   private:
+
+      T sin_[TableSize];
+      T cos_[TableSize];
+      T tan_[TableSize];
+   };
+
+   /*
+      Sine/cosine table of Resolution entries per full turn (Resolution
+      must be a multiple of four) with linearly interpolated lookup of
+      angles in degrees. The cosine is read from the sine entries a
+      quarter turn further on. The shared instance resides in static
+      storage and from C++14 onwards is generated at compile time.
+   */
+   template <typename T, std::size_t Resolution = 4096>
+   class trig_table
+   {
+   public:
+
+      const static std::size_t TableSize = Resolution;
+
+      WYKOBI_CONSTEXPR trig_table()
+      : sin_()
+      {
+         for (std::size_t i = 0; i < EntryCount; ++i)
+         {
+            sin_[i] = T(series_sin((6.283185307179586476925286766559000 * i) / Resolution));
+         }
+      }
+
+      static inline const trig_table& instance()
+      {
+         #if (__cplusplus >= 201402L)
+         static constexpr trig_table table;
+         #else
+         static const trig_table table;
+         #endif
+         return table;
+      }
+
+      inline T sin(const T& angle) const
+      {
+         std::size_t index = 0;
+         T t = T(0.0);
+         locate(angle,index,t);
+         return interpolate(index,t);
+      }
+
+      inline T cos(const T& angle) const
+      {
+         std::size_t index = 0;
+         T t = T(0.0);
+         locate(angle,index,t);
+         return interpolate(index + QuarterTurn,t);
+      }
+
+      inline void sin_cos(const T& angle, T& sin_value, T& cos_value) const
+      {
+         std::size_t index = 0;
+         T t = T(0.0);
+         locate(angle,index,t);
+         sin_value = interpolate(index,t);
+         cos_value = interpolate(index + QuarterTurn,t);
+      }
+
+   private:
+
+      const static std::size_t QuarterTurn = Resolution / 4;
+      const static std::size_t EntryCount  = Resolution + QuarterTurn + 1;
+
+      typedef char resolution_must_be_a_multiple_of_four[((Resolution % 4) == 0) ? 1 : -1];
+
+      inline void locate(const T& angle, std::size_t& index, T& t) const
+      {
+         T position = (angle / T(360.0)) * T(Resolution);
+
+         position -= std::floor(position / T(Resolution)) * T(Resolution);
+
+         index = static_cast<std::size_t>(position);
+
+         if (index < Resolution)
+            t = position - T(index);
+         else
+         {
+            index = 0;
+            t = T(0.0);
+         }
+      }
+
+      inline T interpolate(const std::size_t& index, const T& t) const
+      {
+         return sin_[index] + t * (sin_[index + 1] - sin_[index]);
+      }
+
+      T sin_[EntryCount];
+   };
+
+   /*************[ Affine Transforms ]*************/
+   template <typename T>
+   class affine2d
+   {
+   public:
+      /*
+         Row major 2x3 matrix, a point (x,y) maps to:
+         x' = m[0][0] * x + m[0][1] * y + m[0][2]
+         y' = m[1][0] * x + m[1][1] * y + m[1][2]
+      */
+      T m[2][3];
+   };
+
+   template <typename T>
+   class affine3d
+   {
+   public:
+      /*
+         Row major 3x4 matrix, a point (x,y,z) maps to:
+         x' = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3]
+         y' = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3]
+         z' = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3]
+      */
+      T m[3][4];
+   };
+
+   /************[ General Definitions ]************/
+   typedef segment <Float,2> segment2d;
+   typedef line    <Float,2> line2d;
+   typedef triangle<Float,2> triangle2d;
+   typedef quadix  <Float,2> quadix2d;
+
+   typedef segment <Float,3> segment3d;
+   typedef line    <Float,3> line3d;
+   typedef triangle<Float,3> triangle3d;
+   typedef quadix  <Float,3> quadix3d;
+
+   template <typename T> T epsilon();
+   template<> inline double epsilon<double>() { return static_cast<double>(Epsilon_Medium); }
+   template<> inline  float epsilon<float> () { return static_cast<float> (Epsilon_Low   ); }
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+   template<> inline std::int32_t epsilon<std::int32_t>() { return 0; }
+   template<> inline std::int64_t epsilon<std::int64_t>() { return 0; }
+   #endif
+
+   /*
+      wide_type<T>::type holds the exact product of two differences of
+      coordinates of type T (the exact_* routines evaluate in it).
+   */
+   template <typename T> class wide_type { public: typedef T type; };
+
+   #ifdef WYKOBI_EXACT_INTEGER_PREDICATES
+   template <> class wide_type<std::int32_t> { public: typedef int128 type; };
+   template <> class wide_type<std::int64_t> { public: typedef int128 type; };
+   #endif
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> right_shift(const triangle<T,2>& triangle, const std::size_t& shift);
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> right_shift(const triangle<T,3>& triangle, const std::size_t& shift);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> right_shift(const quadix<T,2>& quadix, const std::size_t& shift);
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> right_shift(const quadix<T,3>& quadix, const std::size_t& shift);
+
+   template <typename T> WYKOBI_INLINE T vector_norm(const vector2d<T>& v);
+
+   template <typename T> WYKOBI_INLINE T vector_norm(const vector3d<T>& v);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> normalize(const vector2d<T>& v);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> normalize(const vector3d<T>& v);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> perpendicular(const vector2d<T>& v);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> perpendicular(const vector3d<T>& v);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator+(const vector2d<T>& v1, const vector2d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator+(const vector3d<T>& v1, const vector3d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator-(const vector2d<T>& v1, const vector2d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator-(const vector3d<T>& v1, const vector3d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE T           operator*(const vector2d<T>& v1, const vector2d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator*(const vector3d<T>& v1, const vector3d<T>& v2);
+
+   template <typename T> WYKOBI_CONSTEXPR T dot_product(const vector2d<T>& v1, const vector2d<T>& v2);
+
+   template <typename T> WYKOBI_CONSTEXPR T dot_product(const vector3d<T>& v1, const vector3d<T>& v2);
+
+   template <typename T> WYKOBI_CONSTEXPR T perpendicular_product(const vector2d<T>& v1, const vector2d<T>& v2);
+
+   template <typename T> WYKOBI_INLINE T triple_product(const vector3d<T>& v1, const vector3d<T>& v2, const vector3d<T>& v3);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator*(const vector2d<T>& v1, const T& scale);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator*(const vector3d<T>& v1, const T& scale);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator*(const T& scale, const vector2d<T>& v1);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator*(const T& scale, const vector3d<T>& v1);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator/(const vector2d<T>& v1, const T& scale);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator/(const vector3d<T>& v1, const T& scale);
+
+   template <typename T> WYKOBI_INLINE point2d<T> operator*(const point2d<T>& point, const T& scale);
+
+   template <typename T> WYKOBI_INLINE point3d<T> operator*(const point3d<T>& point, const T& scale);
+
+   template <typename T> WYKOBI_INLINE point2d<T> operator*(const T& scale, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point3d<T> operator*(const T& scale, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point2d<T> operator+(const point2d<T>& point, const vector2d<T>& v);
+
+   template <typename T> WYKOBI_INLINE point2d<T> operator+(const vector2d<T>& v, const point2d<T>& point);
+
+   template <typename T> WYKOBI_INLINE point3d<T> operator+(const point3d<T>& point, const vector3d<T>& v);
+
+   template <typename T> WYKOBI_INLINE point3d<T> operator+(const vector3d<T>& v, const point3d<T>& point);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> operator-(const point2d<T>& p1, const point2d<T>& p2);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> operator-(const point3d<T>& p1, const point3d<T>& p2);
+
+   template <typename T> WYKOBI_INLINE point2d<T> operator+(const point2d<T>& p1, const point2d<T>& p2);
+
+   template <typename T> WYKOBI_INLINE point3d<T> operator+(const point3d<T>& p1, const point3d<T>& p2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const T& val1, const T& val2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const point2d<T>& point1, const point2d<T>& point2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const point3d<T>& point1, const point3d<T>& point2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const T& val1, const T& val2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const box<T,3>& box1, const box<T,3>& box2);
+
+   template <typename T> WYKOBI_INLINE bool is_equal(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const T& val1, const T& val2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const point2d<T>& point1, const point2d<T>& point2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const point3d<T>& point1, const point3d<T>& point2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const T& val1, const T& val2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const circle<T>& circle1, const circle<T>& circle2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const box<T,3>& box1, const box<T,3>& box2);
+
+   template <typename T> WYKOBI_INLINE bool not_equal(const sphere<T>& sphere1, const sphere<T>& sphere2);
+
+   template <typename T> WYKOBI_INLINE bool less_than_or_equal(const T& val1, const T& val2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool less_than_or_equal(const T& val1, const T& val2);
+
+   template <typename T> WYKOBI_INLINE bool greater_than_or_equal(const T& val1, const T& val2, const T& epsilon);
+
+   template <typename T> WYKOBI_INLINE bool greater_than_or_equal(const T& val1, const T& val2);
+
+   template <typename T> WYKOBI_INLINE bool operator < (const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool operator < (const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool operator > (const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool operator > (const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool operator == (const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE bool operator == (const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE point2d<T> degenerate_point2d();
+
+   template <typename T> WYKOBI_INLINE point3d<T> degenerate_point3d();
+
+   template <typename T> WYKOBI_INLINE vector2d<T> degenerate_vector2d();
+
+   template <typename T> WYKOBI_INLINE vector3d<T> degenerate_vector3d();
+
+   template <typename T> WYKOBI_INLINE ray<T,2> degenerate_ray2d();
+
+   template <typename T> WYKOBI_INLINE ray<T,3> degenerate_ray3d();
+
+   template <typename T> WYKOBI_INLINE line<T,2> degenerate_line2d();
+
+   template <typename T> WYKOBI_INLINE line<T,3> degenerate_line3d();
+
+   template <typename T> WYKOBI_INLINE segment<T,2> degenerate_segment2d();
+
+   template <typename T> WYKOBI_INLINE segment<T,3> degenerate_segment3d();
+
+   template <typename T> WYKOBI_INLINE triangle<T,2> degenerate_triangle2d();
+
+   template <typename T> WYKOBI_INLINE triangle<T,3> degenerate_triangle3d();
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> degenerate_quadix2d();
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> degenerate_quadix3d();
+
+   template <typename T> WYKOBI_INLINE rectangle<T> degenerate_rectangle();
+
+   template <typename T> WYKOBI_INLINE circle<T> degenerate_circle();
+
+   template <typename T> WYKOBI_INLINE sphere<T> degenerate_sphere();
+
+   template <typename T> WYKOBI_INLINE point2d<T> positive_infinite_point2d();
+
+   template <typename T> WYKOBI_INLINE point2d<T> negative_infinite_point2d();
+
+   template <typename T> WYKOBI_INLINE point3d<T> positive_infinite_point3d();
+
+   template <typename T> WYKOBI_INLINE point3d<T> negative_infinite_point3d();
+
+   template <typename T> WYKOBI_INLINE void swap(point2d<T>& point1, point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE void swap(point3d<T>& point1, point3d<T>& point2);
+
+   template <typename T> WYKOBI_CONSTEXPR point2d<T> make_point(const T& x, const T& y);
+
+   template <typename T> WYKOBI_CONSTEXPR point3d<T> make_point(const T& x, const T& y, const T& z);
+
+   template <typename T> WYKOBI_CONSTEXPR point2d<T> make_point(const point3d<T> point);
+
+   template <typename T> WYKOBI_CONSTEXPR point3d<T> make_point(const point2d<T> point, const T& z = T(0.0));
+
+   template <typename T> WYKOBI_INLINE point2d<T> make_point(const circle<T>& circle);
+
+   template <typename T> WYKOBI_INLINE point3d<T> make_point(const sphere<T>& sphere);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> make_vector(const T& x, const T& y);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> make_vector(const T& x, const T& y, const T& z);
+
+   template <typename T> WYKOBI_INLINE vector2d<T> make_vector(const vector3d<T> v);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> make_vector(const vector2d<T> v, const T& z = T(0.0));
+
+   template <typename T> WYKOBI_INLINE vector2d<T> make_vector(const point2d<T> point);
+
+   template <typename T> WYKOBI_INLINE vector3d<T> make_vector(const point3d<T> point);
+
+   template <typename T> WYKOBI_INLINE ray<T,2> make_ray(const T& ox, const T& oy, const T& dir_x, const T& dir_y);
+
+   template <typename T> WYKOBI_INLINE ray<T,3> make_ray(const T& ox, const T& oy, const T& oz, const T& dir_x, const T& dir_y, const T& dir_z);
+
+   template <typename T> WYKOBI_INLINE ray<T,2> make_ray(const point2d<T>& origin, const vector2d<T>& direction);
+
+   template <typename T> WYKOBI_INLINE ray<T,3> make_ray(const point3d<T>& origin, const vector3d<T>& direction);
+
+   template <typename T> WYKOBI_INLINE curve_point<T,2> make_curve_point(const T& x, const T& y, const T& t);
+
+   template <typename T> WYKOBI_INLINE curve_point<T,3> make_curve_point(const T& x, const T& y, const T& z, const T& t);
+
+   template <typename T> WYKOBI_INLINE curve_point<T,2> make_curve_point(const point2d<T>& point, const T& t);
+
+   template <typename T> WYKOBI_INLINE curve_point<T,3> make_curve_point(const point3d<T>& point, const T& t);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,2> make_segment(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,3> make_segment(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,2> make_segment(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,3> make_segment(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,2> make_segment(const line<T,2>& line);
+
+   template <typename T> WYKOBI_CONSTEXPR segment<T,3> make_segment(const line<T,3>& line);
+
+   template <typename T> WYKOBI_INLINE line<T,2> make_line(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE line<T,3> make_line(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE line<T,2> make_line(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE line<T,3> make_line(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE line<T,2> make_line(const segment<T,2>& segment);
+
+   template <typename T> WYKOBI_INLINE line<T,3> make_line(const segment<T,3>& segment);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> make_rectangle(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE rectangle<T> make_rectangle(const point2d<T>& point1, const point2d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE box<T,3> make_box(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2);
+
+   template <typename T> WYKOBI_INLINE box<T,3> make_box(const point3d<T>& point1, const point3d<T>& point2);
+
+   template <typename T> WYKOBI_INLINE obb<T,2> make_obb(const point2d<T>& center, const vector2d<T>& axis, const T& half_length1, const T& half_length2);
+
+   template <typename T> WYKOBI_INLINE obb<T,3> make_obb(const point3d<T>& center,
+                                                  const vector3d<T>& axis1, const vector3d<T>& axis2, const vector3d<T>& axis3,
+                                                  const T& half_length1, const T& half_length2, const T& half_length3);
+
+   template <typename T> WYKOBI_INLINE obb<T,2> make_obb(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE obb<T,3> make_obb(const box<T,3>& box);
+
+   template <typename T> WYKOBI_CONSTEXPR triangle<T,2> make_triangle(const T& x1, const T& y1,
+                                                                      const T& x2, const T& y2,
+                                                                      const T& x3, const T& y3);
+
+   template <typename T> WYKOBI_CONSTEXPR triangle<T,3> make_triangle(const T& x1, const T& y1, const T& z1,
+                                                                      const T& x2, const T& y2, const T& z2,
+                                                                      const T& x3, const T& y3, const T& z3);
+
+   template <typename T> WYKOBI_CONSTEXPR triangle<T,2> make_triangle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3);
+
+   template <typename T> WYKOBI_CONSTEXPR triangle<T,3> make_triangle(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> make_quadix(const T& x1, const T& y1,
+                                                        const T& x2, const T& y2,
+                                                        const T& x3, const T& y3,
+                                                        const T& x4, const T& y4);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> make_quadix(const T& x1, const T& y1, const T& z1,
+                                                        const T& x2, const T& y2, const T& z2,
+                                                        const T& x3, const T& y3, const T& z3,
+                                                        const T& x4, const T& y4, const T& z4);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> make_quadix(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3, const point2d<T>& point4);
+
+   template <typename T> WYKOBI_INLINE quadix<T,3> make_quadix(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> make_quadix(const T& x1, const T& y1, const T& x2, const T& y2);
+
+   template <typename T> WYKOBI_INLINE quadix<T,2> make_quadix(const rectangle<T>& rectangle);
+
+   template <typename T> WYKOBI_INLINE circle<T> make_circle(const T& x, const T& y, const T& radius);
+
+   template <typename T> WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point, const T& radius);
+
+   template <typename T> WYKOBI_INLINE sphere<T> make_sphere(const T& x, const T& y, const T& z, const T& radius);
+
+   template <typename T> WYKOBI_INLINE sphere<T> make_sphere(const point3d<T>& point, const T& radius);
+
+   template <typename T> WYKOBI_INLINE plane<T,3> make_plane(const T& x1, const T& y1, const T& z1,
+                                                      const T& x2, const T& y2, const T& z2,
+                                                      const T& x3, const T& y3, const T& z3);
+
+   template <typename T> WYKOBI_INLINE plane<T,3> make_plane(const T& px, const T& py, const T& pz,
+                                                      const T& nx, const T& ny, const T& nz);
+
+   template <typename T> WYKOBI_INLINE plane<T,3> make_plane(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3);
+
+   template <typename T> WYKOBI_INLINE plane<T,3> make_plane(const point3d<T>& point, const vector3d<T>& normal);
+
+   template <typename T> WYKOBI_INLINE plane<T,3> make_plane(const triangle<T,3>& triangle);
+
+   template <typename T, std::size_t D, typename InputIterator> WYKOBI_INLINE polygon<T,D> make_polygon(const InputIterator begin, const InputIterator end);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const std::vector< point2d<T> >& point_list);
+
+   template <typename T> WYKOBI_INLINE polygon<T,3> make_polygon(const std::vector< point3d<T> >& point_list);
+
+   template <typename T, std::size_t D, typename Allocator> WYKOBI_INLINE polygon_view<T,D> make_polygon_view(const polygon<T,D,Allocator>& polygon);
+
+   template <typename T> WYKOBI_INLINE polygon_view<T,2> make_polygon_view(const point2d<T>* points, const std::size_t& count, const std::size_t& stride = sizeof(point2d<T>));
+
+   template <typename T> WYKOBI_INLINE polygon_view<T,3> make_polygon_view(const point3d<T>* points, const std::size_t& count, const std::size_t& stride = sizeof(point3d<T>));
+
+   template <typename T> WYKOBI_INLINE polygon_view<T,2> make_polygon_view(const std::vector< point2d<T> >& point_list);
+
+   template <typename T> WYKOBI_INLINE polygon_view<T,3> make_polygon_view(const std::vector< point3d<T> >& point_list);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const triangle<T,2>& triangle);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const quadix<T,2>& quadix);
+
+   template <typename T> WYKOBI_INLINE polygon<T,2> make_polygon(const rectangle<T>& rectangle);
+
+} // wykobi namespace
+
+#include "wykobi_types.inl"
+
+#endif
@@ -0,0 +1,1510 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#include "wykobi_types.hpp"
+
+
+namespace wykobi
+{
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> right_shift(const triangle<T,2>& triangle, const std::size_t& shift)
+   {
+      switch(shift % 3)
+      {
+         case 0  : return triangle;
+         case 1  : return make_triangle(triangle[2],triangle[0],triangle[1]);
+         case 2  : return make_triangle(triangle[1],triangle[2],triangle[0]);
+         default : return triangle;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> right_shift(const triangle<T,3>& triangle, const std::size_t& shift)
+   {
+      switch(shift % 3)
+      {
+         case 0  : return triangle;
+         case 1  : return make_triangle(triangle[2],triangle[0],triangle[1]);
+         case 2  : return make_triangle(triangle[1],triangle[2],triangle[0]);
+         default : return triangle;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> right_shift(const quadix<T,2>& quadix, const std::size_t& shift)
+   {
+      switch(shift % 4)
+      {
+         case 0  : return quadix;
+         case 1  : return make_quadix(quadix[3],quadix[0],quadix[1],quadix[2]);
+         case 2  : return make_quadix(quadix[2],quadix[3],quadix[0],quadix[1]);
+         case 3  : return make_quadix(quadix[1],quadix[2],quadix[3],quadix[0]);
+         default : return quadix;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> right_shift(const quadix<T,3>& quadix, const std::size_t& shift)
+   {
+      switch(shift % 4)
+      {
+         case 0  : return quadix;
+         case 1  : return make_quadix(quadix[3],quadix[0],quadix[1],quadix[2]);
+         case 2  : return make_quadix(quadix[2],quadix[3],quadix[0],quadix[1]);
+         case 3  : return make_quadix(quadix[1],quadix[2],quadix[3],quadix[0]);
+         default : return quadix;
+      }
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vector_norm(const vector2d<T>& v)
+   {
+      return sqrt((v.x * v.x) + (v.y * v.y));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T vector_norm(const vector3d<T>& v)
+   {
+      return sqrt((v.x * v.x) + (v.y * v.y) + (v.z * v.z));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> normalize(const vector2d<T>& v)
+   {
+      return v * (T(1.0) / vector_norm(v));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> normalize(const vector3d<T>& v)
+   {
+      return v * (T(1.0) / vector_norm(v));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> perpendicular(const vector2d<T>& v)
+   {
+      return make_vector(v.y,-v.x);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> perpendicular(const vector3d<T>& v)
+   {
+      return make_vector(v.y,-v.x,v.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator+(const vector2d<T>& v1, const vector2d<T>& v2)
+   {
+      vector2d<T> v3;
+      v3.x = v1.x + v2.x;
+      v3.y = v1.y + v2.y;
+      return v3;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator+(const vector3d<T>& v1, const vector3d<T>& v2)
+   {
+      vector3d<T> v3;
+      v3.x = v1.x + v2.x;
+      v3.y = v1.y + v2.y;
+      v3.z = v1.z + v2.z;
+      return v3;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator-(const vector2d<T>& v1, const vector2d<T>& v2)
+   {
+      vector2d<T> v3;
+      v3.x = v1.x - v2.x;
+      v3.y = v1.y - v2.y;
+      return v3;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator-(const vector3d<T>& v1, const vector3d<T>& v2)
+   {
+      vector3d<T> v3;
+      v3.x = v1.x - v2.x;
+      v3.y = v1.y - v2.y;
+      v3.z = v1.z - v2.z;
+      return v3;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T operator*(const vector2d<T>& v1, const vector2d<T>& v2)
+   {
+      return (v1.x * v2.y) - (v1.y - v2.x);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator*(const vector3d<T>& v1, const vector3d<T>& v2)
+   {
+      vector3d<T> v3;
+
+      v3.x = v1.y * v2.z - v1.z * v2.y;
+      v3.y = v1.z * v2.x - v1.x * v2.z;
+      v3.z = v1.x * v2.y - v1.y * v2.x;
+
+      return v3;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T dot_product(const vector2d<T>& v1, const vector2d<T>& v2)
+   {
+      return (v1.x * v2.x) + (v1.y * v2.y);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T dot_product(const vector3d<T>& v1, const vector3d<T>& v2)
+   {
+      return (v1.x * v2.x) + (v1.y * v2.y) + (v1.z * v2.z);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR T perpendicular_product(const vector2d<T>& v1, const vector2d<T>& v2)
+   {
+      return (v1.x * v2.y) - (v1.y * v2.x);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE T triple_product(const vector3d<T>& v1, const vector3d<T>& v2, const vector3d<T>& v3)
+   {
+      return dot_product(v1, v2 * v3);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator*(const vector2d<T>& v, const T& scale)
+   {
+      vector2d<T> v_;
+
+      v_.x = v.x * scale;
+      v_.y = v.y * scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator*(const vector3d<T>& v, const T& scale)
+   {
+      vector3d<T> v_;
+
+      v_.x = v.x * scale;
+      v_.y = v.y * scale;
+      v_.z = v.z * scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator/(const vector2d<T>& v, const T& scale)
+   {
+      vector2d<T> v_;
+
+      v_.x = v.x / scale;
+      v_.y = v.y / scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator/(const vector3d<T>& v, const T& scale)
+   {
+      vector3d<T> v_;
+
+      v_.x = v.x / scale;
+      v_.y = v.y / scale;
+      v_.z = v.z / scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator*(const T& scale, const vector2d<T>& v)
+   {
+      vector2d<T> v_;
+
+      v_.x = v.x * scale;
+      v_.y = v.y * scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator*(const T& scale, const vector3d<T>& v)
+   {
+      vector3d<T> v_;
+
+      v_.x = v.x * scale;
+      v_.y = v.y * scale;
+      v_.z = v.z * scale;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> operator*(const point2d<T>& point, const T& scale)
+   {
+      point2d<T> point_;
+
+      point_.x = point.x * scale;
+      point_.y = point.y * scale;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> operator*(const point3d<T>& point, const T& scale)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x * scale;
+      point_.y = point.y * scale;
+      point_.z = point.z * scale;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> operator*(const T& scale, const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      point_.x = point.x * scale;
+      point_.y = point.y * scale;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> operator*(const T& scale, const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x * scale;
+      point_.y = point.y * scale;
+      point_.z = point.z * scale;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> operator+(const point2d<T>& point, const vector2d<T>& v)
+   {
+      point2d<T> point_;
+
+      point_.x = point.x + v.x;
+      point_.y = point.y + v.y;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> operator+(const vector2d<T>& v, const point2d<T>& point)
+   {
+      point2d<T> point_;
+
+      point_.x = point.x + v.x;
+      point_.y = point.y + v.y;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> operator+(const point3d<T>& point, const vector3d<T>& v)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x + v.x;
+      point_.y = point.y + v.y;
+      point_.z = point.z + v.z;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> operator+(const vector3d<T>& v, const point3d<T>& point)
+   {
+      point3d<T> point_;
+
+      point_.x = point.x + v.x;
+      point_.y = point.y + v.y;
+      point_.z = point.z + v.z;
+
+      return point_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> operator-(const point2d<T>& p1, const point2d<T>& p2)
+   {
+      vector2d<T> v_;
+
+      v_.x = p1.x - p2.x;
+      v_.y = p1.y - p2.y;
+
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> operator-(const point3d<T>& p1, const point3d<T>& p2)
+   {
+      vector3d<T> v_;
+      v_.x = p1.x - p2.x;
+      v_.y = p1.y - p2.y;
+      v_.z = p1.z - p2.z;
+      return v_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> operator+(const point2d<T>& p1, const point2d<T>& p2)
+   {
+      point2d<T> p_;
+
+      p_.x = p1.x + p2.x;
+      p_.y = p1.y + p2.y;
+
+      return p_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> operator+(const point3d<T>& p1, const point3d<T>& p2)
+   {
+      point3d<T> p_;
+
+      p_.x = p1.x + p2.x;
+      p_.y = p1.y + p2.y;
+      p_.z = p1.z + p2.z;
+
+      return p_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const T& val1, const T& val2, const T& epsilon)
+   {
+      T diff = val1 - val2;
+
+      assert(((-epsilon <= diff) && (diff <= epsilon)) == (abs(diff) <= epsilon));
+
+      return ((-epsilon <= diff) && (diff <= epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const point2d<T>& point1, const point2d<T>& point2, const T& epsilon)
+   {
+      return (is_equal(point1.x,point2.x,epsilon) && is_equal(point1.y,point2.y,epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const point3d<T>& point1, const point3d<T>& point2, const T& epsilon)
+   {
+      return is_equal(point1.x,point2.x,epsilon) &&
+             is_equal(point1.y,point2.y,epsilon) &&
+             is_equal(point1.z,point2.z,epsilon) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const T& val1, const T& val2)
+   {
+      return is_equal(val1,val2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return is_equal(point1,point2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return is_equal(point1,point2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      return (is_equal(rectangle1[0],rectangle2[0]) && is_equal(rectangle1[1],rectangle2[1])) ||
+             (is_equal(rectangle1[0],rectangle2[1]) && is_equal(rectangle1[1],rectangle2[0])) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return is_equal(circle1.x,circle2.x) &&
+             is_equal(circle1.y,circle2.y) &&
+             is_equal(circle1.radius,circle2.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const box<T,3>& box1, const box<T,3>& box2)
+   {
+      return (is_equal(box1[0],box2[0]) && is_equal(box1[1],box2[1])) ||
+             (is_equal(box1[0],box2[1]) && is_equal(box1[1],box2[0])) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool is_equal(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      return is_equal(sphere1.x,sphere2.x) &&
+             is_equal(sphere1.y,sphere2.y) &&
+             is_equal(sphere1.z,sphere2.z) &&
+             is_equal(sphere1.radius,sphere2.radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const T& val1, const T& val2, const T& epsilon)
+   {
+      T diff = val1 - val2;
+
+      assert(((-epsilon > diff) || (diff > epsilon)) == (abs(val1 - val2) > epsilon));
+
+      return ((-epsilon > diff) || (diff > epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const point2d<T>& point1, const point2d<T>& point2, const T& epsilon)
+   {
+      return (not_equal(point1.x,point2.x,epsilon) || not_equal(point1.y,point2.y,epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const point3d<T>& point1, const point3d<T>& point2, const T& epsilon)
+   {
+      return not_equal(point1.x, point2.x, epsilon) ||
+             not_equal(point1.y, point2.y, epsilon) ||
+             not_equal(point1.z, point2.z, epsilon) ;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const T& val1, const T& val2)
+   {
+      return not_equal(val1,val2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return not_equal(point1,point2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return not_equal(point1,point2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const rectangle<T>& rectangle1, const rectangle<T>& rectangle2)
+   {
+      return (!is_equal(rectangle1,rectangle2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const circle<T>& circle1, const circle<T>& circle2)
+   {
+      return (!is_equal(circle1,circle2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const box<T,3>& box1, const box<T,3>& box2)
+   {
+      return (!is_equal(box1,box2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool not_equal(const sphere<T>& sphere1, const sphere<T>& sphere2)
+   {
+      return (!is_equal(sphere1,sphere2));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool less_than_or_equal(const T& val1, const T& val2, const T& epsilon)
+   {
+      return (val1 < val2) || is_equal(val1,val2,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool less_than_or_equal(const T& val1, const T& val2)
+   {
+      return (val1 < val2) || is_equal(val1,val2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool greater_than_or_equal(const T& val1, const T& val2, const T& epsilon)
+   {
+      return (val1 > val2) || is_equal(val1,val2,epsilon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool greater_than_or_equal(const T& val1, const T& val2)
+   {
+      return (val1 > val2) || is_equal(val1,val2,T(Epsilon));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator < (const point2d<T>& point1, const point2d<T>& point2)
+   {
+      if (point1.x < point2.x)
+         return true;
+      else if (point1.x > point2.x)
+         return false;
+      else if (point1.y < point2.y)
+         return true;
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator < (const point3d<T>& point1, const point3d<T>& point2)
+   {
+      if (point1.x < point2.x)
+         return true;
+      else if (point1.x > point2.x)
+         return false;
+      else if (point1.y < point2.y)
+         return true;
+      else if (point1.y > point2.y)
+         return false;
+      else if (point1.z < point2.z)
+         return true;
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator > (const point2d<T>& point1, const point2d<T>& point2)
+   {
+      if (point1.x > point2.x)
+         return true;
+      else if (point1.x < point2.x)
+         return false;
+      else if (point1.y > point2.y)
+         return true;
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator > (const point3d<T>& point1, const point3d<T>& point2)
+   {
+      if (point1.x > point2.x)
+         return true;
+      else if (point1.x < point2.x)
+         return false;
+      else if (point1.y > point2.y)
+         return true;
+      else if (point1.y < point2.y)
+         return false;
+      else if (point1.z > point2.z)
+         return true;
+      else
+         return false;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator == (const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return is_equal(point1,point2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE bool operator == (const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return is_equal(point1,point2);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> degenerate_point2d()
+   {
+      return make_point
+             (
+               infinity<T>(),
+               infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> degenerate_point3d()
+   {
+      return make_point
+             (
+               infinity<T>(),
+               infinity<T>(),
+               infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> degenerate_vector2d()
+   {
+      return make_vector
+             (
+               infinity<T>(),
+               infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> degenerate_vector3d()
+   {
+      return make_vector
+             (
+               infinity<T>(),
+               infinity<T>(),
+               infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> degenerate_ray2d()
+   {
+      return make_ray
+             (
+               degenerate_point2d <T>(),
+               degenerate_vector2d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> degenerate_ray3d()
+   {
+      return make_ray
+             (
+               degenerate_point3d <T>(),
+               degenerate_vector3d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> degenerate_line2d()
+   {
+      return make_line
+             (
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> degenerate_line3d()
+   {
+      return make_line
+             (
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,2> degenerate_segment2d()
+   {
+      return make_segment
+             (
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE segment<T,3> degenerate_segment3d()
+   {
+      return make_segment
+             (
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,2> degenerate_triangle2d()
+   {
+      return make_triangle
+             (
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE triangle<T,3> degenerate_triangle3d()
+   {
+      return make_triangle
+             (
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> degenerate_quadix2d()
+   {
+      return make_quadix
+             (
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>()
+            );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> degenerate_quadix3d()
+   {
+      return make_quadix
+             (
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>(),
+               degenerate_point3d<T>()
+            );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> degenerate_rectangle()
+   {
+      return make_rectangle
+             (
+               degenerate_point2d<T>(),
+               degenerate_point2d<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> degenerate_circle()
+   {
+      return make_circle
+             (
+               degenerate_point2d<T>(),
+               infinity          <T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> degenerate_sphere()
+   {
+      return make_sphere
+            (
+              degenerate_point3d<T>(),
+              infinity          <T>()
+            );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> positive_infinite_point2d()
+   {
+      return make_point
+             (
+               +infinity<T>(),
+               +infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> negative_infinite_point2d()
+   {
+      return make_point
+             (
+               -infinity<T>(),
+               -infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> positive_infinite_point3d()
+   {
+      return make_point
+             (
+               +infinity<T>(),
+               +infinity<T>(),
+               +infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> negative_infinite_point3d()
+   {
+      return make_point
+             (
+               -infinity<T>(),
+               -infinity<T>(),
+               -infinity<T>()
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void swap(point2d<T>& point1, point2d<T>& point2)
+   {
+      point2d<T> tmp_point = point1;
+      point1 = point2;
+      point2 = tmp_point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE void swap(point3d<T>& point1, point3d<T>& point2)
+   {
+      point3d<T> tmp_point = point1;
+      point1 = point2;
+      point2 = tmp_point;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR point2d<T> make_point(const T& x, const T& y)
+   {
+      point2d<T> point;
+      point.x = x;
+      point.y = y;
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR point3d<T> make_point(const T& x, const T& y, const T& z)
+   {
+      point3d<T> point;
+      point.x = x;
+      point.y = y;
+      point.z = z;
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR point2d<T> make_point(const point3d<T> point)
+   {
+      return make_point(point.x,point.y);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR point3d<T> make_point(const point2d<T> point, const T& z)
+   {
+      return make_point(point.x,point.y,z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point2d<T> make_point(const circle<T>& circle)
+   {
+      return make_point(circle.x,circle.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE point3d<T> make_point(const sphere<T>& sphere)
+   {
+      return make_point(sphere.x,sphere.y,sphere.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> make_vector(const T& x, const T& y)
+   {
+      vector2d<T> v;
+      v.x = x;
+      v.y = y;
+      return v;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> make_vector(const T& x, const T& y, const T& z)
+   {
+      vector3d<T> v;
+      v.x = x;
+      v.y = y;
+      v.z = z;
+      return v;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> make_vector(const vector3d<T> v)
+   {
+      return make_vector(v.x,v.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> make_vector(const vector2d<T> v, const T& z)
+   {
+      return make_vector(v.x,v.y,z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector2d<T> make_vector(const point2d<T> point)
+   {
+      return make_vector(point.x,point.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE vector3d<T> make_vector(const point3d<T> point)
+   {
+      return make_vector(point.x,point.y,point.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE curve_point<T,2> make_curve_point(const T& x, const T& y, const T& t)
+   {
+      curve_point<T,2> point;
+      point().x = x;
+      point().y = y;
+      point.t = t;
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> make_ray(const T& ox, const T& oy, const T& dir_x, const T& dir_y)
+   {
+      ray<T,2> _ray;
+      _ray.origin.x    = ox;
+      _ray.origin.y    = oy;
+      _ray.direction.x = dir_x;
+      _ray.direction.y = dir_y;
+      _ray.direction   = normalize(_ray.direction);
+      return _ray;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> make_ray(const T& ox, const T& oy, const T& oz, const T& dir_x, const T& dir_y, const T& dir_z)
+   {
+      ray<T,3> _ray;
+      _ray.origin.x    = ox;
+      _ray.origin.y    = oy;
+      _ray.origin.z    = oz;
+      _ray.direction.x = dir_x;
+      _ray.direction.y = dir_y;
+      _ray.direction.z = dir_z;
+      _ray.direction   = normalize(_ray.direction);
+      return _ray;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,2> make_ray(const point2d<T>& origin, const vector2d<T>& direction)
+   {
+      return make_ray(origin.x,origin.y,direction.x,direction.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE ray<T,3> make_ray(const point3d<T>& origin, const vector3d<T>& direction)
+   {
+      return make_ray(origin.x,origin.y,origin.z,direction.x,direction.y,direction.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE curve_point<T,3> make_curve_point(const T& x, const T& y, const T& z, const T& t)
+   {
+      curve_point<T,3> point;
+      point().x = x;
+      point().y = y;
+      point().z = z;
+      point.t = t;
+      return point;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE curve_point<T,2> make_curve_point(const point2d<T>& point, const T& t)
+   {
+      return make_curve_point(point.x,point.y,t);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE curve_point<T,3> make_curve_point(const point3d<T>& point, const T& t)
+   {
+      return make_curve_point(point.x,point.y,point.z,t);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,2> make_segment(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      segment<T,2> segment;
+      segment[0] = make_point(x1,y1);
+      segment[1] = make_point(x2,y2);
+      return segment;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,3> make_segment(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      segment<T,3> segment;
+      segment[0] = make_point(x1,y1,z1);
+      segment[1] = make_point(x2,y2,z2);
+      return segment;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,2> make_segment(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return make_segment(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,3> make_segment(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return make_segment(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,2> make_segment(const line<T,2>& line)
+   {
+      return make_segment(line[0],line[1]);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR segment<T,3> make_segment(const line<T,3>& line)
+   {
+      return make_segment(line[0],line[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> make_line(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      line<T,2> line;
+      line[0] = make_point(x1,y1);
+      line[1] = make_point(x2,y2);
+      return line;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> make_line(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      line<T,3> line;
+      line[0] = make_point(x1,y1,z1);
+      line[1] = make_point(x2,y2,z2);
+      return line;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> make_line(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return make_line(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> make_line(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return make_line(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,2> make_line(const segment<T,2>& segment)
+   {
+      return make_line(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE line<T,3> make_line(const segment<T,3>& segment)
+   {
+      return make_line(segment[0],segment[1]);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> make_rectangle(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      rectangle<T> rectangle_;
+
+      rectangle_[0] = make_point(x1, y1);
+      rectangle_[1] = make_point(x2, y2);
+
+      if (rectangle_[1].x < rectangle_[0].x) std::swap(rectangle_[0].x,rectangle_[1].x);
+      if (rectangle_[1].y < rectangle_[0].y) std::swap(rectangle_[0].y,rectangle_[1].y);
+
+      return rectangle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE rectangle<T> make_rectangle(const point2d<T>& point1, const point2d<T>& point2)
+   {
+      return make_rectangle(point1.x,point1.y,point2.x,point2.y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> make_box(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+   {
+      box<T,3> box_;
+
+      box_[0] = make_point(x1, y1, z1);
+      box_[1] = make_point(x2, y2, z2);
+
+      if (box_[1].x < box_[0].x) std::swap(box_[0].x,box_[1].x);
+      if (box_[1].y < box_[0].y) std::swap(box_[0].y,box_[1].y);
+      if (box_[1].z < box_[0].z) std::swap(box_[0].z,box_[1].z);
+
+      return box_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE box<T,3> make_box(const point3d<T>& point1, const point3d<T>& point2)
+   {
+      return make_box(point1.x,point1.y,point1.z,point2.x,point2.y,point2.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE obb<T,2> make_obb(const point2d<T>& center, const vector2d<T>& axis, const T& half_length1, const T& half_length2)
+   {
+      obb<T,2> obb_;
+
+      obb_.center         = center;
+      obb_.axis[0]        = normalize(axis);
+      obb_.axis[1]        = make_vector(-obb_.axis[0].y, obb_.axis[0].x);
+      obb_.half_length[0] = abs(half_length1);
+      obb_.half_length[1] = abs(half_length2);
+
+      return obb_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE obb<T,3> make_obb(const point3d<T>& center,
+                            const vector3d<T>& axis1, const vector3d<T>& axis2, const vector3d<T>& axis3,
+                            const T& half_length1, const T& half_length2, const T& half_length3)
+   {
+      obb<T,3> obb_;
+
+      obb_.center         = center;
+      obb_.axis[0]        = normalize(axis1);
+      obb_.axis[1]        = normalize(axis2);
+      obb_.axis[2]        = normalize(axis3);
+      obb_.half_length[0] = abs(half_length1);
+      obb_.half_length[1] = abs(half_length2);
+      obb_.half_length[2] = abs(half_length3);
+
+      return obb_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE obb<T,2> make_obb(const rectangle<T>& rectangle)
+   {
+      return make_obb(make_point(T(0.5) * (rectangle[0].x + rectangle[1].x), T(0.5) * (rectangle[0].y + rectangle[1].y)),
+                      make_vector(T(1.0),T(0.0)),
+                      T(0.5) * (rectangle[1].x - rectangle[0].x),
+                      T(0.5) * (rectangle[1].y - rectangle[0].y));
+   }
+
+   template <typename T>
+   WYKOBI_INLINE obb<T,3> make_obb(const box<T,3>& box)
+   {
+      return make_obb(make_point(T(0.5) * (box[0].x + box[1].x), T(0.5) * (box[0].y + box[1].y), T(0.5) * (box[0].z + box[1].z)),
+                      make_vector(T(1.0),T(0.0),T(0.0)),
+                      make_vector(T(0.0),T(1.0),T(0.0)),
+                      make_vector(T(0.0),T(0.0),T(1.0)),
+                      T(0.5) * (box[1].x - box[0].x),
+                      T(0.5) * (box[1].y - box[0].y),
+                      T(0.5) * (box[1].z - box[0].z));
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR triangle<T,2> make_triangle(const T& x1, const T& y1,
+                                                const T& x2, const T& y2,
+                                                const T& x3, const T& y3)
+   {
+      triangle<T,2> triangle_;
+      triangle_[0] = make_point(x1,y1);
+      triangle_[1] = make_point(x2,y2);
+      triangle_[2] = make_point(x3,y3);
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR triangle<T,3> make_triangle(const T& x1, const T& y1, const T& z1,
+                                                const T& x2, const T& y2, const T& z2,
+                                                const T& x3, const T& y3, const T& z3)
+   {
+      triangle<T,3> triangle_;
+      triangle_[0] = make_point(x1,y1,z1);
+      triangle_[1] = make_point(x2,y2,z2);
+      triangle_[2] = make_point(x3,y3,z3);
+      return triangle_;
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR triangle<T,2> make_triangle(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3)
+   {
+      return make_triangle(point1.x,point1.y,
+                           point2.x,point2.y,
+                           point3.x,point3.y);
+   }
+
+   template <typename T>
+   WYKOBI_CONSTEXPR triangle<T,3> make_triangle(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3)
+   {
+      return make_triangle(point1.x,point1.y,point1.z,
+                           point2.x,point2.y,point2.z,
+                           point3.x,point3.y,point3.z);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> make_quadix(const T& x1, const T& y1,
+                                  const T& x2, const T& y2,
+                                  const T& x3, const T& y3,
+                                  const T& x4, const T& y4)
+   {
+      quadix<T,2> quadix_;
+
+      quadix_[0] = make_point(x1,y1);
+      quadix_[1] = make_point(x2,y2);
+      quadix_[2] = make_point(x3,y3);
+      quadix_[3] = make_point(x4,y4);
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> make_quadix(const T& x1, const T& y1, const T& z1,
+                                  const T& x2, const T& y2, const T& z2,
+                                  const T& x3, const T& y3, const T& z3,
+                                  const T& x4, const T& y4, const T& z4)
+   {
+      quadix<T,3> quadix_;
+
+      quadix_[0] = make_point(x1,y1,z1);
+      quadix_[1] = make_point(x2,y2,z2);
+      quadix_[2] = make_point(x3,y3,z3);
+      quadix_[3] = make_point(x4,y4,z4);
+
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> make_quadix(const point2d<T>& point1, const point2d<T>& point2, const point2d<T>& point3, const point2d<T>& point4)
+   {
+      return make_quadix
+             (
+               point1.x,point1.y,
+               point2.x,point2.y,
+               point3.x,point3.y,
+               point4.x,point4.y
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,3> make_quadix(const point3d<T>& point1, const point3d<T>& point2, const point3d<T>& point3, const point3d<T>& point4)
+   {
+      return make_quadix
+             (
+               point1.x,point1.y,point1.z,
+               point2.x,point2.y,point2.z,
+               point3.x,point3.y,point3.z,
+               point4.x,point4.y,point4.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> make_quadix(const T& x1, const T& y1, const T& x2, const T& y2)
+   {
+      quadix<T,2> quadix_;
+      quadix_[0] = make_point(x1,y1);
+      quadix_[1] = make_point(x2,y1);
+      quadix_[2] = make_point(x2,y2);
+      quadix_[3] = make_point(x1,y2);
+      return quadix_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE quadix<T,2> make_quadix(const rectangle<T>& rectangle)
+   {
+      return make_quadix(rectangle[0].x, rectangle[0].y, rectangle[1].x, rectangle[1].y);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> make_circle(const T& x, const T& y, const T& radius)
+   {
+      circle<T> circle_;
+      circle_.x      = x;
+      circle_.y      = y;
+      circle_.radius = radius;
+      return circle_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE circle<T> make_circle(const point2d<T>& point, const T& radius)
+   {
+      return make_circle(point.x,point.y,radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> make_sphere(const T& x, const T& y, const T& z, const T& radius)
+   {
+      sphere<T> sphere_;
+
+      sphere_.x      = x;
+      sphere_.y      = y;
+      sphere_.z      = z;
+      sphere_.radius = radius;
+
+      return sphere_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE sphere<T> make_sphere(const point3d<T>& point, const T& radius)
+   {
+      return make_sphere(point.x, point.y, point.z, radius);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE plane<T,3> make_plane(const T& x1, const T& y1, const T& z1,
+                                const T& x2, const T& y2, const T& z2,
+                                const T& x3, const T& y3, const T& z3)
+   {
+      plane<T,3> plane_;
+
+      vector3d<T> v1 = make_vector(x2 - x1, y2 - y1, z2 - z1);
+      vector3d<T> v2 = make_vector(x3 - x1, y3 - y1, z3 - z1);
+
+      plane_.normal   = normalize(v1 * v2);
+      plane_.constant = -dot_product(plane_.normal,make_vector(x1,y1,z1));
+
+      return plane_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE plane<T,3> make_plane(const T& px, const T& py, const T& pz,
+                                const T& nx, const T& ny, const T& nz)
+   {
+      plane<T,3> plane_;
+
+      plane_.normal   = normalize(make_vector(nx, ny, nz));
+      plane_.constant = -dot_product(plane_.normal,make_vector(px, py, pz));
+
+      return plane_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE plane<T,3> make_plane(const point3d<T>& point1,
+                                const point3d<T>& point2,
+                                const point3d<T>& point3)
+   {
+      return make_plane
+             (
+               point1.x, point1.y, point1.z,
+               point2.x, point2.y, point2.z,
+               point3.x, point3.y, point3.z
+             );
+   }
+
+   template <typename T>
+   WYKOBI_INLINE plane<T,3> make_plane(const point3d<T>& point,
+                                const vector3d<T>& normal)
+   {
+      plane<T,3> plane_;
+
+      plane_.normal   = normalize(normal);
+      plane_.constant = -dot_product(plane_.normal,make_vector(point));
+
+      return plane_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE plane<T,3> make_plane(const triangle<T,3>& triangle)
+   {
+      return make_plane(triangle[0], triangle[1], triangle[2]);
+   }
+
+   template <typename T, std::size_t D, typename InputIterator>
+   WYKOBI_INLINE polygon<T,D> make_polygon(const InputIterator begin, const InputIterator end)
+   {
+      wykobi::polygon<T,D> polygon_;
+      polygon_.reserve(std::distance(begin,end));
+
+      InputIterator it = begin;
+
+      while (end != it) { polygon_.push_back((*it++)); }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const std::vector< point2d<T> >& point_list)
+   {
+      return make_polygon<T,2,typename std::vector< point2d<T> >::const_iterator>(point_list.begin(),point_list.end());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,3> make_polygon(const std::vector< point3d<T> >& point_list)
+   {
+      return make_polygon<T,3,typename std::vector< point3d<T> >::const_iterator>(point_list.begin(),point_list.end());
+   }
+
+   template <typename T, std::size_t D, typename Allocator>
+   WYKOBI_INLINE polygon_view<T,D> make_polygon_view(const polygon<T,D,Allocator>& polygon)
+   {
+      return wykobi::polygon_view<T,D>(polygon);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon_view<T,2> make_polygon_view(const point2d<T>* points, const std::size_t& count, const std::size_t& stride)
+   {
+      return wykobi::polygon_view<T,2>(points,count,stride);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon_view<T,3> make_polygon_view(const point3d<T>* points, const std::size_t& count, const std::size_t& stride)
+   {
+      return wykobi::polygon_view<T,3>(points,count,stride);
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon_view<T,2> make_polygon_view(const std::vector< point2d<T> >& point_list)
+   {
+      return (point_list.empty()) ? wykobi::polygon_view<T,2>() : wykobi::polygon_view<T,2>(&point_list[0],point_list.size());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon_view<T,3> make_polygon_view(const std::vector< point3d<T> >& point_list)
+   {
+      return (point_list.empty()) ? wykobi::polygon_view<T,3>() : wykobi::polygon_view<T,3>(&point_list[0],point_list.size());
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const triangle<T,2>& triangle)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(wykobi::triangle<T,2>::PointCount);
+
+      for (std::size_t i = 0; i < wykobi::triangle<T,2>::PointCount; ++i)
+      {
+         polygon_.push_back(triangle[i]);
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const quadix<T,2>& quadix)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(wykobi::quadix<T,2>::PointCount);
+
+      for (std::size_t i = 0; i < wykobi::quadix<T,2>::PointCount; ++i)
+      {
+         polygon_.push_back(quadix[i]);
+      }
+
+      return polygon_;
+   }
+
+   template <typename T>
+   WYKOBI_INLINE polygon<T,2> make_polygon(const rectangle<T>& rectangle)
+   {
+      wykobi::polygon<T,2> polygon_;
+
+      polygon_.reserve(4);
+
+      polygon_.push_back(make_point(rectangle[0].x,rectangle[0].y));
+      polygon_.push_back(make_point(rectangle[1].x,rectangle[0].y));
+      polygon_.push_back(make_point(rectangle[1].x,rectangle[1].y));
+      polygon_.push_back(make_point(rectangle[0].x,rectangle[1].y));
+
+      return polygon_;
+   }
+
+} // wykobi namespace
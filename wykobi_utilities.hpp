@@ -23,205 +23,139 @@
 
 
 #include <iostream>
-#include <iomanip>
 #include <vector>
 
 #include "wykobi.hpp"
 #include "wykobi_matrix.hpp"
+#include "wykobi_format.hpp"
 
 
 namespace wykobi
 {
-   template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const point2d<Type>& point)
+   namespace detail
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << point.x << "," << point.y << ")";
+      /* Formats through to_chars, falling back to a heap buffer for long polygons. */
+      template <typename Primitive>
+      inline std::ostream& write_formatted(std::ostream& os, const Primitive& primitive)
+      {
+         char buffer[512];
+         char* end = to_chars(buffer,buffer + sizeof(buffer),primitive);
 
-      return os;
-   }
+         if (0 != end)
+            return os.write(buffer,end - buffer);
+
+         std::vector<char> heap(4 * sizeof(buffer));
+
+         while (0 == (end = to_chars(&heap[0],&heap[0] + heap.size(),primitive)))
+         {
+            heap.resize(2 * heap.size());
+         }
+
+         return os.write(&heap[0],end - &heap[0]);
+      }
+
+   } // namespace wykobi::detail
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const point3d<Type>& point)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const point2d<Type>& point)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << point.x << "," << point.y << "," << point.z << ")";
-
-      return os;
+      return detail::write_formatted(os,point);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const vector2d<Type>& v)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const point3d<Type>& point)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << v.x << "," << v.y << ")";
-
-      return os;
+      return detail::write_formatted(os,point);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const vector3d<Type>& v)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const vector2d<Type>& v)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << v.x << "," << v.y << "," << v.z << ")";
-
-      return os;
+      return detail::write_formatted(os,v);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const ray<Type,2>& ray)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const vector3d<Type>& v)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << ray.origin.x << "," << ray.origin.y << "," << ray.direction.x << "," << ray.direction.y << ")";
-
-      return os;
+      return detail::write_formatted(os,v);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const ray<Type,3>& ray)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const ray<Type,2>& ray)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << ray.origin.x    << "," << ray.origin.y    << "," << ray.origin.z    << ","
-                << ray.direction.x << "," << ray.direction.y << "," << ray.direction.z << ")";
+      return detail::write_formatted(os,ray);
+   }
 
-      return os;
+   template <typename Type>
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const ray<Type,3>& ray)
+   {
+      return detail::write_formatted(os,ray);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const pointnd<Type,Dimension>& point)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const pointnd<Type,Dimension>& point)
    {
-      os << "(";
-
-      for (std::size_t i = 0; i < Dimension - 1; ++i)
-      {
-         os << std::scientific
-            << std::showpoint
-            << std::setprecision(6)
-            << point[i] << ",";
-      }
-
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << point[Dimension - 1] << ")";
-
-      return os;
+      return detail::write_formatted(os,point);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const segment<Type,Dimension>& segment)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const segment<Type,Dimension>& segment)
    {
-      for (unsigned int i = 0; i < wykobi::segment<Type,Dimension>::PointCount; ++i)
-      {
-         os << segment[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,segment);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const line<Type,Dimension>& line)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const line<Type,Dimension>& line)
    {
-      for (unsigned int i = 0; i < wykobi::line<Type,Dimension>::PointCount; ++i)
-      {
-         os << line[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,line);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const triangle<Type,Dimension>& triangle)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const triangle<Type,Dimension>& triangle)
    {
-      for (unsigned int i = 0; i < wykobi::triangle<Type,Dimension>::PointCount; ++i)
-      {
-         os << triangle[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,triangle);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const rectangle<Type>& rectangle)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const rectangle<Type>& rectangle)
    {
-      for (unsigned int i = 0; i < wykobi::rectangle<Type>::PointCount; ++i)
-      {
-         os << rectangle[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,rectangle);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const box<Type,Dimension>& box)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const box<Type,Dimension>& box)
    {
-      for (unsigned int i = 0; i < wykobi::box<Type,Dimension>::PointCount; ++i)
-      {
-         os << box[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,box);
    }
 
    template <typename Type, std::size_t Dimension>
-   inline std::ostream& operator<<(std::ostream& os, const quadix<Type,Dimension>& quadix)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const quadix<Type,Dimension>& quadix)
    {
-      for (unsigned int i = 0; i < wykobi::quadix<Type,Dimension>::PointCount; ++i)
-      {
-         os << quadix[i];
-      }
-
-      return os;
+      return detail::write_formatted(os,quadix);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const circle<Type>& circle)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const circle<Type>& circle)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(10)
-         << "(" << circle.x << "," << circle.y << "," << circle.radius << ")";
-
-      return os;
+      return detail::write_formatted(os,circle);
    }
 
    template <typename Type>
-   inline std::ostream& operator<<(std::ostream& os, const sphere<Type>& sphere)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const sphere<Type>& sphere)
    {
-      os << std::scientific
-         << std::showpoint
-         << std::setprecision(6)
-         << "(" << sphere.x << "," << sphere.y << "," << sphere.z << "," << sphere.radius << ")";
-
-      return os;
+      return detail::write_formatted(os,sphere);
    }
 
    template <typename Type, std::size_t M, std::size_t N>
-   inline std::ostream& operator<<(std::ostream& os, const matrix<Type,M,N>& matrix)
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const matrix<Type,M,N>& matrix)
    {
-      for (std::size_t x = 0; x < M; x++)
-      {
-         for (std::size_t y = 0; y < N; y++)
-         {
-            os << matrix(x,y) << "\t";
-         }
-
-         os << std::endl;
-      }
+      return detail::write_formatted(os,matrix);
+   }
 
-      return os;
+   template <typename Type, std::size_t Dimension>
+   WYKOBI_INLINE std::ostream& operator<<(std::ostream& os, const polygon<Type,Dimension>& polygon)
+   {
+      return detail::write_formatted(os,polygon);
    }
 
 } // namespace wykobi
@@ -0,0 +1,367 @@
+/*
+(***********************************************************************)
+(*                                                                     *)
+(* Wykobi Computational Geometry Library                               *)
+(* Release Version 0.0.5                                               *)
+(* http://www.wykobi.com                                               *)
+(* Copyright (c) 2005-2019 Arash Partow, All Rights Reserved.          *)
+(*                                                                     *)
+(* The Wykobi computational geometry library and its components are    *)
+(* supplied under the terms of the open source MIT License.            *)
+(* The contents of the Wykobi computational geometry library and its   *)
+(* components may not be copied or disclosed except in accordance with *)
+(* the terms of the MIT License.                                       *)
+(*                                                                     *)
+(* URL: https://opensource.org/licenses/MIT                            *)
+(*                                                                     *)
+(***********************************************************************)
+*/
+
+
+#ifndef INCLUDE_WYKOBI_VERTEX_BATCH
+#define INCLUDE_WYKOBI_VERTEX_BATCH
+
+
+#include <cstddef>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include "wykobi.hpp"
+
+
+namespace wykobi
+{
+   enum DrawingMode  {
+                        eNoDraw,
+                        eSolid,
+                        eOutLine
+                     };
+
+   enum BatchType    {
+                        ePointBatch,
+                        eLineBatch,
+                        eTriangleBatch
+                     };
+
+   const std::size_t BatchTypeCount = 3;
+
+   /*
+      Interleaved vertex, position followed by colour. The layout matches
+      glVertexPointer(3,GL_FLOAT,sizeof(batch_vertex),&x) together with
+      glColorPointer(3,GL_FLOAT,sizeof(batch_vertex),&red).
+   */
+   struct batch_vertex
+   {
+      float x;
+      float y;
+      float z;
+      float red;
+      float green;
+      float blue;
+   };
+
+   /*
+      Retained mode accumulator that converts primitives into one vertex
+      array per batch type: points, line segment pairs and triangle
+      triples. All primitives of a type can then be submitted in a single
+      draw call. The batch holds no graphics API state, so the generated
+      vertex arrays can be inspected without a rendering context.
+   */
+   template <typename T>
+   class vertex_batch
+   {
+   public:
+
+         vertex_batch(DrawingMode dm = eOutLine, const std::size_t& circle_point_count = 360)
+         : drawing_mode(dm),
+           red(1.0f),
+           green(1.0f),
+           blue(1.0f)
+         {
+            circle_cos.reserve(circle_point_count);
+            circle_sin.reserve(circle_point_count);
+
+            for (std::size_t i = 0; i < circle_point_count; ++i)
+            {
+               const double angle = (2.0 * PI * i) / circle_point_count;
+               circle_cos.push_back(T(std::cos(angle)));
+               circle_sin.push_back(T(std::sin(angle)));
+            }
+         }
+
+        ~vertex_batch(){}
+
+         inline void set_drawing_mode(DrawingMode dm)
+         {
+            drawing_mode = dm;
+         }
+
+         inline void set_color(const unsigned int& _red, const unsigned int& _green, const unsigned int& _blue)
+         {
+            red   = (1.0f * _red)   / 255.0f;
+            green = (1.0f * _green) / 255.0f;
+            blue  = (1.0f * _blue)  / 255.0f;
+         }
+
+         inline void reserve(const BatchType& type, const std::size_t& vertex_count)
+         {
+            batch[type].reserve(vertex_count);
+         }
+
+         inline void clear()
+         {
+            for (std::size_t i = 0; i < BatchTypeCount; ++i)
+            {
+               batch[i].clear();
+            }
+         }
+
+         inline const std::vector<batch_vertex>& vertices(const BatchType& type) const
+         {
+            return batch[type];
+         }
+
+         inline std::size_t size() const
+         {
+            return batch[ePointBatch].size() + batch[eLineBatch].size() + batch[eTriangleBatch].size();
+         }
+
+         inline void draw_pixel(const T& x, const T& y, const T& z = T(0.0))
+         {
+            add_vertex(ePointBatch,x,y,z);
+         }
+
+         inline void draw_segment(const T& x1, const T& y1, const T& x2, const T& y2)
+         {
+            add_vertex(eLineBatch,x1,y1,T(0.0));
+            add_vertex(eLineBatch,x2,y2,T(0.0));
+         }
+
+         inline void draw_segment(const T& x1, const T& y1, const T& z1, const T& x2, const T& y2, const T& z2)
+         {
+            add_vertex(eLineBatch,x1,y1,z1);
+            add_vertex(eLineBatch,x2,y2,z2);
+         }
+
+         inline void draw_triangle(const T& x1, const T& y1, const T& z1,
+                                   const T& x2, const T& y2, const T& z2,
+                                   const T& x3, const T& y3, const T& z3)
+         {
+            switch (drawing_mode)
+            {
+               case eSolid   : add_vertex(eTriangleBatch,x1,y1,z1);
+                               add_vertex(eTriangleBatch,x2,y2,z2);
+                               add_vertex(eTriangleBatch,x3,y3,z3);
+                               break;
+
+               case eOutLine : draw_segment(x1,y1,z1,x2,y2,z2);
+                               draw_segment(x2,y2,z2,x3,y3,z3);
+                               draw_segment(x3,y3,z3,x1,y1,z1);
+                               break;
+
+               case eNoDraw  : break;
+            }
+         }
+
+         inline void draw_quadix(const T& x1, const T& y1, const T& z1,
+                                 const T& x2, const T& y2, const T& z2,
+                                 const T& x3, const T& y3, const T& z3,
+                                 const T& x4, const T& y4, const T& z4)
+         {
+            switch (drawing_mode)
+            {
+               case eSolid   : draw_triangle(x1,y1,z1,x2,y2,z2,x3,y3,z3);
+                               draw_triangle(x1,y1,z1,x3,y3,z3,x4,y4,z4);
+                               break;
+
+               case eOutLine : draw_segment(x1,y1,z1,x2,y2,z2);
+                               draw_segment(x2,y2,z2,x3,y3,z3);
+                               draw_segment(x3,y3,z3,x4,y4,z4);
+                               draw_segment(x4,y4,z4,x1,y1,z1);
+                               break;
+
+               case eNoDraw  : break;
+            }
+         }
+
+         inline void draw_circle(const T& x, const T& y, const T& radius)
+         {
+            if ((drawing_mode == eNoDraw) || circle_cos.empty())
+               return;
+
+            std::size_t j = circle_cos.size() - 1;
+
+            for (std::size_t i = 0; i < circle_cos.size(); ++i)
+            {
+               const T x1 = x + radius * circle_cos[j];
+               const T y1 = y + radius * circle_sin[j];
+               const T x2 = x + radius * circle_cos[i];
+               const T y2 = y + radius * circle_sin[i];
+
+               if (drawing_mode == eSolid)
+               {
+                  add_vertex(eTriangleBatch,x ,y ,T(0.0));
+                  add_vertex(eTriangleBatch,x1,y1,T(0.0));
+                  add_vertex(eTriangleBatch,x2,y2,T(0.0));
+               }
+               else
+                  draw_segment(x1,y1,x2,y2);
+
+               j = i;
+            }
+         }
+
+         template <typename InputIterator>
+         inline void draw_polyline(InputIterator begin, InputIterator end)
+         {
+            if (begin == end)
+               return;
+
+            for (InputIterator it = begin, previous = it++; it != end; previous = it++)
+            {
+               draw(make_segment(*previous,*it));
+            }
+         }
+
+         inline void draw_polyline(const std::vector< point2d<T> >& point_list)
+         {
+            draw_polyline(point_list.begin(),point_list.end());
+         }
+
+         inline void draw_polyline(const std::vector< point3d<T> >& point_list)
+         {
+            draw_polyline(point_list.begin(),point_list.end());
+         }
+
+         inline void draw(const point2d<T>&       point) { draw_pixel(point.x,point.y);                                         }
+         inline void draw(const segment<T,2>&   segment) { draw_segment(segment[0].x,segment[0].y,segment[1].x,segment[1].y);   }
+         inline void draw(const rectangle<T>& rectangle) { draw(make_quadix(rectangle));                                        }
+         inline void draw(const circle<T>&       circle) { draw_circle(circle.x,circle.y,circle.radius);                        }
+
+         inline void draw(const point3d<T>&       point) { draw_pixel(point.x,point.y,point.z);                                 }
+
+         inline void draw(const segment<T,3>& segment)
+         {
+            draw_segment(segment[0].x,segment[0].y,segment[0].z,
+                         segment[1].x,segment[1].y,segment[1].z);
+         }
+
+         inline void draw(const triangle<T,2>& triangle)
+         {
+            draw_triangle(triangle[0].x,triangle[0].y,T(0.0),
+                          triangle[1].x,triangle[1].y,T(0.0),
+                          triangle[2].x,triangle[2].y,T(0.0));
+         }
+
+         inline void draw(const triangle<T,3>& triangle)
+         {
+            draw_triangle(triangle[0].x,triangle[0].y,triangle[0].z,
+                          triangle[1].x,triangle[1].y,triangle[1].z,
+                          triangle[2].x,triangle[2].y,triangle[2].z);
+         }
+
+         inline void draw(const quadix<T,2>& quadix)
+         {
+            draw_quadix(quadix[0].x,quadix[0].y,T(0.0),
+                        quadix[1].x,quadix[1].y,T(0.0),
+                        quadix[2].x,quadix[2].y,T(0.0),
+                        quadix[3].x,quadix[3].y,T(0.0));
+         }
+
+         inline void draw(const quadix<T,3>& quadix)
+         {
+            draw_quadix(quadix[0].x,quadix[0].y,quadix[0].z,
+                        quadix[1].x,quadix[1].y,quadix[1].z,
+                        quadix[2].x,quadix[2].y,quadix[2].z,
+                        quadix[3].x,quadix[3].y,quadix[3].z);
+         }
+
+         /*
+            Solid fill is only available for convex polygons (triangle fan),
+            non-convex polygons are always drawn in outline.
+         */
+         inline void draw(const polygon<T,2>& polygon, const bool convex = false)
+         {
+            if ((polygon.size() < 3) || (drawing_mode == eNoDraw))
+               return;
+
+            if (convex && (drawing_mode == eSolid))
+            {
+               for (std::size_t i = 2; i < polygon.size(); ++i)
+               {
+                  draw(make_triangle(polygon[0],polygon[i - 1],polygon[i]));
+               }
+            }
+            else
+               draw_polygon_outline(polygon);
+         }
+
+         inline void draw(const polygon<T,3>& polygon)
+         {
+            if ((polygon.size() < 3) || (drawing_mode == eNoDraw))
+               return;
+
+            draw_polygon_outline(polygon);
+         }
+
+         inline void draw(const quadratic_bezier<T,2>& bezier, const std::size_t& point_count)
+         {
+            std::vector< point2d<T> > point_list;
+            generate_bezier(bezier,std::back_inserter(point_list),point_count);
+            draw_polyline(point_list);
+         }
+
+         inline void draw(const quadratic_bezier<T,3>& bezier, const std::size_t& point_count)
+         {
+            std::vector< point3d<T> > point_list;
+            generate_bezier(bezier,std::back_inserter(point_list),point_count);
+            draw_polyline(point_list);
+         }
+
+         inline void draw(const cubic_bezier<T,2>& bezier, const std::size_t& point_count)
+         {
+            std::vector< point2d<T> > point_list;
+            generate_bezier(bezier,std::back_inserter(point_list),point_count);
+            draw_polyline(point_list);
+         }
+
+         inline void draw(const cubic_bezier<T,3>& bezier, const std::size_t& point_count)
+         {
+            std::vector< point3d<T> > point_list;
+            generate_bezier(bezier,std::back_inserter(point_list),point_count);
+            draw_polyline(point_list);
+         }
+
+      private:
+
+         inline void add_vertex(const BatchType& type, const T& x, const T& y, const T& z)
+         {
+            const batch_vertex vertex = { float(x), float(y), float(z), red, green, blue };
+            batch[type].push_back(vertex);
+         }
+
+         template <typename Polygon>
+         inline void draw_polygon_outline(const Polygon& polygon)
+         {
+            std::size_t j = polygon.size() - 1;
+
+            for (std::size_t i = 0; i < polygon.size(); ++i)
+            {
+               draw(make_segment(polygon[j],polygon[i]));
+               j = i;
+            }
+         }
+
+         std::vector<batch_vertex> batch[BatchTypeCount];
+         std::vector<T>            circle_cos;
+         std::vector<T>            circle_sin;
+         DrawingMode               drawing_mode;
+         float                     red;
+         float                     green;
+         float                     blue;
+   };
+
+}// namespace wykobi
+
+#endif